@@ -24,9 +24,13 @@
 #include "unit.hpp"
 
 #include <algorithm>
+#include <cmath>
 #include <hip/hip_runtime_api.h>
 #include <hipsparse.h>
 #include <limits>
+#include <sstream>
+#include <stdio.h>
+#include <string.h>
 
 #ifdef GOOGLE_TEST
 #include <gtest/gtest.h>
@@ -40,216 +44,530 @@
 #endif
 #endif
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 /* ========================================Gtest Unit Check
  * ==================================================== */
 
-/*! \brief Template: gtest unit compare two matrices float/double/complex */
-// Do not put a wrapper over ASSERT_FLOAT_EQ, sincer assert exit the current function NOT the test
-// case
-// a wrapper will cause the loop keep going
+/*! \brief Comparison engine of unit_check_general and unit_check_near.
+ *
+ *  Both arrays are compared in a single vectorized and parallel pass, that counts the entries
+ *  out of tolerance and tracks the maximum absolute, relative and ULP errors. Only if entries
+ *  are out of tolerance, a second pass locates the first and the worst of them. The result is
+ *  reported through a single gtest failure, instead of asserting element by element.
+ */
 
-template <>
-void unit_check_general(int64_t M, int64_t N, int64_t lda, float* hCPU, float* hGPU)
-{
-    for(int64_t j = 0; j < N; j++)
-    {
-        for(int64_t i = 0; i < M; i++)
-        {
+// Maximum distance in units of the last place of unit_check_general, as ASSERT_FLOAT_EQ and
+// ASSERT_DOUBLE_EQ do
 #ifdef GOOGLE_TEST
-            ASSERT_FLOAT_EQ(hCPU[i + j * lda], hGPU[i + j * lda]);
+#define UNIT_CHECK_MAX_ULP 4
 #else
-            assert(hCPU[i + j * lda] == hGPU[i + j * lda]);
+#define UNIT_CHECK_MAX_ULP 0
 #endif
-        }
-    }
-}
+
+struct unit_check_result
+{
+    int64_t  count   = 0;
+    double   max_abs = 0.0;
+    double   max_rel = 0.0;
+    uint64_t max_ulp = 0;
+};
+
+template <typename R>
+struct unit_check_bits;
 
 template <>
-void unit_check_general(int64_t M, int64_t N, int64_t lda, double* hCPU, double* hGPU)
+struct unit_check_bits<float>
+{
+    typedef uint32_t type;
+    typedef int32_t  signed_type;
+};
+
+template <>
+struct unit_check_bits<double>
+{
+    typedef uint64_t type;
+    typedef int64_t  signed_type;
+};
+
+// Maps the sign and magnitude representation onto unsigned integers of the same order, such
+// that their difference is the distance in units of the last place. Branch free, such that
+// loops over it vectorize.
+template <typename R>
+static inline typename unit_check_bits<R>::type unit_check_biased(R x)
+{
+    typedef typename unit_check_bits<R>::type        U;
+    typedef typename unit_check_bits<R>::signed_type S;
+
+    const U sign = U(1) << (8 * sizeof(U) - 1);
+
+    U u;
+    memcpy(&u, &x, sizeof(U));
+
+    // All bits set for negative values
+    U negative = static_cast<U>(static_cast<S>(u) >> (8 * sizeof(U) - 1));
+
+    return (negative & (U(0) - u)) | (~negative & (u | sign));
+}
+
+template <typename R>
+static inline uint64_t unit_check_ulp(R a, R b)
 {
-    for(int64_t j = 0; j < N; j++)
+    auto ua = unit_check_biased(a);
+    auto ub = unit_check_biased(b);
+
+    uint64_t dist = std::max(ua, ub) - std::min(ua, ub);
+
+    return (a != a || b != b) ? std::numeric_limits<uint64_t>::max() : dist;
+}
+
+// Tolerance of entry a, zero if compared by ULP distance
+template <typename R>
+static inline double unit_check_tolerance(R a, R rel, double scale)
+{
+    if(rel == 0)
     {
-        for(int64_t i = 0; i < M; i++)
-        {
-#ifdef GOOGLE_TEST
-            ASSERT_DOUBLE_EQ(hCPU[i + j * lda], hGPU[i + j * lda]);
-#else
-            assert(hCPU[i + j * lda] == hGPU[i + j * lda]);
-#endif
-        }
+        return 0.0;
     }
+
+    return std::max(std::abs(a * rel), 10 * std::numeric_limits<R>::epsilon()) * scale;
 }
 
-template <>
-void unit_check_general(int64_t M, int64_t N, int64_t lda, hipComplex* hCPU, hipComplex* hGPU)
+// Entry b is within the tolerance of a. NaN is never within any tolerance.
+template <typename R>
+static inline bool unit_check_pass(R a, R b, R rel, double scale)
 {
-    for(int64_t j = 0; j < N; j++)
+    if(rel == 0)
     {
-        for(int64_t i = 0; i < M; i++)
-        {
-#ifdef GOOGLE_TEST
-            ASSERT_FLOAT_EQ(hCPU[i + j * lda].x, hGPU[i + j * lda].x);
-            ASSERT_FLOAT_EQ(hCPU[i + j * lda].y, hGPU[i + j * lda].y);
-#else
-            assert(hCPU[i + j * lda].x == hGPU[i + j * lda].x);
-            assert(hCPU[i + j * lda].y == hGPU[i + j * lda].y);
-#endif
-        }
+        return unit_check_ulp(a, b) <= UNIT_CHECK_MAX_ULP;
     }
+
+    return std::abs(static_cast<double>(a) - static_cast<double>(b))
+           <= unit_check_tolerance(a, rel, scale);
 }
 
-template <>
-void unit_check_general(
-    int64_t M, int64_t N, int64_t lda, hipDoubleComplex* hCPU, hipDoubleComplex* hGPU)
+// Single pass over n contiguous entries, vectorized and parallel for large n
+template <typename R>
+static void
+    unit_check_range(int64_t n, const R* a, const R* b, R rel, double scale, unit_check_result& res)
 {
-    for(int64_t j = 0; j < N; j++)
-    {
-        for(int64_t i = 0; i < M; i++)
-        {
-#ifdef GOOGLE_TEST
-            ASSERT_DOUBLE_EQ(hCPU[i + j * lda].x, hGPU[i + j * lda].x);
-            ASSERT_DOUBLE_EQ(hCPU[i + j * lda].y, hGPU[i + j * lda].y);
-#else
-            assert(hCPU[i + j * lda].x == hGPU[i + j * lda].x);
-            assert(hCPU[i + j * lda].y == hGPU[i + j * lda].y);
+    int64_t  count   = 0;
+    double   max_abs = 0.0;
+    double   max_rel = 0.0;
+    uint64_t max_ulp = 0;
+
+    bool   by_ulp = (rel == 0);
+    double floor  = 10 * std::numeric_limits<R>::epsilon();
+
+#ifdef _OPENMP
+#pragma omp parallel for simd if(n >= 65536) reduction(+ : count) \
+    reduction(max : max_abs, max_rel, max_ulp)
 #endif
-        }
+    for(int64_t k = 0; k < n; ++k)
+    {
+        double   err = std::abs(static_cast<double>(a[k]) - static_cast<double>(b[k]));
+        double   mag = std::abs(static_cast<double>(a[k]));
+        double   tol = std::max(static_cast<double>(std::abs(a[k] * rel)), floor) * scale;
+        uint64_t ulp = unit_check_ulp(a[k], b[k]);
+
+        count += by_ulp ? (ulp > UNIT_CHECK_MAX_ULP) : !(err <= tol);
+        max_abs = std::max(max_abs, err);
+        max_rel = std::max(max_rel, err / std::max(mag, std::numeric_limits<double>::min()));
+        max_ulp = std::max(max_ulp, ulp);
     }
+
+    res.count += count;
+    res.max_abs = std::max(res.max_abs, max_abs);
+    res.max_rel = std::max(res.max_rel, max_rel);
+    res.max_ulp = std::max(res.max_ulp, max_ulp);
 }
 
-template <>
-void unit_check_general(int64_t M, int64_t N, int64_t lda, int* hCPU, int* hGPU)
+// Compare M x N matrices of entries consisting of parts reals each, rel is zero for the ULP
+// based comparison
+template <typename R>
+static void unit_check_real(int64_t  M,
+                            int64_t  N,
+                            int64_t  lda,
+                            int      parts,
+                            const R* hCPU,
+                            const R* hGPU,
+                            R        rel,
+                            double   scale)
 {
-    for(int64_t j = 0; j < N; j++)
+    // Contiguous columns are compared as a single one
+    bool    merged = (lda == M || N == 1);
+    int64_t rows   = merged ? parts * M * N : parts * M;
+    int64_t cols   = merged ? 1 : N;
+    int64_t ld     = parts * lda;
+
+    unit_check_result res;
+
+    for(int64_t j = 0; j < cols; ++j)
     {
-        for(int64_t i = 0; i < M; i++)
+        unit_check_range(rows, hCPU + j * ld, hGPU + j * ld, rel, scale, res);
+    }
+
+    if(res.count == 0)
+    {
+        return;
+    }
+
+    // Locate the first entry out of tolerance and the worst one relative to its tolerance
+    int64_t first_k = -1;
+    int64_t first_j = -1;
+    int64_t worst_k = -1;
+    int64_t worst_j = -1;
+    double  worst   = -1.0;
+
+    for(int64_t j = 0; j < cols; ++j)
+    {
+        const R* a = hCPU + j * ld;
+        const R* b = hGPU + j * ld;
+
+        for(int64_t k = 0; k < rows; ++k)
         {
-#ifdef GOOGLE_TEST
-            ASSERT_EQ(hCPU[i + j * lda], hGPU[i + j * lda]);
-#else
-            assert(hCPU[i + j * lda] == hGPU[i + j * lda]);
-#endif
+            if(unit_check_pass(a[k], b[k], rel, scale))
+            {
+                continue;
+            }
+
+            double err = (rel == 0)
+                             ? static_cast<double>(unit_check_ulp(a[k], b[k]))
+                             : std::abs(static_cast<double>(a[k]) - static_cast<double>(b[k]))
+                                   / unit_check_tolerance(a[k], rel, scale);
+
+            if(first_k < 0)
+            {
+                first_k = k;
+                first_j = j;
+            }
+
+            if(!(err <= worst))
+            {
+                worst   = err;
+                worst_k = k;
+                worst_j = j;
+            }
         }
     }
-}
 
-template <>
-void unit_check_general(int64_t M, int64_t N, int64_t lda, int64_t* hCPU, int64_t* hGPU)
-{
-    for(int64_t j = 0; j < N; j++)
-    {
-        for(int64_t i = 0; i < M; i++)
+    std::ostringstream msg;
+    msg.precision(std::numeric_limits<R>::max_digits10);
+
+    auto entry = [&](const char* what, int64_t k, int64_t j) {
+        int64_t e = k / parts;
+        int64_t i = merged ? e % std::max<int64_t>(M, 1) : e;
+
+        j = merged ? e / std::max<int64_t>(M, 1) : j;
+
+        R a = hCPU[j * ld + parts * i + k % parts];
+        R b = hGPU[j * ld + parts * i + k % parts];
+
+        msg << "\n  " << what << " (" << i << ", " << j << ")";
+        if(parts == 2)
+        {
+            msg << ((k % parts == 0) ? " real" : " imag");
+        }
+        msg << ": expected " << a << ", got " << b;
+        if(rel == 0)
         {
+            msg << ", " << unit_check_ulp(a, b) << " ulp";
+        }
+        else
+        {
+            msg << ", error " << std::abs(static_cast<double>(a) - static_cast<double>(b))
+                << " > tolerance " << unit_check_tolerance(a, rel, scale);
+        }
+    };
+
+    msg << res.count << " of " << parts * M * N << " values of a " << M << " x " << N
+        << " matrix out of tolerance";
+    entry("first", first_k, first_j);
+    entry("worst", worst_k, worst_j);
+    msg << "\n  max abs error " << res.max_abs << ", max rel error " << res.max_rel
+        << ", max ulp distance " << res.max_ulp;
+
 #ifdef GOOGLE_TEST
-            ASSERT_EQ(hCPU[i + j * lda], hGPU[i + j * lda]);
+    FAIL() << msg.str();
 #else
-            assert(hCPU[i + j * lda] == hGPU[i + j * lda]);
+    fprintf(stderr, "%s\n", msg.str().c_str());
+    assert(res.count == 0);
 #endif
-        }
-    }
 }
 
-template <>
-void unit_check_general(int64_t M, int64_t N, int64_t lda, size_t* hCPU, size_t* hGPU)
+// Compare M x N matrices of entries consisting of parts reals each in the max norm, the largest
+// error has to be within tol times the largest entry of hCPU
+template <typename R>
+static void unit_check_norm_real(
+    int64_t M, int64_t N, int64_t lda, int parts, const R* hCPU, const R* hGPU, double tol)
 {
-    for(int64_t j = 0; j < N; j++)
+    double  max_err = 0.0;
+    double  max_ref = 0.0;
+    int64_t worst_i = -1;
+    int64_t worst_j = -1;
+
+    for(int64_t j = 0; j < N; ++j)
     {
-        for(int64_t i = 0; i < M; i++)
+        for(int64_t i = 0; i < M; ++i)
         {
-#ifdef GOOGLE_TEST
-            ASSERT_EQ(hCPU[i + j * lda], hGPU[i + j * lda]);
-#else
-            assert(hCPU[i + j * lda] == hGPU[i + j * lda]);
-#endif
+            const R* a = hCPU + parts * (j * lda + i);
+            const R* b = hGPU + parts * (j * lda + i);
+
+            double err = 0.0;
+            double ref = 0.0;
+
+            for(int p = 0; p < parts; ++p)
+            {
+                double e = static_cast<double>(a[p]) - static_cast<double>(b[p]);
+
+                err += e * e;
+                ref += static_cast<double>(a[p]) * static_cast<double>(a[p]);
+            }
+
+            // The first NaN is the worst entry
+            if(!(err <= max_err) && !std::isnan(max_err))
+            {
+                max_err = err;
+                worst_i = i;
+                worst_j = j;
+            }
+
+            max_ref = std::max(max_ref, ref);
         }
     }
-}
 
-/*! \brief Template: gtest unit compare two matrices float/double/complex */
-// Do not put a wrapper over ASSERT_FLOAT_EQ, since assert exit the current function NOT the test
-// case
-// a wrapper will cause the loop keep going
+    max_err = std::sqrt(max_err);
+    max_ref = std::sqrt(max_ref);
 
-template <>
-void unit_check_near(int64_t M, int64_t N, int64_t lda, float* hCPU, float* hGPU)
-{
-    for(int64_t j = 0; j < N; j++)
+    if(max_err <= tol * max_ref)
     {
-        for(int64_t i = 0; i < M; i++)
+        return;
+    }
+
+    std::ostringstream msg;
+    msg.precision(std::numeric_limits<R>::max_digits10);
+
+    auto value = [&](const R* v) {
+        if(parts == 2)
         {
-            float compare_val = std::max(std::abs(hCPU[i + j * lda] * 1e-3f),
-                                         10 * std::numeric_limits<float>::epsilon());
+            msg << "(" << v[0] << ", " << v[1] << ")";
+        }
+        else
+        {
+            msg << v[0];
+        }
+    };
+
+    msg << "max norm of the error of a " << M << " x " << N << " matrix " << max_err
+        << " > tolerance " << tol << " * max norm " << max_ref << "\n  worst (" << worst_i
+        << ", " << worst_j << "): expected ";
+    value(hCPU + parts * (worst_j * lda + worst_i));
+    msg << ", got ";
+    value(hGPU + parts * (worst_j * lda + worst_i));
+
 #ifdef GOOGLE_TEST
-            ASSERT_NEAR(hCPU[i + j * lda], hGPU[i + j * lda], compare_val);
+    FAIL() << msg.str();
 #else
-            assert(std::abs(hCPU[i + j * lda] - hGPU[i + j * lda]) < compare_val);
+    fprintf(stderr, "%s\n", msg.str().c_str());
+    assert(max_err <= tol * max_ref);
 #endif
-        }
-    }
 }
 
-template <>
-void unit_check_near(int64_t M, int64_t N, int64_t lda, double* hCPU, double* hGPU)
+// Compare M x N integer matrices for equality
+template <typename T>
+static void unit_check_integer(int64_t M, int64_t N, int64_t lda, const T* hCPU, const T* hGPU)
 {
-    for(int64_t j = 0; j < N; j++)
+    int64_t count   = 0;
+    int64_t first_i = -1;
+    int64_t first_j = -1;
+
+    for(int64_t j = 0; j < N; ++j)
     {
-        for(int64_t i = 0; i < M; i++)
-        {
-            double compare_val = std::max(std::abs(hCPU[i + j * lda] * 1e-10),
-                                          10 * std::numeric_limits<double>::epsilon());
-#ifdef GOOGLE_TEST
-            ASSERT_NEAR(hCPU[i + j * lda], hGPU[i + j * lda], compare_val);
-#else
-            assert(std::abs(hCPU[i + j * lda] - hGPU[i + j * lda]) < compare_val);
+        const T* a = hCPU + j * lda;
+        const T* b = hGPU + j * lda;
+
+        int64_t col_count = 0;
+
+#ifdef _OPENMP
+#pragma omp parallel for simd if(M >= 65536) reduction(+ : col_count)
 #endif
+        for(int64_t i = 0; i < M; ++i)
+        {
+            col_count += (a[i] != b[i]);
         }
+
+        if(col_count > 0 && first_i < 0)
+        {
+            first_i = std::find_if(a, a + M, [&](const T& v) { return v != b[&v - a]; }) - a;
+            first_j = j;
+        }
+
+        count += col_count;
     }
-}
 
-template <>
-void unit_check_near(int64_t M, int64_t N, int64_t lda, hipComplex* hCPU, hipComplex* hGPU)
-{
-    for(int64_t j = 0; j < N; j++)
+    if(count == 0)
     {
-        for(int64_t i = 0; i < M; i++)
-        {
-            hipComplex compare_val
-                = make_hipFloatComplex(std::max(std::abs(hCPU[i + j * lda].x * 1e-3f),
-                                                10 * std::numeric_limits<float>::epsilon()),
-                                       std::max(std::abs(hCPU[i + j * lda].y * 1e-3f),
-                                                10 * std::numeric_limits<float>::epsilon()));
+        return;
+    }
+
+    std::ostringstream msg;
+    msg << count << " of " << M * N << " values of a " << M << " x " << N
+        << " matrix differ\n  first (" << first_i << ", " << first_j << "): expected "
+        << hCPU[first_i + first_j * lda] << ", got " << hGPU[first_i + first_j * lda];
 
 #ifdef GOOGLE_TEST
-            ASSERT_NEAR(hCPU[i + j * lda].x, hGPU[i + j * lda].x, compare_val.x);
-            ASSERT_NEAR(hCPU[i + j * lda].y, hGPU[i + j * lda].y, compare_val.y);
+    FAIL() << msg.str();
 #else
-            assert(std::abs(hCPU[i + j * lda].x - hGPU[i + j * lda].x) < compare_val.x);
-            assert(std::abs(hCPU[i + j * lda].y - hGPU[i + j * lda].y) < compare_val.y);
+    fprintf(stderr, "%s\n", msg.str().c_str());
+    assert(count == 0);
 #endif
-        }
-    }
 }
 
 template <>
-void unit_check_near(
+void unit_check_general(int64_t M, int64_t N, int64_t lda, float* hCPU, float* hGPU)
+{
+    unit_check_real(M, N, lda, 1, hCPU, hGPU, 0.0f, 1.0);
+}
+
+template <>
+void unit_check_general(int64_t M, int64_t N, int64_t lda, double* hCPU, double* hGPU)
+{
+    unit_check_real(M, N, lda, 1, hCPU, hGPU, 0.0, 1.0);
+}
+
+template <>
+void unit_check_general(int64_t M, int64_t N, int64_t lda, hipComplex* hCPU, hipComplex* hGPU)
+{
+    unit_check_real(M,
+                    N,
+                    lda,
+                    2,
+                    reinterpret_cast<const float*>(hCPU),
+                    reinterpret_cast<const float*>(hGPU),
+                    0.0f,
+                    1.0);
+}
+
+template <>
+void unit_check_general(
     int64_t M, int64_t N, int64_t lda, hipDoubleComplex* hCPU, hipDoubleComplex* hGPU)
 {
-    for(int64_t j = 0; j < N; j++)
-    {
-        for(int64_t i = 0; i < M; i++)
-        {
-            hipDoubleComplex compare_val
-                = make_hipDoubleComplex(std::max(std::abs(hCPU[i + j * lda].x * 1e-10),
-                                                 10 * std::numeric_limits<double>::epsilon()),
-                                        std::max(std::abs(hCPU[i + j * lda].y * 1e-10),
-                                                 10 * std::numeric_limits<double>::epsilon()));
-#ifdef GOOGLE_TEST
-            ASSERT_NEAR(hCPU[i + j * lda].x, hGPU[i + j * lda].x, compare_val.x);
-            ASSERT_NEAR(hCPU[i + j * lda].y, hGPU[i + j * lda].y, compare_val.y);
-#else
-            assert(std::abs(hCPU[i + j * lda].x - hGPU[i + j * lda].x) < compare_val.x);
-            assert(std::abs(hCPU[i + j * lda].y - hGPU[i + j * lda].y) < compare_val.y);
-#endif
-        }
-    }
+    unit_check_real(M,
+                    N,
+                    lda,
+                    2,
+                    reinterpret_cast<const double*>(hCPU),
+                    reinterpret_cast<const double*>(hGPU),
+                    0.0,
+                    1.0);
+}
+
+template <>
+void unit_check_general(int64_t M, int64_t N, int64_t lda, int* hCPU, int* hGPU)
+{
+    unit_check_integer(M, N, lda, hCPU, hGPU);
+}
+
+template <>
+void unit_check_general(int64_t M, int64_t N, int64_t lda, int64_t* hCPU, int64_t* hGPU)
+{
+    unit_check_integer(M, N, lda, hCPU, hGPU);
+}
+
+template <>
+void unit_check_general(int64_t M, int64_t N, int64_t lda, size_t* hCPU, size_t* hGPU)
+{
+    unit_check_integer(M, N, lda, hCPU, hGPU);
+}
+
+/*! \brief Template: compare two matrices float/double/complex within a relative tolerance of
+ *  1e-3 for single and 1e-10 for double precision, scaled by tol_scale */
+
+template <>
+void unit_check_near(
+    int64_t M, int64_t N, int64_t lda, float* hCPU, float* hGPU, double tol_scale)
+{
+    unit_check_real(M, N, lda, 1, hCPU, hGPU, 1e-3f, tol_scale);
+}
+
+template <>
+void unit_check_near(
+    int64_t M, int64_t N, int64_t lda, double* hCPU, double* hGPU, double tol_scale)
+{
+    unit_check_real(M, N, lda, 1, hCPU, hGPU, 1e-10, tol_scale);
+}
+
+template <>
+void unit_check_near(
+    int64_t M, int64_t N, int64_t lda, hipComplex* hCPU, hipComplex* hGPU, double tol_scale)
+{
+    unit_check_real(M,
+                    N,
+                    lda,
+                    2,
+                    reinterpret_cast<const float*>(hCPU),
+                    reinterpret_cast<const float*>(hGPU),
+                    1e-3f,
+                    tol_scale);
+}
+
+template <>
+void unit_check_near(int64_t           M,
+                     int64_t           N,
+                     int64_t           lda,
+                     hipDoubleComplex* hCPU,
+                     hipDoubleComplex* hGPU,
+                     double            tol_scale)
+{
+    unit_check_real(M,
+                    N,
+                    lda,
+                    2,
+                    reinterpret_cast<const double*>(hCPU),
+                    reinterpret_cast<const double*>(hGPU),
+                    1e-10,
+                    tol_scale);
+}
+
+/*! \brief Template: compare two matrices float/double/complex in the max norm, relative to the
+ *  largest entry of hCPU */
+
+template <>
+void unit_check_norm(int64_t M, int64_t N, int64_t lda, float* hCPU, float* hGPU, double tol)
+{
+    unit_check_norm_real(M, N, lda, 1, hCPU, hGPU, tol);
+}
+
+template <>
+void unit_check_norm(int64_t M, int64_t N, int64_t lda, double* hCPU, double* hGPU, double tol)
+{
+    unit_check_norm_real(M, N, lda, 1, hCPU, hGPU, tol);
+}
+
+template <>
+void unit_check_norm(
+    int64_t M, int64_t N, int64_t lda, hipComplex* hCPU, hipComplex* hGPU, double tol)
+{
+    unit_check_norm_real(M,
+                         N,
+                         lda,
+                         2,
+                         reinterpret_cast<const float*>(hCPU),
+                         reinterpret_cast<const float*>(hGPU),
+                         tol);
+}
+
+template <>
+void unit_check_norm(
+    int64_t M, int64_t N, int64_t lda, hipDoubleComplex* hCPU, hipDoubleComplex* hGPU, double tol)
+{
+    unit_check_norm_real(M,
+                         N,
+                         lda,
+                         2,
+                         reinterpret_cast<const double*>(hCPU),
+                         reinterpret_cast<const double*>(hGPU),
+                         tol);
 }
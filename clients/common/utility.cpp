@@ -22,13 +22,21 @@
  * ************************************************************************ */
 
 #include <limits>
+#include <sys/stat.h>
 #ifdef WIN32
+#include <sys/utime.h>
 #include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <utime.h>
 #endif
 #include "utility.hpp"
 
 #include <chrono>
 #include <cstdlib>
+#include <fstream>
 
 #ifdef WIN32
 #define strSUITEcmp(A, B) _stricmp(A, B)
@@ -113,6 +121,133 @@ std::string hipsparse_exepath()
 #endif
 }
 
+/* ============================================================================================ */
+// Map a file into host memory
+hipsparse_mapped_file::hipsparse_mapped_file(const char* filename)
+    : opened(false)
+    , mapped(false)
+    , ptr(nullptr)
+    , bytes(0)
+{
+#ifndef WIN32
+    int fd = open(filename, O_RDONLY);
+    if(fd != -1)
+    {
+        struct stat st;
+        if(fstat(fd, &st) == 0)
+        {
+            this->bytes  = st.st_size;
+            this->opened = true;
+
+            if(this->bytes > 0)
+            {
+                void* addr = mmap(nullptr, this->bytes, PROT_READ, MAP_PRIVATE, fd, 0);
+                if(addr != MAP_FAILED)
+                {
+                    madvise(addr, this->bytes, MADV_SEQUENTIAL);
+
+                    this->ptr    = static_cast<const char*>(addr);
+                    this->mapped = true;
+                }
+            }
+        }
+
+        close(fd);
+
+        if(this->mapped || this->bytes == 0)
+        {
+            return;
+        }
+    }
+#endif
+
+    // Fall back to reading the whole file
+    this->opened = false;
+    this->bytes  = 0;
+
+    std::ifstream f(filename, std::ios::in | std::ios::binary | std::ios::ate);
+    if(!f)
+    {
+        return;
+    }
+
+    std::streamoff size = f.tellg();
+    f.seekg(0, std::ios::beg);
+
+    if(size >= 0)
+    {
+        this->buffer.resize(size);
+        if(f.read(this->buffer.data(), size))
+        {
+            this->ptr    = this->buffer.data();
+            this->bytes  = size;
+            this->opened = true;
+        }
+    }
+}
+
+hipsparse_mapped_file::~hipsparse_mapped_file()
+{
+#ifndef WIN32
+    if(this->mapped)
+    {
+        munmap(const_cast<char*>(this->ptr), this->bytes);
+    }
+#endif
+}
+
+/* ============================================================================================ */
+// Size and modification time of a file
+bool hipsparse_file_stamp(const char* filename, uint64_t& size, uint64_t& mtime)
+{
+#ifdef WIN32
+    struct _stat64 st;
+    if(_stat64(filename, &st) != 0)
+    {
+        return false;
+    }
+#else
+    struct stat st;
+    if(stat(filename, &st) != 0)
+    {
+        return false;
+    }
+#endif
+
+    size  = st.st_size;
+    mtime = st.st_mtime;
+
+    return true;
+}
+
+/* ============================================================================================ */
+// Set the modification time of a file
+bool hipsparse_file_touch(const char* filename, uint64_t mtime)
+{
+#ifdef WIN32
+    struct _utimbuf times;
+    times.actime  = mtime;
+    times.modtime = mtime;
+
+    return _utime(filename, &times) == 0;
+#else
+    struct utimbuf times;
+    times.actime  = mtime;
+    times.modtime = mtime;
+
+    return utime(filename, &times) == 0;
+#endif
+}
+
+/* ============================================================================================ */
+// Return path of the directory for temporary files
+std::string hipsparse_tempdir()
+{
+    std::filesystem::path tempdir = std::filesystem::temp_directory_path();
+    tempdir += "/";
+    return tempdir.string();
+}
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -121,7 +121,7 @@ hipsparseStatus_t testing_axpyi(Arguments argus)
     std::vector<T>   hy_gold(N);
 
     // Initial Data on CPU
-    srand(12345ULL);
+    hipsparse_seedrand(12345ULL);
     hipsparseInitIndex(hxInd.data(), nnz, 1, N);
     hipsparseInit<T>(hxVal, 1, nnz);
     hipsparseInit<T>(hy_1, 1, N);
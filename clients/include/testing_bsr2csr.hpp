@@ -308,7 +308,7 @@ hipsparseStatus_t testing_bsr2csr(Arguments argus)
 #endif
     }
 
-    srand(12345ULL);
+    hipsparse_seedrand(12345ULL);
 
     // Host structures
     std::vector<int> csr_row_ptr;
@@ -317,7 +317,7 @@ hipsparseStatus_t testing_bsr2csr(Arguments argus)
 
     // Read or construct CSR matrix
     int nnz = 0;
-    if(!generate_csr_matrix(filename, m, n, nnz, csr_row_ptr, csr_col_ind, csr_val, csr_idx_base))
+    if(!generate_csr_matrix(argus, m, n, nnz, csr_row_ptr, csr_col_ind, csr_val, csr_idx_base))
     {
         fprintf(stderr, "Cannot open [read] %s\ncol", filename.c_str());
         return HIPSPARSE_STATUS_INTERNAL_ERROR;
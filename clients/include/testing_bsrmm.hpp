@@ -461,7 +461,7 @@ hipsparseStatus_t testing_bsrmm(Arguments argus)
 #endif
     }
 
-    srand(12345ULL);
+    hipsparse_seedrand(12345ULL);
 
     // Host structures
     std::vector<int> csr_row_ptr;
@@ -470,7 +470,7 @@ hipsparseStatus_t testing_bsrmm(Arguments argus)
 
     // Read or construct CSR matrix
     int nnz = 0;
-    if(!generate_csr_matrix(filename, m, k, nnz, csr_row_ptr, csr_col_ind, csr_val, idx_base))
+    if(!generate_csr_matrix(argus, m, k, nnz, csr_row_ptr, csr_col_ind, csr_val, idx_base))
     {
         fprintf(stderr, "Cannot open [read] %s\ncol", filename.c_str());
         return HIPSPARSE_STATUS_INTERNAL_ERROR;
@@ -317,7 +317,7 @@ hipsparseStatus_t testing_bsrmv(Arguments argus)
 #endif
     }
 
-    srand(12345ULL);
+    hipsparse_seedrand(12345ULL);
 
     // Host structures
     std::vector<int> hcsr_row_ptr;
@@ -326,7 +326,7 @@ hipsparseStatus_t testing_bsrmv(Arguments argus)
 
     // Read or construct CSR matrix
     int nnz = 0;
-    if(!generate_csr_matrix(filename, m, n, nnz, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base))
+    if(!generate_csr_matrix(argus, m, n, nnz, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base))
     {
         fprintf(stderr, "Cannot open [read] %s\ncol", filename.c_str());
         return HIPSPARSE_STATUS_INTERNAL_ERROR;
@@ -492,9 +492,36 @@ hipsparseStatus_t testing_bsrxmv()
                                                 dy);
     verify_hipsparse_status_success(status, "bsrxmv failed.");
 
-    CHECK_HIP_ERROR(hipMemcpy(hy.data(), dy, sizeof(T) * mb * block_dim, hipMemcpyDeviceToHost));
+    // Device bsrxmv against the expected result
+    std::vector<T> hy_device(mb * block_dim);
+    CHECK_HIP_ERROR(
+        hipMemcpy(hy_device.data(), dy, sizeof(T) * mb * block_dim, hipMemcpyDeviceToHost));
+
+    unit_check_near(1, mb * block_dim, 1, hyref.data(), hy_device.data());
+
+    // Host bsrxmv
+    std::vector<T> hy_gold = hy;
+
+    host_bsrxmv(dir,
+                trans,
+                size_of_mask,
+                mb,
+                nb,
+                nnzb,
+                h_alpha,
+                hbsr_mask_ptr.data(),
+                hbsr_row_ptr.data(),
+                hbsr_end_ptr.data(),
+                hbsr_col_ind.data(),
+                hbsr_val.data(),
+                block_dim,
+                hx.data(),
+                h_beta,
+                hy_gold.data(),
+                idx_base);
 
-    unit_check_near(1, mb * block_dim, 1, hyref.data(), hy.data());
+    unit_check_near(1, mb * block_dim, 1, hyref.data(), hy_gold.data());
+    unit_check_near(1, mb * block_dim, 1, hy_gold.data(), hy_device.data());
     return HIPSPARSE_STATUS_SUCCESS;
 }
 
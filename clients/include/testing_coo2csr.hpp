@@ -106,7 +106,7 @@ hipsparseStatus_t testing_coo2csr(Arguments argus)
 #endif
     }
 
-    srand(12345ULL);
+    hipsparse_seedrand(12345ULL);
 
     // Host structures
     std::vector<int>   hcoo_row_ind;
@@ -115,7 +115,7 @@ hipsparseStatus_t testing_coo2csr(Arguments argus)
 
     // Read or construct CSR matrix
     int nnz = 0;
-    if(!generate_coo_matrix(filename, m, n, nnz, hcoo_row_ind, hcoo_col_ind, hcoo_val, idx_base))
+    if(!generate_coo_matrix(argus, m, n, nnz, hcoo_row_ind, hcoo_col_ind, hcoo_val, idx_base))
     {
         fprintf(stderr, "Cannot open [read] %s\ncol", filename.c_str());
         return HIPSPARSE_STATUS_INTERNAL_ERROR;
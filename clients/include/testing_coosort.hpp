@@ -206,7 +206,7 @@ hipsparseStatus_t testing_coosort(Arguments argus)
 #endif
     }
 
-    srand(12345ULL);
+    hipsparse_seedrand(12345ULL);
 
     // Host structures
     std::vector<int>   hcoo_row_ind;
@@ -215,7 +215,7 @@ hipsparseStatus_t testing_coosort(Arguments argus)
 
     // Read or construct CSR matrix
     int nnz = 0;
-    if(!generate_coo_matrix(filename, m, n, nnz, hcoo_row_ind, hcoo_col_ind, hcoo_val, idx_base))
+    if(!generate_coo_matrix(argus, m, n, nnz, hcoo_row_ind, hcoo_col_ind, hcoo_val, idx_base))
     {
         fprintf(stderr, "Cannot open [read] %s\ncol", filename.c_str());
         return HIPSPARSE_STATUS_INTERNAL_ERROR;
@@ -251,25 +251,13 @@ hipsparseStatus_t testing_coosort(Arguments argus)
     if(!by_row)
     {
         std::vector<int> hperm(nnz);
-        for(int i = 0; i < nnz; ++i)
-        {
-            hperm[i] = i;
-        }
-
-        std::sort(hperm.begin(), hperm.end(), [&](const int& a, const int& b) {
-            if(hcoo_col_ind_unsorted[a] < hcoo_col_ind_unsorted[b])
-            {
-                return true;
-            }
-            else if(hcoo_col_ind_unsorted[a] == hcoo_col_ind_unsorted[b])
-            {
-                return (hcoo_row_ind_unsorted[a] < hcoo_row_ind_unsorted[b]);
-            }
-            else
-            {
-                return false;
-            }
-        });
+        host_coo_sort_permutation(nnz,
+                                  n,
+                                  m,
+                                  hcoo_col_ind_unsorted.data(),
+                                  hcoo_row_ind_unsorted.data(),
+                                  hperm.data(),
+                                  idx_base);
 
         for(int i = 0; i < nnz; ++i)
         {
@@ -185,7 +185,7 @@ hipsparseStatus_t testing_cscsort(Arguments argus)
 #endif
     }
 
-    srand(12345ULL);
+    hipsparse_seedrand(12345ULL);
 
     // Host structures
     std::vector<int>   hcsc_col_ptr;
@@ -194,7 +194,7 @@ hipsparseStatus_t testing_cscsort(Arguments argus)
 
     // Read or construct CSC matrix
     int nnz = 0;
-    if(!generate_csr_matrix(filename, n, m, nnz, hcsc_col_ptr, hcsc_row_ind, hcsc_val, idx_base))
+    if(!generate_csr_matrix(argus, n, m, nnz, hcsc_col_ptr, hcsc_row_ind, hcsc_val, idx_base))
     {
         fprintf(stderr, "Cannot open [read] %s\ncol", filename.c_str());
         return HIPSPARSE_STATUS_INTERNAL_ERROR;
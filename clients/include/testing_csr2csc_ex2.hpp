@@ -364,7 +364,7 @@ hipsparseStatus_t testing_csr2csc_ex2(Arguments argus)
     std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
     hipsparseHandle_t              handle = unique_ptr_handle->handle;
 
-    srand(12345ULL);
+    hipsparse_seedrand(12345ULL);
 
     // Host structures
     std::vector<int> hcsr_row_ptr;
@@ -373,7 +373,7 @@ hipsparseStatus_t testing_csr2csc_ex2(Arguments argus)
 
     // Read or construct CSR matrix
     int nnz = 0;
-    if(!generate_csr_matrix(filename, m, n, nnz, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base))
+    if(!generate_csr_matrix(argus, m, n, nnz, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base))
     {
         fprintf(stderr, "Cannot open [read] %s\ncol", filename.c_str());
         return HIPSPARSE_STATUS_INTERNAL_ERROR;
@@ -462,44 +462,21 @@ hipsparseStatus_t testing_csr2csc_ex2(Arguments argus)
             hipMemcpy(hcsc_val.data(), dcsc_val, sizeof(T) * nnz, hipMemcpyDeviceToHost));
 
         // Host csr2csc conversion
-        std::vector<int> hcsc_row_ind_gold(nnz);
-        std::vector<int> hcsc_col_ptr_gold(n + 1, 0);
-        std::vector<T>   hcsc_val_gold(nnz);
-
-        // Determine nnz per column
-        for(int i = 0; i < nnz; ++i)
-        {
-            ++hcsc_col_ptr_gold[hcsr_col_ind[i] + 1 - idx_base];
-        }
-
-        // Scan
-        for(int i = 0; i < n; ++i)
-        {
-            hcsc_col_ptr_gold[i + 1] += hcsc_col_ptr_gold[i];
-        }
-
-        // Fill row indices and values
-        for(int i = 0; i < m; ++i)
-        {
-            for(int j = hcsr_row_ptr[i]; j < hcsr_row_ptr[i + 1]; ++j)
-            {
-                int col = hcsr_col_ind[j - idx_base] - idx_base;
-                int idx = hcsc_col_ptr_gold[col];
-
-                hcsc_row_ind_gold[idx] = i + idx_base;
-                hcsc_val_gold[idx]     = hcsr_val[j - idx_base];
-
-                ++hcsc_col_ptr_gold[col];
-            }
-        }
-
-        // Shift column pointer array
-        for(int i = n; i > 0; --i)
-        {
-            hcsc_col_ptr_gold[i] = hcsc_col_ptr_gold[i - 1] + idx_base;
-        }
-
-        hcsc_col_ptr_gold[0] = idx_base;
+        std::vector<int> hcsc_row_ind_gold;
+        std::vector<int> hcsc_col_ptr_gold;
+        std::vector<T>   hcsc_val_gold;
+
+        host_csr_to_csc(m,
+                        n,
+                        nnz,
+                        hcsr_row_ptr.data(),
+                        hcsr_col_ind.data(),
+                        hcsr_val.data(),
+                        hcsc_row_ind_gold,
+                        hcsc_col_ptr_gold,
+                        hcsc_val_gold,
+                        action,
+                        idx_base);
 
         // Unit check
         unit_check_general(1, nnz, 1, hcsc_row_ind_gold.data(), hcsc_row_ind.data());
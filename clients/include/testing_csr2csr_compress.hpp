@@ -360,7 +360,7 @@ hipsparseStatus_t testing_csr2csr_compress(Arguments argus)
 
     hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_DEVICE);
 
-    srand(12345ULL);
+    hipsparse_seedrand(12345ULL);
 
     // Host structures
     std::vector<int> hcsr_row_ptr_A;
@@ -370,7 +370,7 @@ hipsparseStatus_t testing_csr2csr_compress(Arguments argus)
     // Read or construct CSR matrix
     int hnnz_A = 0;
     if(!generate_csr_matrix(
-           filename, m, n, hnnz_A, hcsr_row_ptr_A, hcsr_col_ind_A, hcsr_val_A, idx_base))
+           argus, m, n, hnnz_A, hcsr_row_ptr_A, hcsr_col_ind_A, hcsr_val_A, idx_base))
     {
         fprintf(stderr, "Cannot open [read] %s\ncol", filename.c_str());
         return HIPSPARSE_STATUS_INTERNAL_ERROR;
@@ -249,7 +249,7 @@ hipsparseStatus_t testing_csrcolor()
     hipsparseIndexBase_t idx_base = HIPSPARSE_INDEX_BASE_ZERO;
 
     // Initial Data on CPU
-    srand(12345ULL);
+    hipsparse_seedrand(12345ULL);
     floating_data_t<T> fractionToColor = make_DataType<floating_data_t<T>>(1.0);
 
     int m;
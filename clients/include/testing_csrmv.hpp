@@ -169,7 +169,7 @@ hipsparseStatus_t testing_csrmv(Arguments argus)
     // Set matrix index base
     CHECK_HIPSPARSE_ERROR(hipsparseSetMatIndexBase(descr, idx_base));
 
-    srand(12345ULL);
+    hipsparse_seedrand(12345ULL);
 
     // Host structures
     std::vector<int> hcsr_row_ptr;
@@ -179,7 +179,7 @@ hipsparseStatus_t testing_csrmv(Arguments argus)
     // Read or construct CSR matrix
     int nnz = 0;
     if(!generate_csr_matrix(
-           filename, nrow, ncol, nnz, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base))
+           argus, nrow, ncol, nnz, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base))
     {
         fprintf(stderr, "Cannot open [read] %s\ncol", filename.c_str());
         return HIPSPARSE_STATUS_INTERNAL_ERROR;
@@ -247,6 +247,13 @@ hipsparseStatus_t testing_csrmv(Arguments argus)
         CHECK_HIP_ERROR(hipMemcpy(hy_1.data(), dy_1, sizeof(T) * m, hipMemcpyDeviceToHost));
         CHECK_HIP_ERROR(hipMemcpy(hy_2.data(), dy_2, sizeof(T) * m, hipMemcpyDeviceToHost));
 
+        // Query for warpSize
+        int             dev;
+        hipDeviceProp_t prop;
+
+        CHECK_HIP_ERROR(hipGetDevice(&dev));
+        CHECK_HIP_ERROR(hipGetDeviceProperties(&prop, dev));
+
         host_csrmv(transA,
                    nrow,
                    ncol,
@@ -258,10 +265,14 @@ hipsparseStatus_t testing_csrmv(Arguments argus)
                    hx.data(),
                    h_beta,
                    hy_gold.data(),
-                   idx_base);
+                   idx_base,
+                   prop.warpSize);
+
+        double tol_scale = host_csr_tolerance_scale(
+            nrow, ncol, nnz, hcsr_row_ptr.data(), hcsr_col_ind.data(), idx_base);
 
-        unit_check_near(1, m, 1, hy_gold.data(), hy_1.data());
-        unit_check_near(1, m, 1, hy_gold.data(), hy_2.data());
+        unit_check_near(1, m, 1, hy_gold.data(), hy_1.data(), tol_scale);
+        unit_check_near(1, m, 1, hy_gold.data(), hy_2.data(), tol_scale);
     }
 
     return HIPSPARSE_STATUS_SUCCESS;
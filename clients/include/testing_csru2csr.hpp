@@ -266,7 +266,7 @@ hipsparseStatus_t testing_csru2csr(Arguments argus)
     std::unique_ptr<csru2csr_struct> test_info(new csru2csr_struct);
     csru2csrInfo_t                   info = test_info->info;
 
-    srand(12345ULL);
+    hipsparse_seedrand(12345ULL);
 
     // Host structures
     std::vector<int> hcsr_row_ptr;
@@ -276,7 +276,7 @@ hipsparseStatus_t testing_csru2csr(Arguments argus)
     // Read or construct CSR matrix
     int nnz = 0;
     if(!generate_csr_matrix(
-           filename, m, n, nnz, hcsr_row_ptr, hcsr_col_ind_gold, hcsr_val_gold, idx_base))
+           argus, m, n, nnz, hcsr_row_ptr, hcsr_col_ind_gold, hcsr_val_gold, idx_base))
     {
         fprintf(stderr, "Cannot open [read] %s\ncol", filename.c_str());
         return HIPSPARSE_STATUS_INTERNAL_ERROR;
@@ -259,7 +259,7 @@ hipsparseStatus_t testing_dense2csx(const Arguments& argus, FUNC& dense2csx)
     //
     // Initialize a random dense matrix.
     //
-    srand(0);
+    hipsparse_seedrand(0);
     gen_dense_random_sparsity_pattern(M, N, h_dense_val.data(), LD, HIPSPARSE_ORDER_COL, 0.2);
 
     //
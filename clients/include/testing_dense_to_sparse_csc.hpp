@@ -190,7 +190,7 @@ hipsparseStatus_t testing_dense_to_sparse_csc(Arguments argus)
         }
     }
 
-    srand(0);
+    hipsparse_seedrand(0);
     gen_dense_random_sparsity_pattern(m, n, hdense_val.data(), ld, order, 0.2);
 
     // allocate memory on device
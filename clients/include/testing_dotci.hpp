@@ -126,7 +126,7 @@ hipsparseStatus_t testing_dotci(Arguments argus)
     T hresult_gold;
 
     // Initial Data on CPU
-    srand(12345ULL);
+    hipsparse_seedrand(12345ULL);
     hipsparseInitIndex(hx_ind.data(), nnz, 1, N);
     hipsparseInit<T>(hx_val, 1, nnz);
     hipsparseInit<T>(hy, 1, N);
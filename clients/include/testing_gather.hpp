@@ -105,7 +105,7 @@ hipsparseStatus_t testing_gather(Arguments argus)
     std::vector<T> hy(size);
 
     // Initial Data on CPU
-    srand(12345ULL);
+    hipsparse_seedrand(12345ULL);
     hipsparseInitIndex(hx_ind.data(), nnz, 1, size);
     hipsparseInit<T>(hy, 1, size);
 
@@ -341,7 +341,7 @@ hipsparseStatus_t testing_gebsr2csr(Arguments argus)
     int mb = m * row_block_dim;
     int nb = n * col_block_dim;
 
-    srand(12345ULL);
+    hipsparse_seedrand(12345ULL);
 
     // Host structures
     std::vector<int> bsr_row_ptr;
@@ -351,7 +351,7 @@ hipsparseStatus_t testing_gebsr2csr(Arguments argus)
     // Read or construct CSR matrix
     int nnzb = 0;
     if(!generate_csr_matrix(
-           filename, mb, nb, nnzb, bsr_row_ptr, bsr_col_ind, bsr_val, bsr_idx_base))
+           argus, mb, nb, nnzb, bsr_row_ptr, bsr_col_ind, bsr_val, bsr_idx_base))
     {
         fprintf(stderr, "Cannot open [read] %s\ncol", filename.c_str());
         return HIPSPARSE_STATUS_INTERNAL_ERROR;
@@ -458,7 +458,7 @@ hipsparseStatus_t testing_gebsr2gebsc(Arguments argus)
     int mb = m * row_block_dim;
     int nb = n * col_block_dim;
 
-    srand(12345ULL);
+    hipsparse_seedrand(12345ULL);
 
     // Host structures
     std::vector<int> hbsr_row_ptr;
@@ -467,7 +467,7 @@ hipsparseStatus_t testing_gebsr2gebsc(Arguments argus)
 
     // Read or construct CSR matrix
     int nnzb = 0;
-    if(!generate_csr_matrix(filename, mb, nb, nnzb, hbsr_row_ptr, hbsr_col_ind, hbsr_val, base))
+    if(!generate_csr_matrix(argus, mb, nb, nnzb, hbsr_row_ptr, hbsr_col_ind, hbsr_val, base))
     {
         fprintf(stderr, "Cannot open [read] %s\ncol", filename.c_str());
         return HIPSPARSE_STATUS_INTERNAL_ERROR;
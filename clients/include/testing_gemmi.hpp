@@ -298,7 +298,7 @@ hipsparseStatus_t testing_gemmi(Arguments argus)
 #endif
     }
 
-    srand(12345ULL);
+    hipsparse_seedrand(12345ULL);
 
     // Host structures
     std::vector<int> hcsc_col_ptrB;
@@ -308,7 +308,7 @@ hipsparseStatus_t testing_gemmi(Arguments argus)
     // Read or construct CSR matrix
     int nnz = 0;
     if(!generate_csr_matrix(
-           filename, N, K, nnz, hcsc_col_ptrB, hcsc_row_indB, hcsc_valB, HIPSPARSE_INDEX_BASE_ZERO))
+           argus, N, K, nnz, hcsc_col_ptrB, hcsc_row_indB, hcsc_valB, HIPSPARSE_INDEX_BASE_ZERO))
     {
         fprintf(stderr, "Cannot open [read] %s\ncol", filename.c_str());
         return HIPSPARSE_STATUS_INTERNAL_ERROR;
@@ -169,7 +169,7 @@ hipsparseStatus_t testing_gemvi(Arguments argus)
     std::vector<T>   hy_gold(m);
 
     // Initial Data on CPU
-    srand(12345ULL);
+    hipsparse_seedrand(12345ULL);
     hipsparseInitIndex(hx_ind.data(), nnz, 1, n);
     hipsparseInit<T>(hx_val, 1, nnz);
     hipsparseInit<T>(hy, 1, m);
@@ -237,6 +237,23 @@ hipsparseStatus_t testing_gpsv_interleaved_batch(Arguments argus)
 
     unit_check_near<T>(1, m * batch_count, 1, hx_original.data(), hresult.data());
 
+    // Compare to the host solution, whose error is negligible. The error of the device solution
+    // is bounded by the condition number of the test matrix.
+    std::vector<T> hx_ref = hx_original;
+    host_gpsv_interleaved_batch(m,
+                                hds.data(),
+                                hdl.data(),
+                                hd.data(),
+                                hdu.data(),
+                                hdw.data(),
+                                hx_ref.data(),
+                                batch_count);
+
+    // All systems of the test are the same
+    double tol = host_gpsv_tolerance(
+        m, hds.data(), hdl.data(), hd.data(), hdu.data(), hdw.data(), batch_count);
+    unit_check_norm(1, m * batch_count, 1, hx_ref.data(), hx.data(), tol);
+
     CHECK_HIP_ERROR(hipFree(buffer));
 #endif
 
@@ -111,7 +111,7 @@ hipsparseStatus_t testing_gthr(Arguments argus)
     std::vector<T>   hy(N);
 
     // Initial Data on CPU
-    srand(12345ULL);
+    hipsparse_seedrand(12345ULL);
     hipsparseInitIndex(hx_ind.data(), nnz, 1, N);
     hipsparseInit<T>(hy, 1, N);
 
@@ -209,6 +209,16 @@ hipsparseStatus_t testing_gtsv2_strided_batch(Arguments argus)
 
     unit_check_near<T>(1, batch_stride * batch_count, 1, hx_original.data(), hresult.data());
 
+    // Compare to the host solution, whose error is negligible. The error of the device solution
+    // is bounded by the condition number of the test matrix.
+    std::vector<T> hx_ref = hx_original;
+    host_gtsv2_strided_batch(
+        m, hdl.data(), hd.data(), hdu.data(), hx_ref.data(), batch_count, batch_stride);
+
+    // All systems of the test are the same
+    double tol = host_gtsv_tolerance(m, hdl.data(), hd.data(), hdu.data(), 1);
+    unit_check_norm(m, batch_count, batch_stride, hx_ref.data(), hx.data(), tol);
+
     CHECK_HIP_ERROR(hipFree(buffer));
 #endif
 
@@ -170,7 +170,7 @@ hipsparseStatus_t testing_hybmv(Arguments argus)
     std::unique_ptr<hyb_struct> test_hyb(new hyb_struct);
     hipsparseHybMat_t           hyb = test_hyb->hyb;
 
-    srand(12345ULL);
+    hipsparse_seedrand(12345ULL);
 
     // Host structures
     std::vector<int> hcsr_row_ptr;
@@ -179,7 +179,7 @@ hipsparseStatus_t testing_hybmv(Arguments argus)
 
     // Read or construct CSR matrix
     int nnz = 0;
-    if(!generate_csr_matrix(filename, m, n, nnz, hcsr_row_ptr, hcol_ind, hval, idx_base))
+    if(!generate_csr_matrix(argus, m, n, nnz, hcsr_row_ptr, hcol_ind, hval, idx_base))
     {
         fprintf(stderr, "Cannot open [read] %s\ncol", filename.c_str());
         return HIPSPARSE_STATUS_INTERNAL_ERROR;
@@ -0,0 +1,180 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_LAYER_HPP
+#define TESTING_LAYER_HPP
+
+#include "hipsparse.hpp"
+#include "hipsparse_test_unique_ptr.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <fstream>
+#include <hipsparse.h>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace hipsparse;
+using namespace hipsparse_test;
+
+// The logging layer is configured once when the library is loaded, such that these tests
+// only run in a process started with HIPSPARSE_LAYER and HIPSPARSE_LOG_TRACE_PATH set
+inline bool testing_layer_trace_enabled(void)
+{
+#if(!defined(CUDART_VERSION))
+    const char* layer = getenv("HIPSPARSE_LAYER");
+    const char* path  = getenv("HIPSPARSE_LOG_TRACE_PATH");
+
+    return layer != nullptr && (atoi(layer) & 1) && path != nullptr;
+#else
+    return false;
+#endif
+}
+
+// Lines of the trace log
+inline std::vector<std::string> testing_layer_read_trace(void)
+{
+    std::vector<std::string> lines;
+
+    std::ifstream file(getenv("HIPSPARSE_LOG_TRACE_PATH"));
+    std::string   line;
+
+    while(std::getline(file, line))
+    {
+        lines.push_back(line);
+    }
+
+    return lines;
+}
+
+// Check the routine name and the argument names of a trace line
+inline bool testing_layer_check_line(const std::string&              line,
+                                     const std::string&              name,
+                                     const std::vector<std::string>& args)
+{
+    std::vector<std::string> fields;
+    std::stringstream        ss(line);
+    std::string              field;
+
+    while(std::getline(ss, field, ','))
+    {
+        fields.push_back(field);
+    }
+
+    bool match = !fields.empty() && fields[0] == name && fields.size() == args.size() + 1;
+
+    for(size_t i = 0; match && i < args.size(); ++i)
+    {
+        match = fields[i + 1].compare(0, args[i].size() + 1, args[i] + "=") == 0;
+    }
+
+    if(!match)
+    {
+        fprintf(stderr, "Unexpected trace line [%s] for %s\n", line.c_str(), name.c_str());
+    }
+
+    return match;
+}
+
+template <typename T>
+hipsparseStatus_t testing_layer_trace(Arguments argus)
+{
+#if(!defined(CUDART_VERSION))
+    int                  N        = argus.N;
+    int                  nnz      = argus.nnz;
+    hipsparseIndexBase_t idx_base = argus.idx_base;
+
+    // Log lines are buffered until a handle is destroyed, the log is complete up to here
+    // as the handles of earlier tests are gone
+    size_t first = testing_layer_read_trace().size();
+
+    std::unique_ptr<handle_struct> test_handle(new handle_struct);
+    hipsparseHandle_t              handle = test_handle->handle;
+
+    std::vector<int> hx_ind(nnz);
+    std::vector<T>   hx_val(nnz);
+    std::vector<T>   hy(N);
+
+    hipsparse_seedrand(12345ULL);
+    hipsparseInitIndex(hx_ind.data(), nnz, 1, N);
+    hipsparseInit<T>(hx_val, 1, nnz);
+    hipsparseInit<T>(hy, 1, N);
+
+    auto dx_ind_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * nnz), device_free};
+    auto dx_val_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dy_managed     = hipsparse_unique_ptr{device_malloc(sizeof(T) * N), device_free};
+
+    int* dx_ind = (int*)dx_ind_managed.get();
+    T*   dx_val = (T*)dx_val_managed.get();
+    T*   dy     = (T*)dy_managed.get();
+
+    CHECK_HIP_ERROR(hipMemcpy(dx_ind, hx_ind.data(), sizeof(int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx_val, hx_val.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy, hy.data(), sizeof(T) * N, hipMemcpyHostToDevice));
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+
+    T h_alpha = make_DataType<T>(2.0);
+    T h_result;
+
+    // doti queries the stream through hipsparseGetStream, which is not logged as it is
+    // not called by the application
+    CHECK_HIPSPARSE_ERROR(hipsparseXaxpyi(handle, nnz, &h_alpha, dx_val, dx_ind, dy, idx_base));
+    CHECK_HIPSPARSE_ERROR(hipsparseXdoti(handle, nnz, dx_val, dx_ind, dy, &h_result, idx_base));
+
+    // Destroying the handle writes out the buffered lines
+    test_handle.reset();
+
+    std::vector<std::string> lines = testing_layer_read_trace();
+
+    if(lines.size() != first + 3)
+    {
+        fprintf(stderr,
+                "Expected 3 trace lines, got %d\n",
+                static_cast<int>(lines.size()) - static_cast<int>(first));
+        return HIPSPARSE_STATUS_INTERNAL_ERROR;
+    }
+
+    std::string precision = (sizeof(T) == sizeof(float)) ? "S" : "D";
+
+    if(!testing_layer_check_line(
+           lines[first], "hipsparseSetPointerMode", {"handle", "mode", "pointer_mode"})
+       || !testing_layer_check_line(
+           lines[first + 1],
+           "hipsparse" + precision + "axpyi",
+           {"handle", "nnz", "alpha", "xVal", "xInd", "y", "idxBase", "pointer_mode"})
+       || !testing_layer_check_line(
+           lines[first + 2],
+           "hipsparse" + precision + "doti",
+           {"handle", "nnz", "xVal", "xInd", "y", "result", "idxBase", "pointer_mode"}))
+    {
+        return HIPSPARSE_STATUS_INTERNAL_ERROR;
+    }
+#endif
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+#endif // TESTING_LAYER_HPP
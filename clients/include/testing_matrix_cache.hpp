@@ -0,0 +1,156 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_MATRIX_CACHE_HPP
+#define TESTING_MATRIX_CACHE_HPP
+
+#include "utility.hpp"
+
+#include <hipsparse.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+// Read a matrix through the cache and compare it byte by byte to the expected arrays
+template <typename I, typename J, typename T>
+bool matrix_cache_read_equal(const std::string&    filename,
+                             J                     m,
+                             J                     n,
+                             I                     nnz,
+                             const std::vector<I>& hptr,
+                             const std::vector<J>& hcol,
+                             const std::vector<T>& hval,
+                             hipsparseIndexBase_t  idx_base)
+{
+    J              rm;
+    J              rn;
+    I              rnnz;
+    std::vector<I> rptr;
+    std::vector<J> rcol;
+    std::vector<T> rval;
+
+    if(read_matrix_cached(filename, rm, rn, rnnz, rptr, rcol, rval, idx_base) != 0)
+    {
+        return false;
+    }
+
+    return rm == m && rn == n && rnnz == nnz && rptr.size() == hptr.size()
+           && rcol.size() == hcol.size() && rval.size() == hval.size()
+           && memcmp(rptr.data(), hptr.data(), sizeof(I) * hptr.size()) == 0
+           && memcmp(rcol.data(), hcol.data(), sizeof(J) * hcol.size()) == 0
+           && memcmp(rval.data(), hval.data(), sizeof(T) * hval.size()) == 0;
+}
+
+template <typename I, typename J, typename T>
+hipsparseStatus_t testing_matrix_cache(Arguments argus)
+{
+    J                    m        = argus.M;
+    J                    n        = argus.N;
+    hipsparseIndexBase_t idx_base = argus.idx_base;
+
+    I              nnz;
+    std::vector<I> hcsr_row_ptr;
+    std::vector<J> hcsr_col_ind;
+    std::vector<T> hcsr_val;
+
+    generate_csr_matrix(
+        std::string(""), m, n, nnz, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base);
+
+    // Unique file name, such that the cache has never seen it
+    auto        stamp    = std::chrono::high_resolution_clock::now().time_since_epoch();
+    std::string filename = hipsparse_tempdir() + "hipsparse_matrix_cache_"
+                           + std::to_string(stamp.count()) + ".bin";
+
+    if(write_bin_matrix(filename.c_str(),
+                        m,
+                        n,
+                        nnz,
+                        hcsr_row_ptr.data(),
+                        hcsr_col_ind.data(),
+                        hcsr_val.data(),
+                        idx_base)
+       != 0)
+    {
+        return HIPSPARSE_STATUS_INTERNAL_ERROR;
+    }
+
+    hipsparseStatus_t status = HIPSPARSE_STATUS_SUCCESS;
+
+    uint64_t size;
+    uint64_t mtime;
+
+    // Same values with the source being read and with the cache being hit
+    if(!matrix_cache_read_equal(filename, m, n, nnz, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base)
+       || !matrix_cache_read_equal(
+           filename, m, n, nnz, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base)
+       || !hipsparse_file_stamp(filename.c_str(), size, mtime))
+    {
+        status = HIPSPARSE_STATUS_INTERNAL_ERROR;
+    }
+
+    // Rewrite the source with other values of the same size
+    std::vector<T> hcsr_val_new(hcsr_val.size());
+    for(size_t i = 0; i < hcsr_val.size(); ++i)
+    {
+        hcsr_val_new[i] = testing_mult(make_DataType<T>(2.0), hcsr_val[i]);
+    }
+
+    if(status == HIPSPARSE_STATUS_SUCCESS
+       && write_bin_matrix(filename.c_str(),
+                           m,
+                           n,
+                           nnz,
+                           hcsr_row_ptr.data(),
+                           hcsr_col_ind.data(),
+                           hcsr_val_new.data(),
+                           idx_base)
+              != 0)
+    {
+        status = HIPSPARSE_STATUS_INTERNAL_ERROR;
+    }
+
+    // With the old modification time restored, the cache still holds the old values
+    if(status == HIPSPARSE_STATUS_SUCCESS && hipsparse_matrix_cache::instance().capacity > 0
+       && (!hipsparse_file_touch(filename.c_str(), mtime)
+           || !matrix_cache_read_equal(
+               filename, m, n, nnz, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base)))
+    {
+        status = HIPSPARSE_STATUS_INTERNAL_ERROR;
+    }
+
+    // A changed modification time misses the cache and reads the new values
+    if(status == HIPSPARSE_STATUS_SUCCESS
+       && (!hipsparse_file_touch(filename.c_str(), mtime + 2)
+           || !matrix_cache_read_equal(
+               filename, m, n, nnz, hcsr_row_ptr, hcsr_col_ind, hcsr_val_new, idx_base)))
+    {
+        status = HIPSPARSE_STATUS_INTERNAL_ERROR;
+    }
+
+    remove(filename.c_str());
+
+    return status;
+}
+
+#endif // TESTING_MATRIX_CACHE_HPP
@@ -207,7 +207,7 @@ hipsparseStatus_t testing_nnz(Arguments argus)
     //
     // Initialize a random dense matrix.
     //
-    srand(0);
+    hipsparse_seedrand(0);
     gen_dense_random_sparsity_pattern(M, N, h_A.data(), lda, HIPSPARSE_ORDER_COL, 0.2);
 
     //
@@ -0,0 +1,259 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_PERF_COUNTERS_HPP
+#define TESTING_PERF_COUNTERS_HPP
+
+#include "hipsparse.hpp"
+#include "hipsparse_test_unique_ptr.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <hipsparse.h>
+#include <string>
+
+using namespace hipsparse;
+using namespace hipsparse_test;
+
+#if(!defined(CUDART_VERSION))
+// Calls counted for the routine called name, -1 if it is not listed
+int64_t testing_perf_counters_calls(const hipsparseRoutineCounters_t* routines,
+                                    int                               count,
+                                    const std::string&                name)
+{
+    for(int i = 0; i < count; ++i)
+    {
+        if(routines[i].name != nullptr && name == routines[i].name)
+        {
+            return static_cast<int64_t>(routines[i].calls);
+        }
+    }
+
+    return -1;
+}
+#endif
+
+void testing_perf_counters_bad_arg(void)
+{
+#if(!defined(CUDART_VERSION))
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    hipsparsePerfCounters_t    counters;
+    hipsparseRoutineCounters_t routines[4];
+    int                        count = 4;
+
+    // testing for(nullptr == handle)
+    {
+        hipsparseHandle_t handle_null = nullptr;
+
+        verify_hipsparse_status(hipsparseGetPerfCounters(handle_null, &counters, routines, &count),
+                                HIPSPARSE_STATUS_NOT_INITIALIZED,
+                                "Error: handle is nullptr");
+        verify_hipsparse_status(hipsparseResetPerfCounters(handle_null),
+                                HIPSPARSE_STATUS_NOT_INITIALIZED,
+                                "Error: handle is nullptr");
+    }
+
+    // testing for(nullptr == routineCount)
+    {
+        int* count_null = nullptr;
+
+        verify_hipsparse_status_invalid_pointer(
+            hipsparseGetPerfCounters(handle, &counters, routines, count_null),
+            "Error: routineCount is nullptr");
+    }
+
+    // All outputs are optional
+    {
+        verify_hipsparse_status_success(hipsparseGetPerfCounters(handle, nullptr, nullptr, nullptr),
+                                        "Error: no outputs requested");
+    }
+#endif
+}
+
+template <typename T>
+hipsparseStatus_t testing_perf_counters(Arguments argus)
+{
+#if(!defined(CUDART_VERSION))
+    int                  N        = argus.N;
+    int                  nnz      = argus.nnz;
+    hipsparseIndexBase_t idx_base = argus.idx_base;
+
+    std::unique_ptr<handle_struct> test_handle(new handle_struct);
+    hipsparseHandle_t              handle = test_handle->handle;
+
+    std::vector<int> hx_ind(nnz);
+    std::vector<T>   hx_val(nnz);
+    std::vector<T>   hy(N);
+
+    hipsparse_seedrand(12345ULL);
+    hipsparseInitIndex(hx_ind.data(), nnz, 1, N);
+    hipsparseInit<T>(hx_val, 1, nnz);
+    hipsparseInit<T>(hy, 1, N);
+
+    for(int i = 0; i < nnz; ++i)
+    {
+        hx_ind[i] = hx_ind[i] - 1 + idx_base;
+    }
+
+    auto dx_ind_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * nnz), device_free};
+    auto dx_val_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dy_managed     = hipsparse_unique_ptr{device_malloc(sizeof(T) * N), device_free};
+
+    int* dx_ind = (int*)dx_ind_managed.get();
+    T*   dx_val = (T*)dx_val_managed.get();
+    T*   dy     = (T*)dy_managed.get();
+
+    CHECK_HIP_ERROR(hipMemcpy(dx_ind, hx_ind.data(), sizeof(int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx_val, hx_val.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy, hy.data(), sizeof(T) * N, hipMemcpyHostToDevice));
+
+    // Blocking mode and host results, such that every doti synchronizes once. The calls
+    // setting this up are counted as well, so the counters are reset afterwards.
+    CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+    CHECK_HIPSPARSE_ERROR(hipsparseSetSyncMode(handle, HIPSPARSE_SYNC_MODE_BLOCKING));
+    CHECK_HIPSPARSE_ERROR(hipsparseResetPerfCounters(handle));
+
+    hipsparsePerfCounters_t    counters;
+    hipsparseRoutineCounters_t routines[8];
+    int                        count;
+
+    CHECK_HIPSPARSE_ERROR(hipsparseGetPerfCounters(handle, &counters, nullptr, &count));
+
+    int64_t counters_gold[5] = {0, 0, 0, 0, 0};
+    int64_t counters_hip[5]  = {static_cast<int64_t>(counters.calls),
+                               static_cast<int64_t>(counters.timeNs),
+                               static_cast<int64_t>(counters.workspaceBytes),
+                               static_cast<int64_t>(counters.workspaceAllocations),
+                               static_cast<int64_t>(counters.synchronizations)};
+
+    int count_gold = 0;
+    unit_check_general(1, 1, 1, &count_gold, &count);
+    unit_check_general(1, 5, 1, counters_gold, counters_hip);
+
+    // doti queries the stream through hipsparseGetStream, which is not counted as it is
+    // not called by the application
+    T h_alpha = make_DataType<T>(2.0);
+    T h_result;
+
+    for(int i = 0; i < 3; ++i)
+    {
+        CHECK_HIPSPARSE_ERROR(hipsparseXaxpyi(handle, nnz, &h_alpha, dx_val, dx_ind, dy, idx_base));
+    }
+
+    for(int i = 0; i < 2; ++i)
+    {
+        CHECK_HIPSPARSE_ERROR(hipsparseXdoti(handle, nnz, dx_val, dx_ind, dy, &h_result, idx_base));
+    }
+
+    // The first reservation of a handle allocates one page
+    CHECK_HIPSPARSE_ERROR(hipsparseReserveWorkspace(handle, 1));
+
+    // Without a routine array, the number of routines called is returned
+    CHECK_HIPSPARSE_ERROR(hipsparseGetPerfCounters(handle, nullptr, nullptr, &count));
+
+    count_gold = 3;
+    unit_check_general(1, 1, 1, &count_gold, &count);
+
+    count = 8;
+    CHECK_HIPSPARSE_ERROR(hipsparseGetPerfCounters(handle, &counters, routines, &count));
+
+    unit_check_general(1, 1, 1, &count_gold, &count);
+
+    std::string precision = (sizeof(T) == sizeof(float)) ? "S" : "D";
+
+    int64_t calls_gold[4] = {3, 2, 1, -1};
+    int64_t calls_hip[4]
+        = {testing_perf_counters_calls(routines, count, "hipsparse" + precision + "axpyi"),
+           testing_perf_counters_calls(routines, count, "hipsparse" + precision + "doti"),
+           testing_perf_counters_calls(routines, count, "hipsparseReserveWorkspace"),
+           testing_perf_counters_calls(routines, count, "hipsparseGetStream")};
+
+    unit_check_general(1, 4, 1, calls_gold, calls_hip);
+
+    // The totals are the sums over all routines
+    uint64_t time_ns = 0;
+    for(int i = 0; i < count; ++i)
+    {
+        time_ns += routines[i].timeNs;
+    }
+
+    counters_gold[0] = 6;
+    counters_gold[1] = static_cast<int64_t>(time_ns);
+    counters_gold[2] = 4096;
+    counters_gold[3] = 1;
+    counters_gold[4] = 2;
+
+    counters_hip[0] = static_cast<int64_t>(counters.calls);
+    counters_hip[1] = static_cast<int64_t>(counters.timeNs);
+    counters_hip[2] = static_cast<int64_t>(counters.workspaceBytes);
+    counters_hip[3] = static_cast<int64_t>(counters.workspaceAllocations);
+    counters_hip[4] = static_cast<int64_t>(counters.synchronizations);
+
+    unit_check_general(1, 5, 1, counters_gold, counters_hip);
+
+    // Routines beyond the capacity of the array are dropped
+    for(int i = 0; i < 8; ++i)
+    {
+        routines[i].name = nullptr;
+    }
+
+    count = 1;
+    CHECK_HIPSPARSE_ERROR(hipsparseGetPerfCounters(handle, nullptr, routines, &count));
+
+    count_gold = 1;
+    unit_check_general(1, 1, 1, &count_gold, &count);
+
+    int written_gold[2] = {1, 0};
+    int written_hip[2]  = {routines[0].name != nullptr, routines[1].name != nullptr};
+    unit_check_general(1, 2, 1, written_gold, written_hip);
+
+    // Resetting clears all counters
+    CHECK_HIPSPARSE_ERROR(hipsparseResetPerfCounters(handle));
+
+    count = 8;
+    CHECK_HIPSPARSE_ERROR(hipsparseGetPerfCounters(handle, &counters, routines, &count));
+
+    counters_gold[0] = 0;
+    counters_gold[1] = 0;
+    counters_gold[2] = 0;
+    counters_gold[3] = 0;
+    counters_gold[4] = 0;
+
+    counters_hip[0] = static_cast<int64_t>(counters.calls);
+    counters_hip[1] = static_cast<int64_t>(counters.timeNs);
+    counters_hip[2] = static_cast<int64_t>(counters.workspaceBytes);
+    counters_hip[3] = static_cast<int64_t>(counters.workspaceAllocations);
+    counters_hip[4] = static_cast<int64_t>(counters.synchronizations);
+
+    count_gold = 0;
+    unit_check_general(1, 1, 1, &count_gold, &count);
+    unit_check_general(1, 5, 1, counters_gold, counters_hip);
+#endif
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+#endif // TESTING_PERF_COUNTERS_HPP
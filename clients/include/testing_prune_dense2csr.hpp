@@ -299,7 +299,7 @@ hipsparseStatus_t testing_prune_dense2csr(Arguments argus)
     }
 
     // Initialize a random dense matrix.
-    srand(0);
+    hipsparse_seedrand(0);
     gen_dense_random_sparsity_pattern(M, N, h_A.data(), LDA, HIPSPARSE_ORDER_COL, 0.2);
 
     // Transfer.
@@ -110,7 +110,7 @@ hipsparseStatus_t testing_roti(Arguments argus)
     std::vector<T>   hy_gold(N);
 
     // Initial Data on CPU
-    srand(12345ULL);
+    hipsparse_seedrand(12345ULL);
     hipsparseInitIndex(hx_ind.data(), nnz, 1, N);
     hipsparseInit<T>(hx_val_1, 1, nnz);
     hipsparseInit<T>(hy_1, 1, N);
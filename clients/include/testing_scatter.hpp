@@ -105,7 +105,7 @@ hipsparseStatus_t testing_scatter(Arguments argus)
     std::vector<T> hy_gold(size);
 
     // Initial Data on CPU
-    srand(12345ULL);
+    hipsparse_seedrand(12345ULL);
     hipsparseInitIndex(hx_ind.data(), nnz, 1, size);
     hipsparseInit<T>(hx_val, 1, nnz);
     hipsparseInit<T>(hy, 1, size);
@@ -95,7 +95,7 @@ hipsparseStatus_t testing_sctr(Arguments argus)
     std::vector<T>   hy_gold(N);
 
     // Initial Data on CPU
-    srand(12345ULL);
+    hipsparse_seedrand(12345ULL);
     hipsparseInitIndex(hx_ind.data(), nnz, 1, N);
     hipsparseInit<T>(hx_val, 1, nnz);
     hipsparseInit<T>(hy, 1, N);
@@ -218,18 +218,24 @@ hipsparseStatus_t testing_sddmm_coo(Arguments argus)
     std::vector<T> hcsr_val;
 
     // Initial Data on CPU
-    srand(12345ULL);
+    hipsparse_seedrand(12345ULL);
 
     // Read or construct CSR matrix
     I nnz = 0;
-    if(!generate_csr_matrix(filename, m, n, nnz, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base))
+    if(!generate_csr_matrix(argus, m, n, nnz, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base))
     {
         fprintf(stderr, "Cannot open [read] %s\ncol", filename.c_str());
         return HIPSPARSE_STATUS_INTERNAL_ERROR;
     }
 
-    I lda = m;
-    I ldb = k;
+    // Dimensions of A and B as stored
+    I A_m = (transA == HIPSPARSE_OPERATION_NON_TRANSPOSE) ? m : k;
+    I A_n = (transA == HIPSPARSE_OPERATION_NON_TRANSPOSE) ? k : m;
+    I B_m = (transB == HIPSPARSE_OPERATION_NON_TRANSPOSE) ? k : n;
+    I B_n = (transB == HIPSPARSE_OPERATION_NON_TRANSPOSE) ? n : k;
+
+    I lda = (order == HIPSPARSE_ORDER_COL) ? A_m : A_n;
+    I ldb = (order == HIPSPARSE_ORDER_COL) ? B_m : B_n;
 
     std::vector<I> hrow_ind(nnz);
     // Convert to COO
@@ -290,8 +296,8 @@ hipsparseStatus_t testing_sddmm_coo(Arguments argus)
 
     // Create dense matrices
     hipsparseDnMatDescr_t A, B;
-    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnMat(&A, m, k, lda, dA, typeT, order));
-    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnMat(&B, k, n, ldb, dB, typeT, order));
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnMat(&A, A_m, A_n, lda, dA, typeT, order));
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnMat(&B, B_m, B_n, ldb, dB, typeT, order));
 
     // Query SDDMM buffer
     size_t bufferSize;
@@ -320,24 +326,25 @@ hipsparseStatus_t testing_sddmm_coo(Arguments argus)
     CHECK_HIP_ERROR(hipMemcpy(hval2.data(), dval2, sizeof(T) * nnz, hipMemcpyDeviceToHost));
 
     // CPU
-    const I incx = lda;
-    const I incy = 1;
-
-    for(I i = 0; i < m; ++i)
-    {
-        for(I at = hcsr_row_ptr[i] - idx_base; at < hcsr_row_ptr[i + 1] - idx_base; ++at)
-        {
-            I        j   = hcsr_col_ind[at] - idx_base;
-            const T* x   = &hA[i];
-            const T* y   = &hB[ldb * j];
-            T        sum = make_DataType<T>(0.0);
-            for(I k_ = 0; k_ < k; ++k_)
-            {
-                sum = testing_fma(x[incx * k_], y[incy * k_], sum);
-            }
-            hcsr_val[at] = testing_mult(hcsr_val[at], h_beta) + testing_mult(h_alpha, sum);
-        }
-    }
+    host_sddmm(transA,
+               transB,
+               order,
+               order,
+               m,
+               n,
+               k,
+               nnz,
+               h_alpha,
+               hA.data(),
+               lda,
+               hB.data(),
+               ldb,
+               h_beta,
+               hrow_ind.data(),
+               hcsr_col_ind.data(),
+               1,
+               hcsr_val.data(),
+               idx_base);
 
     unit_check_near(1, nnz, 1, hval1.data(), hcsr_val.data());
     unit_check_near(1, nnz, 1, hval2.data(), hcsr_val.data());
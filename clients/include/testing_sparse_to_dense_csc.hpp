@@ -156,10 +156,10 @@ hipsparseStatus_t testing_sparse_to_dense_csc(Arguments argus)
     std::vector<T> hcsr_val;
 
     // Initial Data on CPU
-    srand(12345ULL);
+    hipsparse_seedrand(12345ULL);
 
     I nnz;
-    if(!generate_csr_matrix(filename, m, n, nnz, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base))
+    if(!generate_csr_matrix(argus, m, n, nnz, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base))
     {
         fprintf(stderr, "Cannot open [read] %s\ncol", filename.c_str());
         return HIPSPARSE_STATUS_INTERNAL_ERROR;
@@ -171,44 +171,21 @@ hipsparseStatus_t testing_sparse_to_dense_csc(Arguments argus)
     I ncols = (order == HIPSPARSE_ORDER_COL) ? n : ld;
 
     // Convert CSR matrix to CSC
-    std::vector<I> hcsc_col_ptr(n + 1);
-    std::vector<J> hcsc_row_ind(nnz);
-    std::vector<T> hcsc_val(nnz);
-
-    // Determine nnz per column
-    for(I i = 0; i < nnz; ++i)
-    {
-        ++hcsc_col_ptr[hcsr_col_ind[i] + 1 - idx_base];
-    }
-
-    // Scan
-    for(J i = 0; i < n; ++i)
-    {
-        hcsc_col_ptr[i + 1] += hcsc_col_ptr[i];
-    }
-
-    // Fill row indices and values
-    for(J i = 0; i < m; ++i)
-    {
-        for(I j = hcsr_row_ptr[i]; j < hcsr_row_ptr[i + 1]; ++j)
-        {
-            J col = hcsr_col_ind[j - idx_base] - idx_base;
-            I idx = hcsc_col_ptr[col];
-
-            hcsc_row_ind[idx] = i + idx_base;
-            hcsc_val[idx]     = hcsr_val[j - idx_base];
-
-            ++hcsc_col_ptr[col];
-        }
-    }
-
-    // Shift column pointer array
-    for(J i = n; i > 0; --i)
-    {
-        hcsc_col_ptr[i] = hcsc_col_ptr[i - 1] + idx_base;
-    }
-
-    hcsc_col_ptr[0] = idx_base;
+    std::vector<I> hcsc_col_ptr;
+    std::vector<J> hcsc_row_ind;
+    std::vector<T> hcsc_val;
+
+    host_csr_to_csc(m,
+                    n,
+                    nnz,
+                    hcsr_row_ptr.data(),
+                    hcsr_col_ind.data(),
+                    hcsr_val.data(),
+                    hcsc_row_ind,
+                    hcsc_col_ptr,
+                    hcsc_val,
+                    HIPSPARSE_ACTION_NUMERIC,
+                    idx_base);
 
     // allocate memory on device
     auto dptr_managed = hipsparse_unique_ptr{device_malloc(sizeof(I) * (n + 1)), device_free};
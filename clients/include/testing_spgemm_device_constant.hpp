@@ -0,0 +1,515 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_SPGEMM_DEVICE_CONSTANT_HPP
+#define TESTING_SPGEMM_DEVICE_CONSTANT_HPP
+
+#include "hipsparse_test_unique_ptr.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <hipsparse.h>
+#include <string>
+
+using namespace hipsparse_test;
+
+// Bytes taken by an array of count entries in the SpGEMM external buffers, which pad each
+// array to 256 bytes
+inline size_t spgemm_device_constant_bytes(size_t size, int64_t count)
+{
+    return ((size * count - 1) / 256 + 1) * 256;
+}
+
+// Copies C back to the host and checks it against the host product
+template <typename I, typename J, typename T>
+void spgemm_device_constant_check(J               m,
+                                  int64_t         nnz_C,
+                                  const I*        dcsr_row_ptr_C,
+                                  const J*        dcsr_col_ind_C,
+                                  const T*        dcsr_val_C,
+                                  std::vector<I>& hcsr_row_ptr_C_gold,
+                                  std::vector<J>& hcsr_col_ind_C_gold,
+                                  std::vector<T>& hcsr_val_C_gold)
+{
+    int64_t nnz_C_gold = hcsr_col_ind_C_gold.size();
+    unit_check_general(1, 1, 1, &nnz_C_gold, &nnz_C);
+
+    std::vector<I> hcsr_row_ptr_C(m + 1);
+    std::vector<J> hcsr_col_ind_C(nnz_C);
+    std::vector<T> hcsr_val_C(nnz_C);
+
+    CHECK_HIP_ERROR(hipMemcpy(
+        hcsr_row_ptr_C.data(), dcsr_row_ptr_C, sizeof(I) * (m + 1), hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(
+        hipMemcpy(hcsr_col_ind_C.data(), dcsr_col_ind_C, sizeof(J) * nnz_C, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(
+        hipMemcpy(hcsr_val_C.data(), dcsr_val_C, sizeof(T) * nnz_C, hipMemcpyDeviceToHost));
+
+    unit_check_general(1, m + 1, 1, hcsr_row_ptr_C_gold.data(), hcsr_row_ptr_C.data());
+    unit_check_general(1, nnz_C, 1, hcsr_col_ind_C_gold.data(), hcsr_col_ind_C.data());
+    unit_check_general(1, nnz_C, 1, hcsr_val_C_gold.data(), hcsr_val_C.data());
+}
+
+// Runs SpGEMM and SpGEMMreuse on a new handle in the given pointer mode, with external
+// buffers of exactly the queried sizes. In device pointer mode the scalar 1 used to copy
+// C out of the buffers comes from the device constants of the handle, such that the
+// buffers hold nothing but the arrays of C.
+template <typename I, typename J, typename T>
+hipsparseStatus_t spgemm_device_constant_run(hipsparsePointerMode_t mode,
+                                             J                      m,
+                                             J                      n,
+                                             const T*               alpha,
+                                             const T*               beta,
+                                             hipsparseSpMatDescr_t  A,
+                                             hipsparseSpMatDescr_t  B,
+                                             std::vector<I>&        hcsr_row_ptr_C_gold,
+                                             std::vector<J>&        hcsr_col_ind_C_gold,
+                                             std::vector<T>&        hcsr_val_C_gold)
+{
+    hipsparseOperation_t transA   = HIPSPARSE_OPERATION_NON_TRANSPOSE;
+    hipsparseOperation_t transB   = HIPSPARSE_OPERATION_NON_TRANSPOSE;
+    hipsparseIndexBase_t idxBaseC = HIPSPARSE_INDEX_BASE_ZERO;
+    hipsparseSpGEMMAlg_t alg      = HIPSPARSE_SPGEMM_DEFAULT;
+
+    hipsparseIndexType_t typeI = getIndexType<I>();
+    hipsparseIndexType_t typeJ = getIndexType<J>();
+    hipDataType          typeT = getDataType<T>();
+
+    // New handle, such that its device constants are set up by this run
+    std::unique_ptr<handle_struct> test_handle(new handle_struct);
+    hipsparseHandle_t              handle = test_handle->handle;
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, mode));
+
+    // SpGEMM
+    {
+        std::unique_ptr<spgemm_struct> unique_ptr_descr(new spgemm_struct);
+        hipsparseSpGEMMDescr_t         descr = unique_ptr_descr->descr;
+
+        auto dcsr_row_ptr_C_managed
+            = hipsparse_unique_ptr{device_malloc(sizeof(I) * (m + 1)), device_free};
+        I* dcsr_row_ptr_C = (I*)dcsr_row_ptr_C_managed.get();
+
+        hipsparseSpMatDescr_t C;
+        CHECK_HIPSPARSE_ERROR(hipsparseCreateCsr(
+            &C, m, n, 0, dcsr_row_ptr_C, nullptr, nullptr, typeI, typeJ, idxBaseC, typeT));
+
+        size_t bufferSize1;
+        CHECK_HIPSPARSE_ERROR(hipsparseSpGEMM_workEstimation(handle,
+                                                             transA,
+                                                             transB,
+                                                             alpha,
+                                                             A,
+                                                             B,
+                                                             beta,
+                                                             C,
+                                                             typeT,
+                                                             alg,
+                                                             descr,
+                                                             &bufferSize1,
+                                                             nullptr));
+
+        auto externalBuffer1_managed
+            = hipsparse_unique_ptr{device_malloc(bufferSize1), device_free};
+        void* externalBuffer1 = (void*)externalBuffer1_managed.get();
+
+        CHECK_HIPSPARSE_ERROR(hipsparseSpGEMM_workEstimation(handle,
+                                                             transA,
+                                                             transB,
+                                                             alpha,
+                                                             A,
+                                                             B,
+                                                             beta,
+                                                             C,
+                                                             typeT,
+                                                             alg,
+                                                             descr,
+                                                             &bufferSize1,
+                                                             externalBuffer1));
+
+        int64_t rows_C, cols_C, nnz_C;
+        CHECK_HIPSPARSE_ERROR(hipsparseSpMatGetSize(C, &rows_C, &cols_C, &nnz_C));
+
+        size_t bufferSize2;
+        CHECK_HIPSPARSE_ERROR(hipsparseSpGEMM_compute(handle,
+                                                      transA,
+                                                      transB,
+                                                      alpha,
+                                                      A,
+                                                      B,
+                                                      beta,
+                                                      C,
+                                                      typeT,
+                                                      alg,
+                                                      descr,
+                                                      &bufferSize2,
+                                                      nullptr));
+
+        // Column indices and values of C, and the gather indices of the copy
+        size_t bufferSize2_expected = 2 * spgemm_device_constant_bytes(sizeof(J), nnz_C)
+                                      + spgemm_device_constant_bytes(sizeof(T), nnz_C);
+        unit_check_general(1, 1, 1, &bufferSize2_expected, &bufferSize2);
+
+        auto externalBuffer2_managed
+            = hipsparse_unique_ptr{device_malloc(bufferSize2), device_free};
+        void* externalBuffer2 = (void*)externalBuffer2_managed.get();
+
+        CHECK_HIPSPARSE_ERROR(hipsparseSpGEMM_compute(handle,
+                                                      transA,
+                                                      transB,
+                                                      alpha,
+                                                      A,
+                                                      B,
+                                                      beta,
+                                                      C,
+                                                      typeT,
+                                                      alg,
+                                                      descr,
+                                                      &bufferSize2,
+                                                      externalBuffer2));
+
+        auto dcsr_col_ind_C_managed
+            = hipsparse_unique_ptr{device_malloc(sizeof(J) * nnz_C), device_free};
+        auto dcsr_val_C_managed
+            = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz_C), device_free};
+
+        J* dcsr_col_ind_C = (J*)dcsr_col_ind_C_managed.get();
+        T* dcsr_val_C     = (T*)dcsr_val_C_managed.get();
+
+        CHECK_HIP_ERROR(hipMemset(dcsr_val_C, 0, sizeof(T) * nnz_C));
+        CHECK_HIPSPARSE_ERROR(
+            hipsparseCsrSetPointers(C, dcsr_row_ptr_C, dcsr_col_ind_C, dcsr_val_C));
+
+        CHECK_HIPSPARSE_ERROR(
+            hipsparseSpGEMM_copy(handle, transA, transB, alpha, A, B, beta, C, typeT, alg, descr));
+
+        spgemm_device_constant_check(m,
+                                     nnz_C,
+                                     dcsr_row_ptr_C,
+                                     dcsr_col_ind_C,
+                                     dcsr_val_C,
+                                     hcsr_row_ptr_C_gold,
+                                     hcsr_col_ind_C_gold,
+                                     hcsr_val_C_gold);
+
+        CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(C));
+    }
+
+    // SpGEMMreuse
+    {
+        std::unique_ptr<spgemm_struct> unique_ptr_descr(new spgemm_struct);
+        hipsparseSpGEMMDescr_t         descr = unique_ptr_descr->descr;
+
+        auto dcsr_row_ptr_C_managed
+            = hipsparse_unique_ptr{device_malloc(sizeof(I) * (m + 1)), device_free};
+        I* dcsr_row_ptr_C = (I*)dcsr_row_ptr_C_managed.get();
+
+        hipsparseSpMatDescr_t C;
+        CHECK_HIPSPARSE_ERROR(hipsparseCreateCsr(
+            &C, m, n, 0, dcsr_row_ptr_C, nullptr, nullptr, typeI, typeJ, idxBaseC, typeT));
+
+        size_t bufferSize1;
+        CHECK_HIPSPARSE_ERROR(hipsparseSpGEMMreuse_workEstimation(
+            handle, transA, transB, A, B, C, alg, descr, &bufferSize1, nullptr));
+
+        auto externalBuffer1_managed
+            = hipsparse_unique_ptr{device_malloc(bufferSize1), device_free};
+        void* externalBuffer1 = (void*)externalBuffer1_managed.get();
+
+        CHECK_HIPSPARSE_ERROR(hipsparseSpGEMMreuse_workEstimation(
+            handle, transA, transB, A, B, C, alg, descr, &bufferSize1, externalBuffer1));
+
+        size_t bufferSize2, bufferSize3, bufferSize4;
+        CHECK_HIPSPARSE_ERROR(hipsparseSpGEMMreuse_nnz(handle,
+                                                       transA,
+                                                       transB,
+                                                       A,
+                                                       B,
+                                                       C,
+                                                       alg,
+                                                       descr,
+                                                       &bufferSize2,
+                                                       nullptr,
+                                                       &bufferSize3,
+                                                       nullptr,
+                                                       &bufferSize4,
+                                                       nullptr));
+
+        auto externalBuffer2_managed
+            = hipsparse_unique_ptr{device_malloc(bufferSize2), device_free};
+        auto externalBuffer3_managed
+            = hipsparse_unique_ptr{device_malloc(bufferSize3), device_free};
+        auto externalBuffer4_managed
+            = hipsparse_unique_ptr{device_malloc(bufferSize4), device_free};
+
+        void* externalBuffer2 = (void*)externalBuffer2_managed.get();
+        void* externalBuffer3 = (void*)externalBuffer3_managed.get();
+        void* externalBuffer4 = (void*)externalBuffer4_managed.get();
+
+        CHECK_HIPSPARSE_ERROR(hipsparseSpGEMMreuse_nnz(handle,
+                                                       transA,
+                                                       transB,
+                                                       A,
+                                                       B,
+                                                       C,
+                                                       alg,
+                                                       descr,
+                                                       &bufferSize2,
+                                                       externalBuffer2,
+                                                       &bufferSize3,
+                                                       externalBuffer3,
+                                                       &bufferSize4,
+                                                       externalBuffer4));
+
+        int64_t rows_C, cols_C, nnz_C;
+        CHECK_HIPSPARSE_ERROR(hipsparseSpMatGetSize(C, &rows_C, &cols_C, &nnz_C));
+
+        auto dcsr_col_ind_C_managed
+            = hipsparse_unique_ptr{device_malloc(sizeof(J) * nnz_C), device_free};
+        auto dcsr_val_C_managed
+            = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz_C), device_free};
+
+        J* dcsr_col_ind_C = (J*)dcsr_col_ind_C_managed.get();
+        T* dcsr_val_C     = (T*)dcsr_val_C_managed.get();
+
+        CHECK_HIP_ERROR(hipMemset(dcsr_val_C, 0, sizeof(T) * nnz_C));
+        CHECK_HIPSPARSE_ERROR(
+            hipsparseCsrSetPointers(C, dcsr_row_ptr_C, dcsr_col_ind_C, dcsr_val_C));
+
+        size_t bufferSize5;
+        CHECK_HIPSPARSE_ERROR(hipsparseSpGEMMreuse_copy(
+            handle, transA, transB, A, B, C, alg, descr, &bufferSize5, nullptr));
+
+        // Values of C and the gather indices of the compute
+        size_t bufferSize5_expected = spgemm_device_constant_bytes(sizeof(T), nnz_C)
+                                      + spgemm_device_constant_bytes(sizeof(J), nnz_C);
+        unit_check_general(1, 1, 1, &bufferSize5_expected, &bufferSize5);
+
+        auto externalBuffer5_managed
+            = hipsparse_unique_ptr{device_malloc(bufferSize5), device_free};
+        void* externalBuffer5 = (void*)externalBuffer5_managed.get();
+
+        CHECK_HIPSPARSE_ERROR(hipsparseSpGEMMreuse_copy(
+            handle, transA, transB, A, B, C, alg, descr, &bufferSize5, externalBuffer5));
+
+        CHECK_HIPSPARSE_ERROR(hipsparseSpGEMMreuse_compute(
+            handle, transA, transB, alpha, A, B, beta, C, typeT, alg, descr));
+
+        spgemm_device_constant_check(m,
+                                     nnz_C,
+                                     dcsr_row_ptr_C,
+                                     dcsr_col_ind_C,
+                                     dcsr_val_C,
+                                     hcsr_row_ptr_C_gold,
+                                     hcsr_col_ind_C_gold,
+                                     hcsr_val_C_gold);
+
+        CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(C));
+    }
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+template <typename I, typename J, typename T>
+hipsparseStatus_t testing_spgemm_device_constant(Arguments argus)
+{
+    J                    m       = argus.M;
+    J                    k       = argus.K;
+    T                    h_alpha = make_DataType<T>(argus.alpha);
+    T                    h_beta  = make_DataType<T>(0);
+    hipsparseIndexBase_t idxBase = argus.idx_base;
+
+    hipsparseIndexType_t typeI = getIndexType<I>();
+    hipsparseIndexType_t typeJ = getIndexType<J>();
+    hipDataType          typeT = getDataType<T>();
+
+    // Sparse matrix A, and B as the transpose of A
+    std::vector<I> hcsr_row_ptr_A;
+    std::vector<J> hcsr_col_ind_A;
+    std::vector<T> hcsr_val_A;
+
+    hipsparse_seedrand(12345ULL);
+
+    I nnz_A;
+    if(!generate_csr_matrix(
+           std::string(""), m, k, nnz_A, hcsr_row_ptr_A, hcsr_col_ind_A, hcsr_val_A, idxBase))
+    {
+        return HIPSPARSE_STATUS_INTERNAL_ERROR;
+    }
+
+    J n     = m;
+    I nnz_B = nnz_A;
+
+    std::vector<I> hcsr_row_ptr_B(k + 1);
+    std::vector<J> hcsr_col_ind_B(nnz_B);
+    std::vector<T> hcsr_val_B(nnz_B);
+
+    transpose_csr(m,
+                  k,
+                  nnz_A,
+                  hcsr_row_ptr_A.data(),
+                  hcsr_col_ind_A.data(),
+                  hcsr_val_A.data(),
+                  hcsr_row_ptr_B.data(),
+                  hcsr_col_ind_B.data(),
+                  hcsr_val_B.data(),
+                  idxBase,
+                  idxBase);
+
+    // C = alpha * A * B on the host
+    std::vector<I> hcsr_row_ptr_C_gold(m + 1);
+
+    int64_t nnz_C_gold = host_csrgemm2_nnz(m,
+                                           n,
+                                           k,
+                                           &h_alpha,
+                                           hcsr_row_ptr_A.data(),
+                                           hcsr_col_ind_A.data(),
+                                           hcsr_row_ptr_B.data(),
+                                           hcsr_col_ind_B.data(),
+                                           (const T*)nullptr,
+                                           (const I*)nullptr,
+                                           (const J*)nullptr,
+                                           hcsr_row_ptr_C_gold.data(),
+                                           idxBase,
+                                           idxBase,
+                                           HIPSPARSE_INDEX_BASE_ZERO,
+                                           HIPSPARSE_INDEX_BASE_ZERO);
+
+    std::vector<J> hcsr_col_ind_C_gold(nnz_C_gold);
+    std::vector<T> hcsr_val_C_gold(nnz_C_gold);
+
+    host_csrgemm2(m,
+                  n,
+                  k,
+                  &h_alpha,
+                  hcsr_row_ptr_A.data(),
+                  hcsr_col_ind_A.data(),
+                  hcsr_val_A.data(),
+                  hcsr_row_ptr_B.data(),
+                  hcsr_col_ind_B.data(),
+                  hcsr_val_B.data(),
+                  (const T*)nullptr,
+                  (const I*)nullptr,
+                  (const J*)nullptr,
+                  (const T*)nullptr,
+                  hcsr_row_ptr_C_gold.data(),
+                  hcsr_col_ind_C_gold.data(),
+                  hcsr_val_C_gold.data(),
+                  idxBase,
+                  idxBase,
+                  HIPSPARSE_INDEX_BASE_ZERO,
+                  HIPSPARSE_INDEX_BASE_ZERO);
+
+    // allocate memory on device
+    auto dcsr_row_ptr_A_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(I) * (m + 1)), device_free};
+    auto dcsr_col_ind_A_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(J) * nnz_A), device_free};
+    auto dcsr_val_A_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz_A), device_free};
+    auto dcsr_row_ptr_B_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(I) * (k + 1)), device_free};
+    auto dcsr_col_ind_B_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(J) * nnz_B), device_free};
+    auto dcsr_val_B_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz_B), device_free};
+    auto d_alpha_managed    = hipsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
+    auto d_beta_managed     = hipsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
+
+    I* dcsr_row_ptr_A = (I*)dcsr_row_ptr_A_managed.get();
+    J* dcsr_col_ind_A = (J*)dcsr_col_ind_A_managed.get();
+    T* dcsr_val_A     = (T*)dcsr_val_A_managed.get();
+    I* dcsr_row_ptr_B = (I*)dcsr_row_ptr_B_managed.get();
+    J* dcsr_col_ind_B = (J*)dcsr_col_ind_B_managed.get();
+    T* dcsr_val_B     = (T*)dcsr_val_B_managed.get();
+    T* d_alpha        = (T*)d_alpha_managed.get();
+    T* d_beta         = (T*)d_beta_managed.get();
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr_A, hcsr_row_ptr_A.data(), sizeof(I) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_col_ind_A, hcsr_col_ind_A.data(), sizeof(J) * nnz_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_val_A, hcsr_val_A.data(), sizeof(T) * nnz_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr_B, hcsr_row_ptr_B.data(), sizeof(I) * (k + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_col_ind_B, hcsr_col_ind_B.data(), sizeof(J) * nnz_B, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_val_B, hcsr_val_B.data(), sizeof(T) * nnz_B, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+    hipsparseSpMatDescr_t A, B;
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateCsr(&A,
+                                             m,
+                                             k,
+                                             nnz_A,
+                                             dcsr_row_ptr_A,
+                                             dcsr_col_ind_A,
+                                             dcsr_val_A,
+                                             typeI,
+                                             typeJ,
+                                             idxBase,
+                                             typeT));
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateCsr(&B,
+                                             k,
+                                             n,
+                                             nnz_B,
+                                             dcsr_row_ptr_B,
+                                             dcsr_col_ind_B,
+                                             dcsr_val_B,
+                                             typeI,
+                                             typeJ,
+                                             idxBase,
+                                             typeT));
+
+    CHECK_HIPSPARSE_ERROR(spgemm_device_constant_run(HIPSPARSE_POINTER_MODE_HOST,
+                                                     m,
+                                                     n,
+                                                     &h_alpha,
+                                                     &h_beta,
+                                                     A,
+                                                     B,
+                                                     hcsr_row_ptr_C_gold,
+                                                     hcsr_col_ind_C_gold,
+                                                     hcsr_val_C_gold));
+    CHECK_HIPSPARSE_ERROR(spgemm_device_constant_run(HIPSPARSE_POINTER_MODE_DEVICE,
+                                                     m,
+                                                     n,
+                                                     (const T*)d_alpha,
+                                                     (const T*)d_beta,
+                                                     A,
+                                                     B,
+                                                     hcsr_row_ptr_C_gold,
+                                                     hcsr_col_ind_C_gold,
+                                                     hcsr_val_C_gold));
+
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(A));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(B));
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+#endif // TESTING_SPGEMM_DEVICE_CONSTANT_HPP
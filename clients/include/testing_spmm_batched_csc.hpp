@@ -237,7 +237,7 @@ hipsparseStatus_t testing_spmm_batched_csc(Arguments argus)
     std::vector<T> hcsc_val_temp;
 
     // Initial Data on CPU
-    srand(12345ULL);
+    hipsparse_seedrand(12345ULL);
 
     I nnz_A;
     if(!generate_csr_matrix(filename,
@@ -236,10 +236,10 @@ hipsparseStatus_t testing_spmm_batched_csr(Arguments argus)
     std::vector<T> hcsr_val_temp;
 
     // Initial Data on CPU
-    srand(12345ULL);
+    hipsparse_seedrand(12345ULL);
 
     I nnz_A;
-    if(!generate_csr_matrix(filename,
+    if(!generate_csr_matrix(argus,
                             (transA == HIPSPARSE_OPERATION_NON_TRANSPOSE) ? m : k,
                             (transA == HIPSPARSE_OPERATION_NON_TRANSPOSE) ? k : m,
                             nnz_A,
@@ -240,10 +240,10 @@ hipsparseStatus_t testing_spmm_csc(Arguments argus)
     std::vector<T> hcsc_val;
 
     // Initial Data on CPU
-    srand(12345ULL);
+    hipsparse_seedrand(12345ULL);
 
     I nnz_A;
-    if(!generate_csr_matrix(filename,
+    if(!generate_csr_matrix(argus,
                             (transA == HIPSPARSE_OPERATION_NON_TRANSPOSE) ? k : m,
                             (transA == HIPSPARSE_OPERATION_NON_TRANSPOSE) ? m : k,
                             nnz_A,
@@ -187,10 +187,10 @@ hipsparseStatus_t testing_spmv_coo(Arguments argus)
     std::vector<T> hval;
 
     // Initial Data on CPU
-    srand(12345ULL);
+    hipsparse_seedrand(12345ULL);
 
     I nnz;
-    if(!generate_csr_matrix(filename, m, n, nnz, hrow_ptr, hcol_ind, hval, idx_base))
+    if(!generate_csr_matrix(argus, m, n, nnz, hrow_ptr, hcol_ind, hval, idx_base))
     {
         fprintf(stderr, "Cannot open [read] %s\ncol", filename.c_str());
         return HIPSPARSE_STATUS_INTERNAL_ERROR;
@@ -212,10 +212,10 @@ hipsparseStatus_t testing_spmv_csr(Arguments argus)
     std::vector<T> hval;
 
     // Initial Data on CPU
-    srand(12345ULL);
+    hipsparse_seedrand(12345ULL);
 
     I nnz;
-    if(!generate_csr_matrix(filename, m, n, nnz, hcsr_row_ptr, hcol_ind, hval, idx_base))
+    if(!generate_csr_matrix(argus, m, n, nnz, hcsr_row_ptr, hcol_ind, hval, idx_base))
     {
         fprintf(stderr, "Cannot open [read] %s\ncol", filename.c_str());
         return HIPSPARSE_STATUS_INTERNAL_ERROR;
@@ -301,81 +301,36 @@ hipsparseStatus_t testing_spmv_csr(Arguments argus)
     CHECK_HIP_ERROR(hipMemcpy(hy_2.data(), dy_2, sizeof(T) * m, hipMemcpyDeviceToHost));
 
     // Query for warpSize
+    int             dev;
     hipDeviceProp_t prop;
-    hipGetDeviceProperties(&prop, 0);
 
-    int WF_SIZE;
-    I   nnz_per_row = nnz / m;
+    CHECK_HIP_ERROR(hipGetDevice(&dev));
+    CHECK_HIP_ERROR(hipGetDeviceProperties(&prop, dev));
 
-    if(prop.warpSize == 32)
-    {
-        if(nnz_per_row < 4)
-            WF_SIZE = 2;
-        else if(nnz_per_row < 8)
-            WF_SIZE = 4;
-        else if(nnz_per_row < 16)
-            WF_SIZE = 8;
-        else if(nnz_per_row < 32)
-            WF_SIZE = 16;
-        else
-            WF_SIZE = 32;
-    }
-    else if(prop.warpSize == 64)
-    {
-        if(nnz_per_row < 4)
-            WF_SIZE = 2;
-        else if(nnz_per_row < 8)
-            WF_SIZE = 4;
-        else if(nnz_per_row < 16)
-            WF_SIZE = 8;
-        else if(nnz_per_row < 32)
-            WF_SIZE = 16;
-        else if(nnz_per_row < 64)
-            WF_SIZE = 32;
-        else
-            WF_SIZE = 64;
-    }
-    else
+    if(prop.warpSize != 32 && prop.warpSize != 64)
     {
         return HIPSPARSE_STATUS_INTERNAL_ERROR;
     }
 
-    for(J i = 0; i < m; ++i)
-    {
-        std::vector<T> sum(WF_SIZE, make_DataType<T>(0.0));
-
-        for(I j = hcsr_row_ptr[i] - idx_base; j < hcsr_row_ptr[i + 1] - idx_base; j += WF_SIZE)
-        {
-            for(int k = 0; k < WF_SIZE; ++k)
-            {
-                if(j + k < hcsr_row_ptr[i + 1] - idx_base)
-                {
-                    sum[k] = testing_fma(
-                        testing_mult(h_alpha, hval[j + k]), hx[hcol_ind[j + k] - idx_base], sum[k]);
-                }
-            }
-        }
-
-        for(int j = 1; j < WF_SIZE; j <<= 1)
-        {
-            for(int k = 0; k < WF_SIZE - j; ++k)
-            {
-                sum[k] = sum[k] + sum[k + j];
-            }
-        }
-
-        if(h_beta == make_DataType<T>(0.0))
-        {
-            hy_gold[i] = sum[0];
-        }
-        else
-        {
-            hy_gold[i] = testing_fma(h_beta, hy_gold[i], sum[0]);
-        }
-    }
-
-    unit_check_near(1, m, 1, hy_gold.data(), hy_1.data());
-    unit_check_near(1, m, 1, hy_gold.data(), hy_2.data());
+    host_csrmv(transA,
+               m,
+               n,
+               nnz,
+               h_alpha,
+               hcsr_row_ptr.data(),
+               hcol_ind.data(),
+               hval.data(),
+               hx.data(),
+               h_beta,
+               hy_gold.data(),
+               idx_base,
+               prop.warpSize);
+
+    double tol_scale = host_csr_tolerance_scale(
+        m, n, nnz, hcsr_row_ptr.data(), hcol_ind.data(), idx_base);
+
+    unit_check_near(1, m, 1, hy_gold.data(), hy_1.data(), tol_scale);
+    unit_check_near(1, m, 1, hy_gold.data(), hy_2.data(), tol_scale);
 
     CHECK_HIP_ERROR(hipFree(buffer));
     CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(A));
@@ -144,7 +144,7 @@ hipsparseStatus_t testing_spvv(Arguments argus)
     T hresult_C_gold;
 
     // Initial Data on CPU
-    srand(12345ULL);
+    hipsparse_seedrand(12345ULL);
     hipsparseInitIndex(hx_ind.data(), nnz, 1, size);
     hipsparseInit<T>(hx_val, 1, nnz);
     hipsparseInit<T>(hy, 1, size);
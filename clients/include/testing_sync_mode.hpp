@@ -0,0 +1,299 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_SYNC_MODE_HPP
+#define TESTING_SYNC_MODE_HPP
+
+#include "hipsparse.hpp"
+#include "hipsparse_test_unique_ptr.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <hipsparse.h>
+
+using namespace hipsparse;
+using namespace hipsparse_test;
+
+void testing_sync_mode_bad_arg(void)
+{
+#if(!defined(CUDART_VERSION))
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    hipsparseSyncMode_t mode;
+
+    // testing for(nullptr == handle)
+    {
+        hipsparseHandle_t handle_null = nullptr;
+
+        verify_hipsparse_status(hipsparseSetSyncMode(handle_null, HIPSPARSE_SYNC_MODE_ASYNC),
+                                HIPSPARSE_STATUS_NOT_INITIALIZED,
+                                "Error: handle is nullptr");
+        verify_hipsparse_status(hipsparseGetSyncMode(handle_null, &mode),
+                                HIPSPARSE_STATUS_NOT_INITIALIZED,
+                                "Error: handle is nullptr");
+    }
+
+    // testing for(nullptr == mode)
+    {
+        hipsparseSyncMode_t* mode_null = nullptr;
+
+        verify_hipsparse_status_invalid_pointer(hipsparseGetSyncMode(handle, mode_null),
+                                                "Error: mode is nullptr");
+    }
+
+    // testing for invalid modes, which leave the mode unchanged
+    {
+        verify_hipsparse_status_success(hipsparseSetSyncMode(handle, HIPSPARSE_SYNC_MODE_BLOCKING),
+                                        "Error: set blocking mode");
+
+        verify_hipsparse_status_invalid_value(
+            hipsparseSetSyncMode(handle, (hipsparseSyncMode_t)2), "Error: mode is invalid");
+        verify_hipsparse_status_invalid_value(
+            hipsparseSetSyncMode(handle, (hipsparseSyncMode_t)-1), "Error: mode is invalid");
+
+        verify_hipsparse_status_success(hipsparseGetSyncMode(handle, &mode),
+                                        "Error: get mode");
+
+        int mode_gold = HIPSPARSE_SYNC_MODE_BLOCKING;
+        int mode_int  = mode;
+        unit_check_general(1, 1, 1, &mode_gold, &mode_int);
+    }
+#endif
+}
+
+template <typename T>
+hipsparseStatus_t testing_sync_mode(Arguments argus)
+{
+#if(!defined(CUDART_VERSION))
+    int                  m        = argus.M;
+    int                  nnz_x    = argus.nnz;
+    hipsparseIndexBase_t idx_base = argus.idx_base;
+
+    std::unique_ptr<handle_struct> test_handle(new handle_struct);
+    hipsparseHandle_t              handle = test_handle->handle;
+
+    std::unique_ptr<descr_struct> test_descr(new descr_struct);
+    hipsparseMatDescr_t           descr = test_descr->descr;
+
+    std::unique_ptr<csrsv2_struct> unique_ptr_csrsv2_info(new csrsv2_struct);
+    csrsv2Info_t                   info = unique_ptr_csrsv2_info->info;
+
+    // New handles start in the mode selected by HIPSPARSE_SYNC_MODE
+    const char* env = getenv("HIPSPARSE_SYNC_MODE");
+
+    int mode_gold = (env != nullptr && std::string(env) == "async") ? HIPSPARSE_SYNC_MODE_ASYNC
+                                                                     : HIPSPARSE_SYNC_MODE_BLOCKING;
+
+    hipsparseSyncMode_t mode;
+    CHECK_HIPSPARSE_ERROR(hipsparseGetSyncMode(handle, &mode));
+
+    int mode_int = mode;
+    unit_check_general(1, 1, 1, &mode_gold, &mode_int);
+
+    // Switch to asynchronous mode on a stream of its own
+    CHECK_HIPSPARSE_ERROR(hipsparseSetSyncMode(handle, HIPSPARSE_SYNC_MODE_ASYNC));
+    CHECK_HIPSPARSE_ERROR(hipsparseGetSyncMode(handle, &mode));
+
+    mode_gold = HIPSPARSE_SYNC_MODE_ASYNC;
+    mode_int  = mode;
+    unit_check_general(1, 1, 1, &mode_gold, &mode_int);
+
+    hipStream_t stream;
+    CHECK_HIP_ERROR(hipStreamCreate(&stream));
+    CHECK_HIPSPARSE_ERROR(hipsparseSetStream(handle, stream));
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSetMatIndexBase(descr, idx_base));
+    CHECK_HIPSPARSE_ERROR(hipsparseSetMatDiagType(descr, HIPSPARSE_DIAG_TYPE_UNIT));
+    CHECK_HIPSPARSE_ERROR(hipsparseSetMatFillMode(descr, HIPSPARSE_FILL_MODE_LOWER));
+
+    hipsparse_seedrand(12345ULL);
+
+    // Host structures
+    std::vector<int> hcsr_row_ptr;
+    std::vector<int> hcsr_col_ind;
+    std::vector<T>   hcsr_val;
+
+    int nnz = 0;
+    generate_csr_matrix(
+        std::string(""), m, m, nnz, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base);
+
+    std::vector<int> hx_ind(nnz_x);
+    std::vector<T>   hx_val(nnz_x);
+    std::vector<T>   hx(m);
+    std::vector<T>   hy(m);
+    std::vector<T>   hy_gold(m);
+
+    hipsparseInitIndex(hx_ind.data(), nnz_x, 1, m);
+    hipsparseInit<T>(hx_val, 1, nnz_x);
+    hipsparseInit<T>(hx, 1, m);
+
+    for(int i = 0; i < nnz_x; ++i)
+    {
+        hx_ind[i] = hx_ind[i] - 1 + idx_base;
+    }
+
+    T h_alpha = make_DataType<T>(1.0);
+
+    // Allocate memory on device
+    auto dptr_managed    = hipsparse_unique_ptr{device_malloc(sizeof(int) * (m + 1)), device_free};
+    auto dcol_managed    = hipsparse_unique_ptr{device_malloc(sizeof(int) * nnz), device_free};
+    auto dval_managed    = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dx_ind_managed  = hipsparse_unique_ptr{device_malloc(sizeof(int) * nnz_x), device_free};
+    auto dx_val_managed  = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz_x), device_free};
+    auto dx_managed      = hipsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto dy_managed      = hipsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto d_alpha_managed = hipsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
+    auto d_result_managed   = hipsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
+    auto d_position_managed = hipsparse_unique_ptr{device_malloc(sizeof(int)), device_free};
+
+    int* dptr       = (int*)dptr_managed.get();
+    int* dcol       = (int*)dcol_managed.get();
+    T*   dval       = (T*)dval_managed.get();
+    int* dx_ind     = (int*)dx_ind_managed.get();
+    T*   dx_val     = (T*)dx_val_managed.get();
+    T*   dx         = (T*)dx_managed.get();
+    T*   dy         = (T*)dy_managed.get();
+    T*   d_alpha    = (T*)d_alpha_managed.get();
+    T*   d_result   = (T*)d_result_managed.get();
+    int* d_position = (int*)d_position_managed.get();
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(
+        hipMemcpy(dptr, hcsr_row_ptr.data(), sizeof(int) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcol, hcsr_col_ind.data(), sizeof(int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval, hcsr_val.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx_ind, hx_ind.data(), sizeof(int) * nnz_x, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx_val, hx_val.data(), sizeof(T) * nnz_x, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+
+    // Host doti
+    T hresult_gold = make_DataType<T>(0.0);
+    for(int i = 0; i < nnz_x; ++i)
+    {
+        hresult_gold = hresult_gold + testing_mult(hx[hx_ind[i] - idx_base], hx_val[i]);
+    }
+
+    // Results written through host pointers are complete on return, even in asynchronous mode
+    T hresult_1;
+    CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+    CHECK_HIPSPARSE_ERROR(hipsparseXdoti(handle, nnz_x, dx_val, dx_ind, dx, &hresult_1, idx_base));
+
+    unit_check_general(1, 1, 1, &hresult_gold, &hresult_1);
+
+    // Device results are ordered on the stream only
+    CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_DEVICE));
+    CHECK_HIPSPARSE_ERROR(hipsparseXdoti(handle, nnz_x, dx_val, dx_ind, dx, d_result, idx_base));
+
+    // csrsv2 analysis, solve and pivot query, without blocking the host
+    int bufferSize;
+    CHECK_HIPSPARSE_ERROR(hipsparseXcsrsv2_bufferSize(handle,
+                                                      HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                                                      m,
+                                                      nnz,
+                                                      descr,
+                                                      dval,
+                                                      dptr,
+                                                      dcol,
+                                                      info,
+                                                      &bufferSize));
+
+    auto dbuffer_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(char) * bufferSize), device_free};
+
+    void* dbuffer = (void*)dbuffer_managed.get();
+
+    CHECK_HIPSPARSE_ERROR(hipsparseXcsrsv2_analysis(handle,
+                                                    HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                                                    m,
+                                                    nnz,
+                                                    descr,
+                                                    dval,
+                                                    dptr,
+                                                    dcol,
+                                                    info,
+                                                    HIPSPARSE_SOLVE_POLICY_USE_LEVEL,
+                                                    dbuffer));
+    CHECK_HIPSPARSE_ERROR(hipsparseXcsrsv2_solve(handle,
+                                                 HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                                                 m,
+                                                 nnz,
+                                                 d_alpha,
+                                                 descr,
+                                                 dval,
+                                                 dptr,
+                                                 dcol,
+                                                 info,
+                                                 dx,
+                                                 dy,
+                                                 HIPSPARSE_SOLVE_POLICY_USE_LEVEL,
+                                                 dbuffer));
+    CHECK_HIPSPARSE_ERROR(hipsparseXcsrsv2_zeroPivot(handle, info, d_position));
+
+    // Explicit synchronization before reading the results
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+    T   hresult_2;
+    int hposition;
+    CHECK_HIP_ERROR(hipMemcpy(&hresult_2, d_result, sizeof(T), hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hy.data(), dy, sizeof(T) * m, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(&hposition, d_position, sizeof(int), hipMemcpyDeviceToHost));
+
+    // Host csrsv2
+    hipDeviceProp_t prop;
+    CHECK_HIP_ERROR(hipGetDeviceProperties(&prop, 0));
+
+    int position_gold = csr_lsolve(HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                                   m,
+                                   hcsr_row_ptr.data(),
+                                   hcsr_col_ind.data(),
+                                   hcsr_val.data(),
+                                   h_alpha,
+                                   hx.data(),
+                                   hy_gold.data(),
+                                   idx_base,
+                                   HIPSPARSE_DIAG_TYPE_UNIT,
+                                   prop.warpSize);
+
+    unit_check_general(1, 1, 1, &hresult_gold, &hresult_2);
+    unit_check_general(1, 1, 1, &position_gold, &hposition);
+    unit_check_near(1, m, 1, hy_gold.data(), hy.data());
+
+    // Back to blocking mode
+    CHECK_HIPSPARSE_ERROR(hipsparseSetSyncMode(handle, HIPSPARSE_SYNC_MODE_BLOCKING));
+    CHECK_HIPSPARSE_ERROR(hipsparseGetSyncMode(handle, &mode));
+
+    mode_gold = HIPSPARSE_SYNC_MODE_BLOCKING;
+    mode_int  = mode;
+    unit_check_general(1, 1, 1, &mode_gold, &mode_int);
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSetStream(handle, nullptr));
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+#endif
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+#endif // TESTING_SYNC_MODE_HPP
@@ -0,0 +1,275 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_WORKSPACE_HPP
+#define TESTING_WORKSPACE_HPP
+
+#include "hipsparse.hpp"
+#include "hipsparse_test_unique_ptr.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <hipsparse.h>
+
+using namespace hipsparse;
+using namespace hipsparse_test;
+
+// CSR matrix and its csr2csc output on the device, checked against the host conversion
+template <typename T>
+struct workspace_csr2csc_problem
+{
+    workspace_csr2csc_problem(int m, int n, hipsparseIndexBase_t idx_base)
+        : m(m)
+        , n(n)
+        , idx_base(idx_base)
+        , dcsr_row_ptr_managed(device_malloc(sizeof(int) * (m + 1)), device_free)
+        , dcsr_col_ind_managed(nullptr, device_free)
+        , dcsr_val_managed(nullptr, device_free)
+        , dcsc_row_ind_managed(nullptr, device_free)
+        , dcsc_col_ptr_managed(device_malloc(sizeof(int) * (n + 1)), device_free)
+        , dcsc_val_managed(nullptr, device_free)
+    {
+        generate_csr_matrix(
+            std::string(""), this->m, this->n, nnz, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base);
+
+        dcsr_col_ind_managed.reset(device_malloc(sizeof(int) * nnz));
+        dcsr_val_managed.reset(device_malloc(sizeof(T) * nnz));
+        dcsc_row_ind_managed.reset(device_malloc(sizeof(int) * nnz));
+        dcsc_val_managed.reset(device_malloc(sizeof(T) * nnz));
+
+        CHECK_HIP_ERROR(hipMemcpy(dcsr_row_ptr_managed.get(),
+                                  hcsr_row_ptr.data(),
+                                  sizeof(int) * (m + 1),
+                                  hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dcsr_col_ind_managed.get(),
+                                  hcsr_col_ind.data(),
+                                  sizeof(int) * nnz,
+                                  hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(
+            dcsr_val_managed.get(), hcsr_val.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    }
+
+    hipsparseStatus_t run(hipsparseHandle_t handle)
+    {
+        return hipsparseXcsr2csc(handle,
+                                 m,
+                                 n,
+                                 nnz,
+                                 (const T*)dcsr_val_managed.get(),
+                                 (const int*)dcsr_row_ptr_managed.get(),
+                                 (const int*)dcsr_col_ind_managed.get(),
+                                 (T*)dcsc_val_managed.get(),
+                                 (int*)dcsc_row_ind_managed.get(),
+                                 (int*)dcsc_col_ptr_managed.get(),
+                                 HIPSPARSE_ACTION_NUMERIC,
+                                 idx_base);
+    }
+
+    void check()
+    {
+        std::vector<int> hcsc_row_ind(nnz);
+        std::vector<int> hcsc_col_ptr(n + 1);
+        std::vector<T>   hcsc_val(nnz);
+
+        CHECK_HIP_ERROR(hipMemcpy(hcsc_row_ind.data(),
+                                  dcsc_row_ind_managed.get(),
+                                  sizeof(int) * nnz,
+                                  hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hcsc_col_ptr.data(),
+                                  dcsc_col_ptr_managed.get(),
+                                  sizeof(int) * (n + 1),
+                                  hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(
+            hcsc_val.data(), dcsc_val_managed.get(), sizeof(T) * nnz, hipMemcpyDeviceToHost));
+
+        std::vector<int> hcsc_row_ind_gold;
+        std::vector<int> hcsc_col_ptr_gold;
+        std::vector<T>   hcsc_val_gold;
+
+        host_csr_to_csc(m,
+                        n,
+                        nnz,
+                        hcsr_row_ptr.data(),
+                        hcsr_col_ind.data(),
+                        hcsr_val.data(),
+                        hcsc_row_ind_gold,
+                        hcsc_col_ptr_gold,
+                        hcsc_val_gold,
+                        HIPSPARSE_ACTION_NUMERIC,
+                        idx_base);
+
+        unit_check_general(1, nnz, 1, hcsc_row_ind_gold.data(), hcsc_row_ind.data());
+        unit_check_general(1, n + 1, 1, hcsc_col_ptr_gold.data(), hcsc_col_ptr.data());
+        unit_check_general(1, nnz, 1, hcsc_val_gold.data(), hcsc_val.data());
+    }
+
+    int                  m;
+    int                  n;
+    int                  nnz;
+    hipsparseIndexBase_t idx_base;
+
+    std::vector<int> hcsr_row_ptr;
+    std::vector<int> hcsr_col_ind;
+    std::vector<T>   hcsr_val;
+
+    hipsparse_unique_ptr dcsr_row_ptr_managed;
+    hipsparse_unique_ptr dcsr_col_ind_managed;
+    hipsparse_unique_ptr dcsr_val_managed;
+    hipsparse_unique_ptr dcsc_row_ind_managed;
+    hipsparse_unique_ptr dcsc_col_ptr_managed;
+    hipsparse_unique_ptr dcsc_val_managed;
+};
+
+void testing_workspace_bad_arg(void)
+{
+#if(!defined(CUDART_VERSION))
+    size_t size;
+    size_t high_water;
+
+    // testing for(nullptr == handle)
+    {
+        hipsparseHandle_t handle_null = nullptr;
+
+        verify_hipsparse_status(hipsparseReserveWorkspace(handle_null, 1024),
+                                HIPSPARSE_STATUS_NOT_INITIALIZED,
+                                "Error: handle is nullptr");
+        verify_hipsparse_status(hipsparseGetWorkspaceSize(handle_null, &size, &high_water),
+                                HIPSPARSE_STATUS_NOT_INITIALIZED,
+                                "Error: handle is nullptr");
+        verify_hipsparse_status(hipsparseReleaseWorkspace(handle_null),
+                                HIPSPARSE_STATUS_NOT_INITIALIZED,
+                                "Error: handle is nullptr");
+    }
+#endif
+}
+
+template <typename T>
+hipsparseStatus_t testing_workspace(Arguments argus)
+{
+#if(!defined(CUDART_VERSION))
+    int                  m        = argus.M;
+    int                  n        = argus.N;
+    hipsparseIndexBase_t idx_base = argus.idx_base;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    hipsparse_seedrand(12345ULL);
+
+    // The second matrix is larger, such that it needs a larger workspace
+    workspace_csr2csc_problem<T> small(m, n, idx_base);
+    workspace_csr2csc_problem<T> large(4 * m, 4 * n, idx_base);
+
+    size_t size;
+    size_t high_water;
+    size_t zero = 0;
+    size_t one  = 1;
+
+    // A new handle owns no workspace
+    CHECK_HIPSPARSE_ERROR(hipsparseGetWorkspaceSize(handle, &size, &high_water));
+    unit_check_general(1, 1, 1, &zero, &size);
+    unit_check_general(1, 1, 1, &zero, &high_water);
+
+    // Reserving rounds up to whole pages and does not count towards the high-water mark
+    size_t reserved = 4096;
+    CHECK_HIPSPARSE_ERROR(hipsparseReserveWorkspace(handle, 1));
+    CHECK_HIPSPARSE_ERROR(hipsparseGetWorkspaceSize(handle, &size, &high_water));
+    unit_check_general(1, 1, 1, &reserved, &size);
+    unit_check_general(1, 1, 1, &zero, &high_water);
+
+    // csr2csc takes its buffer from the workspace and records its size
+    CHECK_HIPSPARSE_ERROR(small.run(handle));
+    CHECK_HIP_ERROR(hipDeviceSynchronize());
+    small.check();
+
+    size_t size_small;
+    size_t high_water_small;
+    CHECK_HIPSPARSE_ERROR(hipsparseGetWorkspaceSize(handle, &size_small, &high_water_small));
+
+    size_t covered = (size_small >= high_water_small && size_small >= reserved);
+    unit_check_general(1, 1, 1, &one, &covered);
+
+    if(small.nnz > 0)
+    {
+        size_t used = (high_water_small > 0);
+        unit_check_general(1, 1, 1, &one, &used);
+    }
+
+    // The workspace only grows
+    CHECK_HIPSPARSE_ERROR(hipsparseReserveWorkspace(handle, 0));
+    CHECK_HIPSPARSE_ERROR(hipsparseGetWorkspaceSize(handle, &size, &high_water));
+    unit_check_general(1, 1, 1, &size_small, &size);
+    unit_check_general(1, 1, 1, &high_water_small, &high_water);
+
+    reserved = size_small + 3 * 4096;
+    CHECK_HIPSPARSE_ERROR(hipsparseReserveWorkspace(handle, reserved - 4095));
+    CHECK_HIPSPARSE_ERROR(hipsparseGetWorkspaceSize(handle, &size, &high_water));
+    unit_check_general(1, 1, 1, &reserved, &size);
+
+    // Release frees the buffer but keeps the high-water mark
+    CHECK_HIPSPARSE_ERROR(hipsparseReleaseWorkspace(handle));
+    CHECK_HIPSPARSE_ERROR(hipsparseGetWorkspaceSize(handle, &size, &high_water));
+    unit_check_general(1, 1, 1, &zero, &size);
+    unit_check_general(1, 1, 1, &high_water_small, &high_water);
+
+    // Switching streams between calls, while the workspace grows under work that is still
+    // in flight on the previous stream. Asynchronous mode keeps csr2csc from blocking.
+    CHECK_HIPSPARSE_ERROR(hipsparseSetSyncMode(handle, HIPSPARSE_SYNC_MODE_ASYNC));
+
+    hipStream_t stream_1;
+    hipStream_t stream_2;
+    CHECK_HIP_ERROR(hipStreamCreate(&stream_1));
+    CHECK_HIP_ERROR(hipStreamCreate(&stream_2));
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSetStream(handle, stream_1));
+    CHECK_HIPSPARSE_ERROR(small.run(handle));
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSetStream(handle, stream_2));
+    CHECK_HIPSPARSE_ERROR(large.run(handle));
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSetStream(handle, stream_1));
+    CHECK_HIPSPARSE_ERROR(small.run(handle));
+
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream_1));
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream_2));
+
+    small.check();
+    large.check();
+
+    CHECK_HIPSPARSE_ERROR(hipsparseGetWorkspaceSize(handle, &size, &high_water));
+
+    size_t grown = (size >= high_water && high_water >= high_water_small);
+    unit_check_general(1, 1, 1, &one, &grown);
+
+    // The handle has to be done with the streams before they are destroyed
+    CHECK_HIPSPARSE_ERROR(hipsparseSetStream(handle, nullptr));
+    CHECK_HIPSPARSE_ERROR(hipsparseReleaseWorkspace(handle));
+    CHECK_HIP_ERROR(hipStreamDestroy(stream_1));
+    CHECK_HIP_ERROR(hipStreamDestroy(stream_2));
+#endif
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+#endif // TESTING_WORKSPACE_HPP
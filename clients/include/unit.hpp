@@ -40,14 +40,25 @@
 /* ========================================Gtest Unit Check
  * ==================================================== */
 
-/*! \brief Template: gtest unit compare two matrices float/double/complex */
-// Do not put a wrapper over ASSERT_FLOAT_EQ, since assert exit the current function NOT the test
-// case
-// a wrapper will cause the loop keep going
+/*! \brief Template: gtest unit compare two matrices float/double/complex/integer. Floating
+ *  point values may differ by 4 units in the last place, as with ASSERT_FLOAT_EQ. All entries
+ *  are compared and a single failure summarizes the entries out of tolerance.
+ */
 template <typename T>
 void unit_check_general(int64_t M, int64_t N, int64_t lda, T* hCPU, T* hGPU);
 
+/*! \brief Template: gtest unit compare two matrices float/double/complex within a relative
+ *  tolerance. tol_scale widens the tolerance for results of long sums, see
+ *  host_csr_tolerance_scale.
+ */
+template <typename T>
+void unit_check_near(int64_t M, int64_t N, int64_t lda, T* hCPU, T* hGPU, double tol_scale = 1.0);
+
+/*! \brief Template: gtest unit compare two matrices float/double/complex in the max norm. The
+ *  largest error has to be within tol times the largest entry of hCPU, as for solutions of linear
+ *  systems, whose error is bounded relative to the norm of the solution. See host_gtsv_tolerance.
+ */
 template <typename T>
-void unit_check_near(int64_t M, int64_t N, int64_t lda, T* hCPU, T* hGPU);
+void unit_check_norm(int64_t M, int64_t N, int64_t lda, T* hCPU, T* hGPU, double tol);
 
 #endif // UNIT_HPP
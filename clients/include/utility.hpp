@@ -27,14 +27,22 @@
 
 #include <algorithm>
 #include <assert.h>
+#include <atomic>
+#include <chrono>
 #include <complex>
 #include <hip/hip_runtime_api.h>
 #include <hipsparse/hipsparse.h>
+#include <limits>
+#include <list>
 #include <math.h>
+#include <memory>
+#include <mutex>
 #include <sstream>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string>
+#include <type_traits>
+#include <unordered_set>
 #include <vector>
 
 #include <iostream>
@@ -411,15 +419,352 @@ static inline double testing_real(hipDoubleComplex x)
 /* ============================================================================================ */
 /* generate random number :*/
 
+/*! \brief  Counter based random number stream. The i-th number of a stream only depends on the
+ *  seed and on its position, hence random data can be generated in parallel and is reproducible
+ *  independent of the number of threads.
+ */
+struct hipsparse_rand_stream
+{
+    uint64_t key;
+
+    /*! \brief  i-th 64 bit random number of the stream, using the SplitMix64 finalizer. */
+    uint64_t operator()(uint64_t i) const
+    {
+        uint64_t z = this->key + (i + 1) * 0x9E3779B97F4A7C15ULL;
+
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+
+        return z ^ (z >> 31);
+    }
+
+    /*! \brief  Uniformly distributed integer in [0, range). */
+    uint64_t uniform(uint64_t i, uint64_t range) const
+    {
+        return (*this)(i) % range;
+    }
+
+    /*! \brief  Uniformly distributed floating point number in (0, 1]. */
+    double uniform_real(uint64_t i) const
+    {
+        return static_cast<double>(((*this)(i) >> 11) + 1) * (1.0 / 9007199254740992.0);
+    }
+
+    /*! \brief  Stream starting at position i of this stream. */
+    hipsparse_rand_stream offset(uint64_t i) const
+    {
+        hipsparse_rand_stream sub;
+        sub.key = this->key + i * 0x9E3779B97F4A7C15ULL;
+
+        return sub;
+    }
+
+    /*! \brief  Independent stream, for consumers that draw a data dependent amount of numbers. */
+    hipsparse_rand_stream substream(uint64_t i) const
+    {
+        hipsparse_rand_stream sub;
+        sub.key = (*this)(i);
+
+        return sub;
+    }
+};
+
+/*! \brief  Global seed and position of the random number generator. */
+struct hipsparse_rand_state
+{
+    uint64_t              seed;
+    std::atomic<uint64_t> counter;
+};
+
+inline hipsparse_rand_state& hipsparse_rand_global()
+{
+    static hipsparse_rand_state state = {12345ULL, {0}};
+    return state;
+}
+
+/*! \brief  Seed the random number generator, restarting the stream. rand() is seeded as well. */
+inline void hipsparse_seedrand(uint64_t seed)
+{
+    hipsparse_rand_global().seed    = seed;
+    hipsparse_rand_global().counter = 0;
+
+    srand(static_cast<unsigned int>(seed));
+}
+
+/*! \brief  Reserve the next n numbers of the global stream. Position i of the returned stream
+ *  corresponds to position i of the reserved range.
+ */
+inline hipsparse_rand_stream hipsparse_rand_reserve(uint64_t n)
+{
+    hipsparse_rand_state& state = hipsparse_rand_global();
+
+    hipsparse_rand_stream seed_stream;
+    seed_stream.key = state.seed;
+
+    hipsparse_rand_stream stream;
+    stream.key = seed_stream(0);
+
+    return stream.offset(state.counter.fetch_add(n));
+}
+
 /*! \brief  generate a random number between [0, 0.999...] . */
+template <typename T>
+inline T random_generator(const hipsparse_rand_stream& stream, uint64_t i)
+{
+    // generate a integer number between [1, 10]
+    return make_DataType<T>(stream.uniform(2 * i, 10) + 1, stream.uniform(2 * i + 1, 10) + 1);
+}
+
 template <typename T>
 inline T random_generator()
 {
-    // return rand()/( (T)RAND_MAX + 1);
-    return make_DataType<T>(rand() % 10 + 1,
-                            rand() % 10 + 1); // generate a integer number between [1, 10]
+    return random_generator<T>(hipsparse_rand_reserve(2), 0);
 };
 
+/*! \brief  Sample nnz distinct sorted integers in [start, end), using Floyd's algorithm. Uses the
+ *  positions [0, nnz) of stream.
+ */
+template <typename I>
+inline void hipsparse_rand_sample(
+    const hipsparse_rand_stream& stream, I* x, int64_t nnz, int64_t start, int64_t end)
+{
+    int64_t range = end - start;
+
+    // Short samples are checked for duplicates by linear search
+    std::unordered_set<int64_t> chosen;
+
+    if(nnz > 64)
+    {
+        chosen.reserve(nnz);
+    }
+
+    for(int64_t k = 0; k < nnz; ++k)
+    {
+        int64_t j = range - nnz + k;
+        int64_t t = stream.uniform(k, j + 1);
+
+        bool duplicate = (nnz > 64) ? !chosen.insert(t).second
+                                    : std::find(x, x + k, static_cast<I>(start + t)) != x + k;
+
+        if(duplicate)
+        {
+            t = j;
+
+            if(nnz > 64)
+            {
+                chosen.insert(t);
+            }
+        }
+
+        x[k] = static_cast<I>(start + t);
+    }
+
+    std::sort(x, x + nnz);
+}
+
+/* ============================================================================================ */
+/*! \brief  Number of significant bits of the largest key max_key. */
+inline int host_radix_bits(uint64_t max_key)
+{
+    int bits = 0;
+    while(bits < 64 && (max_key >> bits) != 0)
+    {
+        ++bits;
+    }
+
+    return bits;
+}
+
+/*! \brief  Stable LSD radix sort of n non-negative integer keys in place, of which only the
+ *  lowest key_bits bits are significant. If p is not null, its entries are moved along with the
+ *  keys, such that an identity p yields the sorting permutation.
+ *
+ *  Each pass sorts by 8 bits. The keys are split into up to 64 contiguous blocks, which are
+ *  counted in parallel. The counts are scanned by digit first and block second, which keeps the
+ *  sort stable, and the blocks are scattered in parallel. Passes in which all keys share their
+ *  digit are skipped.
+ */
+template <typename K, typename P>
+inline void host_radix_sort_pairs(int64_t n, K* keys, P* p, int key_bits)
+{
+    if(n <= 1)
+    {
+        return;
+    }
+
+    const int     radix   = 8;
+    const int64_t buckets = int64_t(1) << radix;
+    const int64_t nblocks = std::max(int64_t(1), std::min(int64_t(64), n / 65536));
+
+    std::vector<K>       kbuf(n);
+    std::vector<P>       pbuf(p ? n : 0);
+    std::vector<int64_t> count(buckets * nblocks);
+
+    K* ksrc = keys;
+    K* kdst = kbuf.data();
+    P* psrc = p;
+    P* pdst = pbuf.data();
+
+    for(int shift = 0; shift < key_bits; shift += radix)
+    {
+        std::fill(count.begin(), count.end(), 0);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) if(nblocks > 1)
+#endif
+        for(int64_t b = 0; b < nblocks; ++b)
+        {
+            int64_t* c = count.data() + b * buckets;
+
+            for(int64_t i = n * b / nblocks; i < n * (b + 1) / nblocks; ++i)
+            {
+                ++c[(ksrc[i] >> shift) & (buckets - 1)];
+            }
+        }
+
+        // Exclusive scan, digit major
+        int64_t sum  = 0;
+        bool    skip = false;
+        for(int64_t d = 0; d < buckets; ++d)
+        {
+            int64_t first = sum;
+
+            for(int64_t b = 0; b < nblocks; ++b)
+            {
+                int64_t v              = count[b * buckets + d];
+                count[b * buckets + d] = sum;
+                sum += v;
+            }
+
+            skip |= (sum - first == n);
+        }
+
+        if(skip)
+        {
+            continue;
+        }
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) if(nblocks > 1)
+#endif
+        for(int64_t b = 0; b < nblocks; ++b)
+        {
+            int64_t* c = count.data() + b * buckets;
+
+            for(int64_t i = n * b / nblocks; i < n * (b + 1) / nblocks; ++i)
+            {
+                int64_t at = c[(ksrc[i] >> shift) & (buckets - 1)]++;
+
+                kdst[at] = ksrc[i];
+                if(p)
+                {
+                    pdst[at] = psrc[i];
+                }
+            }
+        }
+
+        std::swap(ksrc, kdst);
+        std::swap(psrc, pdst);
+    }
+
+    if(ksrc != keys)
+    {
+#ifdef _OPENMP
+#pragma omp parallel for if(n >= 65536)
+#endif
+        for(int64_t i = 0; i < n; ++i)
+        {
+            keys[i] = ksrc[i];
+            if(p)
+            {
+                p[i] = psrc[i];
+            }
+        }
+    }
+}
+
+/*! \brief  Stable sorting permutation of n (row, column) index pairs, ordered by row and then by
+ *  column, for matrices with m rows and n columns. The pairs are packed into a 64 bit key if their
+ *  indices fit, otherwise they are sorted by column first and by row second, which is a radix sort
+ *  of 128 bit keys. perm is overwritten.
+ */
+template <typename I, typename J>
+inline void host_coo_sort_permutation(int64_t              nnz,
+                                      J                    m,
+                                      J                    n,
+                                      const J*             row_ind,
+                                      const J*             col_ind,
+                                      I*                   perm,
+                                      hipsparseIndexBase_t base)
+{
+    int row_bits = host_radix_bits(std::max(static_cast<int64_t>(m) - 1, int64_t(0)));
+    int col_bits = host_radix_bits(std::max(static_cast<int64_t>(n) - 1, int64_t(0)));
+
+    std::vector<uint64_t> keys(nnz);
+
+#ifdef _OPENMP
+#pragma omp parallel for if(nnz >= 65536)
+#endif
+    for(int64_t i = 0; i < nnz; ++i)
+    {
+        perm[i] = static_cast<I>(i);
+    }
+
+    if(row_bits + col_bits <= 64)
+    {
+#ifdef _OPENMP
+#pragma omp parallel for if(nnz >= 65536)
+#endif
+        for(int64_t i = 0; i < nnz; ++i)
+        {
+            keys[i] = (static_cast<uint64_t>(row_ind[i] - base) << col_bits)
+                      | static_cast<uint64_t>(col_ind[i] - base);
+        }
+
+        host_radix_sort_pairs(nnz, keys.data(), perm, row_bits + col_bits);
+
+        return;
+    }
+
+#ifdef _OPENMP
+#pragma omp parallel for if(nnz >= 65536)
+#endif
+    for(int64_t i = 0; i < nnz; ++i)
+    {
+        keys[i] = static_cast<uint64_t>(col_ind[i] - base);
+    }
+
+    host_radix_sort_pairs(nnz, keys.data(), perm, col_bits);
+
+#ifdef _OPENMP
+#pragma omp parallel for if(nnz >= 65536)
+#endif
+    for(int64_t i = 0; i < nnz; ++i)
+    {
+        keys[i] = static_cast<uint64_t>(row_ind[perm[i]] - base);
+    }
+
+    host_radix_sort_pairs(nnz, keys.data(), perm, row_bits);
+}
+
+/*! \brief  Row offsets of a COO matrix with m rows, whose row indices are sorted. Each offset is
+ *  found by binary search, independent of the others.
+ */
+template <typename I, typename J>
+inline void host_coo_to_csr(
+    J m, I nnz, const J* coo_row_ind, I* csr_row_ptr, hipsparseIndexBase_t base)
+{
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for(J i = 0; i <= m; ++i)
+    {
+        const J* first = std::lower_bound(coo_row_ind, coo_row_ind + nnz, static_cast<J>(i + base));
+
+        csr_row_ptr[i] = static_cast<I>(first - coo_row_ind) + base;
+    }
+}
+
 /* ============================================================================================ */
 /*! \brief  matrix/vector initialization: */
 // for vector x (M=1, N=lengthX);
@@ -427,11 +772,16 @@ inline T random_generator()
 template <typename T>
 void hipsparseInit(std::vector<T>& A, int M, int N)
 {
+    hipsparse_rand_stream stream = hipsparse_rand_reserve(static_cast<uint64_t>(M) * N);
+
     for(int i = 0; i < M; ++i)
     {
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
         for(int j = 0; j < N; ++j)
         {
-            A[i + j] = random_generator<T>();
+            A[i + j] = random_generator<T>(stream, static_cast<uint64_t>(i) * N + j);
         }
     }
 };
@@ -442,19 +792,7 @@ void hipsparseInit(std::vector<T>& A, int M, int N)
 template <typename I>
 void hipsparseInitIndex(I* x, int nnz, int start, int end)
 {
-    std::vector<bool> check(end - start, false);
-    int               num = 0;
-    while(num < nnz)
-    {
-        int val = start + rand() % (end - start);
-        if(!check[val - start])
-        {
-            x[num]             = val;
-            check[val - start] = true;
-            ++num;
-        }
-    }
-    std::sort(x, x + nnz);
+    hipsparse_rand_sample(hipsparse_rand_reserve(nnz), x, nnz, start, end);
 };
 
 /* ============================================================================================ */
@@ -463,27 +801,40 @@ template <typename T>
 void hipsparseInitCSR(
     std::vector<int>& ptr, std::vector<int>& col, std::vector<T>& val, int nrow, int ncol, int nnz)
 {
+    hipsparse_rand_stream stream_ptr = hipsparse_rand_reserve(nrow);
+    hipsparse_rand_stream stream_col = hipsparse_rand_reserve(nnz);
+    hipsparse_rand_stream stream_val = hipsparse_rand_reserve(2 * static_cast<uint64_t>(nnz));
+
     // Row offsets
     ptr[0]    = 0;
     ptr[nrow] = nnz;
 
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
     for(int i = 1; i < nrow; ++i)
     {
-        ptr[i] = rand() % (nnz - 1) + 1;
+        ptr[i] = stream_ptr.uniform(i, nnz - 1) + 1;
     }
     std::sort(ptr.begin(), ptr.end());
 
-    // Column indices
+    // Column indices, row i uses the positions of its entries
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
     for(int i = 0; i < nrow; ++i)
     {
-        hipsparseInitIndex(&col[ptr[i]], ptr[i + 1] - ptr[i], 0, ncol - 1);
-        std::sort(&col[ptr[i]], &col[ptr[i + 1]]);
+        hipsparse_rand_sample(
+            stream_col.offset(ptr[i]), &col[ptr[i]], ptr[i + 1] - ptr[i], 0, ncol - 1);
     }
 
     // Random values
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
     for(int i = 0; i < nnz; ++i)
     {
-        val[i] = random_generator<T>();
+        val[i] = random_generator<T>(stream_val, i);
     }
 }
 
@@ -557,734 +908,1847 @@ J gen_2d_laplacian(int                  ndim,
 }
 
 /* ============================================================================================ */
-/*! \brief  Generate a random sparsity pattern with a dense format, generated floating point values of type T are positive and normalized. */
-template <typename T>
-void gen_dense_random_sparsity_pattern(
-    int m, int n, T* A, int lda, hipsparseOrder_t order, float sparsity_ratio = 0.3)
+/*! \brief  Generate 3D laplacian on unit cube in CSR format, using a 7 or 27 point stencil */
+template <typename I, typename J, typename T>
+J gen_3d_laplacian(int                  ndim,
+                   int                  stencil,
+                   std::vector<I>&      rowptr,
+                   std::vector<J>&      col,
+                   std::vector<T>&      val,
+                   hipsparseIndexBase_t idx_base)
 {
-    if(order == HIPSPARSE_ORDER_COL)
-    {
-        for(int j = 0; j < n; ++j)
-        {
-            for(int i = 0; i < m; ++i)
-            {
-                const float d  = ((float)rand()) / ((float)RAND_MAX);
-                A[j * lda + i] = (d < sparsity_ratio) ? testing_div(make_DataType<T>(rand()),
-                                                                    make_DataType<T>(RAND_MAX))
-                                                      : make_DataType<T>(0);
-            }
-        }
-    }
-    else
+    if(ndim == 0)
     {
-        for(int j = 0; j < m; ++j)
-        {
-            for(int i = 0; i < n; ++i)
-            {
-                const float d  = ((float)rand()) / ((float)RAND_MAX);
-                A[j * lda + i] = (d < sparsity_ratio) ? testing_div(make_DataType<T>(rand()),
-                                                                    make_DataType<T>(RAND_MAX))
-                                                      : make_DataType<T>(0);
-            }
-        }
+        return 0;
     }
-}
 
-/* ============================================================================================ */
-/*! \brief  Generate a random sparse matrix in COO format */
-template <typename I, typename T>
-void gen_matrix_coo(I                    m,
-                    I                    n,
-                    I                    nnz,
-                    std::vector<I>&      row_ind,
-                    std::vector<I>&      col_ind,
-                    std::vector<T>&      val,
-                    hipsparseIndexBase_t idx_base)
-{
-    if((I)row_ind.size() != nnz)
-    {
-        row_ind.resize(nnz);
-    }
-    if((I)col_ind.size() != nnz)
-    {
-        col_ind.resize(nnz);
-    }
-    if((I)val.size() != nnz)
+    J n = static_cast<J>(ndim) * ndim * ndim;
+
+    rowptr.resize(n + 1);
+
+    // Number of neighbors of each grid point
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for(J idx = 0; idx < n; ++idx)
     {
-        val.resize(nnz);
+        int ix = idx % ndim;
+        int iy = (idx / ndim) % ndim;
+        int iz = idx / ndim / ndim;
+
+        int nx = 1 + (ix > 0) + (ix < ndim - 1);
+        int ny = 1 + (iy > 0) + (iy < ndim - 1);
+        int nz = 1 + (iz > 0) + (iz < ndim - 1);
+
+        rowptr[idx + 1] = (stencil == 27) ? nx * ny * nz : nx + ny + nz - 2;
     }
 
-    // Uniform distributed row indices
-    for(I i = 0; i < nnz; ++i)
+    rowptr[0] = idx_base;
+    for(J idx = 0; idx < n; ++idx)
     {
-        row_ind[i] = rand() % m;
+        rowptr[idx + 1] += rowptr[idx];
     }
 
-    // Sort row indices
-    std::sort(row_ind.begin(), row_ind.end());
+    I nnz = rowptr[n] - idx_base;
 
-    // Sample column indices
-    std::vector<bool> check(nnz, false);
+    col.resize(nnz);
+    val.resize(nnz);
 
+    // Fill local arrays, neighbors are visited in increasing column order
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for(J idx = 0; idx < n; ++idx)
     {
-        I i = 0;
-        while(i < nnz)
+        int ix = idx % ndim;
+        int iy = (idx / ndim) % ndim;
+        int iz = idx / ndim / ndim;
+
+        I k = rowptr[idx] - idx_base;
+
+        for(int dz = -1; dz <= 1; ++dz)
         {
-            I begin = i;
-            while(row_ind[i] == row_ind[begin])
+            for(int dy = -1; dy <= 1; ++dy)
             {
-                ++i;
-                if(i >= nnz)
+                for(int dx = -1; dx <= 1; ++dx)
                 {
-                    break;
-                }
-            }
+                    if(stencil != 27 && std::abs(dx) + std::abs(dy) + std::abs(dz) > 1)
+                    {
+                        continue;
+                    }
 
-            // Sample i disjunct column indices
-            I idx = begin;
-            while(idx < i)
-            {
-#define MM_PI 3.1415
-                // Normal distribution around the diagonal
-                I rng = (i - begin) * sqrt(-2.0 * log((double)rand() / RAND_MAX))
-                        * cos(2.0 * MM_PI * (double)rand() / RAND_MAX);
+                    if(ix + dx < 0 || ix + dx >= ndim || iy + dy < 0 || iy + dy >= ndim
+                       || iz + dz < 0 || iz + dz >= ndim)
+                    {
+                        continue;
+                    }
 
-                if(m <= n)
-                {
-                    rng += row_ind[begin];
-                }
+                    bool diag = (dx == 0 && dy == 0 && dz == 0);
 
-                // Repeat if running out of bounds
-                if(rng < 0 || rng > n - 1)
-                {
-                    continue;
+                    col[k] = idx + (static_cast<J>(dz) * ndim + dy) * ndim + dx + idx_base;
+                    val[k] = make_DataType<T>(diag ? stencil - 1.0 : -1.0);
+                    ++k;
                 }
+            }
+        }
+    }
+
+    return n;
+}
+
+/* ============================================================================================ */
+/*! \brief  Generate a R-MAT power law graph with m rows, n columns and up to nnz entries in CSR
+ *  format. Each entry is placed by recursively choosing a quadrant of the matrix with
+ *  probabilities 0.57, 0.19, 0.19 and 0.05, duplicate entries are merged. Row lengths are heavily
+ *  skewed towards the first rows.
+ */
+template <typename I, typename J, typename T>
+I gen_rmat(J                    m,
+           J                    n,
+           I                    nnz,
+           std::vector<I>&      rowptr,
+           std::vector<J>&      col,
+           std::vector<T>&      val,
+           hipsparseIndexBase_t idx_base)
+{
+    const double a = 0.57;
+    const double b = 0.19;
+    const double c = 0.19;
+
+    if(m == 0 || n == 0)
+    {
+        nnz = 0;
+    }
+
+    hipsparse_rand_stream stream_ind = hipsparse_rand_reserve(nnz);
+    hipsparse_rand_stream stream_val = hipsparse_rand_reserve(2 * static_cast<uint64_t>(nnz));
+
+    int scale = 0;
+    while((static_cast<int64_t>(1) << scale) < std::max(m, n))
+    {
+        ++scale;
+    }
+
+    // Linear index of each entry, entries outside of the matrix are drawn again
+    std::vector<uint64_t> entries(nnz);
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for(I e = 0; e < nnz; ++e)
+    {
+        hipsparse_rand_stream stream = stream_ind.substream(e);
+        uint64_t              pos    = 0;
+        int64_t               row;
+        int64_t               column;
+
+        do
+        {
+            row    = 0;
+            column = 0;
+
+            uint64_t bits = 0;
 
-                // Check for disjunct column index in current row
-                if(!check[rng])
+            // Each level consumes 16 random bits
+            for(int l = 0; l < scale; ++l)
+            {
+                if(l % 4 == 0)
                 {
-                    check[rng]   = true;
-                    col_ind[idx] = rng;
-                    ++idx;
+                    bits = stream(pos++);
                 }
-            }
 
-            // Reset disjunct check array
-            for(I j = begin; j < i; ++j)
-            {
-                check[col_ind[j]] = false;
+                double u = static_cast<double>(((bits >> (16 * (l % 4))) & 0xFFFF) + 1) / 65536.0;
+
+                row    = 2 * row + (u > a + b);
+                column = 2 * column + ((u > a && u <= a + b) || u > a + b + c);
             }
+        } while(row >= m || column >= n);
 
-            // Partially sort column indices
-            std::sort(&col_ind[begin], &col_ind[i]);
-        }
+        entries[e] = static_cast<uint64_t>(row) * n + column;
     }
 
-    // Correct index base accordingly
-    if(idx_base == HIPSPARSE_INDEX_BASE_ONE)
+    host_radix_sort_pairs(static_cast<int64_t>(nnz),
+                          entries.data(),
+                          static_cast<I*>(nullptr),
+                          host_radix_bits(static_cast<uint64_t>(m) * n - 1));
+    entries.erase(std::unique(entries.begin(), entries.end()), entries.end());
+
+    nnz = static_cast<I>(entries.size());
+
+    rowptr.resize(m + 1);
+    col.resize(nnz);
+    val.resize(nnz);
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for(J i = 0; i <= m; ++i)
     {
-        for(I i = 0; i < nnz; ++i)
-        {
-            ++row_ind[i];
-            ++col_ind[i];
-        }
+        auto first = std::lower_bound(entries.begin(), entries.end(), static_cast<uint64_t>(i) * n);
+
+        rowptr[i] = static_cast<I>(first - entries.begin()) + idx_base;
     }
 
-    // Sample random values
-    for(I i = 0; i < nnz; ++i)
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for(I e = 0; e < nnz; ++e)
     {
-        val[i] = random_generator<T>(); //(double) rand() / RAND_MAX;
+        col[e] = static_cast<J>(entries[e] % n) + idx_base;
+        val[e] = random_generator<T>(stream_val, e);
     }
-}
 
-/* ============================================================================================ */
-/*! \brief  Read matrix from mtx file in COO format */
-template <typename I>
-static void read_mtx_value(std::istringstream& is, I& row, I& col, float& val)
-{
-    is >> row >> col >> val;
+    return nnz;
 }
 
-template <typename I>
-static void read_mtx_value(std::istringstream& is, I& row, I& col, double& val)
+/* ============================================================================================ */
+/*! \brief  Generate a diagonally dominant banded matrix with bandwidth entries on each side of the
+ *  diagonal in CSR format
+ */
+template <typename I, typename J, typename T>
+I gen_banded(J                    m,
+             J                    n,
+             J                    bandwidth,
+             std::vector<I>&      rowptr,
+             std::vector<J>&      col,
+             std::vector<T>&      val,
+             hipsparseIndexBase_t idx_base)
 {
-    is >> row >> col >> val;
-}
+    rowptr.resize(m + 1);
 
-template <typename I>
-static void read_mtx_value(std::istringstream& is, I& row, I& col, hipComplex& val)
-{
-    float real;
-    float imag;
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for(J i = 0; i < m; ++i)
+    {
+        J begin = std::max(i - bandwidth, static_cast<J>(0));
+        J end   = std::min(i + bandwidth + 1, n);
 
-    is >> row >> col >> real >> imag;
+        rowptr[i + 1] = std::max(end - begin, static_cast<J>(0));
+    }
 
-    val = make_DataType<hipComplex>(real, imag);
-}
+    rowptr[0] = idx_base;
+    for(J i = 0; i < m; ++i)
+    {
+        rowptr[i + 1] += rowptr[i];
+    }
 
-template <typename I>
-static void read_mtx_value(std::istringstream& is, I& row, I& col, hipDoubleComplex& val)
-{
-    double real;
-    double imag;
+    I nnz = rowptr[m] - idx_base;
 
-    is >> row >> col >> real >> imag;
+    col.resize(nnz);
+    val.resize(nnz);
 
-    val = make_DataType<hipDoubleComplex>(real, imag);
-}
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for(J i = 0; i < m; ++i)
+    {
+        I k     = rowptr[i] - idx_base;
+        J begin = std::max(i - bandwidth, static_cast<J>(0));
+        J end   = std::min(i + bandwidth + 1, n);
 
-template <typename I>
-static void sort(std::vector<I>& perm, std::vector<I>& unsorted_row, std::vector<I>& unsorted_col)
-{
-    std::sort(perm.begin(), perm.end(), [&](const I& a, const I& b) {
-        if(unsorted_row[a] < unsorted_row[b])
-        {
-            return true;
-        }
-        else if(unsorted_row[a] == unsorted_row[b])
-        {
-            return (unsorted_col[a] < unsorted_col[b]);
-        }
-        else
+        for(J j = begin; j < end; ++j)
         {
-            return false;
+            col[k] = j + idx_base;
+            val[k] = make_DataType<T>(i == j ? 2.0 * bandwidth + 1.0 : -1.0);
+            ++k;
         }
-    });
-}
+    }
 
-template <typename I>
-inline void scan(const char* line, I* nrow, I* ncol, I* nnz)
-{
-    sscanf(line, "%d %d %d", nrow, ncol, nnz);
+    return nnz;
 }
 
-template <>
-inline void scan<int64_t>(const char* line, int64_t* nrow, int64_t* ncol, int64_t* nnz)
+/* ============================================================================================ */
+/*! \brief  Generate a block structured matrix in CSR format, as arising from FEM discretizations
+ *  with block_dim unknowns per node. Nodes are coupled by a 3D 7 point stencil on a ndim^3 grid,
+ *  every coupling is a dense block. The matrix is diagonally dominant.
+ */
+template <typename I, typename J, typename T>
+J gen_3d_block_laplacian(int                  ndim,
+                         int                  block_dim,
+                         std::vector<I>&      rowptr,
+                         std::vector<J>&      col,
+                         std::vector<T>&      val,
+                         hipsparseIndexBase_t idx_base)
 {
-    sscanf(line, "%ld %ld %ld", nrow, ncol, nnz);
-}
+    std::vector<I> block_ptr;
+    std::vector<J> block_col;
+    std::vector<T> block_val;
 
-template <typename I, typename T>
-int read_mtx_matrix(const char*          filename,
-                    I&                   nrow,
-                    I&                   ncol,
-                    I&                   nnz,
-                    std::vector<I>&      row,
-                    std::vector<I>&      col,
-                    std::vector<T>&      val,
-                    hipsparseIndexBase_t idx_base)
-{
-    const char* env = getenv("GTEST_LISTENER");
-    if(!env || strcmp(env, "NO_PASS_LINE_IN_LOG"))
-    {
-        printf("Reading matrix %s...", filename);
-        fflush(stdout);
-    }
+    J nb = gen_3d_laplacian(ndim, 7, block_ptr, block_col, block_val, HIPSPARSE_INDEX_BASE_ZERO);
+    J n  = nb * block_dim;
 
-    FILE* f = fopen(filename, "r");
-    if(!f)
+    if(nb == 0)
     {
-        fprintf(stderr,
-                "Failed to open matrix file %s because it does not exist. Please download the "
-                "matrix file using the install script with -c flag.",
-                filename);
-        return -1;
+        return 0;
     }
 
-    char line[1024];
+    rowptr.resize(n + 1);
 
-    // Check for banner
-    if(!fgets(line, 1024, f))
+    rowptr[0] = idx_base;
+    for(J i = 0; i < n; ++i)
     {
-        return -1;
+        J bi = i / block_dim;
+
+        rowptr[i + 1] = rowptr[i] + (block_ptr[bi + 1] - block_ptr[bi]) * block_dim;
     }
 
-    char banner[16];
-    char array[16];
-    char coord[16];
-    char data[16];
-    char type[16];
+    I nnz = rowptr[n] - idx_base;
 
-    // Extract banner
-    if(sscanf(line, "%15s %15s %15s %15s %15s", banner, array, coord, data, type) != 5)
+    col.resize(nnz);
+    val.resize(nnz);
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for(J i = 0; i < n; ++i)
     {
-        return -1;
+        J bi = i / block_dim;
+        I k  = rowptr[i] - idx_base;
+
+        for(I j = block_ptr[bi]; j < block_ptr[bi + 1]; ++j)
+        {
+            for(int bj = 0; bj < block_dim; ++bj)
+            {
+                J c = block_col[j] * block_dim + bj;
+
+                col[k] = c + idx_base;
+                val[k] = make_DataType<T>(i == c ? 7.0 * block_dim : -1.0);
+                ++k;
+            }
+        }
     }
 
-    // Convert to lower case
-    for(char* p = array; *p != '\0'; *p = tolower(*p), p++)
-        ;
-    for(char* p = coord; *p != '\0'; *p = tolower(*p), p++)
-        ;
-    for(char* p = data; *p != '\0'; *p = tolower(*p), p++)
-        ;
-    for(char* p = type; *p != '\0'; *p = tolower(*p), p++)
-        ;
+    return n;
+}
 
-    // Check banner
-    if(strncmp(line, "%%MatrixMarket", 14) != 0)
+/* ============================================================================================ */
+/*! \brief  Generate a random sparsity pattern with a dense format, generated floating point values of type T are positive and normalized. */
+template <typename T>
+void gen_dense_random_sparsity_pattern(
+    int m, int n, T* A, int lda, hipsparseOrder_t order, float sparsity_ratio = 0.3)
+{
+    hipsparse_rand_stream stream = hipsparse_rand_reserve(2 * static_cast<uint64_t>(m) * n);
+
+    int outer = (order == HIPSPARSE_ORDER_COL) ? n : m;
+    int inner = (order == HIPSPARSE_ORDER_COL) ? m : n;
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for(int j = 0; j < outer; ++j)
     {
-        return -1;
+        for(int i = 0; i < inner; ++i)
+        {
+            uint64_t    pos = 2 * (static_cast<uint64_t>(j) * inner + i);
+            const float d   = static_cast<float>(stream.uniform_real(pos));
+
+            A[static_cast<int64_t>(j) * lda + i]
+                = (d < sparsity_ratio) ? make_DataType<T>(stream.uniform_real(pos + 1))
+                                       : make_DataType<T>(0);
+        }
     }
+}
 
-    // Check array type
-    if(strcmp(array, "matrix") != 0)
+/* ============================================================================================ */
+/*! \brief  Generate a random sparse matrix in COO format */
+template <typename I, typename T>
+void gen_matrix_coo(I                    m,
+                    I                    n,
+                    I                    nnz,
+                    std::vector<I>&      row_ind,
+                    std::vector<I>&      col_ind,
+                    std::vector<T>&      val,
+                    hipsparseIndexBase_t idx_base)
+{
+    if((I)row_ind.size() != nnz)
     {
-        return -1;
+        row_ind.resize(nnz);
     }
-
-    // Check coord
-    if(strcmp(coord, "coordinate") != 0)
+    if((I)col_ind.size() != nnz)
     {
-        return -1;
+        col_ind.resize(nnz);
     }
-
-    // Check data
-    if(strcmp(data, "real") != 0 && strcmp(data, "integer") != 0 && strcmp(data, "pattern") != 0)
+    if((I)val.size() != nnz)
     {
-        return -1;
+        val.resize(nnz);
     }
 
-    // Check type
-    if(strcmp(type, "general") != 0 && strcmp(type, "symmetric") != 0)
+    hipsparse_rand_stream stream_row = hipsparse_rand_reserve(nnz);
+    hipsparse_rand_stream stream_col = hipsparse_rand_reserve(nnz);
+    hipsparse_rand_stream stream_val = hipsparse_rand_reserve(2 * static_cast<uint64_t>(nnz));
+
+    // Uniform distributed row indices
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for(I i = 0; i < nnz; ++i)
     {
-        return -1;
+        row_ind[i] = stream_row.uniform(i, m);
     }
 
-    // Symmetric flag
-    int symm = !strcmp(type, "symmetric");
+    // Sort row indices
+    host_radix_sort_pairs(static_cast<int64_t>(nnz),
+                          row_ind.data(),
+                          static_cast<I*>(nullptr),
+                          host_radix_bits(static_cast<uint64_t>(m)));
+
+    // First entry of each row
+    std::vector<I> row_begin;
 
-    // Skip comments
-    while(fgets(line, 1024, f))
+    for(I i = 0; i < nnz; ++i)
     {
-        if(line[0] != '%')
+        if(i == 0 || row_ind[i] != row_ind[i - 1])
         {
-            break;
+            row_begin.push_back(i);
         }
     }
 
-    // Read dimensions
-    I snnz;
+    int64_t nrows = row_begin.size();
 
-    scan<I>(line, &nrow, &ncol, &snnz);
-    nnz = symm ? (snnz - nrow) * 2 + nrow : snnz;
+    row_begin.push_back(nnz);
 
-    std::vector<I> unsorted_row(nnz);
-    std::vector<I> unsorted_col(nnz);
-    std::vector<T> unsorted_val(nnz);
-
-    // Read entries
-    I idx = 0;
-    while(fgets(line, 1024, f))
+    // Sample column indices, each row draws from its own stream
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 64)
+#endif
+    for(int64_t r = 0; r < nrows; ++r)
     {
-        if(idx >= nnz)
-        {
-            return 1;
-        }
-
-        I irow;
-        I icol;
-        T ival;
+        I begin = row_begin[r];
+        I i     = row_begin[r + 1];
 
-        std::istringstream ss(line);
+        hipsparse_rand_stream stream = stream_col.substream(begin);
+        uint64_t              pos    = 0;
 
-        if(!strcmp(data, "pattern"))
-        {
-            ss >> irow >> icol;
-            ival = make_DataType<T>(1.0);
-        }
-        else
-        {
-            read_mtx_value(ss, irow, icol, ival);
-        }
+        // Short rows are checked for duplicates by linear search
+        std::unordered_set<I> chosen;
+        bool                  search = (i - begin) <= 64;
 
-        if(idx_base == HIPSPARSE_INDEX_BASE_ZERO)
+        // Sample i disjunct column indices
+        I idx = begin;
+        while(idx < i)
         {
-            --irow;
-            --icol;
-        }
+#define MM_PI 3.1415
+            // Normal distribution around the diagonal
+            I rng = (i - begin) * sqrt(-2.0 * log(stream.uniform_real(pos)))
+                    * cos(2.0 * MM_PI * stream.uniform_real(pos + 1));
 
-        unsorted_row[idx] = irow;
-        unsorted_col[idx] = icol;
-        unsorted_val[idx] = ival;
+            pos += 2;
 
-        ++idx;
+            if(m <= n)
+            {
+                rng += row_ind[begin];
+            }
 
-        if(symm && irow != icol)
-        {
-            if(idx >= nnz)
+            // Repeat if running out of bounds
+            if(rng < 0 || rng > n - 1)
             {
-                return 1;
+                continue;
             }
 
-            unsorted_row[idx] = icol;
-            unsorted_col[idx] = irow;
-            unsorted_val[idx] = ival;
-            ++idx;
+            // Check for disjunct column index in current row
+            if(search ? std::find(&col_ind[begin], &col_ind[idx], rng) == &col_ind[idx]
+                      : chosen.insert(rng).second)
+            {
+                col_ind[idx] = rng;
+                ++idx;
+            }
         }
+
+        // Partially sort column indices
+        std::sort(&col_ind[begin], &col_ind[i]);
     }
-    fclose(f);
 
-    row.resize(nnz);
-    col.resize(nnz);
-    val.resize(nnz);
-
-    // Sort by row and column index
-    std::vector<I> perm(nnz);
-    for(I i = 0; i < nnz; ++i)
+    // Correct index base accordingly
+    if(idx_base == HIPSPARSE_INDEX_BASE_ONE)
     {
-        perm[i] = i;
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for(I i = 0; i < nnz; ++i)
+        {
+            ++row_ind[i];
+            ++col_ind[i];
+        }
     }
 
-    sort(perm, unsorted_row, unsorted_col);
-
-    // std::sort(perm.begin(), perm.end(), [&](const int& a, const int& b) {
-    //     if(unsorted_row[a] < unsorted_row[b])
-    //     {
-    //         return true;
-    //     }
-    //     else if(unsorted_row[a] == unsorted_row[b])
-    //     {
-    //         return (unsorted_col[a] < unsorted_col[b]);
-    //     }
-    //     else
-    //     {
-    //         return false;
-    //     }
-    // });
-
+    // Sample random values
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
     for(I i = 0; i < nnz; ++i)
     {
-        row[i] = unsorted_row[perm[i]];
-        col[i] = unsorted_col[perm[i]];
-        val[i] = unsorted_val[perm[i]];
-    }
-
-    if(!env || strcmp(env, "NO_PASS_LINE_IN_LOG"))
-    {
-        printf("done.\n");
-        fflush(stdout);
+        val[i] = random_generator<T>(stream_val, i);
     }
-
-    return 0;
 }
 
 /* ============================================================================================ */
-/*! \brief  Read matrix from binary file in CSR format */
-template <typename I, typename J, typename T>
-int read_bin_matrix(const char*          filename,
-                    J&                   nrow,
-                    J&                   ncol,
-                    I&                   nnz,
-                    std::vector<I>&      ptr,
-                    std::vector<J>&      col,
-                    std::vector<T>&      val,
-                    hipsparseIndexBase_t idx_base)
+/*! \brief  Read-only view of the contents of a file. Where supported the file is memory mapped,
+ *  otherwise it is read into host memory.
+ */
+class hipsparse_mapped_file
 {
-    const char* env = getenv("GTEST_LISTENER");
-    if(!env || strcmp(env, "NO_PASS_LINE_IN_LOG"))
+public:
+    explicit hipsparse_mapped_file(const char* filename);
+    ~hipsparse_mapped_file();
+
+    hipsparse_mapped_file(const hipsparse_mapped_file&) = delete;
+    hipsparse_mapped_file& operator=(const hipsparse_mapped_file&) = delete;
+
+    bool is_open() const
     {
-        printf("Reading matrix %s...", filename);
-        fflush(stdout);
+        return this->opened;
     }
 
-    FILE* f = fopen(filename, "rb");
-    if(!f)
+    const char* data() const
     {
-        return -1;
+        return this->ptr;
     }
 
-    int err;
-
-    int nrowf, ncolf, nnzf;
-
-    err = fread(&nrowf, sizeof(int), 1, f);
-    err |= fread(&ncolf, sizeof(int), 1, f);
-    err |= fread(&nnzf, sizeof(int), 1, f);
-    if(!err)
+    size_t size() const
     {
-        fclose(f);
-        return -1;
+        return this->bytes;
     }
-    nrow = (J)nrowf;
-    ncol = (J)ncolf;
-    nnz  = (I)nnzf;
 
-    // Allocate memory
-    std::vector<int>    ptrf(nrow + 1);
-    std::vector<int>    colf(nnz);
-    std::vector<double> valf(nnz);
-    ptr.resize(nrow + 1);
-    col.resize(nnz);
-    val.resize(nnz);
+private:
+    bool              opened;
+    bool              mapped;
+    const char*       ptr;
+    size_t            bytes;
+    std::vector<char> buffer;
+};
 
-    err |= fread(ptrf.data(), sizeof(int), nrow + 1, f);
-    err |= fread(colf.data(), sizeof(int), nnz, f);
-    err |= fread(valf.data(), sizeof(double), nnz, f);
-    if(!err)
-    {
-        fclose(f);
-        return -1;
-    }
+/*! \brief  Size and modification time of a file. Returns false if the file does not exist. */
+bool hipsparse_file_stamp(const char* filename, uint64_t& size, uint64_t& mtime);
 
-    fclose(f);
+/*! \brief  Set the modification time of a file. Returns false on failure. */
+bool hipsparse_file_touch(const char* filename, uint64_t mtime);
 
-    for(J i = 0; i < nrow + 1; ++i)
-    {
-        ptr[i] = (I)ptrf[i];
-    }
+/*! \brief  Directory for temporary files, with trailing separator. */
+std::string hipsparse_tempdir();
 
-    for(I i = 0; i < nnz; ++i)
+/* ============================================================================================ */
+/*! \brief  Matrix Market parsing helpers */
+static inline const char* mtx_skip_blank(const char* p, const char* end)
+{
+    while(p < end && (*p == ' ' || *p == '\t' || *p == '\r'))
     {
-        col[i] = (J)colf[i];
-        val[i] = make_DataType<T>(valf[i]);
+        ++p;
     }
 
-    if(idx_base == HIPSPARSE_INDEX_BASE_ONE)
-    {
-        for(J i = 0; i < nrow + 1; ++i)
-        {
-            ++ptr[i];
-        }
+    return p;
+}
 
-        for(I i = 0; i < nnz; ++i)
-        {
-            ++col[i];
-        }
+template <typename I>
+static inline bool mtx_parse_index(const char*& p, const char* end, I& val)
+{
+    p = mtx_skip_blank(p, end);
+
+    if(p == end || *p < '0' || *p > '9')
+    {
+        return false;
     }
 
-    if(!env || strcmp(env, "NO_PASS_LINE_IN_LOG"))
+    I v = 0;
+    while(p < end && *p >= '0' && *p <= '9')
     {
-        printf("done.\n");
-        fflush(stdout);
+        v = v * 10 + (*p - '0');
+        ++p;
     }
 
-    return 0;
+    val = v;
+
+    return true;
 }
 
-/* ============================================================================================ */
-/*! \brief  Generate CSR matrix from file. File can be either mtx or bin. If filename is empty, a random matrix is generated*/
-template <typename I, typename J, typename T>
-bool generate_csr_matrix(const std::string    filename,
-                         J&                   nrow,
-                         J&                   ncol,
-                         I&                   nnz,
-                         std::vector<I>&      csr_row_ptr,
-                         std::vector<J>&      csr_col_ind,
-                         std::vector<T>&      csr_val,
-                         hipsparseIndexBase_t idx_base)
+// p must point into a line that is terminated by '\n' or '\0'
+static inline bool mtx_parse_real(const char*& p, const char* end, float& val)
 {
-    // If no filename passed, generate matrix
-    if(filename == "")
+    p = mtx_skip_blank(p, end);
+    if(p == end)
     {
-        double scale = 0.02;
-        if(nrow > 1000 || ncol > 1000)
-        {
-            scale = 2.0 / std::max(nrow, ncol);
-        }
-        nnz = nrow * scale * ncol;
+        return false;
+    }
 
-        std::vector<J> coo_row_ind;
-        gen_matrix_coo(nrow, ncol, nnz, coo_row_ind, csr_col_ind, csr_val, idx_base);
+    char* next;
+    val = strtof(p, &next);
 
-        csr_row_ptr.resize(nrow + 1, 0);
-        for(int i = 0; i < nnz; ++i)
-        {
-            ++csr_row_ptr[coo_row_ind[i] + 1 - idx_base];
-        }
+    bool ok = (next != p);
+    p       = next;
 
-        csr_row_ptr[0] = idx_base;
-        for(int i = 0; i < nrow; ++i)
-        {
-            csr_row_ptr[i + 1] += csr_row_ptr[i];
-        }
+    return ok;
+}
 
-        return true;
-    }
-    else
+static inline bool mtx_parse_real(const char*& p, const char* end, double& val)
+{
+    p = mtx_skip_blank(p, end);
+    if(p == end)
     {
-        std::string extension = filename.substr(filename.find_last_of(".") + 1);
-        if(extension == "bin")
-        {
-            if(read_bin_matrix(
-                   filename.c_str(), nrow, ncol, nnz, csr_row_ptr, csr_col_ind, csr_val, idx_base)
-               == 0)
-            {
-                return true;
-            }
-        }
-        else if(extension == "mtx")
-        {
-            std::vector<J> coo_row_ind;
-            if(read_mtx_matrix(
-                   filename.c_str(), nrow, ncol, nnz, coo_row_ind, csr_col_ind, csr_val, idx_base)
-               == 0)
-            {
-                csr_row_ptr.resize(nrow + 1, 0);
-                for(int i = 0; i < nnz; ++i)
-                {
-                    ++csr_row_ptr[coo_row_ind[i] + 1 - idx_base];
-                }
+        return false;
+    }
 
-                csr_row_ptr[0] = idx_base;
-                for(int i = 0; i < nrow; ++i)
-                {
-                    csr_row_ptr[i + 1] += csr_row_ptr[i];
-                }
+    char* next;
+    val = strtod(p, &next);
 
-                return true;
-            }
-        }
-    }
+    bool ok = (next != p);
+    p       = next;
 
-    return false;
+    return ok;
 }
 
-/* ============================================================================================ */
-/*! \brief  Generate COO matrix from file. File can be either mtx or bin. If filename is empty, a random matrix is generated*/
-template <typename I, typename T>
-bool generate_coo_matrix(const std::string    filename,
-                         I&                   nrow,
-                         I&                   ncol,
-                         I&                   nnz,
-                         std::vector<I>&      coo_row_ind,
-                         std::vector<I>&      coo_col_ind,
-                         std::vector<T>&      coo_val,
-                         hipsparseIndexBase_t idx_base)
+// nfields is the number of value fields per entry, i.e. 0 (pattern), 1 (real) or 2 (complex)
+template <typename S>
+static inline bool read_mtx_value(const char*& p, const char* end, int nfields, S& real, S& imag)
 {
-    // If no filename passed, generate matrix
-    if(filename == "")
-    {
-        double scale = 0.02;
-        if(nrow > 1000 || ncol > 1000)
-        {
-            scale = 2.0 / std::max(nrow, ncol);
-        }
-        nnz = nrow * scale * ncol;
+    real = static_cast<S>(1);
+    imag = static_cast<S>(0);
 
-        gen_matrix_coo(nrow, ncol, nnz, coo_row_ind, coo_col_ind, coo_val, idx_base);
-
-        return true;
-    }
-    else
+    if(nfields > 0 && !mtx_parse_real(p, end, real))
     {
-        std::string extension = filename.substr(filename.find_last_of(".") + 1);
-        if(extension == "bin")
-        {
-            std::vector<I> csr_row_ptr;
-            if(read_bin_matrix(
-                   filename.c_str(), nrow, ncol, nnz, csr_row_ptr, coo_col_ind, coo_val, idx_base)
-               == 0)
-            {
-                coo_row_ind.resize(nnz);
-                for(I i = 0; i < nrow; ++i)
-                {
-                    I row_begin = csr_row_ptr[i] - idx_base;
-                    I row_end   = csr_row_ptr[i + 1] - idx_base;
-
-                    for(I j = row_begin; j < row_end; ++j)
-                    {
-                        coo_row_ind[j] = i + idx_base;
-                    }
-                }
+        return false;
+    }
 
-                return true;
-            }
-        }
-        else if(extension == "mtx")
-        {
-            if(read_mtx_matrix(
-                   filename.c_str(), nrow, ncol, nnz, coo_row_ind, coo_col_ind, coo_val, idx_base)
-               == 0)
-            {
-                return true;
-            }
-        }
+    if(nfields > 1 && !mtx_parse_real(p, end, imag))
+    {
+        return false;
     }
 
-    return false;
+    return true;
 }
 
-/* ============================================================================================ */
-/*! \brief  Compute incomplete LU factorization without fill-ins and no pivoting using CSR
- *  matrix storage format.
- */
-static inline float testing_neg(float val)
+static inline bool read_mtx_value(const char*& p, const char* end, int nfields, float& val)
 {
-    return -val;
+    float imag;
+    return read_mtx_value(p, end, nfields, val, imag);
 }
 
-static inline double testing_neg(double val)
+static inline bool read_mtx_value(const char*& p, const char* end, int nfields, double& val)
 {
-    return -val;
+    double imag;
+    return read_mtx_value(p, end, nfields, val, imag);
 }
 
-static inline hipComplex testing_neg(hipComplex val)
+static inline bool read_mtx_value(const char*& p, const char* end, int nfields, hipComplex& val)
 {
-    hipComplex ret;
-    ret.x = -val.x;
-    ret.y = -val.y;
-    return ret;
+    float real;
+    float imag;
+
+    bool ok = read_mtx_value(p, end, nfields, real, imag);
+    val     = make_DataType<hipComplex>(real, imag);
+
+    return ok;
 }
 
-static inline hipDoubleComplex testing_neg(hipDoubleComplex val)
+static inline bool
+    read_mtx_value(const char*& p, const char* end, int nfields, hipDoubleComplex& val)
 {
-    hipDoubleComplex ret;
-    ret.x = -val.x;
-    ret.y = -val.y;
-    return ret;
+    double real;
+    double imag;
+
+    bool ok = read_mtx_value(p, end, nfields, real, imag);
+    val     = make_DataType<hipDoubleComplex>(real, imag);
+
+    return ok;
 }
 
-template <typename T>
-void host_nnz(hipsparseDirection_t      dirA,
-              int                       m,
-              int                       n,
-              const hipsparseMatDescr_t descrA,
-              const T*                  A,
-              int                       lda,
-              int*                      nnzPerRowColumn,
-              int*                      nnzTotalDevHostPtr)
+/* ============================================================================================ */
+/*! \brief  Read matrix from mtx file in CSR format.
+ *
+ *  The file is mapped into memory, split into chunks at line boundaries and the chunks are
+ *  parsed in parallel. The CSR structure is then assembled by two stable counting sorts (by
+ *  column, then by row), such that column indices are sorted within each row. Symmetric,
+ *  hermitian and skew-symmetric matrices are expanded to general storage.
+ */
+template <typename I, typename J, typename T>
+int read_mtx_matrix_csr(const char*          filename,
+                        J&                   nrow,
+                        J&                   ncol,
+                        I&                   nnz,
+                        std::vector<I>&      csr_row_ptr,
+                        std::vector<J>&      csr_col_ind,
+                        std::vector<T>&      csr_val,
+                        hipsparseIndexBase_t idx_base)
 {
-    int mn = (dirA == HIPSPARSE_DIRECTION_ROW) ? m : n;
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-    for(int j = 0; j < mn; ++j)
+    const char* env = getenv("GTEST_LISTENER");
+    if(!env || strcmp(env, "NO_PASS_LINE_IN_LOG"))
     {
-        nnzPerRowColumn[j] = 0;
+        printf("Reading matrix %s...", filename);
+        fflush(stdout);
     }
 
-    for(int j = 0; j < n; ++j)
+    hipsparse_mapped_file file(filename);
+    if(!file.is_open())
     {
-        for(int i = 0; i < m; ++i)
-        {
-            if(A[j * lda + i] != make_DataType<T>(0))
-            {
-                if(dirA == HIPSPARSE_DIRECTION_ROW)
-                {
-                    nnzPerRowColumn[i] += 1;
-                }
-                else
-                {
-                    nnzPerRowColumn[j] += 1;
-                }
-            }
-        }
+        fprintf(stderr,
+                "Failed to open matrix file %s because it does not exist. Please download the "
+                "matrix file using the install script with -c flag.",
+                filename);
+        return -1;
     }
 
-    int sum = 0;
-#ifdef _OPENMP
-#pragma omp parallel for reduction(+ : sum)
-#endif
-    for(int j = 0; j < mn; ++j)
-    {
-        sum = sum + nnzPerRowColumn[j];
-    }
-    nnzTotalDevHostPtr[0] = sum;
-}
+    const char* begin = file.data();
+    const char* end   = begin + file.size();
 
-template <hipsparseDirection_t DIRA, typename T>
-void host_dense2csx(int                  m,
+    // Extract banner
+    const char* eol = static_cast<const char*>(memchr(begin, '\n', end - begin));
+    eol             = eol ? eol : end;
+
+    std::string line(begin, eol);
+
+    char banner[16];
+    char array[16];
+    char coord[16];
+    char data[16];
+    char type[16];
+
+    if(sscanf(line.c_str(), "%15s %15s %15s %15s %15s", banner, array, coord, data, type) != 5)
+    {
+        return -1;
+    }
+
+    // Convert to lower case
+    for(char* p = array; *p != '\0'; *p = tolower(*p), p++)
+        ;
+    for(char* p = coord; *p != '\0'; *p = tolower(*p), p++)
+        ;
+    for(char* p = data; *p != '\0'; *p = tolower(*p), p++)
+        ;
+    for(char* p = type; *p != '\0'; *p = tolower(*p), p++)
+        ;
+
+    // Check banner
+    if(strncmp(line.c_str(), "%%MatrixMarket", 14) != 0)
+    {
+        return -1;
+    }
+
+    // Check array type
+    if(strcmp(array, "matrix") != 0)
+    {
+        return -1;
+    }
+
+    // Check coord
+    if(strcmp(coord, "coordinate") != 0)
+    {
+        return -1;
+    }
+
+    // Check data
+    int nfields;
+    if(strcmp(data, "pattern") == 0)
+    {
+        nfields = 0;
+    }
+    else if(strcmp(data, "real") == 0 || strcmp(data, "integer") == 0)
+    {
+        nfields = 1;
+    }
+    else if(strcmp(data, "complex") == 0)
+    {
+        nfields = 2;
+    }
+    else
+    {
+        return -1;
+    }
+
+    // Check type
+    bool symm = false;
+    bool herm = false;
+    bool skew = false;
+    if(strcmp(type, "symmetric") == 0)
+    {
+        symm = true;
+    }
+    else if(strcmp(type, "hermitian") == 0)
+    {
+        herm = true;
+    }
+    else if(strcmp(type, "skew-symmetric") == 0)
+    {
+        skew = true;
+    }
+    else if(strcmp(type, "general") != 0)
+    {
+        return -1;
+    }
+
+    bool mirror = symm || herm || skew;
+
+    // Skip comments and empty lines
+    const char* p = (eol < end) ? eol + 1 : end;
+    while(p < end)
+    {
+        eol = static_cast<const char*>(memchr(p, '\n', end - p));
+        eol = eol ? eol : end;
+
+        const char* q = mtx_skip_blank(p, eol);
+        if(q != eol && *q != '%')
+        {
+            break;
+        }
+
+        p = (eol < end) ? eol + 1 : end;
+    }
+
+    // Read dimensions
+    J snrow;
+    J sncol;
+    I snnz;
+
+    line.assign(p, (p < end) ? eol : end);
+    const char* q = line.c_str();
+    if(!mtx_parse_index(q, q + line.size(), snrow) || !mtx_parse_index(q, q + line.size(), sncol)
+       || !mtx_parse_index(q, q + line.size(), snnz))
+    {
+        return -1;
+    }
+
+    if(mirror && snrow != sncol)
+    {
+        return -1;
+    }
+
+    nrow = snrow;
+    ncol = sncol;
+
+    // Split the entries into chunks that start at the beginning of a line
+    const char* body = (p < end && eol < end) ? eol + 1 : end;
+
+#ifdef _OPENMP
+    int nchunks = omp_get_max_threads() * 4;
+#else
+    int nchunks = 1;
+#endif
+    nchunks = std::max(1, std::min(nchunks, static_cast<int>((end - body) / 65536) + 1));
+
+    std::vector<const char*> chunk(nchunks + 1);
+
+    chunk[0]       = body;
+    chunk[nchunks] = end;
+    for(int c = 1; c < nchunks; ++c)
+    {
+        const char* pos = body + (end - body) / nchunks * c;
+        pos             = std::max(pos, chunk[c - 1]);
+
+        const char* nl = static_cast<const char*>(memchr(pos, '\n', end - pos));
+        chunk[c]       = nl ? nl + 1 : end;
+    }
+
+    // Count the entries of each chunk
+    std::vector<I> chunk_ptr(nchunks + 1, 0);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+    for(int c = 0; c < nchunks; ++c)
+    {
+        I count = 0;
+
+        for(const char* l = chunk[c]; l < chunk[c + 1];)
+        {
+            const char* e = static_cast<const char*>(memchr(l, '\n', chunk[c + 1] - l));
+            e             = e ? e : chunk[c + 1];
+
+            const char* v = mtx_skip_blank(l, e);
+            if(v != e && *v != '%')
+            {
+                ++count;
+            }
+
+            l = e + 1;
+        }
+
+        chunk_ptr[c + 1] = count;
+    }
+
+    for(int c = 0; c < nchunks; ++c)
+    {
+        chunk_ptr[c + 1] += chunk_ptr[c];
+    }
+
+    if(chunk_ptr[nchunks] != snnz)
+    {
+        return 1;
+    }
+
+    // Parse the entries of each chunk
+    std::vector<J> raw_row(snnz);
+    std::vector<J> raw_col(snnz);
+    std::vector<T> raw_val(snnz);
+
+    int error = 0;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+    for(int c = 0; c < nchunks; ++c)
+    {
+        I           idx = chunk_ptr[c];
+        std::string last;
+
+        for(const char* l = chunk[c]; l < chunk[c + 1];)
+        {
+            const char* e = static_cast<const char*>(memchr(l, '\n', chunk[c + 1] - l));
+
+            // The last line of the file might not be terminated
+            const char* v;
+            const char* v_end;
+            if(e)
+            {
+                v     = l;
+                v_end = e;
+            }
+            else
+            {
+                e = chunk[c + 1];
+                last.assign(l, e);
+                v     = last.c_str();
+                v_end = v + last.size();
+            }
+
+            v = mtx_skip_blank(v, v_end);
+            if(v != v_end && *v != '%')
+            {
+                J irow;
+                J icol;
+                T ival;
+
+                if(!mtx_parse_index(v, v_end, irow) || !mtx_parse_index(v, v_end, icol)
+                   || !read_mtx_value(v, v_end, nfields, ival) || irow < 1 || irow > nrow
+                   || icol < 1 || icol > ncol)
+                {
+#ifdef _OPENMP
+#pragma omp atomic write
+#endif
+                    error = 1;
+                    break;
+                }
+
+                raw_row[idx] = irow - 1;
+                raw_col[idx] = icol - 1;
+                raw_val[idx] = ival;
+                ++idx;
+            }
+
+            l = e + 1;
+        }
+    }
+
+    if(error)
+    {
+        return -1;
+    }
+
+    // Expand mirrored entries, each right behind its original. The offset of each block of
+    // entries is found by a scan over the number of entries of each block.
+    const int64_t  nblocks = std::max(int64_t(1), std::min(int64_t(64), int64_t(snnz) / 65536));
+    std::vector<I> block_ptr(nblocks + 1, 0);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) if(nblocks > 1)
+#endif
+    for(int64_t b = 0; b < nblocks; ++b)
+    {
+        I count = 0;
+        for(I i = snnz * b / nblocks; i < snnz * (b + 1) / nblocks; ++i)
+        {
+            count += (mirror && raw_row[i] != raw_col[i]) ? 2 : 1;
+        }
+
+        block_ptr[b + 1] = count;
+    }
+
+    for(int64_t b = 0; b < nblocks; ++b)
+    {
+        block_ptr[b + 1] += block_ptr[b];
+    }
+
+    nnz = block_ptr[nblocks];
+
+    std::vector<J> coo_row(nnz);
+    std::vector<J> coo_col(nnz);
+    std::vector<T> coo_val(nnz);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) if(nblocks > 1)
+#endif
+    for(int64_t b = 0; b < nblocks; ++b)
+    {
+        I idx = block_ptr[b];
+        for(I i = snnz * b / nblocks; i < snnz * (b + 1) / nblocks; ++i)
+        {
+            J irow = raw_row[i];
+            J icol = raw_col[i];
+
+            coo_row[idx] = irow;
+            coo_col[idx] = icol;
+            coo_val[idx] = raw_val[i];
+            ++idx;
+
+            if(mirror && irow != icol)
+            {
+                coo_row[idx] = icol;
+                coo_col[idx] = irow;
+                coo_val[idx] = symm   ? raw_val[i]
+                               : herm ? testing_conj(raw_val[i])
+                                      : testing_mult(make_DataType<T>(-1.0), raw_val[i]);
+                ++idx;
+            }
+        }
+    }
+
+    std::vector<J>().swap(raw_row);
+    std::vector<J>().swap(raw_col);
+    std::vector<T>().swap(raw_val);
+
+    // Stable radix sort by row and column, duplicates keep their order in the file
+    std::vector<I> perm(nnz);
+    host_coo_sort_permutation(
+        nnz, nrow, ncol, coo_row.data(), coo_col.data(), perm.data(), HIPSPARSE_INDEX_BASE_ZERO);
+
+    csr_row_ptr.resize(nrow + 1);
+    csr_col_ind.resize(nnz);
+    csr_val.resize(nnz);
+
+#ifdef _OPENMP
+#pragma omp parallel for if(nnz >= 65536)
+#endif
+    for(I i = 0; i < nnz; ++i)
+    {
+        csr_col_ind[i] = coo_col[perm[i]] + idx_base;
+        csr_val[i]     = coo_val[perm[i]];
+    }
+
+    // The sorted row indices give the row offsets
+#ifdef _OPENMP
+#pragma omp parallel for if(nnz >= 65536)
+#endif
+    for(I i = 0; i < nnz; ++i)
+    {
+        coo_col[i] = coo_row[perm[i]];
+    }
+
+    host_coo_to_csr(nrow, nnz, coo_col.data(), csr_row_ptr.data(), HIPSPARSE_INDEX_BASE_ZERO);
+
+    if(idx_base == HIPSPARSE_INDEX_BASE_ONE)
+    {
+        for(J i = 0; i < nrow + 1; ++i)
+        {
+            ++csr_row_ptr[i];
+        }
+    }
+
+    if(!env || strcmp(env, "NO_PASS_LINE_IN_LOG"))
+    {
+        printf("done.\n");
+        fflush(stdout);
+    }
+
+    return 0;
+}
+
+/* ============================================================================================ */
+/*! \brief  Read matrix from mtx file in COO format */
+template <typename I, typename T>
+int read_mtx_matrix(const char*          filename,
+                    I&                   nrow,
+                    I&                   ncol,
+                    I&                   nnz,
+                    std::vector<I>&      row,
+                    std::vector<I>&      col,
+                    std::vector<T>&      val,
+                    hipsparseIndexBase_t idx_base)
+{
+    std::vector<I> ptr;
+
+    int status = read_mtx_matrix_csr(filename, nrow, ncol, nnz, ptr, col, val, idx_base);
+    if(status != 0)
+    {
+        return status;
+    }
+
+    row.resize(nnz);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(I i = 0; i < nrow; ++i)
+    {
+        for(I j = ptr[i] - idx_base; j < ptr[i + 1] - idx_base; ++j)
+        {
+            row[j] = i + idx_base;
+        }
+    }
+
+    return 0;
+}
+
+/* ============================================================================================ */
+/*! \brief  Header of the versioned binary CSR format written by hipsparse_mtx2csr.
+ *
+ *  The header is followed by the row offsets, column indices and values. Each array starts at
+ *  a 64 byte aligned file offset, such that the file can be mapped and used in place. The
+ *  checksum covers everything behind the header. Must match deps/convert.cpp.
+ */
+#define HIPSPARSE_BIN_MAGIC "HSPCSRBN"
+#define HIPSPARSE_BIN_VERSION 1
+#define HIPSPARSE_BIN_ALIGNMENT 64
+
+typedef enum hipsparse_bin_value_type_
+{
+    hipsparse_bin_value_real    = 0,
+    hipsparse_bin_value_complex = 1
+} hipsparse_bin_value_type;
+
+/*! \brief  Storage format of the arrays behind the header. Only CSR is read by the clients, the
+ *  other formats are written by hipsparse_mtx2csr --format.
+ */
+typedef enum hipsparse_bin_format_
+{
+    hipsparse_bin_format_csr = 0, // row offsets, column indices
+    hipsparse_bin_format_csc = 1, // column offsets, row indices
+    hipsparse_bin_format_coo = 2, // nnz row indices, column indices
+    hipsparse_bin_format_bsr = 3 // block row offsets, block column indices, row major blocks
+} hipsparse_bin_format;
+
+struct hipsparse_bin_header
+{
+    char     magic[8];
+    uint32_t version;
+    uint32_t header_size;
+    uint8_t  ptr_width; // bytes per row offset, 4 or 8
+    uint8_t  ind_width; // bytes per column index, 4 or 8
+    uint8_t  val_type; // hipsparse_bin_value_type
+    uint8_t  val_width; // bytes per real or imaginary part, 4 or 8
+    uint8_t  idx_base; // index base of row offsets and column indices
+    uint8_t  format; // hipsparse_bin_format
+    uint8_t  reserved0[2];
+    int64_t  nrow;
+    int64_t  ncol;
+    int64_t  nnz;
+    uint64_t ptr_offset;
+    uint64_t ind_offset;
+    uint64_t val_offset;
+    uint64_t checksum;
+    int64_t  block_dim; // block dimension of hipsparse_bin_format_bsr, 0 otherwise
+    uint8_t  reserved1[40];
+};
+
+static_assert(sizeof(hipsparse_bin_header) == 128, "unexpected binary header size");
+
+/*! \brief  Checksum of a binary matrix data segment. first_word is the position of the segment
+ *  behind the header, in multiples of 8 bytes. Zero padding does not contribute.
+ */
+inline uint64_t hipsparse_bin_checksum(const void* data, size_t bytes, uint64_t first_word)
+{
+    const unsigned char* ptr    = static_cast<const unsigned char*>(data);
+    int64_t              nwords = static_cast<int64_t>(bytes / 8);
+    uint64_t             sum    = 0;
+
+#ifdef _OPENMP
+#pragma omp parallel for reduction(+ : sum)
+#endif
+    for(int64_t i = 0; i < nwords; ++i)
+    {
+        uint64_t w;
+        memcpy(&w, ptr + 8 * i, sizeof(uint64_t));
+        sum += (w ^ (w >> 29)) * (2 * (first_word + i) + 1);
+    }
+
+    if(bytes % 8 != 0)
+    {
+        uint64_t w = 0;
+        memcpy(&w, ptr + 8 * nwords, bytes % 8);
+        sum += (w ^ (w >> 29)) * (2 * (first_word + nwords) + 1);
+    }
+
+    return sum;
+}
+
+/*! \brief  Copy width byte integers to index type I, shifting them by shift. */
+template <typename I>
+inline void read_bin_index(const char* src, int width, int64_t n, int64_t shift, I* dst)
+{
+    if(width == sizeof(I) && shift == 0)
+    {
+        memcpy(dst, src, sizeof(I) * n);
+        return;
+    }
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for(int64_t i = 0; i < n; ++i)
+    {
+        if(width == 4)
+        {
+            int32_t v;
+            memcpy(&v, src + 4 * i, 4);
+            dst[i] = static_cast<I>(v + shift);
+        }
+        else
+        {
+            int64_t v;
+            memcpy(&v, src + 8 * i, 8);
+            dst[i] = static_cast<I>(v + shift);
+        }
+    }
+}
+
+/*! \brief  Copy real or complex values of width bytes per part to value type T. */
+template <typename T>
+inline void read_bin_value(const char* src, int val_type, int width, int64_t n, T* dst)
+{
+    int parts = (val_type == hipsparse_bin_value_complex) ? 2 : 1;
+
+    if(static_cast<size_t>(parts * width) == sizeof(T)
+       && (parts == 2) == (sizeof(T) != sizeof(testing_real(dst[0]))))
+    {
+        memcpy(dst, src, sizeof(T) * n);
+        return;
+    }
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for(int64_t i = 0; i < n; ++i)
+    {
+        double v[2] = {0.0, 0.0};
+
+        for(int k = 0; k < parts; ++k)
+        {
+            if(width == 4)
+            {
+                float f;
+                memcpy(&f, src + (parts * i + k) * 4, 4);
+                v[k] = f;
+            }
+            else
+            {
+                memcpy(&v[k], src + (parts * i + k) * 8, 8);
+            }
+        }
+
+        dst[i] = make_DataType<T>(v[0], v[1]);
+    }
+}
+
+/* ============================================================================================ */
+/*! \brief  Read matrix from binary file in CSR format.
+ *
+ *  Both the versioned format (see hipsparse_bin_header) and the legacy headerless format (int
+ *  nrow, ncol, nnz, row offsets and column indices followed by double values) are supported.
+ *  The file is mapped and the arrays are copied or converted directly into the output vectors.
+ */
+template <typename I, typename J, typename T>
+int read_bin_matrix(const char*          filename,
+                    J&                   nrow,
+                    J&                   ncol,
+                    I&                   nnz,
+                    std::vector<I>&      ptr,
+                    std::vector<J>&      col,
+                    std::vector<T>&      val,
+                    hipsparseIndexBase_t idx_base)
+{
+    const char* env = getenv("GTEST_LISTENER");
+    if(!env || strcmp(env, "NO_PASS_LINE_IN_LOG"))
+    {
+        printf("Reading matrix %s...", filename);
+        fflush(stdout);
+    }
+
+    hipsparse_mapped_file file(filename);
+    if(!file.is_open())
+    {
+        return -1;
+    }
+
+    const char* data  = file.data();
+    size_t      bytes = file.size();
+
+    int64_t nrowf;
+    int64_t ncolf;
+    int64_t nnzf;
+
+    const char* ptrf;
+    const char* colf;
+    const char* valf;
+
+    int ptr_width;
+    int ind_width;
+    int val_type;
+    int val_width;
+    int file_base;
+
+    hipsparse_bin_header header;
+
+    if(bytes >= sizeof(header) && memcmp(data, HIPSPARSE_BIN_MAGIC, 8) == 0)
+    {
+        memcpy(&header, data, sizeof(header));
+
+        if(header.version != HIPSPARSE_BIN_VERSION || header.header_size != sizeof(header))
+        {
+            fprintf(stderr, "Unsupported binary matrix version %u\n", header.version);
+            return -1;
+        }
+
+        if(header.format != hipsparse_bin_format_csr)
+        {
+            fprintf(stderr, "Binary matrix %s is not stored in CSR format\n", filename);
+            return -1;
+        }
+
+        nrowf     = header.nrow;
+        ncolf     = header.ncol;
+        nnzf      = header.nnz;
+        ptr_width = header.ptr_width;
+        ind_width = header.ind_width;
+        val_type  = header.val_type;
+        val_width = header.val_width;
+        file_base = header.idx_base;
+
+        int parts = (val_type == hipsparse_bin_value_complex) ? 2 : 1;
+
+        if(nrowf < 0 || ncolf < 0 || nnzf < 0 || (ptr_width != 4 && ptr_width != 8)
+           || (ind_width != 4 && ind_width != 8) || (val_width != 4 && val_width != 8)
+           || header.ptr_offset + (nrowf + 1) * ptr_width > header.ind_offset
+           || header.ind_offset + nnzf * ind_width > header.val_offset
+           || header.val_offset + nnzf * parts * val_width > bytes)
+        {
+            fprintf(stderr, "Corrupted binary matrix header in %s\n", filename);
+            return -1;
+        }
+
+        if(hipsparse_bin_checksum(data + header.header_size, bytes - header.header_size, 0)
+           != header.checksum)
+        {
+            fprintf(stderr, "Checksum mismatch in binary matrix %s\n", filename);
+            return -1;
+        }
+
+        ptrf = data + header.ptr_offset;
+        colf = data + header.ind_offset;
+        valf = data + header.val_offset;
+    }
+    else
+    {
+        // Legacy format
+        int dims[3];
+        if(bytes < sizeof(dims))
+        {
+            return -1;
+        }
+
+        memcpy(dims, data, sizeof(dims));
+
+        nrowf     = dims[0];
+        ncolf     = dims[1];
+        nnzf      = dims[2];
+        ptr_width = sizeof(int);
+        ind_width = sizeof(int);
+        val_type  = hipsparse_bin_value_real;
+        val_width = sizeof(double);
+        file_base = 0;
+
+        if(nrowf < 0 || nnzf < 0
+           || sizeof(dims) + (nrowf + 1 + nnzf) * sizeof(int) + nnzf * sizeof(double) > bytes)
+        {
+            return -1;
+        }
+
+        ptrf = data + sizeof(dims);
+        colf = ptrf + (nrowf + 1) * sizeof(int);
+        valf = colf + nnzf * sizeof(int);
+    }
+
+    // Check that the matrix fits into the requested index types
+    if(nrowf > std::numeric_limits<J>::max() || ncolf > std::numeric_limits<J>::max()
+       || nnzf + 1 > std::numeric_limits<I>::max())
+    {
+        fprintf(stderr, "Binary matrix %s exceeds the requested index type\n", filename);
+        return -1;
+    }
+
+    nrow = static_cast<J>(nrowf);
+    ncol = static_cast<J>(ncolf);
+    nnz  = static_cast<I>(nnzf);
+
+    ptr.resize(nrow + 1);
+    col.resize(nnz);
+    val.resize(nnz);
+
+    int64_t shift = static_cast<int64_t>(idx_base) - file_base;
+
+    read_bin_index(ptrf, ptr_width, nrowf + 1, shift, ptr.data());
+    read_bin_index(colf, ind_width, nnzf, shift, col.data());
+    read_bin_value(valf, val_type, val_width, nnzf, val.data());
+
+    if(!env || strcmp(env, "NO_PASS_LINE_IN_LOG"))
+    {
+        printf("done.\n");
+        fflush(stdout);
+    }
+
+    return 0;
+}
+
+/* ============================================================================================ */
+/*! \brief  Write matrix to binary file in CSR format.
+ *
+ *  The versioned format is written with the widths of I, J and T and the given index base,
+ *  such that read_bin_matrix with the same types copies the arrays without conversion.
+ */
+template <typename I, typename J, typename T>
+int write_bin_matrix(const char*          filename,
+                     J                    nrow,
+                     J                    ncol,
+                     I                    nnz,
+                     const I*             ptr,
+                     const J*             col,
+                     const T*             val,
+                     hipsparseIndexBase_t idx_base)
+{
+    size_t ptr_bytes = sizeof(I) * (static_cast<size_t>(nrow) + 1);
+    size_t ind_bytes = sizeof(J) * static_cast<size_t>(nnz);
+    size_t val_bytes = sizeof(T) * static_cast<size_t>(nnz);
+
+    hipsparse_bin_header header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, HIPSPARSE_BIN_MAGIC, 8);
+
+    bool is_complex = sizeof(T) != sizeof(testing_real(val[0]));
+
+    header.version     = HIPSPARSE_BIN_VERSION;
+    header.header_size = sizeof(header);
+    header.ptr_width   = sizeof(I);
+    header.ind_width   = sizeof(J);
+    header.val_type    = is_complex ? hipsparse_bin_value_complex : hipsparse_bin_value_real;
+    header.val_width   = is_complex ? sizeof(T) / 2 : sizeof(T);
+    header.idx_base    = idx_base;
+    header.nrow        = nrow;
+    header.ncol        = ncol;
+    header.nnz         = nnz;
+
+    auto align = [](uint64_t x) {
+        return (x + HIPSPARSE_BIN_ALIGNMENT - 1) / HIPSPARSE_BIN_ALIGNMENT
+               * HIPSPARSE_BIN_ALIGNMENT;
+    };
+
+    header.ptr_offset = align(sizeof(header));
+    header.ind_offset = align(header.ptr_offset + ptr_bytes);
+    header.val_offset = align(header.ind_offset + ind_bytes);
+
+    // Padding is zero and does not contribute to the checksum
+    header.checksum
+        = hipsparse_bin_checksum(ptr, ptr_bytes, (header.ptr_offset - sizeof(header)) / 8)
+          + hipsparse_bin_checksum(col, ind_bytes, (header.ind_offset - sizeof(header)) / 8)
+          + hipsparse_bin_checksum(val, val_bytes, (header.val_offset - sizeof(header)) / 8);
+
+    FILE* f = fopen(filename, "wb");
+    if(!f)
+    {
+        return -1;
+    }
+
+    uint64_t pos = 0;
+    auto     put = [&](const void* data, size_t bytes, uint64_t offset) {
+        static const char zeros[HIPSPARSE_BIN_ALIGNMENT] = {};
+
+        bool ok = fwrite(zeros, 1, offset - pos, f) == offset - pos
+                  && fwrite(data, 1, bytes, f) == bytes;
+
+        pos = offset + bytes;
+        return ok;
+    };
+
+    bool ok = put(&header, sizeof(header), 0) && put(ptr, ptr_bytes, header.ptr_offset)
+              && put(col, ind_bytes, header.ind_offset) && put(val, val_bytes, header.val_offset);
+
+    return (fclose(f) == 0 && ok) ? 0 : -1;
+}
+
+/* ============================================================================================ */
+/*! \brief  Converted matrix held by the matrix cache, with the arrays in their exact types. */
+struct hipsparse_matrix_cache_entry
+{
+    std::string       key;
+    int64_t           nrow;
+    int64_t           ncol;
+    int64_t           nnz;
+    std::vector<char> ptr;
+    std::vector<char> col;
+    std::vector<char> val;
+
+    size_t bytes() const
+    {
+        return this->ptr.size() + this->col.size() + this->val.size();
+    }
+};
+
+/*! \brief  Process wide cache of converted matrices, least recently used first out. */
+struct hipsparse_matrix_cache
+{
+    std::mutex                                                     mutex;
+    std::list<std::shared_ptr<const hipsparse_matrix_cache_entry>> entries;
+    size_t                                                         bytes = 0;
+    size_t                                                         capacity;
+
+    hipsparse_matrix_cache()
+    {
+        // Capacity in MiB, 0 disables the in-memory cache
+        const char* env = getenv("HIPSPARSE_CLIENTS_MATRIX_CACHE_MB");
+        this->capacity  = (env ? strtoull(env, nullptr, 10) : 1024) << 20;
+    }
+
+    static hipsparse_matrix_cache& instance()
+    {
+        static hipsparse_matrix_cache cache;
+        return cache;
+    }
+};
+
+/*! \brief  Read matrix from mtx or bin file in CSR format, through the matrix cache.
+ *
+ *  Converted matrices are keyed by file name, file size and modification time, the types I, J
+ *  and T and the index base. Hits of the in-memory cache skip reading and conversion entirely.
+ *  If HIPSPARSE_CLIENTS_MATRIX_CACHE_DIR is set, converted matrices are additionally stored in
+ *  that directory in the versioned binary format with the exact widths requested, such that
+ *  later processes map them without parsing or conversion. Files of outdated sources are not
+ *  removed.
+ */
+template <typename I, typename J, typename T>
+int read_matrix_cached(const std::string&   filename,
+                       J&                   nrow,
+                       J&                   ncol,
+                       I&                   nnz,
+                       std::vector<I>&      ptr,
+                       std::vector<J>&      col,
+                       std::vector<T>&      val,
+                       hipsparseIndexBase_t idx_base)
+{
+    std::string extension = filename.substr(filename.find_last_of(".") + 1);
+
+    auto read = [&](const char* name, bool bin) {
+        return bin ? read_bin_matrix(name, nrow, ncol, nnz, ptr, col, val, idx_base)
+                   : read_mtx_matrix_csr(name, nrow, ncol, nnz, ptr, col, val, idx_base);
+    };
+
+    if(extension != "bin" && extension != "mtx")
+    {
+        return -1;
+    }
+
+    uint64_t size;
+    uint64_t mtime;
+    if(!hipsparse_file_stamp(filename.c_str(), size, mtime))
+    {
+        return read(filename.c_str(), extension == "bin");
+    }
+
+    std::ostringstream key;
+    key << filename << '|' << size << '|' << mtime << '|' << typeid(I).name() << '|'
+        << typeid(J).name() << '|' << typeid(T).name() << '|' << idx_base;
+
+    hipsparse_matrix_cache& cache = hipsparse_matrix_cache::instance();
+
+    std::shared_ptr<const hipsparse_matrix_cache_entry> hit;
+    {
+        std::lock_guard<std::mutex> lock(cache.mutex);
+        for(auto it = cache.entries.begin(); it != cache.entries.end(); ++it)
+        {
+            if((*it)->key == key.str())
+            {
+                cache.entries.splice(cache.entries.begin(), cache.entries, it);
+                hit = cache.entries.front();
+                break;
+            }
+        }
+    }
+
+    if(hit != nullptr)
+    {
+        nrow = static_cast<J>(hit->nrow);
+        ncol = static_cast<J>(hit->ncol);
+        nnz  = static_cast<I>(hit->nnz);
+
+        ptr.resize(nrow + 1);
+        col.resize(nnz);
+        val.resize(nnz);
+
+        memcpy(ptr.data(), hit->ptr.data(), hit->ptr.size());
+        memcpy(col.data(), hit->col.data(), hit->col.size());
+        memcpy(val.data(), hit->val.data(), hit->val.size());
+
+        return 0;
+    }
+
+    // Converted file in the on-disk cache, named by a hash of the key
+    std::string cached;
+    const char* dir = getenv("HIPSPARSE_CLIENTS_MATRIX_CACHE_DIR");
+    if(dir != nullptr && dir[0] != '\0')
+    {
+        uint64_t hash = 14695981039346656037ULL;
+        for(char c : key.str())
+        {
+            hash = (hash ^ static_cast<unsigned char>(c)) * 1099511628211ULL;
+        }
+
+        char name[32];
+        snprintf(name, sizeof(name), "hipsparse_%016llx.bin", (unsigned long long)hash);
+        cached = std::string(dir) + "/" + name;
+    }
+
+    uint64_t cached_size;
+    uint64_t cached_mtime;
+    if(cached.empty() || !hipsparse_file_stamp(cached.c_str(), cached_size, cached_mtime)
+       || read(cached.c_str(), true) != 0)
+    {
+        if(read(filename.c_str(), extension == "bin") != 0)
+        {
+            return -1;
+        }
+
+        if(!cached.empty())
+        {
+            // Write to a unique temporary first, readers never see a partially written file
+            auto        stamp = std::chrono::high_resolution_clock::now().time_since_epoch();
+            std::string tmp   = cached + "." + std::to_string(stamp.count()) + ".tmp";
+
+            if(write_bin_matrix(
+                   tmp.c_str(), nrow, ncol, nnz, ptr.data(), col.data(), val.data(), idx_base)
+                   != 0
+               || rename(tmp.c_str(), cached.c_str()) != 0)
+            {
+                remove(tmp.c_str());
+            }
+        }
+    }
+
+    if(sizeof(I) * ptr.size() + sizeof(J) * col.size() + sizeof(T) * val.size() > cache.capacity)
+    {
+        return 0;
+    }
+
+    auto bytes = [](const void* data, size_t size) {
+        const char* begin = static_cast<const char*>(data);
+        return std::vector<char>(begin, begin + size);
+    };
+
+    auto entry = std::make_shared<hipsparse_matrix_cache_entry>();
+
+    entry->key  = key.str();
+    entry->nrow = nrow;
+    entry->ncol = ncol;
+    entry->nnz  = nnz;
+    entry->ptr  = bytes(ptr.data(), sizeof(I) * ptr.size());
+    entry->col  = bytes(col.data(), sizeof(J) * col.size());
+    entry->val  = bytes(val.data(), sizeof(T) * val.size());
+
+    std::lock_guard<std::mutex> lock(cache.mutex);
+
+    cache.bytes += entry->bytes();
+    cache.entries.push_front(entry);
+
+    while(cache.bytes > cache.capacity)
+    {
+        cache.bytes -= cache.entries.back()->bytes();
+        cache.entries.pop_back();
+    }
+
+    return 0;
+}
+
+/* ============================================================================================ */
+/*! \brief  Generate CSR matrix from file. File can be either mtx or bin. If filename is empty, a random matrix is generated*/
+template <typename I, typename J, typename T>
+bool generate_csr_matrix(const std::string    filename,
+                         J&                   nrow,
+                         J&                   ncol,
+                         I&                   nnz,
+                         std::vector<I>&      csr_row_ptr,
+                         std::vector<J>&      csr_col_ind,
+                         std::vector<T>&      csr_val,
+                         hipsparseIndexBase_t idx_base)
+{
+    // If no filename passed, generate matrix
+    if(filename == "")
+    {
+        double scale = 0.02;
+        if(nrow > 1000 || ncol > 1000)
+        {
+            scale = 2.0 / std::max(nrow, ncol);
+        }
+        nnz = nrow * scale * ncol;
+
+        std::vector<J> coo_row_ind;
+        gen_matrix_coo(nrow, ncol, nnz, coo_row_ind, csr_col_ind, csr_val, idx_base);
+
+        csr_row_ptr.resize(nrow + 1, 0);
+        for(int i = 0; i < nnz; ++i)
+        {
+            ++csr_row_ptr[coo_row_ind[i] + 1 - idx_base];
+        }
+
+        csr_row_ptr[0] = idx_base;
+        for(int i = 0; i < nrow; ++i)
+        {
+            csr_row_ptr[i + 1] += csr_row_ptr[i];
+        }
+
+        return true;
+    }
+    else
+    {
+        if(read_matrix_cached(
+               filename, nrow, ncol, nnz, csr_row_ptr, csr_col_ind, csr_val, idx_base)
+           == 0)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/* ============================================================================================ */
+/*! \brief  Generate COO matrix from file. File can be either mtx or bin. If filename is empty, a random matrix is generated*/
+template <typename I, typename T>
+bool generate_coo_matrix(const std::string    filename,
+                         I&                   nrow,
+                         I&                   ncol,
+                         I&                   nnz,
+                         std::vector<I>&      coo_row_ind,
+                         std::vector<I>&      coo_col_ind,
+                         std::vector<T>&      coo_val,
+                         hipsparseIndexBase_t idx_base)
+{
+    // If no filename passed, generate matrix
+    if(filename == "")
+    {
+        double scale = 0.02;
+        if(nrow > 1000 || ncol > 1000)
+        {
+            scale = 2.0 / std::max(nrow, ncol);
+        }
+        nnz = nrow * scale * ncol;
+
+        gen_matrix_coo(nrow, ncol, nnz, coo_row_ind, coo_col_ind, coo_val, idx_base);
+
+        return true;
+    }
+    else
+    {
+        // Both formats share the converted CSR matrix in the matrix cache
+        std::vector<I> csr_row_ptr;
+        if(read_matrix_cached(
+               filename, nrow, ncol, nnz, csr_row_ptr, coo_col_ind, coo_val, idx_base)
+           == 0)
+        {
+            coo_row_ind.resize(nnz);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+            for(I i = 0; i < nrow; ++i)
+            {
+                I row_begin = csr_row_ptr[i] - idx_base;
+                I row_end   = csr_row_ptr[i + 1] - idx_base;
+
+                for(I j = row_begin; j < row_end; ++j)
+                {
+                    coo_row_ind[j] = i + idx_base;
+                }
+            }
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/* ============================================================================================ */
+/*! \brief  Compute incomplete LU factorization without fill-ins and no pivoting using CSR
+ *  matrix storage format.
+ */
+static inline float testing_neg(float val)
+{
+    return -val;
+}
+
+static inline double testing_neg(double val)
+{
+    return -val;
+}
+
+static inline hipComplex testing_neg(hipComplex val)
+{
+    hipComplex ret;
+    ret.x = -val.x;
+    ret.y = -val.y;
+    return ret;
+}
+
+static inline hipDoubleComplex testing_neg(hipDoubleComplex val)
+{
+    hipDoubleComplex ret;
+    ret.x = -val.x;
+    ret.y = -val.y;
+    return ret;
+}
+
+template <typename T>
+void host_nnz(hipsparseDirection_t      dirA,
+              int                       m,
+              int                       n,
+              const hipsparseMatDescr_t descrA,
+              const T*                  A,
+              int                       lda,
+              int*                      nnzPerRowColumn,
+              int*                      nnzTotalDevHostPtr)
+{
+    int mn = (dirA == HIPSPARSE_DIRECTION_ROW) ? m : n;
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for(int j = 0; j < mn; ++j)
+    {
+        nnzPerRowColumn[j] = 0;
+    }
+
+    for(int j = 0; j < n; ++j)
+    {
+        for(int i = 0; i < m; ++i)
+        {
+            if(A[j * lda + i] != make_DataType<T>(0))
+            {
+                if(dirA == HIPSPARSE_DIRECTION_ROW)
+                {
+                    nnzPerRowColumn[i] += 1;
+                }
+                else
+                {
+                    nnzPerRowColumn[j] += 1;
+                }
+            }
+        }
+    }
+
+    int sum = 0;
+#ifdef _OPENMP
+#pragma omp parallel for reduction(+ : sum)
+#endif
+    for(int j = 0; j < mn; ++j)
+    {
+        sum = sum + nnzPerRowColumn[j];
+    }
+    nnzTotalDevHostPtr[0] = sum;
+}
+
+template <hipsparseDirection_t DIRA, typename T>
+void host_dense2csx(int                  m,
                     int                  n,
                     hipsparseIndexBase_t base,
                     const T*             A,
@@ -1294,1715 +2758,3442 @@ void host_dense2csx(int                  m,
                     int*                 csx_row_col_ptr,
                     int*                 csx_col_row_ind)
 {
-    static constexpr T s_zero = {};
-    int                len    = (HIPSPARSE_DIRECTION_ROW == DIRA) ? m : n;
-    *csx_row_col_ptr          = base;
-    for(int i = 0; i < len; ++i)
+    static constexpr T s_zero = {};
+    int                len    = (HIPSPARSE_DIRECTION_ROW == DIRA) ? m : n;
+    *csx_row_col_ptr          = base;
+    for(int i = 0; i < len; ++i)
+    {
+        csx_row_col_ptr[i + 1] = nnz_per_row_columns[i] + csx_row_col_ptr[i];
+    }
+
+    switch(DIRA)
+    {
+    case HIPSPARSE_DIRECTION_COLUMN:
+    {
+        for(int j = 0; j < n; ++j)
+        {
+            for(int i = 0; i < m; ++i)
+            {
+                if(A[j * ld + i] != s_zero)
+                {
+                    *csx_val++         = A[j * ld + i];
+                    *csx_col_row_ind++ = i + base;
+                }
+            }
+        }
+        break;
+    }
+
+    case HIPSPARSE_DIRECTION_ROW:
+    {
+        //
+        // Does not matter having an orthogonal traversal ... testing only.
+        // Otherwise, we would use csxRowPtrA to store the shifts.
+        // and once the job is done a simple memory move would reinitialize the csxRowPtrA to its initial state)
+        //
+        for(int i = 0; i < m; ++i)
+        {
+            for(int j = 0; j < n; ++j)
+            {
+                if(A[j * ld + i] != s_zero)
+                {
+                    *csx_val++         = A[j * ld + i];
+                    *csx_col_row_ind++ = j + base;
+                }
+            }
+        }
+        break;
+    }
+    }
+}
+
+/* ============================================================================================ */
+/*! \brief  Entry of rank pos in ascending order of |A(i, j)| for the m x n column major matrix A,
+ *  which is the entry a full sort of the magnitudes would put at position pos.
+ *
+ *  The bit patterns of non-negative floating point numbers are ordered like the numbers, such
+ *  that the entry is selected by its bits, 11 at a time from the most significant ones. Each
+ *  pass counts in parallel the magnitudes that match the bits selected so far and picks the
+ *  bucket containing rank pos. Neither a copy nor a sort of the magnitudes is needed.
+ */
+template <typename T>
+inline T host_abs_select(int64_t m, int64_t n, const T* A, int64_t lda, int64_t pos)
+{
+    typedef typename std::conditional<sizeof(T) == 4, uint32_t, uint64_t>::type U;
+
+    static_assert(std::is_floating_point<T>::value, "magnitude selection requires real values");
+
+    const int digit = 11;
+
+    U       prefix = 0;
+    U       mask   = 0;
+    int64_t rank   = pos;
+
+    for(int shift = 8 * sizeof(T); shift > 0;)
+    {
+        int width = std::min(digit, shift);
+        shift -= width;
+
+        U                    bucket_mask = (U(1) << width) - 1;
+        std::vector<int64_t> hist(size_t(1) << width, 0);
+
+#ifdef _OPENMP
+#pragma omp parallel if(m * n >= 65536)
+#endif
+        {
+            std::vector<int64_t> local(hist.size(), 0);
+
+#ifdef _OPENMP
+#pragma omp for collapse(2) schedule(static)
+#endif
+            for(int64_t j = 0; j < n; ++j)
+            {
+                for(int64_t i = 0; i < m; ++i)
+                {
+                    T a = std::abs(A[lda * j + i]);
+                    U u;
+                    memcpy(&u, &a, sizeof(U));
+
+                    if((u & mask) == prefix)
+                    {
+                        ++local[(u >> shift) & bucket_mask];
+                    }
+                }
+            }
+
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+            for(size_t b = 0; b < hist.size(); ++b)
+            {
+                hist[b] += local[b];
+            }
+        }
+
+        U b = 0;
+        while(rank >= hist[b])
+        {
+            rank -= hist[b];
+            ++b;
+        }
+
+        prefix |= b << shift;
+        mask |= bucket_mask << shift;
+    }
+
+    T result;
+    memcpy(&result, &prefix, sizeof(T));
+
+    return result;
+}
+
+template <typename T>
+void host_prune_dense2csr(int                   m,
+                          int                   n,
+                          const std::vector<T>& A,
+                          int                   lda,
+                          hipsparseIndexBase_t  base,
+                          T                     threshold,
+                          int&                  nnz,
+                          std::vector<T>&       csr_val,
+                          std::vector<int>&     csr_row_ptr,
+                          std::vector<int>&     csr_col_ind)
+{
+    csr_row_ptr.resize(m + 1, 0);
+    csr_row_ptr[0] = base;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(int i = 0; i < m; i++)
+    {
+        for(int j = 0; j < n; j++)
+        {
+            if(testing_abs(A[lda * j + i]) > threshold)
+            {
+                csr_row_ptr[i + 1]++;
+            }
+        }
+    }
+
+    for(int i = 1; i <= m; i++)
+    {
+        csr_row_ptr[i] += csr_row_ptr[i - 1];
+    }
+
+    nnz = csr_row_ptr[m] - csr_row_ptr[0];
+
+    csr_col_ind.resize(nnz);
+    csr_val.resize(nnz);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(int i = 0; i < m; i++)
+    {
+        int index = csr_row_ptr[i] - base;
+
+        for(int j = 0; j < n; j++)
+        {
+            if(testing_abs(A[lda * j + i]) > threshold)
+            {
+                csr_val[index]     = A[lda * j + i];
+                csr_col_ind[index] = j + base;
+
+                index++;
+            }
+        }
+    }
+}
+
+template <typename T>
+void host_prune_dense2csr_by_percentage(int                   m,
+                                        int                   n,
+                                        const std::vector<T>& A,
+                                        int                   lda,
+                                        hipsparseIndexBase_t  base,
+                                        T                     percentage,
+                                        int&                  nnz,
+                                        std::vector<T>&       csr_val,
+                                        std::vector<int>&     csr_row_ptr,
+                                        std::vector<int>&     csr_col_ind)
+{
+    int nnz_A = m * n;
+    int pos   = std::ceil(nnz_A * (percentage / 100)) - 1;
+    pos       = std::min(pos, nnz_A - 1);
+    pos       = std::max(pos, 0);
+
+    T threshold = (nnz_A > 0) ? host_abs_select(m, n, A.data(), lda, pos) : make_DataType<T>(0);
+    host_prune_dense2csr<T>(m, n, A, lda, base, threshold, nnz, csr_val, csr_row_ptr, csr_col_ind);
+}
+
+template <hipsparseDirection_t DIRA, typename T>
+void host_csx2dense(int                  m,
+                    int                  n,
+                    hipsparseIndexBase_t base,
+                    const T*             csx_val,
+                    const int*           csx_row_col_ptr,
+                    const int*           csx_col_row_ind,
+                    T*                   A,
+                    int                  ld)
+{
+    static constexpr T s_zero = {};
+    switch(DIRA)
+    {
+    case HIPSPARSE_DIRECTION_COLUMN:
+    {
+        for(int col = 0; col < n; ++col)
+        {
+            for(int row = 0; row < m; ++row)
+            {
+                A[row + ld * col] = s_zero;
+            }
+            const int bound = csx_row_col_ptr[col + 1] - base;
+            for(int at = csx_row_col_ptr[col] - base; at < bound; ++at)
+            {
+                A[(csx_col_row_ind[at] - base) + ld * col] = csx_val[at];
+            }
+        }
+        break;
+    }
+
+    case HIPSPARSE_DIRECTION_ROW:
+    {
+        for(int row = 0; row < m; ++row)
+        {
+            for(int col = 0; col < n; ++col)
+            {
+                A[col * ld + row] = s_zero;
+            }
+
+            const int bound = csx_row_col_ptr[row + 1] - base;
+            for(int at = csx_row_col_ptr[row] - base; at < bound; ++at)
+            {
+                A[(csx_col_row_ind[at] - base) * ld + row] = csx_val[at];
+            }
+        }
+        break;
+    }
+    }
+}
+
+template <typename T>
+inline void host_csr_to_csr_compress(int                     M,
+                                     int                     N,
+                                     const std::vector<int>& csr_row_ptr_A,
+                                     const std::vector<int>& csr_col_ind_A,
+                                     const std::vector<T>&   csr_val_A,
+                                     std::vector<int>&       csr_row_ptr_C,
+                                     std::vector<int>&       csr_col_ind_C,
+                                     std::vector<T>&         csr_val_C,
+                                     hipsparseIndexBase_t    base,
+                                     T                       tol)
+{
+    if(M <= 0 || N <= 0)
+    {
+        return;
+    }
+
+    // find how many entries will be in each compressed CSR matrix row
+    std::vector<int> nnz_per_row(M);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(int i = 0; i < M; i++)
+    {
+        int start = csr_row_ptr_A[i] - base;
+        int end   = csr_row_ptr_A[i + 1] - base;
+        int count = 0;
+
+        for(int j = start; j < end; j++)
+        {
+            if(testing_abs(csr_val_A[j]) > testing_real(tol)
+               && testing_abs(csr_val_A[j]) > (std::numeric_limits<float>::min)())
+            {
+                count++;
+            }
+        }
+
+        nnz_per_row[i] = count;
+    }
+
+    // add up total number of entries
+    int nnz_C = 0;
+    for(int i = 0; i < M; i++)
+    {
+        nnz_C += nnz_per_row[i];
+    }
+
+    //column indices and value arrays for compressed CSR matrix
+    csr_col_ind_C.resize(nnz_C);
+    csr_val_C.resize(nnz_C);
+
+    // fill in row pointer array for compressed CSR matrix
+    csr_row_ptr_C.resize(M + 1);
+
+    csr_row_ptr_C[0] = base;
+    for(int i = 0; i < M; i++)
+    {
+        csr_row_ptr_C[i + 1] = csr_row_ptr_C[i] + nnz_per_row[i];
+    }
+
+    // fill in column indices and value arrays for compressed CSR matrix
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(int i = 0; i < M; i++)
+    {
+        int start = csr_row_ptr_A[i] - base;
+        int end   = csr_row_ptr_A[i + 1] - base;
+        int index = csr_row_ptr_C[i] - base;
+
+        for(int j = start; j < end; j++)
+        {
+            if(testing_abs(csr_val_A[j]) > testing_real(tol)
+               && testing_abs(csr_val_A[j]) > (std::numeric_limits<float>::min)())
+            {
+                csr_col_ind_C[index] = csr_col_ind_A[j];
+                csr_val_C[index]     = csr_val_A[j];
+                index++;
+            }
+        }
+    }
+}
+
+template <typename T>
+inline void host_prune_csr_to_csr(int                     M,
+                                  int                     N,
+                                  int                     nnz_A,
+                                  const std::vector<int>& csr_row_ptr_A,
+                                  const std::vector<int>& csr_col_ind_A,
+                                  const std::vector<T>&   csr_val_A,
+                                  int&                    nnz_C,
+                                  std::vector<int>&       csr_row_ptr_C,
+                                  std::vector<int>&       csr_col_ind_C,
+                                  std::vector<T>&         csr_val_C,
+                                  hipsparseIndexBase_t    csr_base_A,
+                                  hipsparseIndexBase_t    csr_base_C,
+                                  T                       threshold)
+{
+    csr_row_ptr_C.resize(M + 1, 0);
+    csr_row_ptr_C[0] = csr_base_C;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(int i = 0; i < M; i++)
+    {
+        for(int j = csr_row_ptr_A[i] - csr_base_A; j < csr_row_ptr_A[i + 1] - csr_base_A; j++)
+        {
+            if(testing_abs(csr_val_A[j]) > threshold
+               && testing_abs(csr_val_A[j]) > (std::numeric_limits<float>::min)())
+            {
+                csr_row_ptr_C[i + 1]++;
+            }
+        }
+    }
+
+    for(int i = 1; i <= M; i++)
+    {
+        csr_row_ptr_C[i] += csr_row_ptr_C[i - 1];
+    }
+
+    nnz_C = csr_row_ptr_C[M] - csr_row_ptr_C[0];
+
+    csr_col_ind_C.resize(nnz_C);
+    csr_val_C.resize(nnz_C);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(int i = 0; i < M; i++)
+    {
+        int index = csr_row_ptr_C[i] - csr_base_C;
+
+        for(int j = csr_row_ptr_A[i] - csr_base_A; j < csr_row_ptr_A[i + 1] - csr_base_A; j++)
+        {
+            if(testing_abs(csr_val_A[j]) > threshold
+               && testing_abs(csr_val_A[j]) > (std::numeric_limits<float>::min)())
+            {
+                csr_col_ind_C[index] = (csr_col_ind_A[j] - csr_base_A) + csr_base_C;
+                csr_val_C[index]     = csr_val_A[j];
+
+                index++;
+            }
+        }
+    }
+}
+
+template <typename T>
+void host_prune_csr_to_csr_by_percentage(int                     M,
+                                         int                     N,
+                                         int                     nnz_A,
+                                         const std::vector<int>& csr_row_ptr_A,
+                                         const std::vector<int>& csr_col_ind_A,
+                                         const std::vector<T>&   csr_val_A,
+                                         int&                    nnz_C,
+                                         std::vector<int>&       csr_row_ptr_C,
+                                         std::vector<int>&       csr_col_ind_C,
+                                         std::vector<T>&         csr_val_C,
+                                         hipsparseIndexBase_t    csr_base_A,
+                                         hipsparseIndexBase_t    csr_base_C,
+                                         T                       percentage)
+{
+    int pos = std::ceil(nnz_A * (percentage / 100)) - 1;
+    pos     = std::min(pos, nnz_A - 1);
+    pos     = std::max(pos, 0);
+
+    T threshold = (nnz_A > 0) ? host_abs_select(nnz_A, 1, csr_val_A.data(), nnz_A, pos)
+                              : make_DataType<T>(0);
+
+    host_prune_csr_to_csr<T>(M,
+                             N,
+                             nnz_A,
+                             csr_row_ptr_A,
+                             csr_col_ind_A,
+                             csr_val_A,
+                             nnz_C,
+                             csr_row_ptr_C,
+                             csr_col_ind_C,
+                             csr_val_C,
+                             csr_base_A,
+                             csr_base_C,
+                             threshold);
+}
+
+/* ============================================================================================ */
+/*! \brief  Number of threads and index of the calling thread, for per-thread scratch arrays. */
+inline int host_max_threads()
+{
+#ifdef _OPENMP
+    return omp_get_max_threads();
+#else
+    return 1;
+#endif
+}
+
+inline int host_thread_num()
+{
+#ifdef _OPENMP
+    return omp_get_thread_num();
+#else
+    return 0;
+#endif
+}
+
+/*! \brief  Split the rows of a CSR matrix into nparts contiguous ranges holding roughly the same
+ *  number of non-zero entries. Range part is returned in [row_begin, row_end).
+ */
+template <typename I, typename J>
+inline void host_csr_partition_rows(J        M,
+                                    const I* csr_row_ptr,
+                                    int      part,
+                                    int      nparts,
+                                    J&       row_begin,
+                                    J&       row_end)
+{
+    I base = csr_row_ptr[0];
+    I nnz  = csr_row_ptr[M] - base;
+
+    auto split = [&](int p) -> J {
+        if(p <= 0)
+        {
+            return 0;
+        }
+        if(p >= nparts)
+        {
+            return M;
+        }
+
+        I target = base + static_cast<I>((static_cast<double>(nnz) * p) / nparts);
+        return static_cast<J>(std::lower_bound(csr_row_ptr, csr_row_ptr + M + 1, target)
+                              - csr_row_ptr);
+    };
+
+    row_begin = std::min(split(part), M);
+    row_end   = std::min(split(part + 1), M);
+}
+
+/* ============================================================================================ */
+/*! \brief  Transpose sparse matrix using CSR storage format. Each thread counts the columns of a
+ *  contiguous range of rows, the columns are then scanned across threads, such that every thread
+ *  scatters its rows to its own positions and the row order within each column is preserved.
+ *  If csr_val_A or csr_val_B is null, only the sparsity pattern is transposed.
+ */
+template <typename I, typename J, typename T>
+void transpose_csr(J                    m,
+                   J                    n,
+                   I                    nnz,
+                   const I*             csr_row_ptr_A,
+                   const J*             csr_col_ind_A,
+                   const T*             csr_val_A,
+                   I*                   csr_row_ptr_B,
+                   J*                   csr_col_ind_B,
+                   T*                   csr_val_B,
+                   hipsparseIndexBase_t idx_base_A,
+                   hipsparseIndexBase_t idx_base_B)
+{
+    bool numeric = (csr_val_A != nullptr && csr_val_B != nullptr);
+
+    // Per thread column histograms only pay off if they are small compared to the matrix
+    int64_t fill   = 4 * static_cast<int64_t>(nnz) / std::max(static_cast<int64_t>(n), int64_t(1));
+    int     nparts = static_cast<int>(std::min(static_cast<int64_t>(host_max_threads()), fill));
+
+    nparts = std::max(1, nparts);
+
+    std::vector<I> count(static_cast<size_t>(nparts) * n, 0);
+
+    // Determine nnz per column, for each range of rows
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static, 1)
+#endif
+    for(int p = 0; p < nparts; ++p)
+    {
+        J  row_begin = 0;
+        J  row_end   = 0;
+        I* count_p   = count.data() + static_cast<int64_t>(p) * n;
+
+        if(m > 0)
+        {
+            host_csr_partition_rows(m, csr_row_ptr_A, p, nparts, row_begin, row_end);
+        }
+
+        for(I j = csr_row_ptr_A[row_begin] - idx_base_A; j < csr_row_ptr_A[row_end] - idx_base_A;
+            ++j)
+        {
+            ++count_p[csr_col_ind_A[j] - idx_base_A];
+        }
+    }
+
+    // Offset of each range within its column, and nnz per column
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static, 4096)
+#endif
+    for(J i = 0; i < n; ++i)
+    {
+        I sum = 0;
+
+        for(int p = 0; p < nparts; ++p)
+        {
+            I& c = count[static_cast<int64_t>(p) * n + i];
+            I  t = c;
+
+            c = sum;
+            sum += t;
+        }
+
+        csr_row_ptr_B[i + 1] = sum;
+    }
+
+    // Scan
+    csr_row_ptr_B[0] = 0;
+
+    for(J i = 0; i < n; ++i)
+    {
+        csr_row_ptr_B[i + 1] += csr_row_ptr_B[i];
+    }
+
+    // Fill row indices and values
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static, 1)
+#endif
+    for(int p = 0; p < nparts; ++p)
+    {
+        J  row_begin = 0;
+        J  row_end   = 0;
+        I* count_p   = count.data() + static_cast<int64_t>(p) * n;
+
+        if(m > 0)
+        {
+            host_csr_partition_rows(m, csr_row_ptr_A, p, nparts, row_begin, row_end);
+        }
+
+        for(J i = row_begin; i < row_end; ++i)
+        {
+            I row_begin_A = csr_row_ptr_A[i] - idx_base_A;
+            I row_end_A   = csr_row_ptr_A[i + 1] - idx_base_A;
+
+            for(I j = row_begin_A; j < row_end_A; ++j)
+            {
+                J col = csr_col_ind_A[j] - idx_base_A;
+                I idx = csr_row_ptr_B[col] + count_p[col]++;
+
+                csr_col_ind_B[idx] = i + idx_base_B;
+
+                if(numeric)
+                {
+                    csr_val_B[idx] = csr_val_A[j];
+                }
+            }
+        }
+    }
+
+    // Shift to the index base of B
+    if(idx_base_B != HIPSPARSE_INDEX_BASE_ZERO)
+    {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static, 4096)
+#endif
+        for(J i = 0; i < n + 1; ++i)
+        {
+            csr_row_ptr_B[i] += idx_base_B;
+        }
+    }
+}
+
+template <typename I, typename J, typename T>
+inline void host_csr_to_csc(J                    M,
+                            J                    N,
+                            I                    nnz,
+                            const I*             csr_row_ptr,
+                            const J*             csr_col_ind,
+                            const T*             csr_val,
+                            std::vector<J>&      csc_row_ind,
+                            std::vector<I>&      csc_col_ptr,
+                            std::vector<T>&      csc_val,
+                            hipsparseAction_t    action,
+                            hipsparseIndexBase_t base)
+{
+    csc_row_ind.resize(nnz);
+    csc_col_ptr.resize(N + 1);
+
+    // Values are left untouched for symbolic conversion
+    if(action == HIPSPARSE_ACTION_NUMERIC)
+    {
+        csc_val.resize(nnz);
+    }
+
+    transpose_csr(M,
+                  N,
+                  nnz,
+                  csr_row_ptr,
+                  csr_col_ind,
+                  (action == HIPSPARSE_ACTION_NUMERIC) ? csr_val : nullptr,
+                  csc_col_ptr.data(),
+                  csc_row_ind.data(),
+                  (action == HIPSPARSE_ACTION_NUMERIC) ? csc_val.data() : nullptr,
+                  base,
+                  base);
+}
+
+template <typename T>
+void host_bsr_to_bsc(int                  mb,
+                     int                  nb,
+                     int                  nnzb,
+                     int                  bsr_dim,
+                     const int*           bsr_row_ptr,
+                     const int*           bsr_col_ind,
+                     const T*             bsr_val,
+                     std::vector<int>&    bsc_row_ind,
+                     std::vector<int>&    bsc_col_ptr,
+                     std::vector<T>&      bsc_val,
+                     hipsparseIndexBase_t bsr_base,
+                     hipsparseIndexBase_t bsc_base)
+{
+    bsc_row_ind.resize(nnzb);
+    bsc_col_ptr.resize(nb + 1, 0);
+    bsc_val.resize(nnzb * bsr_dim * bsr_dim);
+
+    // Determine nnz per column
+    for(int i = 0; i < nnzb; ++i)
+    {
+        ++bsc_col_ptr[bsr_col_ind[i] + 1 - bsr_base];
+    }
+
+    // Scan
+    for(int i = 0; i < nb; ++i)
+    {
+        bsc_col_ptr[i + 1] += bsc_col_ptr[i];
+    }
+
+    // Fill row indices and values
+    for(int i = 0; i < mb; ++i)
+    {
+        int row_begin = bsr_row_ptr[i] - bsr_base;
+        int row_end   = bsr_row_ptr[i + 1] - bsr_base;
+
+        for(int j = row_begin; j < row_end; ++j)
+        {
+            int col = bsr_col_ind[j] - bsr_base;
+            int idx = bsc_col_ptr[col];
+
+            bsc_row_ind[idx] = i + bsc_base;
+
+            for(int bi = 0; bi < bsr_dim; ++bi)
+            {
+                for(int bj = 0; bj < bsr_dim; ++bj)
+                {
+                    bsc_val[bsr_dim * bsr_dim * idx + bi + bj * bsr_dim]
+                        = bsr_val[bsr_dim * bsr_dim * j + bi * bsr_dim + bj];
+                }
+            }
+
+            ++bsc_col_ptr[col];
+        }
+    }
+
+    // Shift column pointer array
+    for(int i = nb; i > 0; --i)
+    {
+        bsc_col_ptr[i] = bsc_col_ptr[i - 1] + bsc_base;
+    }
+
+    bsc_col_ptr[0] = bsc_base;
+}
+
+template <typename T>
+inline void host_gebsr_to_csr(hipsparseDirection_t    direction,
+                              int                     mb,
+                              int                     nb,
+                              int                     nnzb,
+                              const std::vector<T>&   bsr_val,
+                              const std::vector<int>& bsr_row_ptr,
+                              const std::vector<int>& bsr_col_ind,
+                              int                     row_block_dim,
+                              int                     col_block_dim,
+                              hipsparseIndexBase_t    bsr_base,
+                              std::vector<T>&         csr_val,
+                              std::vector<int>&       csr_row_ptr,
+                              std::vector<int>&       csr_col_ind,
+                              hipsparseIndexBase_t    csr_base)
+{
+    int bsize = row_block_dim * col_block_dim;
+
+    csr_col_ind.resize(nnzb * bsize);
+    csr_row_ptr.resize(mb * row_block_dim + 1);
+    csr_val.resize(nnzb * bsize);
+
+    csr_row_ptr[0] = csr_base;
+
+    // Each block row is expanded into its own range of the CSR arrays
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 64)
+#endif
+    for(int i = 0; i < mb; ++i)
+    {
+        int bstart = bsr_row_ptr[i] - bsr_base;
+        int bend   = bsr_row_ptr[i + 1] - bsr_base;
+        int length = (bend - bstart) * col_block_dim;
+
+        for(int r = 0; r < row_block_dim; ++r)
+        {
+            int row = i * row_block_dim + r;
+            int at  = bstart * bsize + r * length;
+
+            for(int k = bstart; k < bend; ++k)
+            {
+                int j = bsr_col_ind[k] - bsr_base;
+
+                for(int c = 0; c < col_block_dim; ++c)
+                {
+                    int col         = col_block_dim * j + c;
+                    csr_col_ind[at] = col + csr_base;
+                    if(direction == HIPSPARSE_DIRECTION_ROW)
+                    {
+                        csr_val[at] = bsr_val[k * bsize + col_block_dim * r + c];
+                    }
+                    else
+                    {
+                        csr_val[at] = bsr_val[k * bsize + row_block_dim * c + r];
+                    }
+                    ++at;
+                }
+            }
+
+            csr_row_ptr[row + 1] = at + csr_base;
+        }
+    }
+}
+
+template <typename T>
+inline void host_csr_to_gebsr(hipsparseDirection_t    direction,
+                              int                     m,
+                              int                     n,
+                              int                     row_block_dim,
+                              int                     col_block_dim,
+                              int&                    nnzb,
+                              hipsparseIndexBase_t    csr_base,
+                              const std::vector<int>& csr_row_ptr,
+                              const std::vector<int>& csr_col_ind,
+                              const std::vector<T>&   csr_val,
+                              hipsparseIndexBase_t    bsr_base,
+                              std::vector<int>&       bsr_row_ptr,
+                              std::vector<int>&       bsr_col_ind,
+                              std::vector<T>&         bsr_val)
+{
+    int mb = (m + row_block_dim - 1) / row_block_dim;
+    int nb = (n + col_block_dim - 1) / col_block_dim;
+
+    bsr_row_ptr.resize(mb + 1);
+
+    // Pass 1: count the distinct block columns of each block row. A block column is marked with
+    // the block row that has seen it last, such that the marks never need to be cleared.
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        std::vector<int> mark(nb, -1);
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 64)
+#endif
+        for(int i = 0; i < mb; ++i)
+        {
+            int start = csr_row_ptr[row_block_dim * i] - csr_base;
+            int end   = csr_row_ptr[std::min(m, row_block_dim * (i + 1))] - csr_base;
+            int count = 0;
+
+            for(int j = start; j < end; ++j)
+            {
+                int bcol = (csr_col_ind[j] - csr_base) / col_block_dim;
+
+                if(mark[bcol] != i)
+                {
+                    mark[bcol] = i;
+                    ++count;
+                }
+            }
+
+            bsr_row_ptr[i + 1] = count;
+        }
+    }
+
+    // fill GEBSR row pointer array
+    bsr_row_ptr[0] = bsr_base;
+    for(int i = 0; i < mb; i++)
+    {
+        bsr_row_ptr[i + 1] += bsr_row_ptr[i];
+    }
+
+    nnzb = bsr_row_ptr[mb] - bsr_row_ptr[0];
+
+    int bsize = row_block_dim * col_block_dim;
+
+    bsr_col_ind.resize(nnzb);
+    bsr_val.resize(nnzb * bsize);
+
+    // Pass 2: each block row collects and sorts its block columns into its own range, zeroes
+    // its blocks and scatters the entries using the position of each block column
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        std::vector<int> mark(nb, -1);
+        std::vector<int> pos(nb);
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 64)
+#endif
+        for(int i = 0; i < mb; ++i)
+        {
+            int frow   = row_block_dim * i;
+            int lrow   = std::min(m, row_block_dim * (i + 1));
+            int bstart = bsr_row_ptr[i] - bsr_base;
+            int bend   = bsr_row_ptr[i + 1] - bsr_base;
+            int count  = 0;
+
+            for(int j = csr_row_ptr[frow] - csr_base; j < csr_row_ptr[lrow] - csr_base; ++j)
+            {
+                int bcol = (csr_col_ind[j] - csr_base) / col_block_dim;
+
+                if(mark[bcol] != i)
+                {
+                    mark[bcol]                  = i;
+                    bsr_col_ind[bstart + count] = bcol;
+                    ++count;
+                }
+            }
+
+            std::sort(bsr_col_ind.begin() + bstart, bsr_col_ind.begin() + bend);
+
+            for(int k = bstart; k < bend; ++k)
+            {
+                pos[bsr_col_ind[k]] = k;
+                bsr_col_ind[k] += bsr_base;
+            }
+
+            std::fill(bsr_val.begin() + bstart * bsize,
+                      bsr_val.begin() + bend * bsize,
+                      make_DataType<T>(0));
+
+            for(int row = frow; row < lrow; ++row)
+            {
+                int local_row = row - frow;
+
+                for(int j = csr_row_ptr[row] - csr_base; j < csr_row_ptr[row + 1] - csr_base; ++j)
+                {
+                    int col       = csr_col_ind[j] - csr_base;
+                    int local_col = col % col_block_dim;
+                    int index     = pos[col / col_block_dim];
+
+                    if(direction == HIPSPARSE_DIRECTION_ROW)
+                    {
+                        bsr_val[bsize * index + col_block_dim * local_row + local_col] = csr_val[j];
+                    }
+                    else
+                    {
+                        bsr_val[bsize * index + row_block_dim * local_col + local_row] = csr_val[j];
+                    }
+                }
+            }
+        }
+    }
+}
+
+template <typename T>
+inline void host_csr_to_bsr(hipsparseDirection_t    direction,
+                            int                     M,
+                            int                     N,
+                            int                     block_dim,
+                            int&                    nnzb,
+                            hipsparseIndexBase_t    csr_base,
+                            const std::vector<int>& csr_row_ptr,
+                            const std::vector<int>& csr_col_ind,
+                            const std::vector<T>&   csr_val,
+                            hipsparseIndexBase_t    bsr_base,
+                            std::vector<int>&       bsr_row_ptr,
+                            std::vector<int>&       bsr_col_ind,
+                            std::vector<T>&         bsr_val)
+{
+    int mb = (M + block_dim - 1) / block_dim;
+
+    // quick return if block_dim == 1
+    if(block_dim == 1)
+    {
+        bsr_row_ptr.resize(mb + 1, 0);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+        for(size_t i = 0; i < csr_row_ptr.size(); i++)
+        {
+            bsr_row_ptr[i] = (csr_row_ptr[i] - csr_base) + bsr_base;
+        }
+
+        nnzb = bsr_row_ptr[mb] - bsr_row_ptr[0];
+
+        bsr_col_ind.resize(nnzb, 0);
+        bsr_val.resize(nnzb * block_dim * block_dim, make_DataType<T>(0));
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+        for(size_t i = 0; i < csr_col_ind.size(); i++)
+        {
+            bsr_col_ind[i] = (csr_col_ind[i] - csr_base) + bsr_base;
+        }
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+        for(size_t i = 0; i < csr_val.size(); i++)
+        {
+            bsr_val[i] = csr_val[i];
+        }
+
+        return;
+    }
+
+    host_csr_to_gebsr(direction,
+                      M,
+                      N,
+                      block_dim,
+                      block_dim,
+                      nnzb,
+                      csr_base,
+                      csr_row_ptr,
+                      csr_col_ind,
+                      csr_val,
+                      bsr_base,
+                      bsr_row_ptr,
+                      bsr_col_ind,
+                      bsr_val);
+}
+
+template <typename T>
+inline void host_gebsr_to_gebsr(hipsparseDirection_t    direction,
+                                int                     mb,
+                                int                     nb,
+                                int                     nnzb,
+                                const std::vector<T>&   bsr_val_A,
+                                const std::vector<int>& bsr_row_ptr_A,
+                                const std::vector<int>& bsr_col_ind_A,
+                                int                     row_block_dim_A,
+                                int                     col_block_dim_A,
+                                hipsparseIndexBase_t    base_A,
+                                std::vector<T>&         bsr_val_C,
+                                std::vector<int>&       bsr_row_ptr_C,
+                                std::vector<int>&       bsr_col_ind_C,
+                                int                     row_block_dim_C,
+                                int                     col_block_dim_C,
+                                hipsparseIndexBase_t    base_C)
+{
+    int m = mb * row_block_dim_A;
+    int n = nb * col_block_dim_A;
+
+    // convert GEBSR to CSR format
+    std::vector<int> csr_row_ptr;
+    std::vector<int> csr_col_ind;
+    std::vector<T>   csr_val;
+
+    host_gebsr_to_csr(direction,
+                      mb,
+                      nb,
+                      nnzb,
+                      bsr_val_A,
+                      bsr_row_ptr_A,
+                      bsr_col_ind_A,
+                      row_block_dim_A,
+                      col_block_dim_A,
+                      base_A,
+                      csr_val,
+                      csr_row_ptr,
+                      csr_col_ind,
+                      HIPSPARSE_INDEX_BASE_ZERO);
+
+    // convert CSR to GEBSR format
+    int nnzb_C;
+    host_csr_to_gebsr(direction,
+                      m,
+                      n,
+                      row_block_dim_C,
+                      col_block_dim_C,
+                      nnzb_C,
+                      HIPSPARSE_INDEX_BASE_ZERO,
+                      csr_row_ptr,
+                      csr_col_ind,
+                      csr_val,
+                      base_C,
+                      bsr_row_ptr_C,
+                      bsr_col_ind_C,
+                      bsr_val_C);
+}
+
+template <typename T>
+void host_gebsr_to_gebsc(int                     Mb,
+                         int                     Nb,
+                         int                     nnzb,
+                         const std::vector<int>& bsr_row_ptr,
+                         const std::vector<int>& bsr_col_ind,
+                         const std::vector<T>&   bsr_val,
+                         int                     row_block_dim,
+                         int                     col_block_dim,
+                         std::vector<int>&       bsc_row_ind,
+                         std::vector<int>&       bsc_col_ptr,
+                         std::vector<T>&         bsc_val,
+                         hipsparseAction_t       action,
+                         hipsparseIndexBase_t    base)
+{
+    bsc_row_ind.resize(nnzb);
+    bsc_col_ptr.resize(Nb + 1, 0);
+    bsc_val.resize(nnzb);
+
+    const int block_shift = row_block_dim * col_block_dim;
+
+    //
+    // Determine nnz per column
+    //
+    for(int i = 0; i < nnzb; ++i)
+    {
+        ++bsc_col_ptr[bsr_col_ind[i] + 1 - base];
+    }
+
+    // Scan
+    for(int i = 0; i < Nb; ++i)
+    {
+        bsc_col_ptr[i + 1] += bsc_col_ptr[i];
+    }
+
+    // Fill row indices and values
+    for(int i = 0; i < Mb; ++i)
+    {
+        const int row_begin = bsr_row_ptr[i] - base;
+        const int row_end   = bsr_row_ptr[i + 1] - base;
+
+        for(int j = row_begin; j < row_end; ++j)
+        {
+            const int col = bsr_col_ind[j] - base;
+            const int idx = bsc_col_ptr[col];
+
+            bsc_row_ind[idx] = i + base;
+            for(int k = 0; k < block_shift; ++k)
+            {
+                bsc_val[idx * block_shift + k] = bsr_val[j * block_shift + k];
+            }
+
+            ++bsc_col_ptr[col];
+        }
+    }
+
+    // Shift column pointer array
+    for(int i = Nb; i > 0; --i)
+    {
+        bsc_col_ptr[i] = bsc_col_ptr[i - 1] + base;
+    }
+
+    bsc_col_ptr[0] = base;
+}
+
+template <typename T>
+inline void host_bsr_to_csr(hipsparseDirection_t    direction,
+                            int                     Mb,
+                            int                     Nb,
+                            int                     block_dim,
+                            hipsparseIndexBase_t    bsr_base,
+                            const std::vector<int>& bsr_row_ptr,
+                            const std::vector<int>& bsr_col_ind,
+                            const std::vector<T>&   bsr_val,
+                            hipsparseIndexBase_t    csr_base,
+                            std::vector<int>&       csr_row_ptr,
+                            std::vector<int>&       csr_col_ind,
+                            std::vector<T>&         csr_val)
+{
+    int m    = Mb * block_dim;
+    int nnzb = bsr_row_ptr[Mb] - bsr_row_ptr[0];
+
+    csr_row_ptr.resize(m + 1, 0);
+    csr_col_ind.resize(nnzb * block_dim * block_dim, 0);
+    csr_val.resize(nnzb * block_dim * block_dim, make_DataType<T>(0));
+
+    // quick return if block_dim == 1
+    if(block_dim == 1)
+    {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+        for(size_t i = 0; i < bsr_row_ptr.size(); i++)
+        {
+            csr_row_ptr[i] = (bsr_row_ptr[i] - bsr_base) + csr_base;
+        }
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+        for(size_t i = 0; i < bsr_col_ind.size(); i++)
+        {
+            csr_col_ind[i] = (bsr_col_ind[i] - bsr_base) + csr_base;
+        }
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+        for(size_t i = 0; i < bsr_val.size(); i++)
+        {
+            csr_val[i] = bsr_val[i];
+        }
+
+        return;
+    }
+
+    csr_row_ptr[0] = csr_base;
+
+    // find csr row ptr array
+    for(int i = 0; i < Mb; i++)
+    {
+        int entries_in_row = block_dim * (bsr_row_ptr[i + 1] - bsr_row_ptr[i]);
+
+        for(int j = 0; j < block_dim; j++)
+        {
+            csr_row_ptr[i * block_dim + j + 1] = csr_row_ptr[i * block_dim + j] + entries_in_row;
+        }
+    }
+
+    int entries_in_block = block_dim * block_dim;
+
+    // find csr col indices and values arrays
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(int i = 0; i < Mb; i++)
+    {
+        int entries_in_Row     = (bsr_row_ptr[i + 1] - bsr_row_ptr[i]) * block_dim;
+        int entries_in_row_sum = (bsr_row_ptr[i] - bsr_base) * entries_in_block;
+
+        for(int j = bsr_row_ptr[i] - bsr_base; j < bsr_row_ptr[i + 1] - bsr_base; j++)
+        {
+            int col    = bsr_col_ind[j] - bsr_base;
+            int offset = entries_in_row_sum + block_dim * (j - (bsr_row_ptr[i] - bsr_base));
+
+            for(int k = 0; k < block_dim; k++)
+            {
+                for(int l = 0; l < block_dim; l++)
+                {
+                    csr_col_ind[offset + k * entries_in_Row + l] = block_dim * col + l + csr_base;
+                    if(direction == HIPSPARSE_DIRECTION_ROW)
+                    {
+                        csr_val[offset + k * entries_in_Row + l]
+                            = bsr_val[j * entries_in_block + k * block_dim + l];
+                    }
+                    else
+                    {
+                        csr_val[offset + k * entries_in_Row + l]
+                            = bsr_val[j * entries_in_block + k + block_dim * l];
+                    }
+                }
+            }
+        }
+    }
+}
+
+/* ============================================================================================ */
+/*! \brief  s + a * x. For real types, contraction is left to the compiler, such that the block
+ *  kernels below vectorize.
+ */
+template <typename T>
+inline T host_bsr_madd(T a, T x, T s)
+{
+    return testing_fma(a, x, s);
+}
+
+inline float host_bsr_madd(float a, float x, float s)
+{
+    return s + a * x;
+}
+
+inline double host_bsr_madd(double a, double x, double s)
+{
+    return s + a * x;
+}
+
+/*! \brief  y = alpha * A_i * x + beta * y for the block row of a BSR matrix with the blocks in
+ *  [block_begin, block_end). x is accessed with stride incx, y points to the block row of the
+ *  result. BLOCKDIM > 0 fixes the block dimension at compile time, such that the accumulators
+ *  stay in registers and the loops over the block rows are unrolled and vectorized. BLOCKDIM == 0
+ *  handles any block dimension bsr_dim.
+ */
+template <int BLOCKDIM, typename T>
+inline void host_bsrmv_block_row(hipsparseDirection_t dir,
+                                 int                  bsr_dim,
+                                 int                  block_begin,
+                                 int                  block_end,
+                                 T                    alpha,
+                                 const int*           bsr_col_ind,
+                                 const T*             bsr_val,
+                                 const T*             x,
+                                 int64_t              incx,
+                                 T                    beta,
+                                 T*                   y,
+                                 hipsparseIndexBase_t base)
+{
+    const int dim = (BLOCKDIM > 0) ? BLOCKDIM : bsr_dim;
+
+    T sum[(BLOCKDIM > 0) ? BLOCKDIM : 1];
+
+    for(int bi = 0; bi < ((BLOCKDIM > 0) ? BLOCKDIM : 1); ++bi)
     {
-        csx_row_col_ptr[i + 1] = nnz_per_row_columns[i] + csx_row_col_ptr[i];
+        sum[bi] = make_DataType<T>(0);
     }
 
-    switch(DIRA)
-    {
-    case HIPSPARSE_DIRECTION_COLUMN:
+    if(BLOCKDIM > 0)
     {
-        for(int j = 0; j < n; ++j)
+        for(int j = block_begin; j < block_end; ++j)
         {
-            for(int i = 0; i < m; ++i)
+            const T* block = bsr_val + static_cast<int64_t>(dim * dim) * j;
+            const T* xb    = x + static_cast<int64_t>(bsr_col_ind[j] - base) * dim * incx;
+
+            if(dir == HIPSPARSE_DIRECTION_COLUMN)
             {
-                if(A[j * ld + i] != s_zero)
+                for(int bj = 0; bj < dim; ++bj)
                 {
-                    *csx_val++         = A[j * ld + i];
-                    *csx_col_row_ind++ = i + base;
+                    T xj = xb[bj * incx];
+
+                    for(int bi = 0; bi < dim; ++bi)
+                    {
+                        sum[bi] = host_bsr_madd(block[dim * bj + bi], xj, sum[bi]);
+                    }
+                }
+            }
+            else
+            {
+                for(int bj = 0; bj < dim; ++bj)
+                {
+                    T xj = xb[bj * incx];
+
+                    for(int bi = 0; bi < dim; ++bi)
+                    {
+                        sum[bi] = host_bsr_madd(block[dim * bi + bj], xj, sum[bi]);
+                    }
                 }
             }
         }
-        break;
     }
 
-    case HIPSPARSE_DIRECTION_ROW:
+    for(int bi = 0; bi < dim; ++bi)
     {
-        //
-        // Does not matter having an orthogonal traversal ... testing only.
-        // Otherwise, we would use csxRowPtrA to store the shifts.
-        // and once the job is done a simple memory move would reinitialize the csxRowPtrA to its initial state)
-        //
-        for(int i = 0; i < m; ++i)
+        T s = make_DataType<T>(0);
+
+        if(BLOCKDIM > 0)
         {
-            for(int j = 0; j < n; ++j)
+            s = sum[bi];
+        }
+        else
+        {
+            // Generic block dimension, one row of the blocks at a time
+            for(int j = block_begin; j < block_end; ++j)
             {
-                if(A[j * ld + i] != s_zero)
+                const T* block = bsr_val + static_cast<int64_t>(dim) * dim * j;
+                const T* xb    = x + static_cast<int64_t>(bsr_col_ind[j] - base) * dim * incx;
+
+                for(int bj = 0; bj < dim; ++bj)
                 {
-                    *csx_val++         = A[j * ld + i];
-                    *csx_col_row_ind++ = j + base;
+                    T a = (dir == HIPSPARSE_DIRECTION_COLUMN) ? block[dim * bj + bi]
+                                                              : block[dim * bi + bj];
+
+                    s = host_bsr_madd(a, xb[bj * incx], s);
                 }
             }
         }
-        break;
-    }
+
+        if(beta != make_DataType<T>(0))
+        {
+            y[bi] = testing_fma(beta, y[bi], testing_mult(alpha, s));
+        }
+        else
+        {
+            y[bi] = testing_mult(alpha, s);
+        }
     }
 }
 
-template <typename T>
-void host_prune_dense2csr(int                   m,
-                          int                   n,
-                          const std::vector<T>& A,
-                          int                   lda,
-                          hipsparseIndexBase_t  base,
-                          T                     threshold,
-                          int&                  nnz,
-                          std::vector<T>&       csr_val,
-                          std::vector<int>&     csr_row_ptr,
-                          std::vector<int>&     csr_col_ind)
+/*! \brief  Y = alpha * A * X + beta * Y for the n columns of X and Y, restricted to the block rows
+ *  listed in bsr_mask_ptr, or all block rows if bsr_mask_ptr is null. Block row i spans the blocks
+ *  [bsr_row_ptr[i], bsr_end_ptr[i]). Unmasked block rows are distributed across threads by their
+ *  number of blocks.
+ */
+template <int BLOCKDIM, typename T>
+inline void host_bsrmv_rows(hipsparseDirection_t dir,
+                            int                  bsr_dim,
+                            int                  mb,
+                            int                  n,
+                            int                  size_of_mask,
+                            const int*           bsr_mask_ptr,
+                            const int*           bsr_row_ptr,
+                            const int*           bsr_end_ptr,
+                            T                    alpha,
+                            const int*           bsr_col_ind,
+                            const T*             bsr_val,
+                            const T*             x,
+                            int64_t              incx,
+                            int64_t              ldx,
+                            T                    beta,
+                            T*                   y,
+                            int64_t              ldy,
+                            hipsparseIndexBase_t base)
 {
-    csr_row_ptr.resize(m + 1, 0);
-    csr_row_ptr[0] = base;
-
+    auto block_row = [&](int i) {
+        for(int k = 0; k < n; ++k)
+        {
+            host_bsrmv_block_row<BLOCKDIM>(dir,
+                                           bsr_dim,
+                                           bsr_row_ptr[i] - base,
+                                           bsr_end_ptr[i] - base,
+                                           alpha,
+                                           bsr_col_ind,
+                                           bsr_val,
+                                           x + ldx * k,
+                                           incx,
+                                           beta,
+                                           y + ldy * k + static_cast<int64_t>(bsr_dim) * i,
+                                           base);
+        }
+    };
+
+    if(bsr_mask_ptr != nullptr)
+    {
 #ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
+#pragma omp parallel for schedule(dynamic, 64)
 #endif
-    for(int i = 0; i < m; i++)
-    {
-        for(int j = 0; j < n; j++)
+        for(int m = 0; m < size_of_mask; ++m)
         {
-            if(testing_abs(A[lda * j + i]) > threshold)
-            {
-                csr_row_ptr[i + 1]++;
-            }
+            block_row(bsr_mask_ptr[m] - base);
         }
-    }
 
-    for(int i = 1; i <= m; i++)
-    {
-        csr_row_ptr[i] += csr_row_ptr[i - 1];
+        return;
     }
 
-    nnz = csr_row_ptr[m] - csr_row_ptr[0];
-
-    csr_col_ind.resize(nnz);
-    csr_val.resize(nnz);
+    int nparts = std::max(1, std::min(4 * host_max_threads(), mb));
 
-    int index = 0;
-    for(int i = 0; i < m; i++)
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+    for(int p = 0; p < nparts; ++p)
     {
-        for(int j = 0; j < n; j++)
+        int row_begin = 0;
+        int row_end   = 0;
+
+        if(mb > 0)
         {
-            if(testing_abs(A[lda * j + i]) > threshold)
-            {
-                csr_val[index]     = A[lda * j + i];
-                csr_col_ind[index] = j + base;
+            host_csr_partition_rows(mb, bsr_row_ptr, p, nparts, row_begin, row_end);
+        }
 
-                index++;
-            }
+        for(int i = row_begin; i < row_end; ++i)
+        {
+            block_row(i);
         }
     }
 }
 
+/*! \brief  Dispatch host_bsrmv_rows to the kernels specialized for block dimensions 1 to 8. */
 template <typename T>
-void host_prune_dense2csr_by_percentage(int                   m,
-                                        int                   n,
-                                        const std::vector<T>& A,
-                                        int                   lda,
-                                        hipsparseIndexBase_t  base,
-                                        T                     percentage,
-                                        int&                  nnz,
-                                        std::vector<T>&       csr_val,
-                                        std::vector<int>&     csr_row_ptr,
-                                        std::vector<int>&     csr_col_ind)
+inline void host_bsrmv_engine(hipsparseDirection_t dir,
+                              int                  bsr_dim,
+                              int                  mb,
+                              int                  n,
+                              int                  size_of_mask,
+                              const int*           bsr_mask_ptr,
+                              const int*           bsr_row_ptr,
+                              const int*           bsr_end_ptr,
+                              T                    alpha,
+                              const int*           bsr_col_ind,
+                              const T*             bsr_val,
+                              const T*             x,
+                              int64_t              incx,
+                              int64_t              ldx,
+                              T                    beta,
+                              T*                   y,
+                              int64_t              ldy,
+                              hipsparseIndexBase_t base)
 {
-    int nnz_A = m * n;
-    int pos   = std::ceil(nnz_A * (percentage / 100)) - 1;
-    pos       = std::min(pos, nnz_A - 1);
-    pos       = std::max(pos, 0);
-
-    std::vector<T> sorted_A(nnz_A);
-    for(int i = 0; i < n; i++)
-    {
-        for(int j = 0; j < m; j++)
-        {
-            sorted_A[m * i + j] = std::abs(A[lda * i + j]);
-        }
+#define HOST_BSRMV_ROWS(BLOCKDIM)                           \
+    host_bsrmv_rows<BLOCKDIM>(dir,                          \
+                              bsr_dim,                      \
+                              mb,                           \
+                              n,                            \
+                              size_of_mask,                 \
+                              bsr_mask_ptr,                 \
+                              bsr_row_ptr,                  \
+                              bsr_end_ptr,                  \
+                              alpha,                        \
+                              bsr_col_ind,                  \
+                              bsr_val,                      \
+                              x,                            \
+                              incx,                         \
+                              ldx,                          \
+                              beta,                         \
+                              y,                            \
+                              ldy,                          \
+                              base)
+
+    switch(bsr_dim)
+    {
+    case 1:
+        HOST_BSRMV_ROWS(1);
+        break;
+    case 2:
+        HOST_BSRMV_ROWS(2);
+        break;
+    case 3:
+        HOST_BSRMV_ROWS(3);
+        break;
+    case 4:
+        HOST_BSRMV_ROWS(4);
+        break;
+    case 5:
+        HOST_BSRMV_ROWS(5);
+        break;
+    case 6:
+        HOST_BSRMV_ROWS(6);
+        break;
+    case 7:
+        HOST_BSRMV_ROWS(7);
+        break;
+    case 8:
+        HOST_BSRMV_ROWS(8);
+        break;
+    default:
+        HOST_BSRMV_ROWS(0);
+        break;
     }
 
-    std::sort(sorted_A.begin(), sorted_A.end());
-
-    T threshold = (nnz_A > 0) ? sorted_A[pos] : make_DataType<T>(0);
-    host_prune_dense2csr<T>(m, n, A, lda, base, threshold, nnz, csr_val, csr_row_ptr, csr_col_ind);
+#undef HOST_BSRMV_ROWS
 }
 
-template <hipsparseDirection_t DIRA, typename T>
-void host_csx2dense(int                  m,
-                    int                  n,
-                    hipsparseIndexBase_t base,
-                    const T*             csx_val,
-                    const int*           csx_row_col_ptr,
-                    const int*           csx_col_row_ind,
-                    T*                   A,
-                    int                  ld)
+template <typename T>
+inline void host_bsrmv(hipsparseDirection_t dir,
+                       hipsparseOperation_t trans,
+                       int                  mb,
+                       int                  nb,
+                       int                  nnzb,
+                       T                    alpha,
+                       const int*           bsr_row_ptr,
+                       const int*           bsr_col_ind,
+                       const T*             bsr_val,
+                       int                  bsr_dim,
+                       const T*             x,
+                       T                    beta,
+                       T*                   y,
+                       hipsparseIndexBase_t base)
 {
-    static constexpr T s_zero = {};
-    switch(DIRA)
-    {
-    case HIPSPARSE_DIRECTION_COLUMN:
+    // Quick return
+    if(alpha == make_DataType<T>(0))
     {
-        for(int col = 0; col < n; ++col)
+        if(beta != make_DataType<T>(1))
         {
-            for(int row = 0; row < m; ++row)
-            {
-                A[row + ld * col] = s_zero;
-            }
-            const int bound = csx_row_col_ptr[col + 1] - base;
-            for(int at = csx_row_col_ptr[col] - base; at < bound; ++at)
+            for(int i = 0; i < mb * bsr_dim; ++i)
             {
-                A[(csx_col_row_ind[at] - base) + ld * col] = csx_val[at];
+                y[i] = testing_mult(beta, y[i]);
             }
         }
-        break;
+
+        return;
     }
 
-    case HIPSPARSE_DIRECTION_ROW:
+    host_bsrmv_engine(dir,
+                      bsr_dim,
+                      mb,
+                      1,
+                      0,
+                      (const int*)nullptr,
+                      bsr_row_ptr,
+                      bsr_row_ptr + 1,
+                      alpha,
+                      bsr_col_ind,
+                      bsr_val,
+                      x,
+                      1,
+                      0,
+                      beta,
+                      y,
+                      0,
+                      base);
+}
+
+/*! \brief  Masked BSR matrix vector multiplication. Only the block rows listed in bsr_mask_ptr
+ *  are computed, using the blocks in [bsr_row_ptr[i], bsr_end_ptr[i]).
+ */
+template <typename T>
+inline void host_bsrxmv(hipsparseDirection_t dir,
+                        hipsparseOperation_t trans,
+                        int                  size_of_mask,
+                        int                  mb,
+                        int                  nb,
+                        int                  nnzb,
+                        T                    alpha,
+                        const int*           bsr_mask_ptr,
+                        const int*           bsr_row_ptr,
+                        const int*           bsr_end_ptr,
+                        const int*           bsr_col_ind,
+                        const T*             bsr_val,
+                        int                  bsr_dim,
+                        const T*             x,
+                        T                    beta,
+                        T*                   y,
+                        hipsparseIndexBase_t base)
+{
+    // Quick return
+    if(alpha == make_DataType<T>(0))
     {
-        for(int row = 0; row < m; ++row)
+        if(beta != make_DataType<T>(1))
         {
-            for(int col = 0; col < n; ++col)
+            for(int m = 0; m < size_of_mask; ++m)
             {
-                A[col * ld + row] = s_zero;
-            }
+                T* yb = y + static_cast<int64_t>(bsr_dim) * (bsr_mask_ptr[m] - base);
 
-            const int bound = csx_row_col_ptr[row + 1] - base;
-            for(int at = csx_row_col_ptr[row] - base; at < bound; ++at)
-            {
-                A[(csx_col_row_ind[at] - base) * ld + row] = csx_val[at];
+                for(int bi = 0; bi < bsr_dim; ++bi)
+                {
+                    yb[bi] = testing_mult(beta, yb[bi]);
+                }
             }
         }
-        break;
+
+        return;
     }
+
+    host_bsrmv_engine(dir,
+                      bsr_dim,
+                      mb,
+                      1,
+                      size_of_mask,
+                      bsr_mask_ptr,
+                      bsr_row_ptr,
+                      bsr_end_ptr,
+                      alpha,
+                      bsr_col_ind,
+                      bsr_val,
+                      x,
+                      1,
+                      0,
+                      beta,
+                      y,
+                      0,
+                      base);
+}
+
+/* ============================================================================================ */
+/*! \brief  Row dot product sum_j (alpha * val[j]) * x[col[j]] in sequential order. */
+template <typename I, typename J, typename T>
+inline T host_csr_row_dot(
+    I row_begin, I row_end, T alpha, const J* col, const T* val, const T* x, int base)
+{
+    T sum = make_DataType<T>(0);
+
+    for(I j = row_begin; j < row_end; ++j)
+    {
+        sum = testing_fma(testing_mult(alpha, val[j]), x[col[j] - base], sum);
     }
+
+    return sum;
 }
 
-template <typename T>
-inline void host_csr_to_csr_compress(int                     M,
-                                     int                     N,
-                                     const std::vector<int>& csr_row_ptr_A,
-                                     const std::vector<int>& csr_col_ind_A,
-                                     const std::vector<T>&   csr_val_A,
-                                     std::vector<int>&       csr_row_ptr_C,
-                                     std::vector<int>&       csr_col_ind_C,
-                                     std::vector<T>&         csr_val_C,
-                                     hipsparseIndexBase_t    base,
-                                     T                       tol)
+template <typename I, typename J>
+inline float host_csr_row_dot(
+    I row_begin, I row_end, float alpha, const J* col, const float* val, const float* x, int base)
 {
-    if(M <= 0 || N <= 0)
+    float sum = 0.0f;
+#ifdef _OPENMP
+#pragma omp simd reduction(+ : sum)
+#endif
+    for(I j = row_begin; j < row_end; ++j)
     {
-        return;
+        sum += alpha * val[j] * x[col[j] - base];
     }
 
-    // find how many entries will be in each compressed CSR matrix row
-    std::vector<int> nnz_per_row(M);
+    return sum;
+}
 
+template <typename I, typename J>
+inline double host_csr_row_dot(I             row_begin,
+                               I             row_end,
+                               double        alpha,
+                               const J*      col,
+                               const double* val,
+                               const double* x,
+                               int           base)
+{
+    double sum = 0.0;
 #ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
+#pragma omp simd reduction(+ : sum)
 #endif
-    for(int i = 0; i < M; i++)
+    for(I j = row_begin; j < row_end; ++j)
+    {
+        sum += alpha * val[j] * x[col[j] - base];
+    }
+
+    return sum;
+}
+
+/*! \brief  Row dot product in the order of a device wavefront of size wf_size, i.e. wf_size
+ *  strided partial sums followed by a tree reduction. wf_size must not exceed 64.
+ */
+template <typename I, typename J, typename T>
+inline T host_csr_row_dot_wf(I        row_begin,
+                             I        row_end,
+                             T        alpha,
+                             const J* col,
+                             const T* val,
+                             const T* x,
+                             int      base,
+                             int      wf_size)
+{
+    T sum[64];
+
+    for(int k = 0; k < wf_size; ++k)
     {
-        int start = csr_row_ptr_A[i] - base;
-        int end   = csr_row_ptr_A[i + 1] - base;
-        int count = 0;
+        sum[k] = make_DataType<T>(0);
+    }
 
-        for(int j = start; j < end; j++)
+    for(I j = row_begin; j < row_end; j += wf_size)
+    {
+        for(int k = 0; k < wf_size; ++k)
         {
-            if(testing_abs(csr_val_A[j]) > testing_real(tol)
-               && testing_abs(csr_val_A[j]) > (std::numeric_limits<float>::min)())
+            if(j + k < row_end)
             {
-                count++;
+                sum[k] = testing_fma(testing_mult(alpha, val[j + k]), x[col[j + k] - base], sum[k]);
             }
         }
-
-        nnz_per_row[i] = count;
     }
 
-    // add up total number of entries
-    int nnz_C = 0;
-    for(int i = 0; i < M; i++)
+    for(int j = 1; j < wf_size; j <<= 1)
     {
-        nnz_C += nnz_per_row[i];
+        for(int k = 0; k < wf_size - j; ++k)
+        {
+            sum[k] = sum[k] + sum[k + j];
+        }
     }
 
-    //column indices and value arrays for compressed CSR matrix
-    csr_col_ind_C.resize(nnz_C);
-    csr_val_C.resize(nnz_C);
+    return sum[0];
+}
 
-    // fill in row pointer array for compressed CSR matrix
-    csr_row_ptr_C.resize(M + 1);
+/* ============================================================================================ */
+/*! \brief  Tolerance scale for unit_check_near of products with a CSR matrix. Rounding errors of
+ *  a sum grow with the number of its terms, typically like their square root. Sums of up to 64
+ *  terms keep the default tolerance. Rows and columns are both considered, such that the scale
+ *  holds for op(A) = A and A^T.
+ */
+template <typename I, typename J>
+inline double host_csr_tolerance_scale(
+    J M, J N, I nnz, const I* csr_row_ptr, const J* csr_col_ind, hipsparseIndexBase_t base)
+{
+    std::vector<I> col_nnz(N, 0);
 
-    csr_row_ptr_C[0] = base;
-    for(int i = 0; i < M; i++)
+    I max_nnz = 0;
+    for(J i = 0; i < M; ++i)
     {
-        csr_row_ptr_C[i + 1] = csr_row_ptr_C[i] + nnz_per_row[i];
+        max_nnz = std::max(max_nnz, csr_row_ptr[i + 1] - csr_row_ptr[i]);
     }
 
-    // fill in column indices and value arrays for compressed CSR matrix
-#ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
-#endif
-    for(int i = 0; i < M; i++)
+    for(I j = 0; j < nnz; ++j)
     {
-        int start = csr_row_ptr_A[i] - base;
-        int end   = csr_row_ptr_A[i + 1] - base;
-        int index = csr_row_ptr_C[i] - base;
-
-        for(int j = start; j < end; j++)
-        {
-            if(testing_abs(csr_val_A[j]) > testing_real(tol)
-               && testing_abs(csr_val_A[j]) > (std::numeric_limits<float>::min)())
-            {
-                csr_col_ind_C[index] = csr_col_ind_A[j];
-                csr_val_C[index]     = csr_val_A[j];
-                index++;
-            }
-        }
+        max_nnz = std::max(max_nnz, ++col_nnz[csr_col_ind[j] - base]);
     }
+
+    return std::max(1.0, std::sqrt(max_nnz / 64.0));
 }
 
-template <typename T>
-inline void host_prune_csr_to_csr(int                     M,
-                                  int                     N,
-                                  int                     nnz_A,
-                                  const std::vector<int>& csr_row_ptr_A,
-                                  const std::vector<int>& csr_col_ind_A,
-                                  const std::vector<T>&   csr_val_A,
-                                  int&                    nnz_C,
-                                  std::vector<int>&       csr_row_ptr_C,
-                                  std::vector<int>&       csr_col_ind_C,
-                                  std::vector<T>&         csr_val_C,
-                                  hipsparseIndexBase_t    csr_base_A,
-                                  hipsparseIndexBase_t    csr_base_C,
-                                  T                       threshold)
+/* ============================================================================================ */
+/*! \brief  CSR matrix vector multiplication y = alpha * op(A) * x + beta * y.
+ *
+ *  If wf_size is 0, each row is reduced sequentially (vectorized for real types). If wf_size is
+ *  the device warp size (32 or 64), rows are reduced in the same order as the device csrmv kernel
+ *  so that results are bitwise reproducible. Transposed products are scattered by ranges of rows
+ *  into per range partial results, which are then added in range order.
+ */
+template <typename I, typename J, typename T>
+inline void host_csrmv(hipsparseOperation_t trans,
+                       J                    M,
+                       J                    N,
+                       I                    nnz,
+                       T                    alpha,
+                       const I*             csr_row_ptr,
+                       const J*             csr_col_ind,
+                       const T*             csr_val,
+                       const T*             x,
+                       T                    beta,
+                       T*                   y,
+                       hipsparseIndexBase_t base,
+                       unsigned int         wf_size = 0)
 {
-    csr_row_ptr_C.resize(M + 1, 0);
-    csr_row_ptr_C[0] = csr_base_C;
+    if(trans == HIPSPARSE_OPERATION_NON_TRANSPOSE)
+    {
+        int WF_SIZE = 0;
+
+        if(wf_size != 0)
+        {
+            J nnz_per_row = (M == 0) ? 0 : (nnz / M);
+
+            if(nnz_per_row < 4)
+                WF_SIZE = 2;
+            else if(nnz_per_row < 8)
+                WF_SIZE = 4;
+            else if(nnz_per_row < 16)
+                WF_SIZE = 8;
+            else if(nnz_per_row < 32)
+                WF_SIZE = 16;
+            else if(nnz_per_row < 64 || wf_size == 32)
+                WF_SIZE = 32;
+            else
+                WF_SIZE = 64;
+        }
 
 #ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
+#pragma omp parallel
 #endif
-    for(int i = 0; i < M; i++)
-    {
-        for(int j = csr_row_ptr_A[i] - csr_base_A; j < csr_row_ptr_A[i + 1] - csr_base_A; j++)
         {
-            if(testing_abs(csr_val_A[j]) > threshold
-               && testing_abs(csr_val_A[j]) > (std::numeric_limits<float>::min)())
+#ifdef _OPENMP
+            int nthreads = omp_get_num_threads();
+            int tid      = omp_get_thread_num();
+#else
+            int nthreads = 1;
+            int tid      = 0;
+#endif
+
+            J row_begin;
+            J row_end;
+            host_csr_partition_rows(M, csr_row_ptr, tid, nthreads, row_begin, row_end);
+
+            for(J i = row_begin; i < row_end; ++i)
             {
-                csr_row_ptr_C[i + 1]++;
+                I j_begin = csr_row_ptr[i] - base;
+                I j_end   = csr_row_ptr[i + 1] - base;
+
+                T sum = (WF_SIZE == 0)
+                            ? host_csr_row_dot(j_begin, j_end, alpha, csr_col_ind, csr_val, x, base)
+                            : host_csr_row_dot_wf(
+                                j_begin, j_end, alpha, csr_col_ind, csr_val, x, base, WF_SIZE);
+
+                if(beta == make_DataType<T>(0.0))
+                {
+                    y[i] = sum;
+                }
+                else
+                {
+                    y[i] = testing_fma(beta, y[i], sum);
+                }
             }
         }
     }
-
-    for(int i = 1; i <= M; i++)
+    else
     {
-        csr_row_ptr_C[i] += csr_row_ptr_C[i - 1];
-    }
+        // Per range partial results only pay off if they are small compared to the matrix
+        int64_t fill   = static_cast<int64_t>(nnz) / std::max(static_cast<int64_t>(N), int64_t(1));
+        int     nparts = static_cast<int>(std::min(static_cast<int64_t>(host_max_threads()), fill));
 
-    nnz_C = csr_row_ptr_C[M] - csr_row_ptr_C[0];
+        nparts = std::max(1, nparts);
 
-    csr_col_ind_C.resize(nnz_C);
-    csr_val_C.resize(nnz_C);
+        std::vector<T> partial(static_cast<size_t>(nparts) * N, make_DataType<T>(0.0));
 
-    int index = 0;
-    for(int i = 0; i < M; i++)
-    {
-        for(int j = csr_row_ptr_A[i] - csr_base_A; j < csr_row_ptr_A[i + 1] - csr_base_A; j++)
+        // Transposed SpMV, each range of rows is scattered into its own partial result
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static, 1)
+#endif
+        for(int p = 0; p < nparts; ++p)
         {
-            if(testing_abs(csr_val_A[j]) > threshold
-               && testing_abs(csr_val_A[j]) > (std::numeric_limits<float>::min)())
-            {
-                csr_col_ind_C[index] = (csr_col_ind_A[j] - csr_base_A) + csr_base_C;
-                csr_val_C[index]     = csr_val_A[j];
+            J  row_begin = 0;
+            J  row_end   = 0;
+            T* partial_p = partial.data() + static_cast<int64_t>(p) * N;
 
-                index++;
+            if(M > 0)
+            {
+                host_csr_partition_rows(M, csr_row_ptr, p, nparts, row_begin, row_end);
             }
-        }
-    }
-}
 
-template <typename T>
-void host_prune_csr_to_csr_by_percentage(int                     M,
-                                         int                     N,
-                                         int                     nnz_A,
-                                         const std::vector<int>& csr_row_ptr_A,
-                                         const std::vector<int>& csr_col_ind_A,
-                                         const std::vector<T>&   csr_val_A,
-                                         int&                    nnz_C,
-                                         std::vector<int>&       csr_row_ptr_C,
-                                         std::vector<int>&       csr_col_ind_C,
-                                         std::vector<T>&         csr_val_C,
-                                         hipsparseIndexBase_t    csr_base_A,
-                                         hipsparseIndexBase_t    csr_base_C,
-                                         T                       percentage)
-{
-    int pos = std::ceil(nnz_A * (percentage / 100)) - 1;
-    pos     = std::min(pos, nnz_A - 1);
-    pos     = std::max(pos, 0);
+            for(J i = row_begin; i < row_end; ++i)
+            {
+                I j_begin = csr_row_ptr[i] - base;
+                I j_end   = csr_row_ptr[i + 1] - base;
+                T row_val = testing_mult(alpha, x[i]);
+
+                for(I j = j_begin; j < j_end; ++j)
+                {
+                    J col = csr_col_ind[j] - base;
+                    T val = (trans == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE)
+                                ? testing_conj(csr_val[j])
+                                : csr_val[j];
 
-    std::vector<T> sorted_A(nnz_A);
+                    partial_p[col] = testing_fma(val, row_val, partial_p[col]);
+                }
+            }
+        }
 
+        // Scale y with beta and add the partial results in range order
 #ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
+#pragma omp parallel for schedule(static, 4096)
 #endif
-    for(int i = 0; i < nnz_A; i++)
-    {
-        sorted_A[i] = testing_abs(csr_val_A[i]);
-    }
-
-    std::sort(sorted_A.begin(), sorted_A.end());
+        for(J i = 0; i < N; ++i)
+        {
+            T sum = partial[i];
 
-    T threshold = sorted_A[pos];
+            for(int p = 1; p < nparts; ++p)
+            {
+                sum = sum + partial[static_cast<int64_t>(p) * N + i];
+            }
 
-    host_prune_csr_to_csr<T>(M,
-                             N,
-                             nnz_A,
-                             csr_row_ptr_A,
-                             csr_col_ind_A,
-                             csr_val_A,
-                             nnz_C,
-                             csr_row_ptr_C,
-                             csr_col_ind_C,
-                             csr_val_C,
-                             csr_base_A,
-                             csr_base_C,
-                             threshold);
+            y[i] = testing_fma(beta, y[i], sum);
+        }
+    }
 }
 
-template <typename I, typename J, typename T>
-inline void host_csr_to_csc(J        M,
-                            J        N,
-                            I        nnz,
-                            const I* csr_row_ptr,
-                            const J* csr_col_ind,
-                            const T* csr_val,
-                            //const std::vector<I>& csr_row_ptr,
-                            //const std::vector<J>& csr_col_ind,
-                            //const std::vector<T>&   csr_val,
-                            std::vector<J>&      csc_row_ind,
-                            std::vector<I>&      csc_col_ptr,
-                            std::vector<T>&      csc_val,
-                            hipsparseAction_t    action,
-                            hipsparseIndexBase_t base)
+template <typename T>
+inline void host_bsrmm(int                     Mb,
+                       int                     N,
+                       int                     Kb,
+                       int                     block_dim,
+                       hipsparseDirection_t    dir,
+                       hipsparseOperation_t    transA,
+                       hipsparseOperation_t    transB,
+                       T                       alpha,
+                       const std::vector<int>& bsr_row_ptr_A,
+                       const std::vector<int>& bsr_col_ind_A,
+                       const std::vector<T>&   bsr_val_A,
+                       const std::vector<T>&   B,
+                       int                     ldb,
+                       T                       beta,
+                       std::vector<T>&         C,
+                       int                     ldc,
+                       hipsparseIndexBase_t    base)
 {
-    csc_row_ind.resize(nnz);
-    csc_col_ptr.resize(N + 1, 0);
-    csc_val.resize(nnz);
-
-    // Determine nnz per column
-    for(I i = 0; i < nnz; ++i)
+    if(transA != HIPSPARSE_OPERATION_NON_TRANSPOSE)
     {
-        ++csc_col_ptr[csr_col_ind[i] + 1 - base];
+        return;
     }
 
-    // Scan
-    for(J i = 0; i < N; ++i)
+    if(transB != HIPSPARSE_OPERATION_NON_TRANSPOSE && transB != HIPSPARSE_OPERATION_TRANSPOSE)
     {
-        csc_col_ptr[i + 1] += csc_col_ptr[i];
+        return;
     }
 
-    // Fill row indices and values
-    for(J i = 0; i < M; ++i)
-    {
-        I row_begin = csr_row_ptr[i] - base;
-        I row_end   = csr_row_ptr[i + 1] - base;
+    bool    trans_B = (transB == HIPSPARSE_OPERATION_TRANSPOSE);
+    int64_t incx    = trans_B ? ldb : 1;
+    int64_t ldx     = trans_B ? 1 : ldb;
+
+    host_bsrmv_engine(dir,
+                      block_dim,
+                      Mb,
+                      N,
+                      0,
+                      (const int*)nullptr,
+                      bsr_row_ptr_A.data(),
+                      bsr_row_ptr_A.data() + 1,
+                      alpha,
+                      bsr_col_ind_A.data(),
+                      bsr_val_A.data(),
+                      B.data(),
+                      incx,
+                      ldx,
+                      beta,
+                      C.data(),
+                      ldc,
+                      base);
+}
 
-        for(I j = row_begin; j < row_end; ++j)
-        {
-            J col = csr_col_ind[j] - base;
-            I idx = csc_col_ptr[col];
+/* ============================================================================================ */
+/*! \brief  Panel sizes of the host SpMM kernels. Dense operands that are contiguous along N are
+ *  processed in panels of HOST_SPMM_ROW_PANEL columns, small enough to keep the accumulators in
+ *  L1. Strided operands are processed in panels of columns that fit into HOST_SPMM_L2_BYTES.
+ */
+#define HOST_SPMM_ROW_PANEL 256
+#define HOST_SPMM_L2_BYTES 262144
 
-            csc_row_ind[idx] = i + base;
-            csc_val[idx]     = csr_val[j];
+/*! \brief  Number of dense columns of n_rows entries that fit into the L2 budget. */
+template <typename T>
+inline int64_t host_spmm_column_panel(int64_t n_rows)
+{
+    return std::max(static_cast<int64_t>(1),
+                    static_cast<int64_t>(HOST_SPMM_L2_BYTES / sizeof(T))
+                        / std::max(static_cast<int64_t>(1), n_rows));
+}
 
-            ++csc_col_ptr[col];
-        }
+/*! \brief  y[j] = a * op(x[j]) + y[j] for n contiguous entries, using fma. */
+template <typename T>
+inline void host_fma_panel(int64_t n, T a, const T* x, bool conj_x, T* y)
+{
+    for(int64_t j = 0; j < n; ++j)
+    {
+        y[j] = testing_fma(a, testing_conj(x[j], conj_x), y[j]);
     }
+}
 
-    // Shift column pointer array
-    for(J i = N; i > 0; --i)
+inline void host_fma_panel(int64_t n, float a, const float* x, bool, float* y)
+{
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+    for(int64_t j = 0; j < n; ++j)
     {
-        csc_col_ptr[i] = csc_col_ptr[i - 1] + base;
+        y[j] = std::fma(a, x[j], y[j]);
     }
-
-    csc_col_ptr[0] = base;
 }
 
-template <typename T>
-inline void host_csr_to_bsr(hipsparseDirection_t    direction,
-                            int                     M,
-                            int                     N,
-                            int                     block_dim,
-                            int&                    nnzb,
-                            hipsparseIndexBase_t    csr_base,
-                            const std::vector<int>& csr_row_ptr,
-                            const std::vector<int>& csr_col_ind,
-                            const std::vector<T>&   csr_val,
-                            hipsparseIndexBase_t    bsr_base,
-                            std::vector<int>&       bsr_row_ptr,
-                            std::vector<int>&       bsr_col_ind,
-                            std::vector<T>&         bsr_val)
+inline void host_fma_panel(int64_t n, double a, const double* x, bool, double* y)
 {
-    int mb = (M + block_dim - 1) / block_dim;
-    int nb = (N + block_dim - 1) / block_dim;
-
-    // quick return if block_dim == 1
-    if(block_dim == 1)
-    {
-        bsr_row_ptr.resize(mb + 1, 0);
 #ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
+#pragma omp simd
 #endif
-        for(size_t i = 0; i < csr_row_ptr.size(); i++)
-        {
-            bsr_row_ptr[i] = (csr_row_ptr[i] - csr_base) + bsr_base;
-        }
+    for(int64_t j = 0; j < n; ++j)
+    {
+        y[j] = std::fma(a, x[j], y[j]);
+    }
+}
 
-        nnzb = bsr_row_ptr[mb] - bsr_row_ptr[0];
+/*! \brief  y[j] = y[j] + alpha * (a * op(x[j])) for n contiguous entries. */
+template <typename T>
+inline void host_scale_add_panel(int64_t n, T alpha, T a, const T* x, bool conj_x, T* y)
+{
+    for(int64_t j = 0; j < n; ++j)
+    {
+        y[j] = y[j] + testing_mult(alpha, testing_mult(a, testing_conj(x[j], conj_x)));
+    }
+}
 
-        bsr_col_ind.resize(nnzb, 0);
-        bsr_val.resize(nnzb * block_dim * block_dim, make_DataType<T>(0));
+inline void
+    host_scale_add_panel(int64_t n, float alpha, float a, const float* x, bool, float* y)
+{
 #ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
+#pragma omp simd
 #endif
-        for(size_t i = 0; i < csr_col_ind.size(); i++)
-        {
-            bsr_col_ind[i] = (csr_col_ind[i] - csr_base) + bsr_base;
-        }
+    for(int64_t j = 0; j < n; ++j)
+    {
+        y[j] = y[j] + alpha * (a * x[j]);
+    }
+}
+
+inline void
+    host_scale_add_panel(int64_t n, double alpha, double a, const double* x, bool, double* y)
+{
 #ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
+#pragma omp simd
 #endif
-        for(size_t i = 0; i < csr_val.size(); i++)
-        {
-            bsr_val[i] = csr_val[i];
-        }
-
-        return;
+    for(int64_t j = 0; j < n; ++j)
+    {
+        y[j] = y[j] + alpha * (a * x[j]);
     }
+}
 
-    // determine number of non-zero block columns for each block row of the bsr matrix
-    bsr_row_ptr.resize(mb + 1, 0);
-
-    bsr_row_ptr[0] = bsr_base;
+/*! \brief  Scale the M x N dense matrix C by beta. */
+template <typename T, typename J>
+inline void host_dense_scale(J M, J N, T beta, T* C, J ldc, hipsparseOrder_t order_C)
+{
+    J outer = (order_C == HIPSPARSE_ORDER_COL) ? N : M;
+    J inner = (order_C == HIPSPARSE_ORDER_COL) ? M : N;
 
 #ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
+#pragma omp parallel for schedule(dynamic, 64)
 #endif
-    for(int i = 0; i < mb; i++)
+    for(J i = 0; i < outer; ++i)
     {
-        int start = csr_row_ptr[i * block_dim] - csr_base;
-        int end   = csr_row_ptr[std::min(M, block_dim * i + block_dim)] - csr_base;
-
-        std::vector<int> temp(nb, 0);
-        for(int j = start; j < end; j++)
+        for(J j = 0; j < inner; ++j)
         {
-            int blockCol   = (csr_col_ind[j] - csr_base) / block_dim;
-            temp[blockCol] = 1;
+            C[static_cast<int64_t>(i) * ldc + j]
+                = testing_mult(beta, C[static_cast<int64_t>(i) * ldc + j]);
         }
+    }
+}
 
-        int sum = 0;
-        for(size_t j = 0; j < temp.size(); j++)
-        {
-            sum += temp[j];
-        }
+/*! \brief  Width of the column panels that are distributed over the threads. At most max_panel,
+ *  and small enough that every thread gets a panel.
+ */
+template <typename J>
+inline J host_spmm_thread_panel(J N, int64_t max_panel)
+{
+    int64_t nthreads = host_max_threads();
+    int64_t panel    = std::min(max_panel, (static_cast<int64_t>(N) + nthreads - 1) / nthreads);
 
-        bsr_row_ptr[i + 1] = sum;
-    }
+    return static_cast<J>(std::max(static_cast<int64_t>(1), panel));
+}
 
-    for(int i = 0; i < mb; i++)
+template <typename I, typename J, typename T>
+void host_csrmm(J                    M,
+                J                    N,
+                J                    K,
+                hipsparseOperation_t transA,
+                hipsparseOperation_t transB,
+                T                    alpha,
+                const I*             csr_row_ptr_A,
+                const J*             csr_col_ind_A,
+                const T*             csr_val_A,
+                const T*             B,
+                J                    ldb,
+                hipsparseOrder_t     orderB,
+                T                    beta,
+                T*                   C,
+                J                    ldc,
+                hipsparseOrder_t     orderC,
+                hipsparseIndexBase_t base,
+                bool                 force_conj_A)
+{
+    bool conj_A = (transA == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE || force_conj_A);
+    bool conj_B = (transB == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE);
+
+    // op(B) is either strided (column major) or contiguous (row major) along N
+    bool col_B = (transB == HIPSPARSE_OPERATION_NON_TRANSPOSE && orderB == HIPSPARSE_ORDER_COL)
+                 || (transB != HIPSPARSE_OPERATION_NON_TRANSPOSE && orderB != HIPSPARSE_ORDER_COL);
+    bool col_C = (orderC == HIPSPARSE_ORDER_COL);
+
+    int64_t ldb_k = col_B ? 1 : ldb;
+    int64_t ldb_j = col_B ? ldb : 1;
+    int64_t ldc_i = col_C ? 1 : ldc;
+    int64_t ldc_j = col_C ? ldc : 1;
+
+    if(transA == HIPSPARSE_OPERATION_NON_TRANSPOSE)
     {
-        bsr_row_ptr[i + 1] += bsr_row_ptr[i];
-    }
+        if(!col_B)
+        {
+            // Rows of B are contiguous, accumulate panels of a row of C with SIMD
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 64)
+#endif
+            for(J i = 0; i < M; i++)
+            {
+                I row_begin = csr_row_ptr_A[i] - base;
+                I row_end   = csr_row_ptr_A[i + 1] - base;
 
-    nnzb = bsr_row_ptr[mb] - bsr_row_ptr[0];
+                T sum[HOST_SPMM_ROW_PANEL];
 
-    // find bsr col indices array
-    bsr_col_ind.resize(nnzb, 0);
-    bsr_val.resize(nnzb * block_dim * block_dim, make_DataType<T>(0));
+                for(J j0 = 0; j0 < N; j0 += HOST_SPMM_ROW_PANEL)
+                {
+                    J nj = std::min(static_cast<J>(HOST_SPMM_ROW_PANEL), static_cast<J>(N - j0));
 
-    int colIndex = 0;
+                    for(J j = 0; j < nj; ++j)
+                    {
+                        sum[j] = make_DataType<T>(0);
+                    }
 
-    for(int i = 0; i < mb; i++)
-    {
-        int start = csr_row_ptr[i * block_dim] - csr_base;
-        int end   = csr_row_ptr[std::min(M, block_dim * i + block_dim)] - csr_base;
+                    for(I k = row_begin; k < row_end; ++k)
+                    {
+                        host_fma_panel(nj,
+                                       testing_conj(csr_val_A[k], conj_A),
+                                       B + (csr_col_ind_A[k] - base) * ldb_k + j0,
+                                       conj_B,
+                                       sum);
+                    }
 
-        std::vector<int> temp(nb, 0);
+                    for(J j = 0; j < nj; ++j)
+                    {
+                        int64_t idx_C = i * ldc_i + (j0 + j) * ldc_j;
 
-        for(int j = start; j < end; j++)
-        {
-            int blockCol   = (csr_col_ind[j] - csr_base) / block_dim;
-            temp[blockCol] = 1;
+                        if(beta == make_DataType<T>(0))
+                        {
+                            C[idx_C] = testing_mult(alpha, sum[j]);
+                        }
+                        else
+                        {
+                            C[idx_C] = testing_fma(beta, C[idx_C], testing_mult(alpha, sum[j]));
+                        }
+                    }
+                }
+            }
         }
-
-        for(int j = 0; j < nb; j++)
+        else
         {
-            if(temp[j] == 1)
+            // Columns of B are contiguous, sweep all rows of A over a panel of B columns that
+            // stays in cache
+            J panel = static_cast<J>(std::min(static_cast<int64_t>(N),
+                                              host_spmm_column_panel<T>(K)));
+
+            for(J j0 = 0; j0 < N; j0 += panel)
             {
-                bsr_col_ind[colIndex] = j + bsr_base;
-                colIndex++;
+                J j1 = std::min(N, static_cast<J>(j0 + panel));
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+                for(J i = 0; i < M; i++)
+                {
+                    I row_begin = csr_row_ptr_A[i] - base;
+                    I row_end   = csr_row_ptr_A[i + 1] - base;
+
+                    for(J j = j0; j < j1; ++j)
+                    {
+                        const T* B_j = B + j * ldb_j;
+
+                        T sum = make_DataType<T>(0);
+
+                        for(I k = row_begin; k < row_end; ++k)
+                        {
+                            sum = testing_fma(testing_conj(csr_val_A[k], conj_A),
+                                              testing_conj(B_j[csr_col_ind_A[k] - base], conj_B),
+                                              sum);
+                        }
+
+                        int64_t idx_C = i * ldc_i + j * ldc_j;
+
+                        if(beta == make_DataType<T>(0))
+                        {
+                            C[idx_C] = testing_mult(alpha, sum);
+                        }
+                        else
+                        {
+                            C[idx_C] = testing_fma(beta, C[idx_C], testing_mult(alpha, sum));
+                        }
+                    }
+                }
             }
         }
     }
-
-    // find bsr values array
-    for(int i = 0; i < M; i++)
+    else
     {
-        int blockRow = i / block_dim;
+        // scale C by beta
+        host_dense_scale(K, N, beta, C, ldc, orderC);
 
-        int start = csr_row_ptr[i] - csr_base;
-        int end   = csr_row_ptr[i + 1] - csr_base;
+        // Each entry of C accumulates in the order of the rows of A, thus columns of C are
+        // independent and processed in panels, concurrently
+        bool contiguous = !col_B && !col_C;
+        J    panel      = host_spmm_thread_panel(
+            N, contiguous ? HOST_SPMM_ROW_PANEL : host_spmm_column_panel<T>(K));
 
-        for(int j = start; j < end; j++)
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+        for(J j0 = 0; j0 < N; j0 += panel)
         {
-            int blockCol = (csr_col_ind[j] - csr_base) / block_dim;
+            J nj = std::min(panel, static_cast<J>(N - j0));
 
-            colIndex = -1;
-            for(int k = bsr_row_ptr[blockRow] - bsr_base; k < bsr_row_ptr[blockRow + 1] - bsr_base;
-                k++)
+            for(J i = 0; i < M; i++)
             {
-                if(bsr_col_ind[k] - bsr_base == blockCol)
+                I row_begin = csr_row_ptr_A[i] - base;
+                I row_end   = csr_row_ptr_A[i + 1] - base;
+
+                for(I k = row_begin; k < row_end; ++k)
                 {
-                    colIndex = k - (bsr_row_ptr[blockRow] - bsr_base);
-                    break;
-                }
-            }
+                    J col = csr_col_ind_A[k] - base;
+                    T val = testing_conj(csr_val_A[k], conj_A);
 
-            assert(colIndex != -1);
+                    if(contiguous)
+                    {
+                        host_scale_add_panel(
+                            nj, alpha, val, B + i * ldb_k + j0, conj_B, C + col * ldc_i + j0);
+                        continue;
+                    }
 
-            int blockIndex = 0;
-            if(direction == HIPSPARSE_DIRECTION_ROW)
-            {
-                blockIndex = (csr_col_ind[j] - csr_base) % block_dim + (i % block_dim) * block_dim;
-            }
-            else
-            {
-                blockIndex
-                    = ((csr_col_ind[j] - csr_base) % block_dim) * block_dim + (i % block_dim);
-            }
+                    for(J j = j0; j < j0 + nj; ++j)
+                    {
+                        int64_t idx_B = i * ldb_k + j * ldb_j;
+                        int64_t idx_C = col * ldc_i + j * ldc_j;
 
-            int index = (bsr_row_ptr[blockRow] - bsr_base) * block_dim * block_dim
-                        + colIndex * block_dim * block_dim + blockIndex;
+                        T prod = testing_mult(val, testing_conj(B[idx_B], conj_B));
 
-            bsr_val[index] = csr_val[j];
+                        C[idx_C] = C[idx_C] + testing_mult(alpha, prod);
+                    }
+                }
+            }
         }
     }
 }
 
-template <typename T>
-void host_bsr_to_bsc(int                  mb,
-                     int                  nb,
-                     int                  nnzb,
-                     int                  bsr_dim,
-                     const int*           bsr_row_ptr,
-                     const int*           bsr_col_ind,
-                     const T*             bsr_val,
-                     std::vector<int>&    bsc_row_ind,
-                     std::vector<int>&    bsc_col_ptr,
-                     std::vector<T>&      bsc_val,
-                     hipsparseIndexBase_t bsr_base,
-                     hipsparseIndexBase_t bsc_base)
+template <typename T, typename I, typename J>
+void host_csrmm_batched(J                    M,
+                        J                    N,
+                        J                    K,
+                        J                    batch_count_A,
+                        J                    offsets_batch_stride_A,
+                        I                    columns_values_batch_stride_A,
+                        hipsparseOperation_t transA,
+                        hipsparseOperation_t transB,
+                        T                    alpha,
+                        const I*             csr_row_ptr_A,
+                        const J*             csr_col_ind_A,
+                        const T*             csr_val_A,
+                        const T*             B,
+                        J                    ldb,
+                        J                    batch_count_B,
+                        I                    batch_stride_B,
+                        hipsparseOrder_t     order_B,
+                        T                    beta,
+                        T*                   C,
+                        J                    ldc,
+                        J                    batch_count_C,
+                        I                    batch_stride_C,
+                        hipsparseOrder_t     order_C,
+                        hipsparseIndexBase_t base,
+                        bool                 force_conj_A)
 {
-    bsc_row_ind.resize(nnzb);
-    bsc_col_ptr.resize(nb + 1, 0);
-    bsc_val.resize(nnzb * bsr_dim * bsr_dim);
+    bool Ci_A_Bi  = (batch_count_A == 1 && batch_count_B == batch_count_C);
+    bool Ci_Ai_B  = (batch_count_B == 1 && batch_count_A == batch_count_C);
+    bool Ci_Ai_Bi = (batch_count_A == batch_count_C && batch_count_A == batch_count_B);
 
-    // Determine nnz per column
-    for(int i = 0; i < nnzb; ++i)
+    if(!Ci_A_Bi && !Ci_Ai_B && !Ci_Ai_Bi)
     {
-        ++bsc_col_ptr[bsr_col_ind[i] + 1 - bsr_base];
+        return;
     }
 
-    // Scan
-    for(int i = 0; i < nb; ++i)
+    if(Ci_A_Bi)
     {
-        bsc_col_ptr[i + 1] += bsc_col_ptr[i];
+        for(J i = 0; i < batch_count_C; i++)
+        {
+            host_csrmm(M,
+                       N,
+                       K,
+                       transA,
+                       transB,
+                       alpha,
+                       csr_row_ptr_A,
+                       csr_col_ind_A,
+                       csr_val_A,
+                       B + batch_stride_B * i,
+                       ldb,
+                       order_B,
+                       beta,
+                       C + batch_stride_C * i,
+                       ldc,
+                       order_C,
+                       base,
+                       force_conj_A);
+        }
     }
-
-    // Fill row indices and values
-    for(int i = 0; i < mb; ++i)
+    else if(Ci_Ai_B)
     {
-        int row_begin = bsr_row_ptr[i] - bsr_base;
-        int row_end   = bsr_row_ptr[i + 1] - bsr_base;
-
-        for(int j = row_begin; j < row_end; ++j)
+        for(J i = 0; i < batch_count_C; i++)
         {
-            int col = bsr_col_ind[j] - bsr_base;
-            int idx = bsc_col_ptr[col];
-
-            bsc_row_ind[idx] = i + bsc_base;
-
-            for(int bi = 0; bi < bsr_dim; ++bi)
-            {
-                for(int bj = 0; bj < bsr_dim; ++bj)
-                {
-                    bsc_val[bsr_dim * bsr_dim * idx + bi + bj * bsr_dim]
-                        = bsr_val[bsr_dim * bsr_dim * j + bi * bsr_dim + bj];
-                }
-            }
-
-            ++bsc_col_ptr[col];
+            host_csrmm(M,
+                       N,
+                       K,
+                       transA,
+                       transB,
+                       alpha,
+                       csr_row_ptr_A + offsets_batch_stride_A * i,
+                       csr_col_ind_A + columns_values_batch_stride_A * i,
+                       csr_val_A + columns_values_batch_stride_A * i,
+                       B,
+                       ldb,
+                       order_B,
+                       beta,
+                       C + batch_stride_C * i,
+                       ldc,
+                       order_C,
+                       base,
+                       force_conj_A);
         }
     }
-
-    // Shift column pointer array
-    for(int i = nb; i > 0; --i)
+    else if(Ci_Ai_Bi)
     {
-        bsc_col_ptr[i] = bsc_col_ptr[i - 1] + bsc_base;
+        for(J i = 0; i < batch_count_C; i++)
+        {
+            host_csrmm(M,
+                       N,
+                       K,
+                       transA,
+                       transB,
+                       alpha,
+                       csr_row_ptr_A + offsets_batch_stride_A * i,
+                       csr_col_ind_A + columns_values_batch_stride_A * i,
+                       csr_val_A + columns_values_batch_stride_A * i,
+                       B + batch_stride_B * i,
+                       ldb,
+                       order_B,
+                       beta,
+                       C + batch_stride_C * i,
+                       ldc,
+                       order_C,
+                       base,
+                       force_conj_A);
+        }
     }
-
-    bsc_col_ptr[0] = bsc_base;
 }
 
-template <typename T>
-inline void host_gebsr_to_csr(hipsparseDirection_t    direction,
-                              int                     mb,
-                              int                     nb,
-                              int                     nnzb,
-                              const std::vector<T>&   bsr_val,
-                              const std::vector<int>& bsr_row_ptr,
-                              const std::vector<int>& bsr_col_ind,
-                              int                     row_block_dim,
-                              int                     col_block_dim,
-                              hipsparseIndexBase_t    bsr_base,
-                              std::vector<T>&         csr_val,
-                              std::vector<int>&       csr_row_ptr,
-                              std::vector<int>&       csr_col_ind,
-                              hipsparseIndexBase_t    csr_base)
+/* ============================================================================================ */
+/*! \brief  Dot product sum_k x[k] * y[k] of contiguous vectors, vectorized for real types. */
+template <typename J, typename T>
+inline T host_dense_dot(J K, const T* x, const T* y)
 {
+    T sum = make_DataType<T>(0);
 
-    csr_col_ind.resize(nnzb * row_block_dim * col_block_dim);
-    csr_row_ptr.resize(mb * row_block_dim + 1);
-    csr_val.resize(nnzb * row_block_dim * col_block_dim);
-    int at         = 0;
-    csr_row_ptr[0] = csr_base;
-    for(int i = 0; i < mb; ++i)
+    for(J k = 0; k < K; ++k)
     {
-        for(int r = 0; r < row_block_dim; ++r)
-        {
-            int row = i * row_block_dim + r;
-            for(int k = bsr_row_ptr[i] - bsr_base; k < bsr_row_ptr[i + 1] - bsr_base; ++k)
-            {
-                int j = bsr_col_ind[k] - bsr_base;
-                for(int c = 0; c < col_block_dim; ++c)
-                {
-                    int col         = col_block_dim * j + c;
-                    csr_col_ind[at] = col + csr_base;
-                    if(direction == HIPSPARSE_DIRECTION_ROW)
-                    {
-                        csr_val[at]
-                            = bsr_val[k * row_block_dim * col_block_dim + col_block_dim * r + c];
-                    }
-                    else
-                    {
-                        csr_val[at]
-                            = bsr_val[k * row_block_dim * col_block_dim + row_block_dim * c + r];
-                    }
-                    ++at;
-                }
-            }
-
-            csr_row_ptr[row + 1]
-                = csr_row_ptr[row] + (bsr_row_ptr[i + 1] - bsr_row_ptr[i]) * col_block_dim;
-        }
+        sum = testing_fma(x[k], y[k], sum);
     }
+
+    return sum;
 }
 
-template <typename T>
-inline void host_csr_to_gebsr(hipsparseDirection_t    direction,
-                              int                     m,
-                              int                     n,
-                              int                     row_block_dim,
-                              int                     col_block_dim,
-                              int&                    nnzb,
-                              hipsparseIndexBase_t    csr_base,
-                              const std::vector<int>& csr_row_ptr,
-                              const std::vector<int>& csr_col_ind,
-                              const std::vector<T>&   csr_val,
-                              hipsparseIndexBase_t    bsr_base,
-                              std::vector<int>&       bsr_row_ptr,
-                              std::vector<int>&       bsr_col_ind,
-                              std::vector<T>&         bsr_val)
+template <typename J>
+inline float host_dense_dot(J K, const float* x, const float* y)
 {
-    int mb  = (m + row_block_dim - 1) / row_block_dim;
-    int nnz = csr_col_ind.size();
-
-    bsr_row_ptr.resize(mb + 1, 0);
-
-    std::vector<int> temp(nnz);
-
+    float sum = 0.0f;
 #ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
+#pragma omp simd reduction(+ : sum)
 #endif
-    for(int i = 0; i < nnz; i++)
+    for(J k = 0; k < K; ++k)
     {
-        temp[i] = (csr_col_ind[i] - csr_base) / col_block_dim;
+        sum += x[k] * y[k];
     }
 
+    return sum;
+}
+
+template <typename J>
+inline double host_dense_dot(J K, const double* x, const double* y)
+{
+    double sum = 0.0;
 #ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
+#pragma omp simd reduction(+ : sum)
 #endif
-    for(int i = 0; i < mb; i++)
+    for(J k = 0; k < K; ++k)
     {
-        int frow = row_block_dim * i;
-        int lrow = row_block_dim * (i + 1);
+        sum += x[k] * y[k];
+    }
 
-        if(lrow > m)
-        {
-            lrow = m;
-        }
+    return sum;
+}
 
-        int start = csr_row_ptr[frow] - csr_base;
-        int end   = csr_row_ptr[lrow] - csr_base;
+/*! \brief  Rows of X', where X'(r, c) is X(r, c) or, if transposed, X(c, r), optionally
+ *  conjugated, as contiguous vectors of length K. If the rows of X' are already contiguous in
+ *  X, X is returned, otherwise X' is gathered into buffer. Rows are ldr apart.
+ */
+template <typename J, typename T>
+inline const T* host_sddmm_rows(J                R,
+                                J                K,
+                                const T*         X,
+                                int64_t          ld,
+                                hipsparseOrder_t order,
+                                bool             transposed,
+                                bool             conj,
+                                std::vector<T>&  buffer,
+                                int64_t&         ldr)
+{
+    bool row_major = (order == HIPSPARSE_ORDER_ROW) != transposed;
 
-        std::sort(temp.begin() + start, temp.begin() + end);
+    if(row_major && !conj)
+    {
+        ldr = ld;
+        return X;
     }
 
+    int64_t stride_r = row_major ? ld : 1;
+    int64_t stride_c = row_major ? 1 : ld;
+
+    buffer.resize(static_cast<size_t>(R) * K);
+    ldr = K;
+
 #ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
+#pragma omp parallel for schedule(static)
 #endif
-    for(int i = 0; i < mb; i++)
+    for(J r = 0; r < R; ++r)
     {
-        int frow = row_block_dim * i;
-        int lrow = row_block_dim * (i + 1);
-
-        if(lrow > m)
+        for(J c = 0; c < K; ++c)
         {
-            lrow = m;
-        }
+            T v = X[r * stride_r + c * stride_c];
 
-        int start = csr_row_ptr[frow] - csr_base;
-        int end   = csr_row_ptr[lrow] - csr_base;
-
-        int col   = -1;
-        int count = 0;
-        for(int j = start; j < end; j++)
-        {
-            if(temp[j] > col)
-            {
-                col                 = temp[j];
-                temp[j]             = -1;
-                temp[start + count] = col;
-                count++;
-            }
-            else
-            {
-                temp[j] = -1;
-            }
+            buffer[static_cast<size_t>(r) * K + c] = conj ? testing_conj(v) : v;
         }
-
-        bsr_row_ptr[i + 1] = count;
     }
 
-    // fill GEBSR row pointer array
-    bsr_row_ptr[0] = bsr_base;
-    for(int i = 0; i < mb; i++)
+    return buffer.data();
+}
+
+/*! \brief  Sampled dense dense matrix multiplication
+ *  C = alpha * (op(A) * op(B)) o spy(C) + beta * C for the nnz entries (row_ind, col_ind) of C.
+ *  Indices are ind_stride apart, which covers the COO and COO AoS formats, see host_sddmm_csr
+ *  and host_sddmm_csc for the others.
+ *
+ *  The rows of op(A) and the columns of op(B) are gathered once into contiguous vectors for all
+ *  orders and operations, each entry then is a contiguous dot product of length K. All entries
+ *  cost the same, such that they are split evenly across threads.
+ */
+template <typename I, typename J, typename T>
+inline void host_sddmm(hipsparseOperation_t transA,
+                       hipsparseOperation_t transB,
+                       hipsparseOrder_t     orderA,
+                       hipsparseOrder_t     orderB,
+                       J                    M,
+                       J                    N,
+                       J                    K,
+                       I                    nnz,
+                       T                    alpha,
+                       const T*             A,
+                       int64_t              lda,
+                       const T*             B,
+                       int64_t              ldb,
+                       T                    beta,
+                       const J*             row_ind,
+                       const J*             col_ind,
+                       int64_t              ind_stride,
+                       T*                   val,
+                       hipsparseIndexBase_t base)
+{
+    std::vector<T> bufA;
+    std::vector<T> bufB;
+
+    int64_t ldar;
+    int64_t ldbr;
+
+    // Rows of op(A) and rows of op(B)^T
+    const T* Ar = host_sddmm_rows(M,
+                                  K,
+                                  A,
+                                  lda,
+                                  orderA,
+                                  transA != HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                                  transA == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE,
+                                  bufA,
+                                  ldar);
+    const T* Br = host_sddmm_rows(N,
+                                  K,
+                                  B,
+                                  ldb,
+                                  orderB,
+                                  transB == HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                                  transB == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE,
+                                  bufB,
+                                  ldbr);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for(I at = 0; at < nnz; ++at)
     {
-        bsr_row_ptr[i + 1] += bsr_row_ptr[i];
+        J i = row_ind[at * ind_stride] - base;
+        J j = col_ind[at * ind_stride] - base;
+
+        T dot = host_dense_dot(K, Ar + i * ldar, Br + j * ldbr);
+
+        val[at] = testing_mult(val[at], beta) + testing_mult(alpha, dot);
     }
+}
 
-    nnzb = bsr_row_ptr[mb] - bsr_row_ptr[0];
-    bsr_col_ind.resize(nnzb);
-    bsr_val.resize(nnzb * row_block_dim * col_block_dim, make_DataType<T>(0));
+/*! \brief  Sampled dense dense matrix multiplication for C in CSR format, see host_sddmm. */
+template <typename I, typename J, typename T>
+inline void host_sddmm_csr(hipsparseOperation_t transA,
+                           hipsparseOperation_t transB,
+                           hipsparseOrder_t     orderA,
+                           hipsparseOrder_t     orderB,
+                           J                    M,
+                           J                    N,
+                           J                    K,
+                           I                    nnz,
+                           T                    alpha,
+                           const T*             A,
+                           int64_t              lda,
+                           const T*             B,
+                           int64_t              ldb,
+                           T                    beta,
+                           const I*             csr_row_ptr,
+                           const J*             csr_col_ind,
+                           T*                   csr_val,
+                           hipsparseIndexBase_t base)
+{
+    std::vector<J> row_ind(nnz);
 
-    // fill GEBSR col indices array
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(J i = 0; i < M; ++i)
     {
-        int index = 0;
-        for(int i = 0; i < nnz; i++)
+        for(I at = csr_row_ptr[i] - base; at < csr_row_ptr[i + 1] - base; ++at)
         {
-            if(temp[i] != -1)
-            {
-                bsr_col_ind[index] = temp[i] + bsr_base;
-                index++;
-            }
+            row_ind[at] = i + base;
         }
     }
 
-    // fill GEBSR values array
+    host_sddmm(transA,
+               transB,
+               orderA,
+               orderB,
+               M,
+               N,
+               K,
+               nnz,
+               alpha,
+               A,
+               lda,
+               B,
+               ldb,
+               beta,
+               row_ind.data(),
+               csr_col_ind,
+               1,
+               csr_val,
+               base);
+}
+
+/*! \brief  Sampled dense dense matrix multiplication for C in CSC format, see host_sddmm. */
+template <typename I, typename J, typename T>
+inline void host_sddmm_csc(hipsparseOperation_t transA,
+                           hipsparseOperation_t transB,
+                           hipsparseOrder_t     orderA,
+                           hipsparseOrder_t     orderB,
+                           J                    M,
+                           J                    N,
+                           J                    K,
+                           I                    nnz,
+                           T                    alpha,
+                           const T*             A,
+                           int64_t              lda,
+                           const T*             B,
+                           int64_t              ldb,
+                           T                    beta,
+                           const I*             csc_col_ptr,
+                           const J*             csc_row_ind,
+                           T*                   csc_val,
+                           hipsparseIndexBase_t base)
+{
+    std::vector<J> col_ind(nnz);
+
 #ifdef _OPENMP
 #pragma omp parallel for schedule(dynamic, 1024)
 #endif
-    for(int i = 0; i < m; i++)
+    for(J j = 0; j < N; ++j)
     {
-        int start = csr_row_ptr[i] - csr_base;
-        int end   = csr_row_ptr[i + 1] - csr_base;
-
-        int bstart = bsr_row_ptr[i / row_block_dim] - bsr_base;
-        int bend   = bsr_row_ptr[i / row_block_dim + 1] - bsr_base;
-
-        int local_row = i % row_block_dim;
-
-        for(int j = start; j < end; j++)
+        for(I at = csc_col_ptr[j] - base; at < csc_col_ptr[j + 1] - base; ++at)
         {
-            int col = csr_col_ind[j] - csr_base;
-
-            int local_col = col % col_block_dim;
-
-            {
-                int index = 0;
-                for(int k = bstart; k < bend; k++)
-                {
-                    if(bsr_col_ind[k] - bsr_base == col / col_block_dim)
-                    {
-                        index  = k;
-                        bstart = k;
-                        break;
-                    }
-                }
-
-                if(direction == HIPSPARSE_DIRECTION_ROW)
-                {
-                    bsr_val[row_block_dim * col_block_dim * index + col_block_dim * local_row
-                            + local_col]
-                        = csr_val[j];
-                }
-                else
-                {
-                    bsr_val[row_block_dim * col_block_dim * index + row_block_dim * local_col
-                            + local_row]
-                        = csr_val[j];
-                }
-            }
+            col_ind[at] = j + base;
         }
     }
+
+    host_sddmm(transA,
+               transB,
+               orderA,
+               orderB,
+               M,
+               N,
+               K,
+               nnz,
+               alpha,
+               A,
+               lda,
+               B,
+               ldb,
+               beta,
+               csc_row_ind,
+               col_ind.data(),
+               1,
+               csc_val,
+               base);
 }
 
+/* ============================================================================================ */
+/*! \brief  Host references of the solvers are computed in double precision, such that their
+ *  rounding errors are negligible against those of the device.
+ */
 template <typename T>
-inline void host_gebsr_to_gebsr(hipsparseDirection_t    direction,
-                                int                     mb,
-                                int                     nb,
-                                int                     nnzb,
-                                const std::vector<T>&   bsr_val_A,
-                                const std::vector<int>& bsr_row_ptr_A,
-                                const std::vector<int>& bsr_col_ind_A,
-                                int                     row_block_dim_A,
-                                int                     col_block_dim_A,
-                                hipsparseIndexBase_t    base_A,
-                                std::vector<T>&         bsr_val_C,
-                                std::vector<int>&       bsr_row_ptr_C,
-                                std::vector<int>&       bsr_col_ind_C,
-                                int                     row_block_dim_C,
-                                int                     col_block_dim_C,
-                                hipsparseIndexBase_t    base_C)
+struct host_double_type
 {
-    int m = mb * row_block_dim_A;
-    int n = nb * col_block_dim_A;
+    typedef double type;
+};
 
-    // convert GEBSR to CSR format
-    std::vector<int> csr_row_ptr;
-    std::vector<int> csr_col_ind;
-    std::vector<T>   csr_val;
+template <>
+struct host_double_type<hipComplex>
+{
+    typedef hipDoubleComplex type;
+};
 
-    host_gebsr_to_csr(direction,
-                      mb,
-                      nb,
-                      nnzb,
-                      bsr_val_A,
-                      bsr_row_ptr_A,
-                      bsr_col_ind_A,
-                      row_block_dim_A,
-                      col_block_dim_A,
-                      base_A,
-                      csr_val,
-                      csr_row_ptr,
-                      csr_col_ind,
-                      HIPSPARSE_INDEX_BASE_ZERO);
+template <>
+struct host_double_type<hipDoubleComplex>
+{
+    typedef hipDoubleComplex type;
+};
+
+inline double host_double(float x)
+{
+    return x;
+}
+
+inline double host_double(double x)
+{
+    return x;
+}
+
+inline hipDoubleComplex host_double(hipComplex x)
+{
+    return make_hipDoubleComplex(x.x, x.y);
+}
 
-    // convert CSR to GEBSR format
-    int nnzb_C;
-    host_csr_to_gebsr(direction,
-                      m,
-                      n,
-                      row_block_dim_C,
-                      col_block_dim_C,
-                      nnzb_C,
-                      HIPSPARSE_INDEX_BASE_ZERO,
-                      csr_row_ptr,
-                      csr_col_ind,
-                      csr_val,
-                      base_C,
-                      bsr_row_ptr_C,
-                      bsr_col_ind_C,
-                      bsr_val_C);
+inline hipDoubleComplex host_double(hipDoubleComplex x)
+{
+    return x;
 }
 
+/*! \brief  Copy of n entries of x in double precision. */
 template <typename T>
-void host_gebsr_to_gebsc(int                     Mb,
-                         int                     Nb,
-                         int                     nnzb,
-                         const std::vector<int>& bsr_row_ptr,
-                         const std::vector<int>& bsr_col_ind,
-                         const std::vector<T>&   bsr_val,
-                         int                     row_block_dim,
-                         int                     col_block_dim,
-                         std::vector<int>&       bsc_row_ind,
-                         std::vector<int>&       bsc_col_ptr,
-                         std::vector<T>&         bsc_val,
-                         hipsparseAction_t       action,
-                         hipsparseIndexBase_t    base)
+inline std::vector<typename host_double_type<T>::type> host_double_copy(int64_t n, const T* x)
 {
-    bsc_row_ind.resize(nnzb);
-    bsc_col_ptr.resize(Nb + 1, 0);
-    bsc_val.resize(nnzb);
-
-    const int block_shift = row_block_dim * col_block_dim;
+    std::vector<typename host_double_type<T>::type> y(n);
 
-    //
-    // Determine nnz per column
-    //
-    for(int i = 0; i < nnzb; ++i)
+    for(int64_t i = 0; i < n; ++i)
     {
-        ++bsc_col_ptr[bsr_col_ind[i] + 1 - base];
+        y[i] = host_double(x[i]);
     }
 
-    // Scan
-    for(int i = 0; i < Nb; ++i)
-    {
-        bsc_col_ptr[i + 1] += bsc_col_ptr[i];
-    }
+    return y;
+}
 
-    // Fill row indices and values
-    for(int i = 0; i < Mb; ++i)
+/*! \brief  Round n entries of x in double precision to y. */
+template <typename T>
+inline void host_double_round(int64_t n, const double* x, T* y)
+{
+    for(int64_t i = 0; i < n; ++i)
     {
-        const int row_begin = bsr_row_ptr[i] - base;
-        const int row_end   = bsr_row_ptr[i + 1] - base;
-
-        for(int j = row_begin; j < row_end; ++j)
-        {
-            const int col = bsr_col_ind[j] - base;
-            const int idx = bsc_col_ptr[col];
-
-            bsc_row_ind[idx] = i + base;
-            for(int k = 0; k < block_shift; ++k)
-            {
-                bsc_val[idx * block_shift + k] = bsr_val[j * block_shift + k];
-            }
-
-            ++bsc_col_ptr[col];
-        }
+        y[i] = make_DataType<T>(x[i]);
     }
+}
 
-    // Shift column pointer array
-    for(int i = Nb; i > 0; --i)
+template <typename T>
+inline void host_double_round(int64_t n, const hipDoubleComplex* x, T* y)
+{
+    for(int64_t i = 0; i < n; ++i)
     {
-        bsc_col_ptr[i] = bsc_col_ptr[i - 1] + base;
+        y[i] = make_DataType<T>(x[i].x, x[i].y);
     }
+}
 
-    bsc_col_ptr[0] = base;
+/* ============================================================================================ */
+/*! \brief  Algorithms of the host tridiagonal solvers. */
+typedef enum host_gtsv_alg_
+{
+    host_gtsv_alg_thomas = 0, /**< Gaussian elimination without pivoting */
+    host_gtsv_alg_lu     = 1, /**< LU factorization with partial pivoting, as LAPACK gtsv */
+    host_gtsv_alg_cr     = 2 /**< cyclic reduction without pivoting */
+} host_gtsv_alg;
+
+/*! \brief  Number of systems solved together by the batched tridiagonal and pentadiagonal host
+ *  solvers. Interleaved systems (sx == 1) are solved in groups of lanes, such that the innermost
+ *  loops run over contiguous entries and vectorize. Other systems are solved one by one.
+ */
+inline int64_t host_gtsv_lanes(int64_t sx)
+{
+    return (sx == 1) ? 64 : 1;
 }
 
+/*! \brief  Thomas algorithm for nl tridiagonal systems.
+ *
+ *  In all host_gtsv_* and host_gpsv_* lane solvers, row i of system l is at i * stride + l * sa
+ *  in the diagonals and at i * stride + l * sx in x, which holds the right hand sides on entry
+ *  and the solutions on exit. sa is 0 if the systems share their coefficients. Workspace arrays
+ *  hold m * nl entries.
+ */
 template <typename T>
-inline void host_bsr_to_csr(hipsparseDirection_t    direction,
-                            int                     Mb,
-                            int                     Nb,
-                            int                     block_dim,
-                            hipsparseIndexBase_t    bsr_base,
-                            const std::vector<int>& bsr_row_ptr,
-                            const std::vector<int>& bsr_col_ind,
-                            const std::vector<T>&   bsr_val,
-                            hipsparseIndexBase_t    csr_base,
-                            std::vector<int>&       csr_row_ptr,
-                            std::vector<int>&       csr_col_ind,
-                            std::vector<T>&         csr_val)
+inline void host_gtsv_thomas_lanes(int      m,
+                                   int64_t  nl,
+                                   const T* dl,
+                                   const T* d,
+                                   const T* du,
+                                   int64_t  sa,
+                                   T*       x,
+                                   int64_t  stride,
+                                   int64_t  sx,
+                                   T*       cp)
 {
-    int m    = Mb * block_dim;
-    int nnzb = bsr_row_ptr[Mb] - bsr_row_ptr[0];
-
-    csr_row_ptr.resize(m + 1, 0);
-    csr_col_ind.resize(nnzb * block_dim * block_dim, 0);
-    csr_val.resize(nnzb * block_dim * block_dim, make_DataType<T>(0));
+    const T one = make_DataType<T>(1);
 
-    // quick return if block_dim == 1
-    if(block_dim == 1)
-    {
-#ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
-#endif
-        for(size_t i = 0; i < bsr_row_ptr.size(); i++)
-        {
-            csr_row_ptr[i] = (bsr_row_ptr[i] - bsr_base) + csr_base;
-        }
-#ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
-#endif
-        for(size_t i = 0; i < bsr_col_ind.size(); i++)
-        {
-            csr_col_ind[i] = (bsr_col_ind[i] - bsr_base) + csr_base;
-        }
 #ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
+#pragma omp simd
 #endif
-        for(size_t i = 0; i < bsr_val.size(); i++)
-        {
-            csr_val[i] = bsr_val[i];
-        }
+    for(int64_t l = 0; l < nl; ++l)
+    {
+        T inv = testing_div(one, d[l * sa]);
 
-        return;
+        cp[l]     = testing_mult(du[l * sa], inv);
+        x[l * sx] = testing_mult(x[l * sx], inv);
     }
 
-    csr_row_ptr[0] = csr_base;
-
-    // find csr row ptr array
-    for(int i = 0; i < Mb; i++)
+    for(int i = 1; i < m; ++i)
     {
-        int entries_in_row = block_dim * (bsr_row_ptr[i + 1] - bsr_row_ptr[i]);
+        const T* a  = dl + i * stride;
+        const T* b  = d + i * stride;
+        const T* c  = du + i * stride;
+        const T* xp = x + (i - 1) * stride;
+        T*       xi = x + i * stride;
+        const T* cq = cp + (i - 1) * nl;
+        T*       ci = cp + i * nl;
 
-        for(int j = 0; j < block_dim; j++)
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+        for(int64_t l = 0; l < nl; ++l)
         {
-            csr_row_ptr[i * block_dim + j + 1] = csr_row_ptr[i * block_dim + j] + entries_in_row;
+            T al  = a[l * sa];
+            T inv = testing_div(one, b[l * sa] - testing_mult(al, cq[l]));
+
+            ci[l]      = testing_mult(c[l * sa], inv);
+            xi[l * sx] = testing_mult(xi[l * sx] - testing_mult(al, xp[l * sx]), inv);
         }
     }
 
-    int entries_in_block = block_dim * block_dim;
+    for(int i = m - 2; i >= 0; --i)
+    {
+        const T* xn = x + (i + 1) * stride;
+        T*       xi = x + i * stride;
+        const T* ci = cp + i * nl;
 
-    // find csr col indices and values arrays
 #ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
+#pragma omp simd
 #endif
-    for(int i = 0; i < Mb; i++)
-    {
-        int entries_in_Row     = (bsr_row_ptr[i + 1] - bsr_row_ptr[i]) * block_dim;
-        int entries_in_row_sum = (bsr_row_ptr[i] - bsr_base) * entries_in_block;
-
-        for(int j = bsr_row_ptr[i] - bsr_base; j < bsr_row_ptr[i + 1] - bsr_base; j++)
+        for(int64_t l = 0; l < nl; ++l)
         {
-            int col    = bsr_col_ind[j] - bsr_base;
-            int offset = entries_in_row_sum + block_dim * (j - (bsr_row_ptr[i] - bsr_base));
-
-            for(int k = 0; k < block_dim; k++)
-            {
-                for(int l = 0; l < block_dim; l++)
-                {
-                    csr_col_ind[offset + k * entries_in_Row + l] = block_dim * col + l + csr_base;
-                    if(direction == HIPSPARSE_DIRECTION_ROW)
-                    {
-                        csr_val[offset + k * entries_in_Row + l]
-                            = bsr_val[j * entries_in_block + k * block_dim + l];
-                    }
-                    else
-                    {
-                        csr_val[offset + k * entries_in_Row + l]
-                            = bsr_val[j * entries_in_block + k + block_dim * l];
-                    }
-                }
-            }
+            xi[l * sx] = xi[l * sx] - testing_mult(ci[l], xn[l * sx]);
         }
     }
 }
 
+/*! \brief  LU factorization with partial pivoting and solve for nl tridiagonal systems, following
+ *  LAPACK gtsv. Rows i and i + 1 are swapped if |dl[i + 1]| > |d[i]|, which fills the second
+ *  super diagonal. wd, wu and wu2 hold the factored diagonal and super diagonals.
+ */
 template <typename T>
-inline void host_bsrmv(hipsparseDirection_t dir,
-                       hipsparseOperation_t trans,
-                       int                  mb,
-                       int                  nb,
-                       int                  nnzb,
-                       T                    alpha,
-                       const int*           bsr_row_ptr,
-                       const int*           bsr_col_ind,
-                       const T*             bsr_val,
-                       int                  bsr_dim,
-                       const T*             x,
-                       T                    beta,
-                       T*                   y,
-                       hipsparseIndexBase_t base)
+inline void host_gtsv_lu_lanes(int      m,
+                               int64_t  nl,
+                               const T* dl,
+                               const T* d,
+                               const T* du,
+                               int64_t  sa,
+                               T*       x,
+                               int64_t  stride,
+                               int64_t  sx,
+                               T*       wd,
+                               T*       wu,
+                               T*       wu2)
 {
-    // Quick return
-    if(alpha == make_DataType<T>(0))
+    const T zero = make_DataType<T>(0);
+
+    for(int i = 0; i < m; ++i)
     {
-        if(beta != make_DataType<T>(1))
+        for(int64_t l = 0; l < nl; ++l)
         {
-            for(int i = 0; i < mb * bsr_dim; ++i)
-            {
-                y[i] = testing_mult(beta, y[i]);
-            }
+            wd[i * nl + l]  = d[i * stride + l * sa];
+            wu[i * nl + l]  = du[i * stride + l * sa];
+            wu2[i * nl + l] = zero;
         }
-
-        return;
     }
 
-    int WFSIZE;
-
-    if(bsr_dim == 2)
+    for(int i = 0; i < m - 1; ++i)
     {
-        int blocks_per_row = nnzb / mb;
+        const T* a  = dl + (i + 1) * stride;
+        T*       xi = x + i * stride;
+        T*       xn = x + (i + 1) * stride;
+        T*       bi = wd + i * nl;
+        T*       bn = wd + (i + 1) * nl;
+        T*       ci = wu + i * nl;
+        T*       cn = wu + (i + 1) * nl;
+        T*       ei = wu2 + i * nl;
 
-        if(blocks_per_row < 8)
-        {
-            WFSIZE = 4;
-        }
-        else if(blocks_per_row < 16)
-        {
-            WFSIZE = 8;
-        }
-        else if(blocks_per_row < 32)
-        {
-            WFSIZE = 16;
-        }
-        else if(blocks_per_row < 64)
-        {
-            WFSIZE = 32;
-        }
-        else
-        {
-            WFSIZE = 64;
-        }
-    }
-    else if(bsr_dim <= 8)
-    {
-        WFSIZE = 8;
-    }
-    else if(bsr_dim <= 16)
-    {
-        WFSIZE = 16;
-    }
-    else
-    {
-        WFSIZE = 32;
-    }
+        bool last = (i == m - 2);
 
 #ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
+#pragma omp simd
 #endif
-    for(int row = 0; row < mb; ++row)
-    {
-        int row_begin = bsr_row_ptr[row] - base;
-        int row_end   = bsr_row_ptr[row + 1] - base;
-
-        if(bsr_dim == 2)
+        for(int64_t l = 0; l < nl; ++l)
         {
-            std::vector<T> sum0(WFSIZE, make_DataType<T>(0));
-            std::vector<T> sum1(WFSIZE, make_DataType<T>(0));
-
-            for(int j = row_begin; j < row_end; j += WFSIZE)
-            {
-                for(int k = 0; k < WFSIZE; ++k)
-                {
-                    if(j + k < row_end)
-                    {
-                        int col = bsr_col_ind[j + k] - base;
-
-                        if(dir == HIPSPARSE_DIRECTION_COLUMN)
-                        {
-                            sum0[k] = testing_fma(bsr_val[bsr_dim * bsr_dim * (j + k) + 0],
-                                                  x[col * bsr_dim + 0],
-                                                  sum0[k]);
-                            sum1[k] = testing_fma(bsr_val[bsr_dim * bsr_dim * (j + k) + 1],
-                                                  x[col * bsr_dim + 0],
-                                                  sum1[k]);
-                            sum0[k] = testing_fma(bsr_val[bsr_dim * bsr_dim * (j + k) + 2],
-                                                  x[col * bsr_dim + 1],
-                                                  sum0[k]);
-                            sum1[k] = testing_fma(bsr_val[bsr_dim * bsr_dim * (j + k) + 3],
-                                                  x[col * bsr_dim + 1],
-                                                  sum1[k]);
-                        }
-                        else
-                        {
-                            sum0[k] = testing_fma(bsr_val[bsr_dim * bsr_dim * (j + k) + 0],
-                                                  x[col * bsr_dim + 0],
-                                                  sum0[k]);
-                            sum0[k] = testing_fma(bsr_val[bsr_dim * bsr_dim * (j + k) + 1],
-                                                  x[col * bsr_dim + 1],
-                                                  sum0[k]);
-                            sum1[k] = testing_fma(bsr_val[bsr_dim * bsr_dim * (j + k) + 2],
-                                                  x[col * bsr_dim + 0],
-                                                  sum1[k]);
-                            sum1[k] = testing_fma(bsr_val[bsr_dim * bsr_dim * (j + k) + 3],
-                                                  x[col * bsr_dim + 1],
-                                                  sum1[k]);
-                        }
-                    }
-                }
-            }
+            T al = a[l * sa];
 
-            for(int j = 1; j < WFSIZE; j <<= 1)
+            if(testing_abs(bi[l]) >= testing_abs(al))
             {
-                for(int k = 0; k < WFSIZE - j; ++k)
-                {
-                    sum0[k] = sum0[k] + sum0[k + j];
-                    sum1[k] = sum1[k] + sum1[k + j];
-                }
-            }
+                T f = testing_div(al, bi[l]);
 
-            if(beta != make_DataType<T>(0))
-            {
-                y[row * bsr_dim + 0]
-                    = testing_fma(beta, y[row * bsr_dim + 0], testing_mult(alpha, sum0[0]));
-                y[row * bsr_dim + 1]
-                    = testing_fma(beta, y[row * bsr_dim + 1], testing_mult(alpha, sum1[0]));
+                bn[l]      = bn[l] - testing_mult(f, ci[l]);
+                xn[l * sx] = xn[l * sx] - testing_mult(f, xi[l * sx]);
             }
             else
             {
-                y[row * bsr_dim + 0] = testing_mult(alpha, sum0[0]);
-                y[row * bsr_dim + 1] = testing_mult(alpha, sum1[0]);
-            }
-        }
-        else
-        {
-            for(int bi = 0; bi < bsr_dim; ++bi)
-            {
-                std::vector<T> sum(WFSIZE, make_DataType<T>(0));
-
-                for(int j = row_begin; j < row_end; ++j)
-                {
-                    int col = bsr_col_ind[j] - base;
-
-                    for(int bj = 0; bj < bsr_dim; bj += WFSIZE)
-                    {
-                        for(int k = 0; k < WFSIZE; ++k)
-                        {
-                            if(bj + k < bsr_dim)
-                            {
-                                if(dir == HIPSPARSE_DIRECTION_COLUMN)
-                                {
-                                    sum[k] = testing_fma(
-                                        bsr_val[bsr_dim * bsr_dim * j + bsr_dim * (bj + k) + bi],
-                                        x[bsr_dim * col + (bj + k)],
-                                        sum[k]);
-                                }
-                                else
-                                {
-                                    sum[k] = testing_fma(
-                                        bsr_val[bsr_dim * bsr_dim * j + bsr_dim * bi + (bj + k)],
-                                        x[bsr_dim * col + (bj + k)],
-                                        sum[k]);
-                                }
-                            }
-                        }
-                    }
-                }
+                T f = testing_div(bi[l], al);
+                T t = bn[l];
 
-                for(int j = 1; j < WFSIZE; j <<= 1)
-                {
-                    for(int k = 0; k < WFSIZE - j; ++k)
-                    {
-                        sum[k] = sum[k] + sum[k + j];
-                    }
-                }
+                bi[l] = al;
+                bn[l] = ci[l] - testing_mult(f, t);
 
-                if(beta != make_DataType<T>(0))
-                {
-                    y[row * bsr_dim + bi]
-                        = testing_fma(beta, y[row * bsr_dim + bi], testing_mult(alpha, sum[0]));
-                }
-                else
+                if(!last)
                 {
-                    y[row * bsr_dim + bi] = testing_mult(alpha, sum[0]);
+                    ei[l] = cn[l];
+                    cn[l] = zero - testing_mult(f, ei[l]);
                 }
+
+                ci[l] = t;
+
+                T xt       = xi[l * sx];
+                xi[l * sx] = xn[l * sx];
+                xn[l * sx] = xt - testing_mult(f, xn[l * sx]);
             }
         }
     }
-}
 
-template <typename I, typename J, typename T>
-inline void host_csrmv(hipsparseOperation_t trans,
-                       J                    M,
-                       J                    N,
-                       I                    nnz,
-                       T                    alpha,
-                       const I*             csr_row_ptr,
-                       const J*             csr_col_ind,
-                       const T*             csr_val,
-                       const T*             x,
-                       T                    beta,
-                       T*                   y,
-                       hipsparseIndexBase_t base)
-{
-    if(trans == HIPSPARSE_OPERATION_NON_TRANSPOSE)
+    for(int i = m - 1; i >= 0; --i)
     {
-        // Get device properties
-        int             dev;
-        hipDeviceProp_t prop;
-
-        hipGetDevice(&dev);
-        hipGetDeviceProperties(&prop, dev);
-
-        int WF_SIZE;
-        J   nnz_per_row = (M == 0) ? 0 : (nnz / M);
-
-        if(nnz_per_row < 4)
-            WF_SIZE = 2;
-        else if(nnz_per_row < 8)
-            WF_SIZE = 4;
-        else if(nnz_per_row < 16)
-            WF_SIZE = 8;
-        else if(nnz_per_row < 32)
-            WF_SIZE = 16;
-        else if(nnz_per_row < 64 || prop.warpSize == 32)
-            WF_SIZE = 32;
-        else
-            WF_SIZE = 64;
+        T*       xi = x + i * stride;
+        const T* bi = wd + i * nl;
+        const T* ci = wu + i * nl;
+        const T* ei = wu2 + i * nl;
 
-        for(J i = 0; i < M; ++i)
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+        for(int64_t l = 0; l < nl; ++l)
         {
-            I row_begin = csr_row_ptr[i] - base;
-            I row_end   = csr_row_ptr[i + 1] - base;
+            T r = xi[l * sx];
 
-            std::vector<T> sum(WF_SIZE, static_cast<T>(0));
-
-            for(I j = row_begin; j < row_end; j += WF_SIZE)
+            if(i + 1 < m)
             {
-                for(int k = 0; k < WF_SIZE; ++k)
-                {
-                    if(j + k < row_end)
-                    {
-                        sum[k] = testing_fma(testing_mult(alpha, csr_val[j + k]),
-                                             x[csr_col_ind[j + k] - base],
-                                             sum[k]);
-                    }
-                }
+                r = r - testing_mult(ci[l], xi[stride + l * sx]);
             }
 
-            for(int j = 1; j < WF_SIZE; j <<= 1)
+            if(i + 2 < m)
             {
-                for(int k = 0; k < WF_SIZE - j; ++k)
-                {
-                    sum[k] = sum[k] + sum[k + j];
-                }
+                r = r - testing_mult(ei[l], xi[2 * stride + l * sx]);
             }
 
-            if(beta == make_DataType<T>(0.0))
-            {
-                y[i] = sum[0];
-            }
-            else
-            {
-                y[i] = testing_fma(beta, y[i], sum[0]);
-            }
+            xi[l * sx] = testing_div(r, bi[l]);
         }
     }
-    else
+}
+
+/*! \brief  Cyclic reduction for a single tridiagonal system. Each level eliminates the odd
+ *  unknowns of the previous level from the even ones, the unknowns are recovered in reverse
+ *  order of the levels. a, b, c and f hold m entries.
+ */
+template <typename T>
+inline void host_gtsv_cr(int      m,
+                         const T* dl,
+                         const T* d,
+                         const T* du,
+                         T*       x,
+                         int64_t  stride,
+                         T*       a,
+                         T*       b,
+                         T*       c,
+                         T*       f)
+{
+    const T zero = make_DataType<T>(0);
+
+    for(int i = 0; i < m; ++i)
     {
-        // Scale y with beta
-        for(J i = 0; i < N; ++i)
+        a[i] = (i > 0) ? dl[i * stride] : zero;
+        b[i] = d[i * stride];
+        c[i] = (i < m - 1) ? du[i * stride] : zero;
+        f[i] = x[i * stride];
+    }
+
+    // Reduction, equation i of level s couples to i - 2s and i + 2s afterwards
+    int s = 1;
+    for(; 2 * s <= m; s *= 2)
+    {
+        for(int i = 2 * s - 1; i < m; i += 2 * s)
         {
-            y[i] = testing_mult(y[i], beta);
+            T alpha = zero - testing_div(a[i], b[i - s]);
+            T gamma = (i + s < m) ? zero - testing_div(c[i], b[i + s]) : zero;
+
+            b[i] = b[i] + testing_mult(alpha, c[i - s]);
+            f[i] = f[i] + testing_mult(alpha, f[i - s]);
+            a[i] = testing_mult(alpha, a[i - s]);
+
+            if(i + s < m)
+            {
+                b[i] = b[i] + testing_mult(gamma, a[i + s]);
+                f[i] = f[i] + testing_mult(gamma, f[i + s]);
+            }
+
+            c[i] = (i + s < m) ? testing_mult(gamma, c[i + s]) : zero;
         }
+    }
 
-        // Transposed SpMV
-        for(J i = 0; i < M; ++i)
+    // The single equation left on the top level is decoupled
+    x[(s - 1) * stride] = testing_div(f[s - 1], b[s - 1]);
+
+    for(s /= 2; s >= 1; s /= 2)
+    {
+        for(int i = s - 1; i < m; i += 2 * s)
         {
-            I row_begin = csr_row_ptr[i] - base;
-            I row_end   = csr_row_ptr[i + 1] - base;
-            T row_val   = testing_mult(alpha, x[i]);
+            T r = f[i];
 
-            for(I j = row_begin; j < row_end; ++j)
+            if(i - s >= 0)
             {
-                J col = csr_col_ind[j] - base;
-                T val = (trans == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE)
-                            ? testing_conj(csr_val[j])
-                            : csr_val[j];
+                r = r - testing_mult(a[i], x[(i - s) * stride]);
+            }
 
-                y[col] = testing_fma(val, row_val, y[col]);
+            if(i + s < m)
+            {
+                r = r - testing_mult(c[i], x[(i + s) * stride]);
             }
+
+            x[i * stride] = testing_div(r, b[i]);
         }
     }
 }
 
+/*! \brief  Solve batch_count tridiagonal systems with m rows, see host_gtsv_thomas_lanes for the
+ *  layout. The systems are split across threads.
+ */
 template <typename T>
-inline void host_bsrmm(int                     Mb,
-                       int                     N,
-                       int                     Kb,
-                       int                     block_dim,
-                       hipsparseDirection_t    dir,
-                       hipsparseOperation_t    transA,
-                       hipsparseOperation_t    transB,
-                       T                       alpha,
-                       const std::vector<int>& bsr_row_ptr_A,
-                       const std::vector<int>& bsr_col_ind_A,
-                       const std::vector<T>&   bsr_val_A,
-                       const std::vector<T>&   B,
-                       int                     ldb,
-                       T                       beta,
-                       std::vector<T>&         C,
-                       int                     ldc,
-                       hipsparseIndexBase_t    base)
+inline void host_gtsv_batch(host_gtsv_alg alg,
+                            int           m,
+                            const T*      dl,
+                            const T*      d,
+                            const T*      du,
+                            int64_t       sa,
+                            T*            x,
+                            int64_t       stride,
+                            int64_t       sx,
+                            int           batch_count)
 {
-    if(transA != HIPSPARSE_OPERATION_NON_TRANSPOSE)
-    {
-        return;
-    }
-
-    if(transB != HIPSPARSE_OPERATION_NON_TRANSPOSE && transB != HIPSPARSE_OPERATION_TRANSPOSE)
+    if(m <= 0 || batch_count <= 0)
     {
         return;
     }
 
-    int M = Mb * block_dim;
+    int64_t lanes  = (alg == host_gtsv_alg_cr) ? 1 : host_gtsv_lanes(sx);
+    int64_t groups = (batch_count + lanes - 1) / lanes;
 
 #ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
+#pragma omp parallel if(groups > 1)
 #endif
-    for(int i = 0; i < M; i++)
     {
-        int local_row = i % block_dim;
+        std::vector<T> work(4 * static_cast<size_t>(m) * lanes);
 
-        int row_begin = bsr_row_ptr_A[i / block_dim] - base;
-        int row_end   = bsr_row_ptr_A[i / block_dim + 1] - base;
+        T* w0 = work.data();
+        T* w1 = w0 + m * lanes;
+        T* w2 = w1 + m * lanes;
+        T* w3 = w2 + m * lanes;
 
-        for(int j = 0; j < N; j++)
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+        for(int64_t g = 0; g < groups; ++g)
         {
-            int idx_C = i + j * ldc;
+            int64_t l0 = g * lanes;
+            int64_t nl = std::min(lanes, batch_count - l0);
 
-            T sum = make_DataType<T>(0.0);
+            const T* a  = dl + l0 * sa;
+            const T* b  = d + l0 * sa;
+            const T* c  = du + l0 * sa;
+            T*       xg = x + l0 * sx;
 
-            for(int s = row_begin; s < row_end; s++)
+            switch(alg)
             {
-                for(int t = 0; t < block_dim; t++)
-                {
-                    int idx_A = (dir == HIPSPARSE_DIRECTION_ROW)
-                                    ? block_dim * block_dim * s + block_dim * local_row + t
-                                    : block_dim * block_dim * s + block_dim * t + local_row;
-                    int idx_B = (transB == HIPSPARSE_OPERATION_NON_TRANSPOSE)
-                                    ? j * ldb + block_dim * (bsr_col_ind_A[s] - base) + t
-                                    : (block_dim * (bsr_col_ind_A[s] - base) + t) * ldb + j;
-
-                    sum = sum + testing_mult(alpha, testing_mult(bsr_val_A[idx_A], B[idx_B]));
-                }
+            case host_gtsv_alg_thomas:
+                host_gtsv_thomas_lanes(m, nl, a, b, c, sa, xg, stride, sx, w0);
+                break;
+            case host_gtsv_alg_lu:
+                host_gtsv_lu_lanes(m, nl, a, b, c, sa, xg, stride, sx, w0, w1, w2);
+                break;
+            case host_gtsv_alg_cr:
+                host_gtsv_cr(m, a, b, c, xg, stride, w0, w1, w2, w3);
+                break;
             }
+        }
+    }
+}
 
-            if(beta == make_DataType<T>(0.0))
-            {
-                C[idx_C] = sum;
-            }
-            else
-            {
-                C[idx_C] = sum + testing_mult(beta, C[idx_C]);
-            }
+/*! \brief  Solve the tridiagonal system with n right hand sides in B in double precision, see
+ *  hipsparseXgtsv2 and hipsparseXgtsv2_nopivot. Without pivoting, the system is solved by cyclic
+ *  reduction as on the device.
+ */
+template <typename T>
+inline void
+    host_gtsv2(int m, int n, const T* dl, const T* d, const T* du, T* B, int ldb, bool pivot)
+{
+    int64_t size = static_cast<int64_t>(ldb) * n;
+
+    auto dl64 = host_double_copy(m, dl);
+    auto d64  = host_double_copy(m, d);
+    auto du64 = host_double_copy(m, du);
+    auto B64  = host_double_copy(size, B);
+
+    host_gtsv_batch(pivot ? host_gtsv_alg_lu : host_gtsv_alg_cr,
+                    m,
+                    dl64.data(),
+                    d64.data(),
+                    du64.data(),
+                    0,
+                    B64.data(),
+                    1,
+                    ldb,
+                    n);
+
+    host_double_round(size, B64.data(), B);
+}
+
+/*! \brief  Solve batch_count tridiagonal systems stored batch_stride apart in double precision,
+ *  see hipsparseXgtsv2StridedBatch. The systems are solved by cyclic reduction as on the device.
+ */
+template <typename T>
+inline void host_gtsv2_strided_batch(
+    int m, const T* dl, const T* d, const T* du, T* x, int batch_count, int batch_stride)
+{
+    if(batch_count <= 0)
+    {
+        return;
+    }
+
+    int64_t size = static_cast<int64_t>(batch_stride) * (batch_count - 1) + m;
+
+    auto dl64 = host_double_copy(size, dl);
+    auto d64  = host_double_copy(size, d);
+    auto du64 = host_double_copy(size, du);
+    auto x64  = host_double_copy(size, x);
+
+    host_gtsv_batch(host_gtsv_alg_cr,
+                    m,
+                    dl64.data(),
+                    d64.data(),
+                    du64.data(),
+                    batch_stride,
+                    x64.data(),
+                    1,
+                    batch_stride,
+                    batch_count);
+
+    host_double_round(size, x64.data(), x);
+}
+
+/*! \brief  Solve batch_count interleaved tridiagonal systems in double precision, see
+ *  hipsparseXgtsvInterleavedBatch. Algorithm 1 (Thomas) is solved without pivoting, the pivoting
+ *  algorithms 2 (LU) and 3 (QR) as well as the default 0 are solved by LU with partial pivoting.
+ */
+template <typename T>
+inline void host_gtsv_interleaved_batch(
+    int algo, int m, const T* dl, const T* d, const T* du, T* x, int batch_count)
+{
+    int64_t size = static_cast<int64_t>(m) * batch_count;
+
+    auto dl64 = host_double_copy(size, dl);
+    auto d64  = host_double_copy(size, d);
+    auto du64 = host_double_copy(size, du);
+    auto x64  = host_double_copy(size, x);
+
+    host_gtsv_batch(algo == 1 ? host_gtsv_alg_thomas : host_gtsv_alg_lu,
+                    m,
+                    dl64.data(),
+                    d64.data(),
+                    du64.data(),
+                    1,
+                    x64.data(),
+                    batch_count,
+                    1,
+                    batch_count);
+
+    host_double_round(size, x64.data(), x);
+}
+
+/*! \brief  Load row of a pentadiagonal system into a row of the window of host_gpsv_lanes, where
+ *  entry k of the window row is column row - shift + k. Entries outside of the matrix are zero.
+ */
+template <typename T>
+inline void host_gpsv_row(int            m,
+                          int            row,
+                          int            shift,
+                          int64_t        nl,
+                          const T* const diag[5],
+                          int64_t        sa,
+                          const T*       x,
+                          int64_t        stride,
+                          int64_t        sx,
+                          T*             w)
+{
+    const T zero = make_DataType<T>(0);
+
+    for(int k = 0; k < 5; ++k)
+    {
+        int  off   = k - shift;
+        int  col   = row + off;
+        bool valid = row < m && off >= -2 && off <= 2 && col >= 0 && col < m;
+
+        const T* a = valid ? diag[off + 2] + row * stride : nullptr;
+
+        for(int64_t l = 0; l < nl; ++l)
+        {
+            w[k * nl + l] = valid ? a[l * sa] : zero;
         }
     }
+
+    for(int64_t l = 0; l < nl; ++l)
+    {
+        w[5 * nl + l] = (row < m) ? x[row * stride + l * sx] : zero;
+    }
 }
 
-template <typename I, typename J, typename T>
-void host_csrmm(J                    M,
-                J                    N,
-                J                    K,
-                hipsparseOperation_t transA,
-                hipsparseOperation_t transB,
-                T                    alpha,
-                const I*             csr_row_ptr_A,
-                const J*             csr_col_ind_A,
-                const T*             csr_val_A,
-                const T*             B,
-                J                    ldb,
-                hipsparseOrder_t     orderB,
-                T                    beta,
-                T*                   C,
-                J                    ldc,
-                hipsparseOrder_t     orderC,
-                hipsparseIndexBase_t base,
-                bool                 force_conj_A)
+/*! \brief  LU factorization with partial pivoting and solve for nl pentadiagonal systems with the
+ *  second sub diagonal ds, the sub diagonal dl, the diagonal d, the super diagonal du and the
+ *  second super diagonal dw. Step i picks the pivot of column i among the rows i to i + 2, which
+ *  are kept in a window of columns i to i + 4 and their right hand side. The rows of U have up
+ *  to four super diagonals and are stored in u, win holds 18 * nl entries.
+ */
+template <typename T>
+inline void host_gpsv_lanes(int      m,
+                            int64_t  nl,
+                            const T* ds,
+                            const T* dl,
+                            const T* d,
+                            const T* du,
+                            const T* dw,
+                            int64_t  sa,
+                            T*       x,
+                            int64_t  stride,
+                            int64_t  sx,
+                            T*       u,
+                            T*       win)
 {
-    bool conj_A = (transA == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE || force_conj_A);
-    bool conj_B = (transB == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE);
+    const T  zero    = make_DataType<T>(0);
+    const T  one     = make_DataType<T>(1);
+    const T* diag[5] = {ds, dl, d, du, dw};
 
-    if(transA == HIPSPARSE_OPERATION_NON_TRANSPOSE)
+    const int64_t ws = 6 * nl;
+
+    for(int j = 0; j < 3; ++j)
+    {
+        host_gpsv_row(m, j, j, nl, diag, sa, x, stride, sx, win + j * ws);
+    }
+
+    for(int i = 0; i < m; ++i)
     {
+        T* ui = u + i * 5 * nl;
+        T* xi = x + i * stride;
+
 #ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
+#pragma omp simd
 #endif
-        for(J i = 0; i < M; i++)
+        for(int64_t l = 0; l < nl; ++l)
         {
-            for(J j = 0; j < N; ++j)
-            {
-                I row_begin = csr_row_ptr_A[i] - base;
-                I row_end   = csr_row_ptr_A[i + 1] - base;
-                J idx_C     = orderC == HIPSPARSE_ORDER_COL ? i + j * ldc : i * ldc + j;
+            T* w = win + l;
 
-                T sum = make_DataType<T>(0);
+            double a0 = testing_abs(w[0]);
+            double a1 = testing_abs(w[ws]);
+            double a2 = testing_abs(w[2 * ws]);
 
-                for(I k = row_begin; k < row_end; ++k)
-                {
-                    J idx_B = 0;
-                    if((transB == HIPSPARSE_OPERATION_NON_TRANSPOSE
-                        && orderB == HIPSPARSE_ORDER_COL)
-                       || (transB == HIPSPARSE_OPERATION_TRANSPOSE && orderB != HIPSPARSE_ORDER_COL)
-                       || (transB == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE
-                           && orderB != HIPSPARSE_ORDER_COL))
-                    {
-                        idx_B = (csr_col_ind_A[k] - base + j * ldb);
-                    }
-                    else
-                    {
-                        idx_B = (j + (csr_col_ind_A[k] - base) * ldb);
-                    }
+            int p = (a2 > std::max(a0, a1)) ? 2 : ((a1 > a0) ? 1 : 0);
 
-                    sum = testing_fma(
-                        testing_conj(csr_val_A[k], conj_A), testing_conj(B[idx_B], conj_B), sum);
+            if(p != 0)
+            {
+                for(int k = 0; k < 6; ++k)
+                {
+                    T t                = w[k * nl];
+                    w[k * nl]          = w[p * ws + k * nl];
+                    w[p * ws + k * nl] = t;
                 }
+            }
+
+            T inv = testing_div(one, w[0]);
+
+            for(int j = 1; j < 3; ++j)
+            {
+                T f = testing_mult(w[j * ws], inv);
 
-                if(beta == make_DataType<T>(0))
+                for(int k = 0; k < 6; ++k)
                 {
-                    C[idx_C] = testing_mult(alpha, sum);
+                    w[j * ws + k * nl] = w[j * ws + k * nl] - testing_mult(f, w[k * nl]);
                 }
-                else
+            }
+
+            for(int k = 0; k < 5; ++k)
+            {
+                ui[k * nl + l] = w[k * nl];
+            }
+
+            xi[l * sx] = w[5 * nl];
+
+            // Rows i + 1 and i + 2 move up and to the columns i + 1 to i + 5
+            for(int j = 0; j < 2; ++j)
+            {
+                for(int k = 0; k < 4; ++k)
                 {
-                    C[idx_C] = testing_fma(beta, C[idx_C], testing_mult(alpha, sum));
+                    w[j * ws + k * nl] = w[(j + 1) * ws + (k + 1) * nl];
                 }
+
+                w[j * ws + 4 * nl] = zero;
+                w[j * ws + 5 * nl] = w[(j + 1) * ws + 5 * nl];
             }
         }
+
+        host_gpsv_row(m, i + 3, 2, nl, diag, sa, x, stride, sx, win + 2 * ws);
     }
-    else
+
+    for(int i = m - 1; i >= 0; --i)
     {
-        // scale C by beta
-        for(J i = 0; i < K; i++)
-        {
-            for(J j = 0; j < N; ++j)
-            {
-                J idx_C  = (orderC == HIPSPARSE_ORDER_COL) ? i + j * ldc : i * ldc + j;
-                C[idx_C] = testing_mult(beta, C[idx_C]);
-            }
-        }
+        T*       xi = x + i * stride;
+        const T* ui = u + i * 5 * nl;
 
-        for(J i = 0; i < M; i++)
+        int kmax = std::min(4, m - 1 - i);
+
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+        for(int64_t l = 0; l < nl; ++l)
         {
-            I row_begin = csr_row_ptr_A[i] - base;
-            I row_end   = csr_row_ptr_A[i + 1] - base;
+            T r = xi[l * sx];
 
-            for(J j = 0; j < N; ++j)
+            for(int k = 1; k <= kmax; ++k)
             {
-                for(I k = row_begin; k < row_end; ++k)
-                {
-                    J col = csr_col_ind_A[k] - base;
-                    T val = testing_conj(csr_val_A[k], conj_A);
+                r = r - testing_mult(ui[k * nl + l], xi[k * stride + l * sx]);
+            }
 
-                    J idx_B = 0;
+            xi[l * sx] = testing_div(r, ui[l]);
+        }
+    }
+}
 
-                    if((transB == HIPSPARSE_OPERATION_NON_TRANSPOSE
-                        && orderB == HIPSPARSE_ORDER_COL)
-                       || (transB == HIPSPARSE_OPERATION_TRANSPOSE && orderB != HIPSPARSE_ORDER_COL)
-                       || (transB == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE
-                           && orderB != HIPSPARSE_ORDER_COL))
-                    {
-                        idx_B = (i + j * ldb);
-                    }
-                    else
-                    {
-                        idx_B = (j + i * ldb);
-                    }
+/*! \brief  Solve batch_count pentadiagonal systems with m rows, see host_gtsv_thomas_lanes for
+ *  the layout and host_gpsv_lanes for the diagonals. The systems are split across threads.
+ */
+template <typename T>
+inline void host_gpsv_batch(int      m,
+                            const T* ds,
+                            const T* dl,
+                            const T* d,
+                            const T* du,
+                            const T* dw,
+                            int64_t  sa,
+                            T*       x,
+                            int64_t  stride,
+                            int64_t  sx,
+                            int      batch_count)
+{
+    if(m <= 0 || batch_count <= 0)
+    {
+        return;
+    }
 
-                    J idx_C = (orderC == HIPSPARSE_ORDER_COL) ? col + j * ldc : col * ldc + j;
+    int64_t lanes  = host_gtsv_lanes(sx);
+    int64_t groups = (batch_count + lanes - 1) / lanes;
 
-                    C[idx_C]
-                        = C[idx_C]
-                          + testing_mult(alpha, testing_mult(val, testing_conj(B[idx_B], conj_B)));
-                }
-            }
+#ifdef _OPENMP
+#pragma omp parallel if(groups > 1)
+#endif
+    {
+        std::vector<T> work((5 * static_cast<size_t>(m) + 18) * lanes);
+
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+        for(int64_t g = 0; g < groups; ++g)
+        {
+            int64_t l0  = g * lanes;
+            int64_t nl  = std::min(lanes, batch_count - l0);
+            int64_t off = l0 * sa;
+
+            host_gpsv_lanes(m,
+                            nl,
+                            ds + off,
+                            dl + off,
+                            d + off,
+                            du + off,
+                            dw + off,
+                            sa,
+                            x + l0 * sx,
+                            stride,
+                            sx,
+                            work.data(),
+                            work.data() + 5 * m * lanes);
         }
     }
 }
 
-template <typename T, typename I, typename J>
-void host_csrmm_batched(J                    M,
-                        J                    N,
-                        J                    K,
-                        J                    batch_count_A,
-                        J                    offsets_batch_stride_A,
-                        I                    columns_values_batch_stride_A,
-                        hipsparseOperation_t transA,
-                        hipsparseOperation_t transB,
-                        T                    alpha,
-                        const I*             csr_row_ptr_A,
-                        const J*             csr_col_ind_A,
-                        const T*             csr_val_A,
-                        const T*             B,
-                        J                    ldb,
-                        J                    batch_count_B,
-                        I                    batch_stride_B,
-                        hipsparseOrder_t     order_B,
-                        T                    beta,
-                        T*                   C,
-                        J                    ldc,
-                        J                    batch_count_C,
-                        I                    batch_stride_C,
-                        hipsparseOrder_t     order_C,
-                        hipsparseIndexBase_t base,
-                        bool                 force_conj_A)
+/*! \brief  Solve batch_count interleaved pentadiagonal systems in double precision, see
+ *  hipsparseXgpsvInterleavedBatch. All algorithms are solved by LU with partial pivoting.
+ */
+template <typename T>
+inline void host_gpsv_interleaved_batch(int      m,
+                                        const T* ds,
+                                        const T* dl,
+                                        const T* d,
+                                        const T* du,
+                                        const T* dw,
+                                        T*       x,
+                                        int      batch_count)
 {
-    bool Ci_A_Bi  = (batch_count_A == 1 && batch_count_B == batch_count_C);
-    bool Ci_Ai_B  = (batch_count_B == 1 && batch_count_A == batch_count_C);
-    bool Ci_Ai_Bi = (batch_count_A == batch_count_C && batch_count_A == batch_count_B);
+    int64_t size = static_cast<int64_t>(m) * batch_count;
+
+    auto ds64 = host_double_copy(size, ds);
+    auto dl64 = host_double_copy(size, dl);
+    auto d64  = host_double_copy(size, d);
+    auto du64 = host_double_copy(size, du);
+    auto dw64 = host_double_copy(size, dw);
+    auto x64  = host_double_copy(size, x);
+
+    host_gpsv_batch(m,
+                    ds64.data(),
+                    dl64.data(),
+                    d64.data(),
+                    du64.data(),
+                    dw64.data(),
+                    1,
+                    x64.data(),
+                    batch_count,
+                    1,
+                    batch_count);
+
+    host_double_round(size, x64.data(), x);
+}
 
-    if(!Ci_A_Bi && !Ci_Ai_B && !Ci_Ai_Bi)
-    {
-        return;
-    }
+/*! \brief  Largest absolute row sum of the m x m column major matrix A. */
+template <typename T>
+inline double host_max_row_sum(int m, const T* A)
+{
+    std::vector<double> sum(m, 0.0);
 
-    if(Ci_A_Bi)
+    for(int64_t j = 0; j < m; ++j)
     {
-        for(J i = 0; i < batch_count_C; i++)
+        for(int64_t i = 0; i < m; ++i)
         {
-            host_csrmm(M,
-                       N,
-                       K,
-                       transA,
-                       transB,
-                       alpha,
-                       csr_row_ptr_A,
-                       csr_col_ind_A,
-                       csr_val_A,
-                       B + batch_stride_B * i,
-                       ldb,
-                       order_B,
-                       beta,
-                       C + batch_stride_C * i,
-                       ldc,
-                       order_C,
-                       base,
-                       force_conj_A);
+            sum[i] += testing_abs(A[j * m + i]);
         }
     }
-    else if(Ci_Ai_B)
+
+    return (m > 0) ? *std::max_element(sum.begin(), sum.end()) : 0.0;
+}
+
+/*! \brief  Tolerance of unit_check_norm for solutions of a tridiagonal system, row i of which is
+ *  at i * stride. The relative error of the solution of a backward stable solver is bounded by
+ *  about the condition number of the system times the machine epsilon of T. The condition number
+ *  in the max norm is computed from the inverse of the system, which takes O(m^2) operations.
+ */
+template <typename T>
+inline double host_gtsv_tolerance(int m, const T* dl, const T* d, const T* du, int64_t stride)
+{
+    typedef typename host_double_type<T>::type D;
+
+    std::vector<D> a(m), b(m), c(m), inv(static_cast<size_t>(m) * m, make_DataType<D>(0));
+
+    for(int64_t i = 0; i < m; ++i)
     {
-        for(J i = 0; i < batch_count_C; i++)
-        {
-            host_csrmm(M,
-                       N,
-                       K,
-                       transA,
-                       transB,
-                       alpha,
-                       csr_row_ptr_A + offsets_batch_stride_A * i,
-                       csr_col_ind_A + columns_values_batch_stride_A * i,
-                       csr_val_A + columns_values_batch_stride_A * i,
-                       B,
-                       ldb,
-                       order_B,
-                       beta,
-                       C + batch_stride_C * i,
-                       ldc,
-                       order_C,
-                       base,
-                       force_conj_A);
-        }
+        a[i] = (i > 0) ? host_double(dl[i * stride]) : make_DataType<D>(0);
+        b[i] = host_double(d[i * stride]);
+        c[i] = (i < m - 1) ? host_double(du[i * stride]) : make_DataType<D>(0);
+
+        inv[i * m + i] = make_DataType<D>(1);
     }
-    else if(Ci_Ai_Bi)
+
+    double norm = 0.0;
+    for(int i = 0; i < m; ++i)
     {
-        for(J i = 0; i < batch_count_C; i++)
+        norm = std::max(norm, testing_abs(a[i]) + testing_abs(b[i]) + testing_abs(c[i]));
+    }
+
+    host_gtsv_batch(host_gtsv_alg_lu, m, a.data(), b.data(), c.data(), 0, inv.data(), 1, m, m);
+
+    double eps = std::numeric_limits<decltype(testing_real(make_DataType<T>(0)))>::epsilon();
+
+    return norm * host_max_row_sum(m, inv.data()) * eps;
+}
+
+/*! \brief  Tolerance of unit_check_norm for solutions of a pentadiagonal system, row i of which is
+ *  at i * stride, see host_gtsv_tolerance.
+ */
+template <typename T>
+inline double host_gpsv_tolerance(
+    int m, const T* ds, const T* dl, const T* d, const T* du, const T* dw, int64_t stride)
+{
+    typedef typename host_double_type<T>::type D;
+
+    std::vector<D> diag[5];
+    std::vector<D> inv(static_cast<size_t>(m) * m, make_DataType<D>(0));
+
+    const T* src[5] = {ds, dl, d, du, dw};
+
+    double norm = 0.0;
+    for(int64_t i = 0; i < m; ++i)
+    {
+        double row = 0.0;
+
+        for(int k = 0; k < 5; ++k)
         {
-            host_csrmm(M,
-                       N,
-                       K,
-                       transA,
-                       transB,
-                       alpha,
-                       csr_row_ptr_A + offsets_batch_stride_A * i,
-                       csr_col_ind_A + columns_values_batch_stride_A * i,
-                       csr_val_A + columns_values_batch_stride_A * i,
-                       B + batch_stride_B * i,
-                       ldb,
-                       order_B,
-                       beta,
-                       C + batch_stride_C * i,
-                       ldc,
-                       order_C,
-                       base,
-                       force_conj_A);
+            // Entries outside of the matrix are ignored
+            bool inside = (i + k - 2 >= 0 && i + k - 2 < m);
+
+            diag[k].push_back(inside ? host_double(src[k][i * stride]) : make_DataType<D>(0));
+            row += testing_abs(diag[k][i]);
         }
+
+        norm = std::max(norm, row);
+
+        inv[i * m + i] = make_DataType<D>(1);
     }
+
+    host_gpsv_batch(m,
+                    diag[0].data(),
+                    diag[1].data(),
+                    diag[2].data(),
+                    diag[3].data(),
+                    diag[4].data(),
+                    0,
+                    inv.data(),
+                    1,
+                    m,
+                    m);
+
+    double eps = std::numeric_limits<decltype(testing_real(make_DataType<T>(0)))>::epsilon();
+
+    return norm * host_max_row_sum(m, inv.data()) * eps;
 }
 
 template <typename T, typename I, typename J>
@@ -3227,92 +6418,57 @@ void host_coomm(I                    M,
                 hipsparseOrder_t     order_C,
                 hipsparseIndexBase_t base)
 {
+    bool trans  = (transA != HIPSPARSE_OPERATION_NON_TRANSPOSE);
     bool conj_A = (transA == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE);
     bool conj_B = (transB == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE);
 
-    if(transA == HIPSPARSE_OPERATION_NON_TRANSPOSE)
-    {
-        for(I j = 0; j < N; j++)
-        {
-#ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
-#endif
-            for(I i = 0; i < M; ++i)
-            {
-                I idx_C = (order_C == HIPSPARSE_ORDER_COL) ? i + j * ldc : i * ldc + j;
+    // op(B) is either strided (column major) or contiguous (row major) along N
+    bool col_B = (transB == HIPSPARSE_OPERATION_NON_TRANSPOSE && order_B == HIPSPARSE_ORDER_COL)
+                 || (transB != HIPSPARSE_OPERATION_NON_TRANSPOSE && order_B != HIPSPARSE_ORDER_COL);
+    bool col_C = (order_C == HIPSPARSE_ORDER_COL);
 
-                C[idx_C] = testing_mult(beta, C[idx_C]);
-            }
-        }
+    int64_t ldb_k = col_B ? 1 : ldb;
+    int64_t ldb_j = col_B ? ldb : 1;
+    int64_t ldc_i = col_C ? 1 : ldc;
+    int64_t ldc_j = col_C ? ldc : 1;
+
+    // scale C by beta
+    host_dense_scale(trans ? K : M, N, beta, C, ldc, order_C);
+
+    // Each entry of C accumulates in the order of the COO entries, thus columns of C are
+    // independent and processed in panels, concurrently
+    bool contiguous = !col_B && !col_C;
+    I    panel      = host_spmm_thread_panel(
+        N, contiguous ? HOST_SPMM_ROW_PANEL : host_spmm_column_panel<T>(std::max(M, K)));
 
 #ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
+#pragma omp parallel for schedule(dynamic, 1)
 #endif
-        for(I j = 0; j < N; j++)
-        {
-            for(I i = 0; i < nnz; ++i)
-            {
-                I row = coo_row_ind_A[i] - base;
-                I col = coo_col_ind_A[i] - base;
-                T val = testing_mult(alpha, coo_val_A[i]);
+    for(I j0 = 0; j0 < N; j0 += panel)
+    {
+        I nj = std::min(panel, static_cast<I>(N - j0));
 
-                I idx_C = (order_C == HIPSPARSE_ORDER_COL) ? row + j * ldc : row * ldc + j;
+        for(I i = 0; i < nnz; ++i)
+        {
+            I row = coo_row_ind_A[i] - base;
+            I col = coo_col_ind_A[i] - base;
+            T val = trans ? testing_mult(alpha, testing_conj(coo_val_A[i], conj_A))
+                          : testing_mult(alpha, coo_val_A[i]);
 
-                I idx_B = 0;
-                if((transB == HIPSPARSE_OPERATION_NON_TRANSPOSE && order_B == HIPSPARSE_ORDER_COL)
-                   || (transB != HIPSPARSE_OPERATION_NON_TRANSPOSE
-                       && order_B != HIPSPARSE_ORDER_COL))
-                {
-                    idx_B = (col + j * ldb);
-                }
-                else
-                {
-                    idx_B = (j + col * ldb);
-                }
+            // Row of C and row of op(B) of this entry
+            I row_C = trans ? col : row;
+            I row_B = trans ? row : col;
 
-                C[idx_C] = testing_fma(val, testing_conj(B[idx_B], conj_B), C[idx_C]);
-            }
-        }
-    }
-    else
-    {
-        for(I j = 0; j < N; j++)
-        {
-#ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
-#endif
-            for(I i = 0; i < K; ++i)
+            if(contiguous)
             {
-                I idx_C = (order_C == HIPSPARSE_ORDER_COL) ? i + j * ldc : i * ldc + j;
-
-                C[idx_C] = testing_mult(beta, C[idx_C]);
+                host_fma_panel(nj, val, B + row_B * ldb_k + j0, conj_B, C + row_C * ldc_i + j0);
+                continue;
             }
-        }
 
-#ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
-#endif
-        for(I j = 0; j < N; j++)
-        {
-            for(I i = 0; i < nnz; ++i)
+            for(I j = j0; j < j0 + nj; ++j)
             {
-                I row = coo_row_ind_A[i] - base;
-                I col = coo_col_ind_A[i] - base;
-                T val = testing_mult(alpha, testing_conj(coo_val_A[i], conj_A));
-
-                I idx_C = (order_C == HIPSPARSE_ORDER_COL) ? col + j * ldc : col * ldc + j;
-
-                I idx_B = 0;
-                if((transB == HIPSPARSE_OPERATION_NON_TRANSPOSE && order_B == HIPSPARSE_ORDER_COL)
-                   || (transB != HIPSPARSE_OPERATION_NON_TRANSPOSE
-                       && order_B != HIPSPARSE_ORDER_COL))
-                {
-                    idx_B = (row + j * ldb);
-                }
-                else
-                {
-                    idx_B = (j + row * ldb);
-                }
+                int64_t idx_B = row_B * ldb_k + j * ldb_j;
+                int64_t idx_C = row_C * ldc_i + j * ldc_j;
 
                 C[idx_C] = testing_fma(val, testing_conj(B[idx_B], conj_B), C[idx_C]);
             }
@@ -3429,6 +6585,189 @@ void host_coomm_batched(I                    M,
     }
 }
 
+/* ============================================================================================ */
+/*! \brief  Level schedule of a sparse triangular matrix. All rows of a level only depend on rows
+ *  of preceding levels and can therefore be solved concurrently.
+ */
+template <typename J>
+struct host_csr_level_info
+{
+    std::vector<J> level_ptr; // start of each level in rows, number of levels + 1 entries
+    std::vector<J> rows; // rows ordered by level
+};
+
+/*! \brief  Bucket rows by their level (depth) in the dependency graph. */
+template <typename J>
+inline void host_level_buckets(const std::vector<J>& depth, J nlevel, host_csr_level_info<J>& info)
+{
+    J M = static_cast<J>(depth.size());
+
+    info.level_ptr.assign(nlevel + 1, 0);
+    info.rows.resize(M);
+
+    for(J row = 0; row < M; ++row)
+    {
+        ++info.level_ptr[depth[row] + 1];
+    }
+
+    for(J l = 0; l < nlevel; ++l)
+    {
+        info.level_ptr[l + 1] += info.level_ptr[l];
+    }
+
+    std::vector<J> next(info.level_ptr.begin(), info.level_ptr.end() - 1);
+
+    for(J row = 0; row < M; ++row)
+    {
+        info.rows[next[depth[row]]++] = row;
+    }
+}
+
+/*! \brief  Compute the level schedule of the lower or upper triangular part of a CSR matrix. */
+template <typename I, typename J>
+inline void host_csr_level_analysis(J                       M,
+                                    const I*                csr_row_ptr,
+                                    const J*                csr_col_ind,
+                                    hipsparseFillMode_t     fill_mode,
+                                    hipsparseIndexBase_t    base,
+                                    host_csr_level_info<J>& info)
+{
+    std::vector<J> depth(M);
+    J              nlevel = 0;
+
+    for(J i = 0; i < M; ++i)
+    {
+        J row = (fill_mode == HIPSPARSE_FILL_MODE_LOWER) ? i : M - 1 - i;
+        J d   = 0;
+
+        I row_begin = csr_row_ptr[row] - base;
+        I row_end   = csr_row_ptr[row + 1] - base;
+
+        for(I j = row_begin; j < row_end; ++j)
+        {
+            J col = csr_col_ind[j] - base;
+
+            if((fill_mode == HIPSPARSE_FILL_MODE_LOWER) ? (col < row) : (col > row))
+            {
+                d = std::max(d, static_cast<J>(depth[col] + 1));
+            }
+        }
+
+        depth[row] = d;
+        nlevel     = std::max(nlevel, static_cast<J>(d + 1));
+    }
+
+    host_level_buckets(depth, nlevel, info);
+}
+
+/*! \brief  Return the level schedule of the lower or upper triangular part of a CSR matrix.
+ *  Schedules are cached per sparsity pattern, such that repeated solves with the same matrix only
+ *  run the analysis once.
+ */
+template <typename I, typename J>
+inline std::shared_ptr<const host_csr_level_info<J>>
+    host_csr_level_schedule(J                    M,
+                            const I*             csr_row_ptr,
+                            const J*             csr_col_ind,
+                            hipsparseFillMode_t  fill_mode,
+                            hipsparseIndexBase_t base)
+{
+    typedef std::shared_ptr<const host_csr_level_info<J>> info_ptr;
+
+    struct cache_entry
+    {
+        uint64_t key[5];
+        info_ptr info;
+    };
+
+    static const size_t           capacity = 16;
+    static std::mutex             mutex;
+    static std::list<cache_entry> cache; // most recently used first
+
+    if(M <= 0)
+    {
+        return std::make_shared<const host_csr_level_info<J>>();
+    }
+
+    int64_t nnz = csr_row_ptr[M] - base;
+
+    cache_entry entry;
+    entry.key[0] = static_cast<uint64_t>(M);
+    entry.key[1] = static_cast<uint64_t>(nnz);
+    entry.key[2] = static_cast<uint64_t>(fill_mode) * 2 + static_cast<uint64_t>(base);
+    entry.key[3] = hipsparse_bin_checksum(csr_row_ptr, sizeof(I) * (M + 1), 0);
+    entry.key[4] = hipsparse_bin_checksum(csr_col_ind, sizeof(J) * nnz, 0);
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        for(typename std::list<cache_entry>::iterator it = cache.begin(); it != cache.end(); ++it)
+        {
+            if(std::equal(entry.key, entry.key + 5, it->key))
+            {
+                cache.splice(cache.begin(), cache, it);
+                return it->info;
+            }
+        }
+    }
+
+    std::shared_ptr<host_csr_level_info<J>> info = std::make_shared<host_csr_level_info<J>>();
+    host_csr_level_analysis(M, csr_row_ptr, csr_col_ind, fill_mode, base, *info);
+    entry.info = info;
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    cache.push_front(entry);
+
+    if(cache.size() > capacity)
+    {
+        cache.pop_back();
+    }
+
+    return entry.info;
+}
+
+/*! \brief  Call f(row, k) for all rows of a level schedule and all k in [0, n), level by level.
+ *  Levels with little work are processed sequentially to avoid the fork / join overhead.
+ */
+template <typename J, typename F>
+inline void host_csr_level_apply(const host_csr_level_info<J>& info, J n, F f)
+{
+    for(size_t l = 0; l + 1 < info.level_ptr.size(); ++l)
+    {
+        const J* rows = info.rows.data() + info.level_ptr[l];
+        int64_t  size = static_cast<int64_t>(info.level_ptr[l + 1] - info.level_ptr[l]) * n;
+
+        if(size >= 1024)
+        {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 16)
+#endif
+            for(int64_t i = 0; i < size; ++i)
+            {
+                f(rows[i / n], static_cast<J>(i % n));
+            }
+        }
+        else
+        {
+            for(int64_t i = 0; i < size; ++i)
+            {
+                f(rows[i / n], static_cast<J>(i % n));
+            }
+        }
+    }
+}
+
+/*! \brief  Update a zero pivot, rows may be solved concurrently. */
+template <typename J>
+inline void host_csr_update_pivot(J* pivot, J row)
+{
+#ifdef _OPENMP
+#pragma omp critical(host_csr_update_pivot)
+#endif
+    *pivot = std::min(*pivot, row);
+}
+
 template <typename T>
 int csrilu0(int                  m,
             const int*           ptr,
@@ -3439,13 +6778,45 @@ int csrilu0(int                  m,
             double               boost_tol,
             T                    boost_val)
 {
-    // pointer of upper part of each row
-    std::vector<int> diag_offset(m);
-    std::vector<int> nnz_entries(m, 0);
+    // pointer of upper part of each row, -1 for rows that failed
+    std::vector<int> diag_offset(m, -1);
+
+    // per thread nnz entries of the row that is processed
+    std::vector<std::vector<int>> nnz_entries(host_max_threads());
+
+    // Diagonals that are used by a later row and thus get boosted
+    std::vector<char> boost_diag(boost ? m : 0, 0);
+
+    if(boost)
+    {
+        for(int ai = 0; ai < m; ++ai)
+        {
+            for(int j = ptr[ai] - idx_base; j < ptr[ai + 1] - idx_base; ++j)
+            {
+                if(col[j] - idx_base < ai)
+                {
+                    boost_diag[col[j] - idx_base] = 1;
+                }
+            }
+        }
+    }
+
+    // Zero pivot of the first row that failed
+    int pivot_row = m;
+    int pivot     = -1;
+
+    // Rows of a level only depend on rows of previous levels
+    std::shared_ptr<const host_csr_level_info<int>> info
+        = host_csr_level_schedule(m, ptr, col, HIPSPARSE_FILL_MODE_LOWER, idx_base);
+
+    host_csr_level_apply(*info, 1, [&](int ai, int) {
+        std::vector<int>& entries = nnz_entries[host_thread_num()];
+
+        if(entries.empty())
+        {
+            entries.assign(m, 0);
+        }
 
-    // ai = 0 to N loop over all rows
-    for(int ai = 0; ai < m; ++ai)
-    {
         // ai-th row entries
         int row_start = ptr[ai] - idx_base;
         int row_end   = ptr[ai + 1] - idx_base;
@@ -3454,10 +6825,12 @@ int csrilu0(int                  m,
         // nnz position of ai-th row in val array
         for(j = row_start; j < row_end; ++j)
         {
-            nnz_entries[col[j] - idx_base] = j;
+            entries[col[j] - idx_base] = j;
         }
 
-        bool has_diag = false;
+        bool has_diag  = false;
+        bool failed    = false;
+        int  row_pivot = -1;
 
         // loop over ai-th row nnz entries
         for(j = row_start; j < row_end; ++j)
@@ -3468,21 +6841,22 @@ int csrilu0(int                  m,
                 int col_j  = col[j] - idx_base;
                 int diag_j = diag_offset[col_j];
 
-                T diag_val = val[diag_j];
-
-                if(boost)
+                // A previous row failed already
+                if(diag_j == -1)
                 {
-                    diag_val    = (boost_tol >= testing_abs(diag_val)) ? boost_val : diag_val;
-                    val[diag_j] = diag_val;
+                    failed = true;
+                    break;
                 }
-                else
+
+                // Boosted diagonals have been set when finishing row col_j
+                T diag_val = val[diag_j];
+
+                // Check for numeric pivot
+                if(!boost && diag_val == make_DataType<T>(0.0))
                 {
-                    // Check for numeric pivot
-                    if(diag_val == make_DataType<T>(0.0))
-                    {
-                        // Numerical zero diagonal
-                        return col_j + idx_base;
-                    }
+                    // Numerical zero diagonal
+                    row_pivot = col_j + idx_base;
+                    break;
                 }
 
                 // multiplication factor
@@ -3492,9 +6866,9 @@ int csrilu0(int                  m,
                 for(int k = diag_j + 1; k < ptr[col_j + 1] - idx_base; ++k)
                 {
                     // if nnz at this position do linear combination
-                    if(nnz_entries[col[k] - idx_base] != 0)
+                    if(entries[col[k] - idx_base] != 0)
                     {
-                        int idx  = nnz_entries[col[k] - idx_base];
+                        int idx  = entries[col[k] - idx_base];
                         val[idx] = testing_fma(testing_neg(val[j]), val[k], val[idx]);
                     }
                 }
@@ -3510,23 +6884,43 @@ int csrilu0(int                  m,
             }
         }
 
-        if(!has_diag)
+        if(!failed && row_pivot == -1 && !has_diag)
         {
             // Structural zero digonal
-            return ai + idx_base;
+            row_pivot = ai + idx_base;
+        }
+
+        if(row_pivot != -1)
+        {
+            // Report the pivot of the first row that failed, as the sequential algorithm does
+#ifdef _OPENMP
+#pragma omp critical(csrilu0_pivot)
+#endif
+            if(ai < pivot_row)
+            {
+                pivot_row = ai;
+                pivot     = row_pivot;
+            }
         }
+        else if(!failed)
+        {
+            if(boost && boost_diag[ai])
+            {
+                val[j] = (boost_tol >= testing_abs(val[j])) ? boost_val : val[j];
+            }
 
-        // set diagonal pointer to diagonal element
-        diag_offset[ai] = j;
+            // set diagonal pointer to diagonal element
+            diag_offset[ai] = j;
+        }
 
         // clear nnz entries
         for(j = row_start; j < row_end; ++j)
         {
-            nnz_entries[col[j] - idx_base] = 0;
+            entries[col[j] - idx_base] = 0;
         }
-    }
+    });
 
-    return -1;
+    return pivot;
 }
 
 template <typename T>
@@ -3543,25 +6937,33 @@ inline void host_bsrilu02(hipsparseDirection_t    dir,
                           double                  boost_tol,
                           T                       boost_val)
 {
-    // Initialize pivots
-    *struct_pivot  = mb + 1;
-    *numeric_pivot = mb + 1;
+    // First BSR rows with a structural and a numerical zero pivot
+    int struct_row  = mb;
+    int numeric_row = mb;
 
-    // Temporary vector to hold diagonal offset to access diagonal BSR block
-    std::vector<int> diag_offset(mb);
-    std::vector<int> nnz_entries(mb, -1);
+    // Temporary vector to hold diagonal offset to access diagonal BSR block, -1 for rows that
+    // failed
+    std::vector<int> diag_offset(mb, -1);
 
-    // First diagonal block is index 0
-    if(mb > 0)
-    {
-        diag_offset[0] = 0;
-    }
+    // Per thread entry points of the BSR row that is processed
+    std::vector<std::vector<int>> nnz_entries(host_max_threads());
+
+    // BSR rows of a level only depend on BSR rows of previous levels
+    std::shared_ptr<const host_csr_level_info<int>> info = host_csr_level_schedule(
+        mb, bsr_row_ptr.data(), bsr_col_ind.data(), HIPSPARSE_FILL_MODE_LOWER, base);
 
     // Loop over all BSR rows
-    for(int i = 0; i < mb; ++i)
-    {
+    host_csr_level_apply(*info, 1, [&](int i, int) {
+        std::vector<int>& entries = nnz_entries[host_thread_num()];
+
+        if(entries.empty())
+        {
+            entries.assign(mb, -1);
+        }
+
         // Flag whether we have a diagonal block or not
         bool has_diag = false;
+        bool failed   = false;
 
         // BSR column entry and exit point
         int row_begin = bsr_row_ptr[i] - base;
@@ -3572,8 +6974,8 @@ inline void host_bsrilu02(hipsparseDirection_t    dir,
         // Set up entry points for linear combination
         for(j = row_begin; j < row_end; ++j)
         {
-            int col_j          = bsr_col_ind[j] - base;
-            nnz_entries[col_j] = j;
+            int col_j      = bsr_col_ind[j] - base;
+            entries[col_j] = j;
         }
 
         // Process lower diagonal BSR blocks (diagonal BSR block is excluded)
@@ -3604,6 +7006,13 @@ inline void host_bsrilu02(hipsparseDirection_t    dir,
             int diag_j    = diag_offset[bsr_col];
             int row_end_j = bsr_row_ptr[bsr_col + 1] - base;
 
+            // A previous BSR row has a structural pivot, factorization stopped there
+            if(diag_j == -1)
+            {
+                failed = true;
+                break;
+            }
+
             // Loop through all rows within the BSR block
             for(int bi = 0; bi < bsr_dim; ++bi)
             {
@@ -3633,9 +7042,9 @@ inline void host_bsrilu02(hipsparseDirection_t    dir,
             {
                 int bsr_col_k = bsr_col_ind[k] - base;
 
-                if(nnz_entries[bsr_col_k] != -1)
+                if(entries[bsr_col_k] != -1)
                 {
-                    int m = nnz_entries[bsr_col_k];
+                    int m = entries[bsr_col_k];
 
                     // Loop through all rows within the BSR block
                     for(int bi = 0; bi < bsr_dim; ++bi)
@@ -3661,74 +7070,82 @@ inline void host_bsrilu02(hipsparseDirection_t    dir,
         }
 
         // Check for structural pivot
-        if(!has_diag)
+        if(!failed && !has_diag)
         {
-            *struct_pivot = std::min(*struct_pivot, i + base);
-            break;
+#ifdef _OPENMP
+#pragma omp critical(host_bsrilu02_pivot)
+#endif
+            struct_row = std::min(struct_row, i);
         }
 
-        // Process diagonal
-        if(bsr_col_ind[j] - base == i)
+        if(!failed && has_diag)
         {
-            // Loop through all rows within the BSR block
-            for(int bi = 0; bi < bsr_dim; ++bi)
+            // Process diagonal
+            if(bsr_col_ind[j] - base == i)
             {
-                T diag = bsr_val[BSR_IND(j, bi, bi, dir)];
-
-                if(boost)
+                // Loop through all rows within the BSR block
+                for(int bi = 0; bi < bsr_dim; ++bi)
                 {
-                    diag = (boost_tol >= testing_abs(diag)) ? boost_val : diag;
-                    bsr_val[BSR_IND(j, bi, bi, dir)] = diag;
-                }
-                else
-                {
-                    // Check for numeric pivot
-                    if(diag == make_DataType<T>(0))
+                    T diag = bsr_val[BSR_IND(j, bi, bi, dir)];
+
+                    if(boost)
                     {
-                        *numeric_pivot = std::min(*numeric_pivot, bsr_col_ind[j]);
-                        continue;
+                        diag = (boost_tol >= testing_abs(diag)) ? boost_val : diag;
+                        bsr_val[BSR_IND(j, bi, bi, dir)] = diag;
+                    }
+                    else
+                    {
+                        // Check for numeric pivot
+                        if(diag == make_DataType<T>(0))
+                        {
+#ifdef _OPENMP
+#pragma omp critical(host_bsrilu02_pivot)
+#endif
+                            numeric_row = std::min(numeric_row, i);
+                            continue;
+                        }
                     }
-                }
 
-                // Process all rows within the BSR block after bi-th row
-                for(int bk = bi + 1; bk < bsr_dim; ++bk)
-                {
-                    T val = bsr_val[BSR_IND(j, bk, bi, dir)];
+                    // Process all rows within the BSR block after bi-th row
+                    for(int bk = bi + 1; bk < bsr_dim; ++bk)
+                    {
+                        T val = bsr_val[BSR_IND(j, bk, bi, dir)];
 
-                    // Multiplication factor
-                    bsr_val[BSR_IND(j, bk, bi, dir)] = val = testing_div(val, diag);
+                        // Multiplication factor
+                        bsr_val[BSR_IND(j, bk, bi, dir)] = val = testing_div(val, diag);
 
-                    // Loop through remaining columns of bk-th row and do linear combination
-                    for(int bj = bi + 1; bj < bsr_dim; ++bj)
-                    {
-                        bsr_val[BSR_IND(j, bk, bj, dir)]
-                            = testing_fma(-val,
-                                          bsr_val[BSR_IND(j, bi, bj, dir)],
-                                          bsr_val[BSR_IND(j, bk, bj, dir)]);
+                        // Loop through remaining columns of bk-th row and do linear combination
+                        for(int bj = bi + 1; bj < bsr_dim; ++bj)
+                        {
+                            bsr_val[BSR_IND(j, bk, bj, dir)]
+                                = testing_fma(-val,
+                                              bsr_val[BSR_IND(j, bi, bj, dir)],
+                                              bsr_val[BSR_IND(j, bk, bj, dir)]);
+                        }
                     }
                 }
             }
-        }
 
-        // Store diagonal BSR block entry point
-        int row_diag = diag_offset[i] = j;
+            // Store diagonal BSR block entry point
+            int row_diag = diag_offset[i] = j;
 
-        // Process upper diagonal BSR blocks
-        for(j = row_diag + 1; j < row_end; ++j)
-        {
-            // Loop through all rows within the BSR block
-            for(int bi = 0; bi < bsr_dim; ++bi)
+            // Process upper diagonal BSR blocks
+            for(j = row_diag + 1; j < row_end; ++j)
             {
-                // Process all rows within the BSR block after bi-th row
-                for(int bk = bi + 1; bk < bsr_dim; ++bk)
+                // Loop through all rows within the BSR block
+                for(int bi = 0; bi < bsr_dim; ++bi)
                 {
-                    // Loop through columns of bk-th row and do linear combination
-                    for(int bj = 0; bj < bsr_dim; ++bj)
+                    // Process all rows within the BSR block after bi-th row
+                    for(int bk = bi + 1; bk < bsr_dim; ++bk)
                     {
-                        bsr_val[BSR_IND(j, bk, bj, dir)]
-                            = testing_fma(-bsr_val[BSR_IND(row_diag, bk, bi, dir)],
-                                          bsr_val[BSR_IND(j, bi, bj, dir)],
-                                          bsr_val[BSR_IND(j, bk, bj, dir)]);
+                        // Loop through columns of bk-th row and do linear combination
+                        for(int bj = 0; bj < bsr_dim; ++bj)
+                        {
+                            bsr_val[BSR_IND(j, bk, bj, dir)]
+                                = testing_fma(-bsr_val[BSR_IND(row_diag, bk, bi, dir)],
+                                              bsr_val[BSR_IND(j, bi, bj, dir)],
+                                              bsr_val[BSR_IND(j, bk, bj, dir)]);
+                        }
                     }
                 }
             }
@@ -3737,13 +7154,15 @@ inline void host_bsrilu02(hipsparseDirection_t    dir,
         // Reset entry points
         for(j = row_begin; j < row_end; ++j)
         {
-            int col_j          = bsr_col_ind[j] - base;
-            nnz_entries[col_j] = -1;
+            int col_j      = bsr_col_ind[j] - base;
+            entries[col_j] = -1;
         }
-    }
+    });
 
-    *struct_pivot  = (*struct_pivot == mb + 1) ? -1 : *struct_pivot;
-    *numeric_pivot = (*numeric_pivot == mb + 1) ? -1 : *numeric_pivot;
+    // The sequential factorization stops at the first structural pivot, numerical pivots
+    // of later rows are not reported
+    *struct_pivot  = (struct_row == mb) ? -1 : struct_row + base;
+    *numeric_pivot = (numeric_row < struct_row) ? numeric_row + base : -1;
 }
 
 template <typename T>
@@ -3768,10 +7187,16 @@ inline void host_bsric02(hipsparseDirection_t    direction,
         return;
     }
 
+    // First block rows with a structural and a numerical zero pivot
+    int struct_block  = Mb;
+    int numeric_block = Mb;
+
     // pointer of upper part of each row
     std::vector<int> diag_block_offset(Mb);
     std::vector<int> diag_offset(M, -1);
-    std::vector<int> nnz_entries(M, -1);
+
+    // Per thread entry points of the row that is processed
+    std::vector<std::vector<int>> nnz_entries(host_max_threads());
 
 #ifdef _OPENMP
 #pragma omp parallel for schedule(dynamic, 1024)
@@ -3791,8 +7216,48 @@ inline void host_bsric02(hipsparseDirection_t    direction,
         }
     }
 
-    for(int i = 0; i < M; i++)
+    // Level schedule of the rows. Row i depends on all rows of the BSR blocks left of the
+    // diagonal block and on the rows above it in the diagonal block.
+    std::vector<int>         depth(M);
+    std::vector<int>         block_depth(Mb);
+    host_csr_level_info<int> info;
+
+    int nlevel = 0;
+
+    for(int i = 0; i < Mb; i++)
     {
+        int d = 0;
+
+        for(int j = bsr_row_ptr[i] - base; j < bsr_row_ptr[i + 1] - base; j++)
+        {
+            int block_col_j = bsr_col_ind[j] - base;
+
+            if(block_col_j < i)
+            {
+                d = std::max(d, block_depth[block_col_j] + 1);
+            }
+        }
+
+        for(int k = 0; k < block_dim; k++)
+        {
+            depth[block_dim * i + k] = d + k;
+        }
+
+        block_depth[i] = d + block_dim - 1;
+        nlevel         = std::max(nlevel, block_depth[i] + 1);
+    }
+
+    host_level_buckets(depth, nlevel, info);
+
+    // Rows of a level are processed concurrently
+    host_csr_level_apply(info, 1, [&](int i, int) {
+        std::vector<int>& entries = nnz_entries[host_thread_num()];
+
+        if(entries.empty())
+        {
+            entries.assign(M, -1);
+        }
+
         int local_row = i % block_dim;
 
         int row_begin = bsr_row_ptr[i / block_dim] - base;
@@ -3806,12 +7271,12 @@ inline void host_bsric02(hipsparseDirection_t    direction,
             {
                 if(direction == HIPSPARSE_DIRECTION_ROW)
                 {
-                    nnz_entries[block_dim * block_col_j + k]
+                    entries[block_dim * block_col_j + k]
                         = block_dim * block_dim * j + block_dim * local_row + k;
                 }
                 else
                 {
-                    nnz_entries[block_dim * block_col_j + k]
+                    entries[block_dim * block_col_j + k]
                         = block_dim * block_dim * j + block_dim * k + local_row;
                 }
             }
@@ -3871,12 +7336,10 @@ inline void host_bsric02(hipsparseDirection_t    direction,
                 if(inv_diag == make_DataType<T>(0))
                 {
                     // Numerical non-invertible block diagonal
-                    if(*numeric_pivot == -1)
-                    {
-                        *numeric_pivot = block_col_j + base;
-                    }
-
-                    *numeric_pivot = std::min(*numeric_pivot, block_col_j + base);
+#ifdef _OPENMP
+#pragma omp critical(host_bsric02_pivot)
+#endif
+                    numeric_block = std::min(numeric_block, block_col_j);
 
                     inv_diag = make_DataType<T>(1);
                 }
@@ -3890,7 +7353,7 @@ inline void host_bsric02(hipsparseDirection_t    direction,
 
                     for(int m = 0; m < block_dim; m++)
                     {
-                        int idx = nnz_entries[block_dim * block_col_l + m];
+                        int idx = entries[block_dim * block_col_l + m];
 
                         if(idx != -1 && block_dim * block_col_l + m < col_j)
                         {
@@ -3934,10 +7397,10 @@ inline void host_bsric02(hipsparseDirection_t    direction,
         if(!has_diag)
         {
             // Structural missing block diagonal
-            if(*struct_pivot == -1)
-            {
-                *struct_pivot = i / block_dim + base;
-            }
+#ifdef _OPENMP
+#pragma omp critical(host_bsric02_pivot)
+#endif
+            struct_block = std::min(struct_block, i / block_dim);
         }
 
         // Process diagonal entry
@@ -3949,12 +7412,10 @@ inline void host_bsric02(hipsparseDirection_t    direction,
             if(diag_entry == make_DataType<T>(0))
             {
                 // Numerical non-invertible block diagonal
-                if(*numeric_pivot == -1)
-                {
-                    *numeric_pivot = i / block_dim + base;
-                }
-
-                *numeric_pivot = std::min(*numeric_pivot, i / block_dim + base);
+#ifdef _OPENMP
+#pragma omp critical(host_bsric02_pivot)
+#endif
+                numeric_block = std::min(numeric_block, i / block_dim);
             }
 
             // Store diagonal offset
@@ -3969,15 +7430,18 @@ inline void host_bsric02(hipsparseDirection_t    direction,
             {
                 if(direction == HIPSPARSE_DIRECTION_ROW)
                 {
-                    nnz_entries[block_dim * block_col_j + k] = -1;
+                    entries[block_dim * block_col_j + k] = -1;
                 }
                 else
                 {
-                    nnz_entries[block_dim * block_col_j + k] = -1;
+                    entries[block_dim * block_col_j + k] = -1;
                 }
             }
         }
-    }
+    });
+
+    *struct_pivot  = (struct_block == Mb) ? -1 : struct_block + base;
+    *numeric_pivot = (numeric_block == Mb) ? -1 : numeric_block + base;
 }
 
 template <typename T>
@@ -3993,13 +7457,27 @@ void csric0(int                  M,
     struct_pivot  = -1;
     numeric_pivot = -1;
 
-    // pointer of upper part of each row
-    std::vector<int> diag_offset(M);
-    std::vector<int> nnz_entries(M, 0);
+    // First row that failed
+    int pivot_row = M;
+
+    // pointer of upper part of each row, -1 for rows that failed
+    std::vector<int> diag_offset(M, -1);
+
+    // per thread nnz entries of the row that is processed
+    std::vector<std::vector<int>> nnz_entries(host_max_threads());
+
+    // Rows of a level only depend on rows of previous levels
+    std::shared_ptr<const host_csr_level_info<int>> info = host_csr_level_schedule(
+        M, csr_row_ptr, csr_col_ind, HIPSPARSE_FILL_MODE_LOWER, idx_base);
+
+    host_csr_level_apply(*info, 1, [&](int ai, int) {
+        std::vector<int>& entries = nnz_entries[host_thread_num()];
+
+        if(entries.empty())
+        {
+            entries.assign(M, 0);
+        }
 
-    // ai = 0 to N loop over all rows
-    for(int ai = 0; ai < M; ++ai)
-    {
         // ai-th row entries
         int row_begin = csr_row_ptr[ai] - idx_base;
         int row_end   = csr_row_ptr[ai + 1] - idx_base;
@@ -4008,12 +7486,15 @@ void csric0(int                  M,
         // nnz position of ai-th row in val array
         for(j = row_begin; j < row_end; ++j)
         {
-            nnz_entries[csr_col_ind[j] - idx_base] = j;
+            entries[csr_col_ind[j] - idx_base] = j;
         }
 
         T sum = make_DataType<T>(0.0);
 
-        bool has_diag = false;
+        bool has_diag    = false;
+        bool failed      = false;
+        int  row_struct  = -1;
+        int  row_numeric = -1;
 
         // loop over ai-th row nnz entries
         for(j = row_begin; j < row_end; ++j)
@@ -4037,6 +7518,13 @@ void csric0(int                  M,
             int row_begin_j = csr_row_ptr[col_j] - idx_base;
             int row_diag_j  = diag_offset[col_j];
 
+            // A previous row failed already
+            if(row_diag_j == -1)
+            {
+                failed = true;
+                break;
+            }
+
             T local_sum = make_DataType<T>(0.0);
             T inv_diag  = csr_val[row_diag_j];
 
@@ -4044,8 +7532,8 @@ void csric0(int                  M,
             if(inv_diag == make_DataType<T>(0.0))
             {
                 // Numerical zero diagonal
-                numeric_pivot = col_j + idx_base;
-                return;
+                row_numeric = col_j + idx_base;
+                break;
             }
 
             inv_diag = testing_div(make_DataType<T>(1.0), inv_diag);
@@ -4055,41 +7543,252 @@ void csric0(int                  M,
             {
                 int col_k = csr_col_ind[k] - idx_base;
 
-                // if nnz at this position do linear combination
-                if(nnz_entries[col_k] != 0)
-                {
-                    int idx   = nnz_entries[col_k];
-                    local_sum = testing_fma(csr_val[k], testing_conj(csr_val[idx]), local_sum);
+                // if nnz at this position do linear combination
+                if(entries[col_k] != 0)
+                {
+                    int idx   = entries[col_k];
+                    local_sum = testing_fma(csr_val[k], testing_conj(csr_val[idx]), local_sum);
+                }
+            }
+
+            val_j = testing_mult((val_j - local_sum), inv_diag);
+            sum   = testing_fma(val_j, testing_conj(val_j), sum);
+
+            csr_val[j] = val_j;
+        }
+
+        if(!failed && row_numeric == -1 && !has_diag)
+        {
+            // Structural (and numerical) zero diagonal
+            row_struct  = ai + idx_base;
+            row_numeric = ai + idx_base;
+        }
+
+        if(row_numeric != -1)
+        {
+            // Report the pivots of the first row that failed, as the sequential algorithm does
+#ifdef _OPENMP
+#pragma omp critical(csric0_pivot)
+#endif
+            if(ai < pivot_row)
+            {
+                pivot_row     = ai;
+                struct_pivot  = row_struct;
+                numeric_pivot = row_numeric;
+            }
+        }
+        else if(!failed)
+        {
+            // Process diagonal entry
+            T diag_entry = make_DataType<T>(std::sqrt(testing_abs(csr_val[j] - sum)));
+            csr_val[j]   = diag_entry;
+
+            // Store diagonal offset
+            diag_offset[ai] = j;
+        }
+
+        // clear nnz entries
+        for(j = row_begin; j < row_end; ++j)
+        {
+            entries[csr_col_ind[j] - idx_base] = 0;
+        }
+    });
+}
+
+/*! \brief  Solve a single row of a lower triangular CSR matrix, where y(col) returns the already
+ *  solved entries. Products are accumulated in the same wavefront order as the device kernel.
+ */
+template <typename I, typename J, typename T, typename Y>
+inline T host_csr_lsolve_row(J                    row,
+                             T                    rhs,
+                             const I*             csr_row_ptr,
+                             const J*             csr_col_ind,
+                             const T*             csr_val,
+                             Y                    y,
+                             int                  wf_size,
+                             hipsparseDiagType_t  diag_type,
+                             hipsparseIndexBase_t base,
+                             J*                   struct_pivot,
+                             J*                   numeric_pivot)
+{
+    T temp[64];
+
+    temp[0] = rhs;
+    for(int k = 1; k < wf_size; ++k)
+    {
+        temp[k] = make_DataType<T>(0);
+    }
+
+    I diag      = -1;
+    I row_begin = csr_row_ptr[row] - base;
+    I row_end   = csr_row_ptr[row + 1] - base;
+
+    T diag_val = make_DataType<T>(0);
+
+    for(I l = row_begin; l < row_end; l += wf_size)
+    {
+        for(int k = 0; k < wf_size; ++k)
+        {
+            I j = l + k;
+
+            // Do not run out of bounds
+            if(j >= row_end)
+            {
+                break;
+            }
+
+            J local_col = csr_col_ind[j] - base;
+            T local_val = csr_val[j];
+
+            if(local_val == make_DataType<T>(0) && local_col == row
+               && diag_type == HIPSPARSE_DIAG_TYPE_NON_UNIT)
+            {
+                // Numerical zero pivot found, avoid division by 0
+                // and store index for later use.
+                host_csr_update_pivot(numeric_pivot, static_cast<J>(row + base));
+                local_val = make_DataType<T>(1);
+            }
+
+            // Ignore all entries that are above the diagonal
+            if(local_col > row)
+            {
+                break;
+            }
+
+            // Diagonal entry
+            if(local_col == row)
+            {
+                // If diagonal type is non unit, do division by diagonal entry
+                // This is not required for unit diagonal for obvious reasons
+                if(diag_type == HIPSPARSE_DIAG_TYPE_NON_UNIT)
+                {
+                    diag     = j;
+                    diag_val = testing_div(make_DataType<T>(1), local_val);
+                }
+
+                break;
+            }
+
+            // Lower triangular part
+            temp[k] = testing_fma(testing_neg(local_val), y(local_col), temp[k]);
+        }
+    }
+
+    for(int j = 1; j < wf_size; j <<= 1)
+    {
+        for(int k = 0; k < wf_size - j; ++k)
+        {
+            temp[k] = temp[k] + temp[k + j];
+        }
+    }
+
+    if(diag_type == HIPSPARSE_DIAG_TYPE_NON_UNIT)
+    {
+        if(diag == -1)
+        {
+            host_csr_update_pivot(struct_pivot, static_cast<J>(row + base));
+        }
+
+        return testing_mult(temp[0], diag_val);
+    }
+
+    return temp[0];
+}
+
+/*! \brief  Solve a single row of an upper triangular CSR matrix, where y(col) returns the already
+ *  solved entries. Products are accumulated in the same wavefront order as the device kernel.
+ */
+template <typename I, typename J, typename T, typename Y>
+inline T host_csr_usolve_row(J                    row,
+                             T                    rhs,
+                             const I*             csr_row_ptr,
+                             const J*             csr_col_ind,
+                             const T*             csr_val,
+                             Y                    y,
+                             int                  wf_size,
+                             hipsparseDiagType_t  diag_type,
+                             hipsparseIndexBase_t base,
+                             J*                   struct_pivot,
+                             J*                   numeric_pivot)
+{
+    T temp[64];
+
+    temp[0] = rhs;
+    for(int k = 1; k < wf_size; ++k)
+    {
+        temp[k] = make_DataType<T>(0);
+    }
+
+    I diag      = -1;
+    I row_begin = csr_row_ptr[row] - base;
+    I row_end   = csr_row_ptr[row + 1] - base;
+
+    T diag_val = make_DataType<T>(0);
+
+    for(I l = row_end - 1; l >= row_begin; l -= wf_size)
+    {
+        for(int k = 0; k < wf_size; ++k)
+        {
+            I j = l - k;
+
+            // Do not run out of bounds
+            if(j < row_begin)
+            {
+                break;
+            }
+
+            J local_col = csr_col_ind[j] - base;
+            T local_val = csr_val[j];
+
+            // Ignore all entries that are below the diagonal
+            if(local_col < row)
+            {
+                continue;
+            }
+
+            // Diagonal entry
+            if(local_col == row)
+            {
+                if(diag_type == HIPSPARSE_DIAG_TYPE_NON_UNIT)
+                {
+                    // Check for numerical zero
+                    if(local_val == make_DataType<T>(0))
+                    {
+                        host_csr_update_pivot(numeric_pivot, static_cast<J>(row + base));
+                        local_val = make_DataType<T>(1);
+                    }
+
+                    diag     = j;
+                    diag_val = testing_div(make_DataType<T>(1), local_val);
                 }
-            }
 
-            val_j = testing_mult((val_j - local_sum), inv_diag);
-            sum   = testing_fma(val_j, testing_conj(val_j), sum);
+                continue;
+            }
 
-            csr_val[j] = val_j;
+            // Upper triangular part
+            temp[k] = testing_fma(testing_neg(local_val), y(local_col), temp[k]);
         }
+    }
 
-        if(!has_diag)
+    for(int j = 1; j < wf_size; j <<= 1)
+    {
+        for(int k = 0; k < wf_size - j; ++k)
         {
-            // Structural (and numerical) zero diagonal
-            struct_pivot  = ai + idx_base;
-            numeric_pivot = ai + idx_base;
-            return;
+            temp[k] = temp[k] + temp[k + j];
         }
+    }
 
-        // Process diagonal entry
-        T diag_entry = make_DataType<T>(std::sqrt(testing_abs(csr_val[j] - sum)));
-        csr_val[j]   = diag_entry;
-
-        // Store diagonal offset
-        diag_offset[ai] = j;
-
-        // clear nnz entries
-        for(j = row_begin; j < row_end; ++j)
+    if(diag_type == HIPSPARSE_DIAG_TYPE_NON_UNIT)
+    {
+        if(diag == -1)
         {
-            nnz_entries[csr_col_ind[j] - idx_base] = 0;
+            host_csr_update_pivot(struct_pivot, static_cast<J>(row + base));
         }
+
+        return testing_mult(temp[0], diag_val);
     }
+
+    return temp[0];
 }
 
 /* ============================================================================================ */
@@ -4117,123 +7816,34 @@ static inline void host_lssolve(J                     M,
     hipGetDevice(&dev);
     hipGetDeviceProperties(&prop, dev);
 
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-    for(J i = 0; i < nrhs; ++i)
-    {
-        std::vector<T> temp(prop.warpSize);
-
-        // Process lower triangular part
-        for(J row = 0; row < M; ++row)
-        {
-            temp.assign(prop.warpSize, make_DataType<T>(0.0));
-
-            J idx_B
-                = (transB == HIPSPARSE_OPERATION_NON_TRANSPOSE && order_B == HIPSPARSE_ORDER_COL)
-                      ? i * ldb + row
-                      : row * ldb + i;
-
-            if(transB == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE)
-            {
-                temp[0] = testing_mult(alpha, testing_conj(B[idx_B]));
-            }
-            else
-            {
-                temp[0] = testing_mult(alpha, B[idx_B]);
-            }
-
-            I diag      = -1;
-            I row_begin = csr_row_ptr[row] - base;
-            I row_end   = csr_row_ptr[row + 1] - base;
-
-            T diag_val = make_DataType<T>(0.0);
-
-            for(I l = row_begin; l < row_end; l += prop.warpSize)
-            {
-                for(int k = 0; k < prop.warpSize; ++k)
-                {
-                    I j = l + k;
-
-                    // Do not run out of bounds
-                    if(j >= row_end)
-                    {
-                        break;
-                    }
-
-                    J local_col = csr_col_ind[j] - base;
-                    T local_val = csr_val[j];
-
-                    if(local_val == make_DataType<T>(0.0) && local_col == row
-                       && diag_type == HIPSPARSE_DIAG_TYPE_NON_UNIT)
-                    {
-                        // Numerical zero pivot found, avoid division by 0 and store
-                        // index for later use
-                        *numeric_pivot = std::min(*numeric_pivot, row + base);
-                        local_val      = make_DataType<T>(1.0);
-                    }
-
-                    // Ignore all entries that are above the diagonal
-                    if(local_col > row)
-                    {
-                        break;
-                    }
-
-                    // Diagonal entry
-                    if(local_col == row)
-                    {
-                        // If diagonal type is non unit, do division by diagonal entry
-                        // This is not required for unit diagonal for obvious reasons
-                        if(diag_type == HIPSPARSE_DIAG_TYPE_NON_UNIT)
-                        {
-                            diag     = j;
-                            diag_val = testing_div(make_DataType<T>(1.0), local_val);
-                        }
-
-                        break;
-                    }
-
-                    // Lower triangular part
-                    J idx     = (transB == HIPSPARSE_OPERATION_NON_TRANSPOSE
-                             && order_B == HIPSPARSE_ORDER_COL)
-                                    ? i * ldb + local_col
-                                    : local_col * ldb + i;
-                    T neg_val = testing_mult(make_DataType<T>(-1.0), local_val);
-
-                    if(transB == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE)
-                    {
-                        temp[k] = testing_fma(neg_val, testing_conj(B[idx]), temp[k]);
-                    }
-                    else
-                    {
-                        temp[k] = testing_fma(neg_val, B[idx], temp[k]);
-                    }
-                }
-            }
-
-            for(int j = 1; j < prop.warpSize; j <<= 1)
-            {
-                for(int k = 0; k < prop.warpSize - j; ++k)
-                {
-                    temp[k] = temp[k] + temp[k + j];
-                }
-            }
-
-            if(diag_type == HIPSPARSE_DIAG_TYPE_NON_UNIT)
-            {
-                if(diag == -1)
-                {
-                    *struct_pivot = std::min(*struct_pivot, row + base);
-                }
-
-                B[idx_B] = testing_mult(temp[0], diag_val);
-            }
-            else
-            {
-                B[idx_B] = temp[0];
-            }
-        }
-    }
+    std::shared_ptr<const host_csr_level_info<J>> info = host_csr_level_schedule(
+        M, csr_row_ptr.data(), csr_col_ind.data(), HIPSPARSE_FILL_MODE_LOWER, base);
+
+    bool col_major
+        = (transB == HIPSPARSE_OPERATION_NON_TRANSPOSE && order_B == HIPSPARSE_ORDER_COL);
+    bool conj = (transB == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE);
+    T*   b    = B.data();
+
+    // Process lower triangular part, level by level
+    host_csr_level_apply(*info, nrhs, [&](J row, J i) {
+        J idx_B = col_major ? i * ldb + row : row * ldb + i;
+
+        b[idx_B] = host_csr_lsolve_row(
+            row,
+            testing_mult(alpha, conj ? testing_conj(b[idx_B]) : b[idx_B]),
+            csr_row_ptr.data(),
+            csr_col_ind.data(),
+            csr_val.data(),
+            [&](J col) {
+                J idx = col_major ? i * ldb + col : col * ldb + i;
+                return conj ? testing_conj(b[idx]) : b[idx];
+            },
+            prop.warpSize,
+            diag_type,
+            base,
+            struct_pivot,
+            numeric_pivot);
+    });
 }
 
 template <typename I, typename J, typename T>
@@ -4259,120 +7869,34 @@ static inline void host_ussolve(J                     M,
     hipGetDevice(&dev);
     hipGetDeviceProperties(&prop, dev);
 
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-    for(J i = 0; i < nrhs; ++i)
-    {
-        std::vector<T> temp(prop.warpSize);
-
-        // Process upper triangular part
-        for(J row = M - 1; row >= 0; --row)
-        {
-            temp.assign(prop.warpSize, make_DataType<T>(0.0));
-
-            J idx_B
-                = (transB == HIPSPARSE_OPERATION_NON_TRANSPOSE && order_B == HIPSPARSE_ORDER_COL)
-                      ? i * ldb + row
-                      : row * ldb + i;
-
-            if(transB == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE)
-            {
-                temp[0] = testing_mult(alpha, testing_conj(B[idx_B]));
-            }
-            else
-            {
-                temp[0] = testing_mult(alpha, B[idx_B]);
-            }
-
-            I diag      = -1;
-            I row_begin = csr_row_ptr[row] - base;
-            I row_end   = csr_row_ptr[row + 1] - base;
-
-            T diag_val = make_DataType<T>(0.0);
-
-            for(I l = row_end - 1; l >= row_begin; l -= prop.warpSize)
-            {
-                for(int k = 0; k < prop.warpSize; ++k)
-                {
-                    I j = l - k;
-
-                    // Do not run out of bounds
-                    if(j < row_begin)
-                    {
-                        break;
-                    }
-
-                    J local_col = csr_col_ind[j] - base;
-                    T local_val = csr_val[j];
-
-                    // Ignore all entries that are below the diagonal
-                    if(local_col < row)
-                    {
-                        continue;
-                    }
-
-                    // Diagonal entry
-                    if(local_col == row)
-                    {
-                        if(diag_type == HIPSPARSE_DIAG_TYPE_NON_UNIT)
-                        {
-                            // Check for numerical zero
-                            if(local_val == make_DataType<T>(0.0))
-                            {
-                                *numeric_pivot = std::min(*numeric_pivot, row + base);
-                                local_val      = make_DataType<T>(1.0);
-                            }
-
-                            diag     = j;
-                            diag_val = testing_div(make_DataType<T>(1.0), local_val);
-                        }
-
-                        continue;
-                    }
-
-                    // Upper triangular part
-                    J idx = (transB == HIPSPARSE_OPERATION_NON_TRANSPOSE
-                             && order_B == HIPSPARSE_ORDER_COL)
-                                ? i * ldb + local_col
-                                : local_col * ldb + i;
-
-                    T neg_val = testing_mult(make_DataType<T>(-1.0), local_val);
-
-                    if(transB == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE)
-                    {
-                        temp[k] = testing_fma(neg_val, testing_conj(B[idx]), temp[k]);
-                    }
-                    else
-                    {
-                        temp[k] = testing_fma(neg_val, B[idx], temp[k]);
-                    }
-                }
-            }
-
-            for(int j = 1; j < prop.warpSize; j <<= 1)
-            {
-                for(int k = 0; k < prop.warpSize - j; ++k)
-                {
-                    temp[k] = temp[k] + temp[k + j];
-                }
-            }
-
-            if(diag_type == HIPSPARSE_DIAG_TYPE_NON_UNIT)
-            {
-                if(diag == -1)
-                {
-                    *struct_pivot = std::min(*struct_pivot, row + base);
-                }
-
-                B[idx_B] = testing_mult(temp[0], diag_val);
-            }
-            else
-            {
-                B[idx_B] = temp[0];
-            }
-        }
-    }
+    std::shared_ptr<const host_csr_level_info<J>> info = host_csr_level_schedule(
+        M, csr_row_ptr.data(), csr_col_ind.data(), HIPSPARSE_FILL_MODE_UPPER, base);
+
+    bool col_major
+        = (transB == HIPSPARSE_OPERATION_NON_TRANSPOSE && order_B == HIPSPARSE_ORDER_COL);
+    bool conj = (transB == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE);
+    T*   b    = B.data();
+
+    // Process upper triangular part, level by level
+    host_csr_level_apply(*info, nrhs, [&](J row, J i) {
+        J idx_B = col_major ? i * ldb + row : row * ldb + i;
+
+        b[idx_B] = host_csr_usolve_row(
+            row,
+            testing_mult(alpha, conj ? testing_conj(b[idx_B]) : b[idx_B]),
+            csr_row_ptr.data(),
+            csr_col_ind.data(),
+            csr_val.data(),
+            [&](J col) {
+                J idx = col_major ? i * ldb + col : col * ldb + i;
+                return conj ? testing_conj(b[idx]) : b[idx];
+            },
+            prop.warpSize,
+            diag_type,
+            base,
+            struct_pivot,
+            numeric_pivot);
+    });
 }
 
 template <typename T>
@@ -4532,91 +8056,24 @@ void host_csr_lsolve(J                    M,
     hipGetDevice(&dev);
     hipGetDeviceProperties(&prop, dev);
 
-    std::vector<T> temp(prop.warpSize);
-
-    // Process lower triangular part
-    for(J row = 0; row < M; ++row)
-    {
-        temp.assign(prop.warpSize, make_DataType<T>(0.0));
-        temp[0] = testing_mult(alpha, x[row]);
-
-        I diag      = -1;
-        I row_begin = csr_row_ptr[row] - base;
-        I row_end   = csr_row_ptr[row + 1] - base;
-
-        T diag_val = make_DataType<T>(0.0);
-
-        for(I l = row_begin; l < row_end; l += prop.warpSize)
-        {
-            for(int k = 0; k < prop.warpSize; ++k)
-            {
-                I j = l + k;
-
-                // Do not run out of bounds
-                if(j >= row_end)
-                {
-                    break;
-                }
-
-                J local_col = csr_col_ind[j] - base;
-                T local_val = csr_val[j];
-
-                if(local_val == make_DataType<T>(0.0) && local_col == row
-                   && diag_type == HIPSPARSE_DIAG_TYPE_NON_UNIT)
-                {
-                    // Numerical zero pivot found, avoid division by 0
-                    // and store index for later use.
-                    *numeric_pivot = std::min(*numeric_pivot, row + base);
-                    local_val      = make_DataType<T>(1);
-                }
-
-                // Ignore all entries that are above the diagonal
-                if(local_col > row)
-                {
-                    break;
-                }
-
-                // Diagonal entry
-                if(local_col == row)
-                {
-                    // If diagonal type is non unit, do division by diagonal entry
-                    // This is not required for unit diagonal for obvious reasons
-                    if(diag_type == HIPSPARSE_DIAG_TYPE_NON_UNIT)
-                    {
-                        diag     = j;
-                        diag_val = testing_div(make_DataType<T>(1), local_val);
-                    }
-
-                    break;
-                }
-
-                // Lower triangular part
-                temp[k] = testing_fma(-local_val, y[local_col], temp[k]);
-            }
-        }
-
-        for(int j = 1; j < prop.warpSize; j <<= 1)
-        {
-            for(int k = 0; k < prop.warpSize - j; ++k)
-            {
-                temp[k] = temp[k] + temp[k + j];
-            }
-        }
-
-        if(diag_type == HIPSPARSE_DIAG_TYPE_NON_UNIT)
-        {
-            if(diag == -1)
-            {
-                *struct_pivot = std::min(*struct_pivot, row + base);
-            }
-
-            y[row] = testing_mult(temp[0], diag_val);
-        }
-        else
-        {
-            y[row] = temp[0];
-        }
-    }
+    std::shared_ptr<const host_csr_level_info<J>> info = host_csr_level_schedule(
+        M, csr_row_ptr, csr_col_ind, HIPSPARSE_FILL_MODE_LOWER, base);
+
+    // Process lower triangular part, level by level
+    host_csr_level_apply(*info, static_cast<J>(1), [&](J row, J) {
+        y[row] = host_csr_lsolve_row(
+            row,
+            testing_mult(alpha, x[row]),
+            csr_row_ptr,
+            csr_col_ind,
+            csr_val,
+            [&](J col) { return y[col]; },
+            prop.warpSize,
+            diag_type,
+            base,
+            struct_pivot,
+            numeric_pivot);
+    });
 }
 
 template <typename I, typename J, typename T>
@@ -4628,98 +8085,35 @@ void host_csr_usolve(J                    M,
                      const T*             x,
                      T*                   y,
                      hipsparseDiagType_t  diag_type,
-                     hipsparseIndexBase_t base,
-                     J*                   struct_pivot,
-                     J*                   numeric_pivot)
-{
-    // Get device properties
-    int             dev;
-    hipDeviceProp_t prop;
-
-    hipGetDevice(&dev);
-    hipGetDeviceProperties(&prop, dev);
-
-    std::vector<T> temp(prop.warpSize);
-
-    // Process upper triangular part
-    for(J row = M - 1; row >= 0; --row)
-    {
-        temp.assign(prop.warpSize, make_DataType<T>(0));
-        temp[0] = testing_mult(alpha, x[row]);
-
-        I diag      = -1;
-        I row_begin = csr_row_ptr[row] - base;
-        I row_end   = csr_row_ptr[row + 1] - base;
-
-        T diag_val = make_DataType<T>(0);
-
-        for(I l = row_end - 1; l >= row_begin; l -= prop.warpSize)
-        {
-            for(int k = 0; k < prop.warpSize; ++k)
-            {
-                I j = l - k;
-
-                // Do not run out of bounds
-                if(j < row_begin)
-                {
-                    break;
-                }
-
-                J local_col = csr_col_ind[j] - base;
-                T local_val = csr_val[j];
-
-                // Ignore all entries that are below the diagonal
-                if(local_col < row)
-                {
-                    continue;
-                }
-
-                // Diagonal entry
-                if(local_col == row)
-                {
-                    if(diag_type == HIPSPARSE_DIAG_TYPE_NON_UNIT)
-                    {
-                        // Check for numerical zero
-                        if(local_val == make_DataType<T>(0))
-                        {
-                            *numeric_pivot = std::min(*numeric_pivot, row + base);
-                            local_val      = make_DataType<T>(1);
-                        }
-
-                        diag     = j;
-                        diag_val = testing_div(make_DataType<T>(1), local_val);
-                    }
-
-                    continue;
-                }
-
-                // Upper triangular part
-                temp[k] = testing_fma(-local_val, y[local_col], temp[k]);
-            }
-        }
-
-        for(int j = 1; j < prop.warpSize; j <<= 1)
-        {
-            for(int k = 0; k < prop.warpSize - j; ++k)
-            {
-                temp[k] = temp[k] + temp[k + j];
-            }
-        }
+                     hipsparseIndexBase_t base,
+                     J*                   struct_pivot,
+                     J*                   numeric_pivot)
+{
+    // Get device properties
+    int             dev;
+    hipDeviceProp_t prop;
 
-        if(diag_type == HIPSPARSE_DIAG_TYPE_NON_UNIT)
-        {
-            if(diag == -1)
-            {
-                *struct_pivot = std::min(*struct_pivot, row + base);
-            }
+    hipGetDevice(&dev);
+    hipGetDeviceProperties(&prop, dev);
 
-            y[row] = testing_mult(temp[0], diag_val);
-        }
-        else
-        {
-            y[row] = temp[0];
-        }
-    }
+    std::shared_ptr<const host_csr_level_info<J>> info = host_csr_level_schedule(
+        M, csr_row_ptr, csr_col_ind, HIPSPARSE_FILL_MODE_UPPER, base);
+
+    // Process upper triangular part, level by level
+    host_csr_level_apply(*info, static_cast<J>(1), [&](J row, J) {
+        y[row] = host_csr_usolve_row(
+            row,
+            testing_mult(alpha, x[row]),
+            csr_row_ptr,
+            csr_col_ind,
+            csr_val,
+            [&](J col) { return y[col]; },
+            prop.warpSize,
+            diag_type,
+            base,
+            struct_pivot,
+            numeric_pivot);
+    });
 }
 
 template <typename I, typename J, typename T>
@@ -4855,18 +8249,7 @@ void host_coosv(hipsparseOperation_t  trans,
 {
     std::vector<I> csr_row_ptr(M + 1);
 
-    //host_coo_to_csr(M, coo_row_ind, csr_row_ptr, base);
-    // coo2csr on host
-    for(I i = 0; i < nnz; ++i)
-    {
-        ++csr_row_ptr[coo_row_ind[i] + 1 - base];
-    }
-
-    csr_row_ptr[0] = base;
-    for(I i = 0; i < M; ++i)
-    {
-        csr_row_ptr[i + 1] += csr_row_ptr[i];
-    }
+    host_coo_to_csr(M, nnz, coo_row_ind.data(), csr_row_ptr.data(), base);
 
     host_csrsv(trans,
                M,
@@ -5341,18 +8724,7 @@ void host_coosm(I                     M,
 
     std::vector<I> csr_row_ptr(M + 1);
 
-    //host_coo_to_csr(M, coo_row_ind, csr_row_ptr, base);
-    // coo2csr on host
-    for(I i = 0; i < nnz; ++i)
-    {
-        ++csr_row_ptr[coo_row_ind[i] + 1 - base];
-    }
-
-    csr_row_ptr[0] = base;
-    for(I i = 0; i < M; ++i)
-    {
-        csr_row_ptr[i + 1] += csr_row_ptr[i];
-    }
+    host_coo_to_csr(M, nnz, coo_row_ind.data(), csr_row_ptr.data(), base);
 
     host_csrsm2(M,
                 nrhs,
@@ -5989,62 +9361,6 @@ int csr_usolve(hipsparseOperation_t trans,
     return -1;
 }
 
-/* ============================================================================================ */
-/*! \brief  Transpose sparse matrix using CSR storage format. */
-template <typename I, typename J, typename T>
-void transpose_csr(J                    m,
-                   J                    n,
-                   I                    nnz,
-                   const I*             csr_row_ptr_A,
-                   const J*             csr_col_ind_A,
-                   const T*             csr_val_A,
-                   I*                   csr_row_ptr_B,
-                   J*                   csr_col_ind_B,
-                   T*                   csr_val_B,
-                   hipsparseIndexBase_t idx_base_A,
-                   hipsparseIndexBase_t idx_base_B)
-{
-    memset(csr_row_ptr_B, 0, sizeof(I) * (n + 1));
-
-    // Determine nnz per column
-    for(I i = 0; i < nnz; ++i)
-    {
-        ++csr_row_ptr_B[csr_col_ind_A[i] + 1 - idx_base_A];
-    }
-
-    // Scan
-    for(J i = 0; i < n; ++i)
-    {
-        csr_row_ptr_B[i + 1] += csr_row_ptr_B[i];
-    }
-
-    // Fill row indices and values
-    for(J i = 0; i < m; ++i)
-    {
-        I row_begin = csr_row_ptr_A[i] - idx_base_A;
-        I row_end   = csr_row_ptr_A[i + 1] - idx_base_A;
-
-        for(I j = row_begin; j < row_end; ++j)
-        {
-            J col = csr_col_ind_A[j] - idx_base_A;
-            I idx = csr_row_ptr_B[col];
-
-            csr_col_ind_B[idx] = i + idx_base_B;
-            csr_val_B[idx]     = csr_val_A[j];
-
-            ++csr_row_ptr_B[col];
-        }
-    }
-
-    // Shift column pointer array
-    for(J i = n; i > 0; --i)
-    {
-        csr_row_ptr_B[i] = csr_row_ptr_B[i - 1] + idx_base_B;
-    }
-
-    csr_row_ptr_B[0] = idx_base_B;
-}
-
 /* ============================================================================================ */
 /*! \brief  Transpose sparse matrix using CSR storage format. */
 template <typename T>
@@ -6111,7 +9427,47 @@ void transpose_bsr(int                  mb,
 }
 
 /* ============================================================================================ */
-/*! \brief  Compute sparse matrix sparse matrix addition. */
+/*! \brief  Check whether two CSR matrices, possibly using different index bases, share the same
+ *  sparsity pattern.
+ */
+inline bool host_csr_same_pattern(int                  M,
+                                  const int*           csr_row_ptr_A,
+                                  const int*           csr_col_ind_A,
+                                  hipsparseIndexBase_t base_A,
+                                  const int*           csr_row_ptr_B,
+                                  const int*           csr_col_ind_B,
+                                  hipsparseIndexBase_t base_B)
+{
+    if(csr_row_ptr_A[M] - base_A != csr_row_ptr_B[M] - base_B)
+    {
+        return false;
+    }
+
+    int nnz  = csr_row_ptr_A[M] - base_A;
+    int diff = 0;
+
+#ifdef _OPENMP
+#pragma omp parallel for reduction(+ : diff)
+#endif
+    for(int i = 0; i < M; ++i)
+    {
+        diff += (csr_row_ptr_A[i] - base_A != csr_row_ptr_B[i] - base_B);
+    }
+
+#ifdef _OPENMP
+#pragma omp parallel for reduction(+ : diff)
+#endif
+    for(int j = 0; j < nnz; ++j)
+    {
+        diff += (csr_col_ind_A[j] - base_A != csr_col_ind_B[j] - base_B);
+    }
+
+    return diff == 0;
+}
+
+/*! \brief  Compute sparse matrix sparse matrix addition. Rows of A and B are merged, hence their
+ *  column indices have to be sorted.
+ */
 template <typename T>
 static int host_csrgeam_nnz(int                  M,
                             int                  N,
@@ -6126,201 +9482,491 @@ static int host_csrgeam_nnz(int                  M,
                             hipsparseIndexBase_t base_B,
                             hipsparseIndexBase_t base_C)
 {
+    // Index base
+    csr_row_ptr_C[0] = base_C;
+
+    // Same sparsity pattern, C inherits the pattern of A
+    if(host_csr_same_pattern(
+           M, csr_row_ptr_A, csr_col_ind_A, base_A, csr_row_ptr_B, csr_col_ind_B, base_B))
+    {
 #ifdef _OPENMP
-#pragma omp parallel
+#pragma omp parallel for
+#endif
+        for(int i = 0; i < M; ++i)
+        {
+            csr_row_ptr_C[i + 1] = csr_row_ptr_A[i + 1] - base_A + base_C;
+        }
+
+        return csr_row_ptr_C[M] - base_C;
+    }
+
+    // Count the merged columns of each row
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(int i = 0; i < M; ++i)
+    {
+        int j     = csr_row_ptr_A[i] - base_A;
+        int l     = csr_row_ptr_B[i] - base_B;
+        int end_A = csr_row_ptr_A[i + 1] - base_A;
+        int end_B = csr_row_ptr_B[i + 1] - base_B;
+        int nnz   = 0;
+
+        while(j < end_A && l < end_B)
+        {
+            int col_A = csr_col_ind_A[j] - base_A;
+            int col_B = csr_col_ind_B[l] - base_B;
+
+            j += (col_A <= col_B);
+            l += (col_B <= col_A);
+            ++nnz;
+        }
+
+        csr_row_ptr_C[i + 1] = nnz + (end_A - j) + (end_B - l);
+    }
+
+    // Scan to obtain row offsets
+    for(int i = 0; i < M; ++i)
+    {
+        csr_row_ptr_C[i + 1] += csr_row_ptr_C[i];
+    }
+
+    return csr_row_ptr_C[M] - base_C;
+}
+
+template <typename T>
+static void host_csrgeam(int                  M,
+                         int                  N,
+                         T                    alpha,
+                         const int*           csr_row_ptr_A,
+                         const int*           csr_col_ind_A,
+                         const T*             csr_val_A,
+                         T                    beta,
+                         const int*           csr_row_ptr_B,
+                         const int*           csr_col_ind_B,
+                         const T*             csr_val_B,
+                         const int*           csr_row_ptr_C,
+                         int*                 csr_col_ind_C,
+                         T*                   csr_val_C,
+                         hipsparseIndexBase_t base_A,
+                         hipsparseIndexBase_t base_B,
+                         hipsparseIndexBase_t base_C)
+{
+    // Same sparsity pattern, add the values entry by entry
+    if(host_csr_same_pattern(
+           M, csr_row_ptr_A, csr_col_ind_A, base_A, csr_row_ptr_B, csr_col_ind_B, base_B))
+    {
+        int nnz = csr_row_ptr_A[M] - base_A;
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for(int j = 0; j < nnz; ++j)
+        {
+            csr_col_ind_C[j] = csr_col_ind_A[j] - base_A + base_C;
+            csr_val_C[j]
+                = testing_mult(alpha, csr_val_A[j]) + testing_mult(beta, csr_val_B[j]);
+        }
+
+        return;
+    }
+
+    // Merge the rows of A and B
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
 #endif
+    for(int i = 0; i < M; ++i)
+    {
+        int j     = csr_row_ptr_A[i] - base_A;
+        int l     = csr_row_ptr_B[i] - base_B;
+        int end_A = csr_row_ptr_A[i + 1] - base_A;
+        int end_B = csr_row_ptr_B[i + 1] - base_B;
+        int idx   = csr_row_ptr_C[i] - base_C;
+
+        while(j < end_A || l < end_B)
+        {
+            int col_A = (j < end_A) ? csr_col_ind_A[j] - base_A : N;
+            int col_B = (l < end_B) ? csr_col_ind_B[l] - base_B : N;
+
+            if(col_A < col_B)
+            {
+                csr_col_ind_C[idx] = col_A + base_C;
+                csr_val_C[idx]     = testing_mult(alpha, csr_val_A[j++]);
+            }
+            else if(col_B < col_A)
+            {
+                csr_col_ind_C[idx] = col_B + base_C;
+                csr_val_C[idx]     = testing_mult(beta, csr_val_B[l++]);
+            }
+            else
+            {
+                csr_col_ind_C[idx] = col_A + base_C;
+                csr_val_C[idx]
+                    = testing_mult(alpha, csr_val_A[j++]) + testing_mult(beta, csr_val_B[l++]);
+            }
+
+            ++idx;
+        }
+    }
+}
+
+/* ============================================================================================ */
+/*! \brief  Open addressing hash table mapping the columns of a row of C to their position in the
+ *  row. Used as accumulator for rows of C that are short compared to the number of columns.
+ */
+template <typename J>
+struct host_csrgemm_hash
+{
+    std::vector<J> key;
+    std::vector<J> pos;
+    size_t         mask;
+
+    void reset(int64_t size)
+    {
+        size_t capacity = 16;
+
+        while(capacity < 2 * static_cast<size_t>(size))
+        {
+            capacity <<= 1;
+        }
+
+        key.assign(capacity, -1);
+        pos.resize(capacity);
+        mask = capacity - 1;
+    }
+
+    // Return the slot of col, inserting col if it is not present yet
+    size_t insert(J col, bool& inserted)
     {
-        std::vector<int> nnz(N, -1);
+        size_t slot = (static_cast<size_t>(col) * 103) & mask;
+
+        while(key[slot] != col)
+        {
+            if(key[slot] == -1)
+            {
+                key[slot] = col;
+                inserted  = true;
+
+                return slot;
+            }
+
+            slot = (slot + 1) & mask;
+        }
+
+        inserted = false;
+
+        return slot;
+    }
+};
+
+/*! \brief  Symbolic part of C = alpha * A * B + beta * D. work holds the prefix sum of an upper
+ *  bound of the products per row and is used to balance the rows across threads.
+ */
+template <typename I, typename J>
+struct host_csrgemm_info
+{
+    std::vector<int64_t> work;
+    std::vector<I>       row_ptr; // zero based
+    std::vector<J>       col_ind; // zero based, sorted within each row
+};
+
+/*! \brief  Rows of C with an upper bound of products above n / HOST_CSRGEMM_DENSE_RATIO use a
+ *  dense accumulator, all other rows use a hash table.
+ */
+#define HOST_CSRGEMM_DENSE_RATIO 8
+
+/*! \brief  Number of row ranges of balanced work for m rows of C, several per thread such that
+ *  ranges are dynamically scheduled.
+ */
+template <typename J>
+inline int host_csrgemm_nparts(J m)
+{
+    return static_cast<int>(
+        std::max(static_cast<int64_t>(1),
+                 std::min(static_cast<int64_t>(8) * host_max_threads(), static_cast<int64_t>(m))));
+}
+
+/*! \brief  Compute the sparsity pattern of C = alpha * A * B + beta * D. */
+template <typename I, typename J>
+inline void host_csrgemm_analysis(J                        m,
+                                  J                        n,
+                                  bool                     alpha,
+                                  const I*                 csr_row_ptr_A,
+                                  const J*                 csr_col_ind_A,
+                                  const I*                 csr_row_ptr_B,
+                                  const J*                 csr_col_ind_B,
+                                  bool                     beta,
+                                  const I*                 csr_row_ptr_D,
+                                  const J*                 csr_col_ind_D,
+                                  hipsparseIndexBase_t     idx_base_A,
+                                  hipsparseIndexBase_t     idx_base_B,
+                                  hipsparseIndexBase_t     idx_base_D,
+                                  host_csrgemm_info<I, J>& info)
+{
+    info.work.resize(m + 1);
+    info.row_ptr.resize(m + 1);
+
+    info.work[0]    = 0;
+    info.row_ptr[0] = 0;
 
+    // Upper bound of the products per row, plus one to account for the row itself
 #ifdef _OPENMP
-        int nthreads = omp_get_num_threads();
-        int tid      = omp_get_thread_num();
-#else
-        int nthreads = 1;
-        int tid      = 0;
+#pragma omp parallel for schedule(dynamic, 1024)
 #endif
+    for(J i = 0; i < m; ++i)
+    {
+        int64_t flops = 1;
+
+        if(alpha)
+        {
+            for(I j = csr_row_ptr_A[i] - idx_base_A; j < csr_row_ptr_A[i + 1] - idx_base_A; ++j)
+            {
+                J col_A = csr_col_ind_A[j] - idx_base_A;
+                flops += csr_row_ptr_B[col_A + 1] - csr_row_ptr_B[col_A];
+            }
+        }
+
+        if(beta)
+        {
+            flops += csr_row_ptr_D[i + 1] - csr_row_ptr_D[i];
+        }
+
+        info.work[i + 1] = flops;
+    }
+
+    for(J i = 0; i < m; ++i)
+    {
+        info.work[i + 1] += info.work[i];
+    }
 
-        int rows_per_thread = (M + nthreads - 1) / nthreads;
-        int chunk_begin     = rows_per_thread * tid;
-        int chunk_end       = std::min(chunk_begin + rows_per_thread, M);
+    int                         nparts = host_csrgemm_nparts(m);
+    std::vector<std::vector<J>> part_col(nparts);
 
-        // Index base
-        csr_row_ptr_C[0] = base_C;
+    // Each range of rows collects its sorted columns, the number of columns per row is stored in
+    // the row pointer array
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        std::vector<J>       mark;
+        host_csrgemm_hash<J> hash;
 
-        // Loop over rows
-        for(int i = chunk_begin; i < chunk_end; ++i)
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 1)
+#endif
+        for(int p = 0; p < nparts; ++p)
         {
-            // Initialize csr row pointer with previous row offset
-            csr_row_ptr_C[i + 1] = 0;
+            J row_begin = 0;
+            J row_end   = 0;
+
+            if(m > 0)
+            {
+                host_csr_partition_rows(m, info.work.data(), p, nparts, row_begin, row_end);
+            }
+
+            std::vector<J>& col = part_col[p];
+
+            for(J i = row_begin; i < row_end; ++i)
+            {
+                int64_t flops = info.work[i + 1] - info.work[i] - 1;
+                size_t  first = col.size();
+                bool    dense = flops * HOST_CSRGEMM_DENSE_RATIO > n;
+
+                if(dense && mark.empty())
+                {
+                    mark.assign(n, -1);
+                }
+                else if(!dense)
+                {
+                    hash.reset(flops);
+                }
+
+                auto insert = [&](J c) {
+                    bool inserted;
+
+                    if(dense)
+                    {
+                        inserted = (mark[c] != i);
+                        mark[c]  = i;
+                    }
+                    else
+                    {
+                        hash.insert(c, inserted);
+                    }
 
-            int row_begin_A = csr_row_ptr_A[i] - base_A;
-            int row_end_A   = csr_row_ptr_A[i + 1] - base_A;
+                    if(inserted)
+                    {
+                        col.push_back(c);
+                    }
+                };
 
-            // Loop over columns of A
-            for(int j = row_begin_A; j < row_end_A; ++j)
-            {
-                int col_A = csr_col_ind_A[j] - base_A;
+                if(alpha)
+                {
+                    I row_begin_A = csr_row_ptr_A[i] - idx_base_A;
+                    I row_end_A   = csr_row_ptr_A[i + 1] - idx_base_A;
 
-                nnz[col_A] = i;
-                ++csr_row_ptr_C[i + 1];
-            }
+                    for(I j = row_begin_A; j < row_end_A; ++j)
+                    {
+                        J col_A = csr_col_ind_A[j] - idx_base_A;
 
-            int row_begin_B = csr_row_ptr_B[i] - base_B;
-            int row_end_B   = csr_row_ptr_B[i + 1] - base_B;
+                        I row_begin_B = csr_row_ptr_B[col_A] - idx_base_B;
+                        I row_end_B   = csr_row_ptr_B[col_A + 1] - idx_base_B;
 
-            // Loop over columns of B
-            for(int j = row_begin_B; j < row_end_B; ++j)
-            {
-                int col_B = csr_col_ind_B[j] - base_B;
+                        for(I l = row_begin_B; l < row_end_B; ++l)
+                        {
+                            insert(csr_col_ind_B[l] - idx_base_B);
+                        }
+                    }
+                }
 
-                // Check if a new nnz is generated
-                if(nnz[col_B] != i)
+                if(beta)
                 {
-                    nnz[col_B] = i;
-                    ++csr_row_ptr_C[i + 1];
+                    I row_begin_D = csr_row_ptr_D[i] - idx_base_D;
+                    I row_end_D   = csr_row_ptr_D[i + 1] - idx_base_D;
+
+                    for(I j = row_begin_D; j < row_end_D; ++j)
+                    {
+                        insert(csr_col_ind_D[j] - idx_base_D);
+                    }
                 }
+
+                std::sort(col.begin() + first, col.end());
+
+                info.row_ptr[i + 1] = static_cast<I>(col.size() - first);
             }
         }
     }
 
     // Scan to obtain row offsets
-    for(int i = 0; i < M; ++i)
+    for(J i = 0; i < m; ++i)
     {
-        csr_row_ptr_C[i + 1] += csr_row_ptr_C[i];
+        info.row_ptr[i + 1] += info.row_ptr[i];
     }
 
-    return csr_row_ptr_C[M] - base_C;
-}
+    info.col_ind.resize(info.row_ptr[m]);
 
-template <typename T>
-static void host_csrgeam(int                  M,
-                         int                  N,
-                         T                    alpha,
-                         const int*           csr_row_ptr_A,
-                         const int*           csr_col_ind_A,
-                         const T*             csr_val_A,
-                         T                    beta,
-                         const int*           csr_row_ptr_B,
-                         const int*           csr_col_ind_B,
-                         const T*             csr_val_B,
-                         const int*           csr_row_ptr_C,
-                         int*                 csr_col_ind_C,
-                         T*                   csr_val_C,
-                         hipsparseIndexBase_t base_A,
-                         hipsparseIndexBase_t base_B,
-                         hipsparseIndexBase_t base_C)
-{
 #ifdef _OPENMP
-#pragma omp parallel
+#pragma omp parallel for schedule(dynamic, 1)
 #endif
+    for(int p = 0; p < nparts; ++p)
     {
-        std::vector<int> nnz(N, -1);
+        J row_begin = 0;
+        J row_end   = 0;
 
-#ifdef _OPENMP
-        int nthreads = omp_get_num_threads();
-        int tid      = omp_get_thread_num();
-#else
-        int nthreads = 1;
-        int tid      = 0;
-#endif
-
-        int rows_per_thread = (M + nthreads - 1) / nthreads;
-        int chunk_begin     = rows_per_thread * tid;
-        int chunk_end       = std::min(chunk_begin + rows_per_thread, M);
-
-        // Loop over rows
-        for(int i = chunk_begin; i < chunk_end; ++i)
+        if(m > 0)
         {
-            int row_begin_C = csr_row_ptr_C[i] - base_C;
-            int row_end_C   = row_begin_C;
-
-            int row_begin_A = csr_row_ptr_A[i] - base_A;
-            int row_end_A   = csr_row_ptr_A[i + 1] - base_A;
-
-            // Copy A into C
-            for(int j = row_begin_A; j < row_end_A; ++j)
-            {
-                // Current column of A
-                int col_A = csr_col_ind_A[j] - base_A;
+            host_csr_partition_rows(m, info.work.data(), p, nparts, row_begin, row_end);
+        }
 
-                // Current value of A
-                T val_A = testing_mult(alpha, csr_val_A[j]);
+        std::copy(part_col[p].begin(),
+                  part_col[p].end(),
+                  info.col_ind.begin() + info.row_ptr[row_begin]);
+        std::vector<J>().swap(part_col[p]);
+    }
+}
 
-                nnz[col_A] = row_end_C;
+/*! \brief  Return the sparsity pattern of C = alpha * A * B + beta * D. Patterns are cached per
+ *  sparsity pattern of A, B and D, such that the numeric product following host_csrgemm2_nnz, as
+ *  well as repeated numeric products with new values, skip the symbolic pass.
+ */
+template <typename I, typename J>
+inline std::shared_ptr<const host_csrgemm_info<I, J>>
+    host_csrgemm_symbolic(J                    m,
+                          J                    n,
+                          J                    k,
+                          bool                 alpha,
+                          const I*             csr_row_ptr_A,
+                          const J*             csr_col_ind_A,
+                          const I*             csr_row_ptr_B,
+                          const J*             csr_col_ind_B,
+                          bool                 beta,
+                          const I*             csr_row_ptr_D,
+                          const J*             csr_col_ind_D,
+                          hipsparseIndexBase_t idx_base_A,
+                          hipsparseIndexBase_t idx_base_B,
+                          hipsparseIndexBase_t idx_base_D)
+{
+    typedef std::shared_ptr<const host_csrgemm_info<I, J>> info_ptr;
 
-                csr_col_ind_C[row_end_C] = col_A + base_C;
-                csr_val_C[row_end_C]     = val_A;
-                ++row_end_C;
-            }
+    struct cache_entry
+    {
+        uint64_t key[9];
+        info_ptr info;
+    };
 
-            int row_begin_B = csr_row_ptr_B[i] - base_B;
-            int row_end_B   = csr_row_ptr_B[i + 1] - base_B;
+    static const size_t           capacity = 4;
+    static std::mutex             mutex;
+    static std::list<cache_entry> cache; // most recently used first
 
-            // Loop over columns of B
-            for(int j = row_begin_B; j < row_end_B; ++j)
-            {
-                // Current column of B
-                int col_B = csr_col_ind_B[j] - base_B;
+    cache_entry entry;
+    std::fill(entry.key, entry.key + 9, 0);
 
-                // Current value of B
-                T val_B = testing_mult(beta, csr_val_B[j]);
+    entry.key[0] = static_cast<uint64_t>(m);
+    entry.key[1] = static_cast<uint64_t>(n);
+    entry.key[2] = static_cast<uint64_t>(alpha) | static_cast<uint64_t>(beta) << 1
+                   | static_cast<uint64_t>(idx_base_A) << 2
+                   | static_cast<uint64_t>(idx_base_B) << 3
+                   | static_cast<uint64_t>(idx_base_D) << 4;
 
-                // Check if a new nnz is generated or if the value is added
-                if(nnz[col_B] < row_begin_C)
-                {
-                    nnz[col_B] = row_end_C;
+    if(alpha)
+    {
+        int64_t nnz_A = csr_row_ptr_A[m] - idx_base_A;
+        int64_t nnz_B = csr_row_ptr_B[k] - idx_base_B;
 
-                    csr_col_ind_C[row_end_C] = col_B + base_C;
-                    csr_val_C[row_end_C]     = val_B;
-                    ++row_end_C;
-                }
-                else
-                {
-                    csr_val_C[nnz[col_B]] = csr_val_C[nnz[col_B]] + val_B;
-                }
-            }
-        }
+        entry.key[3] = hipsparse_bin_checksum(csr_row_ptr_A, sizeof(I) * (m + 1), 0);
+        entry.key[4] = hipsparse_bin_checksum(csr_col_ind_A, sizeof(J) * nnz_A, 0);
+        entry.key[5] = hipsparse_bin_checksum(csr_row_ptr_B, sizeof(I) * (k + 1), 0);
+        entry.key[6] = hipsparse_bin_checksum(csr_col_ind_B, sizeof(J) * nnz_B, 0);
     }
 
-    int nnz = csr_row_ptr_C[M] - base_C;
-
-    std::vector<int> col(nnz);
-    std::vector<T>   val(nnz);
-
-    for(int i = 0; i < nnz; ++i)
+    if(beta)
     {
-        col[i] = csr_col_ind_C[i];
-        val[i] = csr_val_C[i];
+        int64_t nnz_D = csr_row_ptr_D[m] - idx_base_D;
+
+        entry.key[7] = hipsparse_bin_checksum(csr_row_ptr_D, sizeof(I) * (m + 1), 0);
+        entry.key[8] = hipsparse_bin_checksum(csr_col_ind_D, sizeof(J) * nnz_D, 0);
     }
 
-#ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
-#endif
-    for(int i = 0; i < M; ++i)
     {
-        int row_begin = csr_row_ptr_C[i] - base_C;
-        int row_end   = csr_row_ptr_C[i + 1] - base_C;
-        int row_nnz   = row_end - row_begin;
+        std::lock_guard<std::mutex> lock(mutex);
 
-        std::vector<int> perm(row_nnz);
-        for(int j = 0; j < row_nnz; ++j)
+        for(typename std::list<cache_entry>::iterator it = cache.begin(); it != cache.end(); ++it)
         {
-            perm[j] = j;
+            if(std::equal(entry.key, entry.key + 9, it->key))
+            {
+                cache.splice(cache.begin(), cache, it);
+                return it->info;
+            }
         }
+    }
+
+    std::shared_ptr<host_csrgemm_info<I, J>> info = std::make_shared<host_csrgemm_info<I, J>>();
+    host_csrgemm_analysis(m,
+                          n,
+                          alpha,
+                          csr_row_ptr_A,
+                          csr_col_ind_A,
+                          csr_row_ptr_B,
+                          csr_col_ind_B,
+                          beta,
+                          csr_row_ptr_D,
+                          csr_col_ind_D,
+                          idx_base_A,
+                          idx_base_B,
+                          idx_base_D,
+                          *info);
+    entry.info = info;
 
-        int* col_entry = &col[row_begin];
-        T*   val_entry = &val[row_begin];
+    std::lock_guard<std::mutex> lock(mutex);
 
-        std::sort(perm.begin(), perm.end(), [&](const int& a, const int& b) {
-            return col_entry[a] <= col_entry[b];
-        });
+    cache.push_front(entry);
 
-        for(int j = 0; j < row_nnz; ++j)
-        {
-            csr_col_ind_C[row_begin + j] = col_entry[perm[j]];
-            csr_val_C[row_begin + j]     = val_entry[perm[j]];
-        }
+    if(cache.size() > capacity)
+    {
+        cache.pop_back();
     }
+
+    return entry.info;
 }
 
 /* ============================================================================================ */
@@ -6343,92 +9989,27 @@ static I host_csrgemm2_nnz(J                    m,
                            hipsparseIndexBase_t idx_base_C,
                            hipsparseIndexBase_t idx_base_D)
 {
-#ifdef _OPENMP
-#pragma omp parallel
-#endif
-    {
-        std::vector<J> nnz(n, -1);
-
-#ifdef _OPENMP
-        int nthreads = omp_get_num_threads();
-        int tid      = omp_get_thread_num();
-#else
-        int nthreads = 1;
-        int tid      = 0;
-#endif
-
-        J rows_per_thread = (m + nthreads - 1) / nthreads;
-        J chunk_begin     = rows_per_thread * tid;
-        J chunk_end       = std::min(chunk_begin + rows_per_thread, m);
-
-        // Index base
-        csr_row_ptr_C[0] = idx_base_C;
-
-        // Loop over rows of A
-        for(J i = chunk_begin; i < chunk_end; ++i)
-        {
-            // Initialize csr row pointer with previous row offset
-            csr_row_ptr_C[i + 1] = 0;
-
-            if(alpha)
-            {
-                I row_begin_A = csr_row_ptr_A[i] - idx_base_A;
-                I row_end_A   = csr_row_ptr_A[i + 1] - idx_base_A;
-
-                // Loop over columns of A
-                for(I j = row_begin_A; j < row_end_A; ++j)
-                {
-                    // Current column of A
-                    J col_A = csr_col_ind_A[j] - idx_base_A;
-
-                    I row_begin_B = csr_row_ptr_B[col_A] - idx_base_B;
-                    I row_end_B   = csr_row_ptr_B[col_A + 1] - idx_base_B;
-
-                    // Loop over columns of B in row col_A
-                    for(I irow = row_begin_B; irow < row_end_B; ++irow)
-                    {
-                        // Current column of B
-                        J col_B = csr_col_ind_B[irow] - idx_base_B;
-
-                        // Check if a new nnz is generated
-                        if(nnz[col_B] != i)
-                        {
-                            nnz[col_B] = i;
-                            ++csr_row_ptr_C[i + 1];
-                        }
-                    }
-                }
-            }
-
-            // Add nnz of D if beta != 0
-            if(beta)
-            {
-                I row_begin_D = csr_row_ptr_D[i] - idx_base_D;
-                I row_end_D   = csr_row_ptr_D[i + 1] - idx_base_D;
-
-                // Loop over columns of D
-                for(I j = row_begin_D; j < row_end_D; ++j)
-                {
-                    J col_D = csr_col_ind_D[j] - idx_base_D;
-
-                    // Check if a new nnz is generated
-                    if(nnz[col_D] != i)
-                    {
-                        nnz[col_D] = i;
-                        ++csr_row_ptr_C[i + 1];
-                    }
-                }
-            }
-        }
-    }
-
-    // Scan to obtain row offsets
-    for(J i = 0; i < m; ++i)
-    {
-        csr_row_ptr_C[i + 1] += csr_row_ptr_C[i];
-    }
-
-    return csr_row_ptr_C[m] - idx_base_C;
+    std::shared_ptr<const host_csrgemm_info<I, J>> info = host_csrgemm_symbolic(m,
+                                                                                n,
+                                                                                k,
+                                                                                alpha != nullptr,
+                                                                                csr_row_ptr_A,
+                                                                                csr_col_ind_A,
+                                                                                csr_row_ptr_B,
+                                                                                csr_col_ind_B,
+                                                                                beta != nullptr,
+                                                                                csr_row_ptr_D,
+                                                                                csr_col_ind_D,
+                                                                                idx_base_A,
+                                                                                idx_base_B,
+                                                                                idx_base_D);
+
+    for(J i = 0; i < m + 1; ++i)
+    {
+        csr_row_ptr_C[i] = info->row_ptr[i] + idx_base_C;
+    }
+
+    return info->row_ptr[m];
 }
 
 template <typename I, typename J, typename T>
@@ -6454,137 +10035,137 @@ static void host_csrgemm2(J                    m,
                           hipsparseIndexBase_t idx_base_C,
                           hipsparseIndexBase_t idx_base_D)
 {
+    std::shared_ptr<const host_csrgemm_info<I, J>> info = host_csrgemm_symbolic(m,
+                                                                                n,
+                                                                                k,
+                                                                                alpha != nullptr,
+                                                                                csr_row_ptr_A,
+                                                                                csr_col_ind_A,
+                                                                                csr_row_ptr_B,
+                                                                                csr_col_ind_B,
+                                                                                beta != nullptr,
+                                                                                csr_row_ptr_D,
+                                                                                csr_col_ind_D,
+                                                                                idx_base_A,
+                                                                                idx_base_B,
+                                                                                idx_base_D);
+
+    int nparts = host_csrgemm_nparts(m);
+
 #ifdef _OPENMP
 #pragma omp parallel
 #endif
     {
-        std::vector<I> nnz(n, -1);
+        std::vector<J>       slot;
+        std::vector<char>    seen;
+        host_csrgemm_hash<J> hash;
 
 #ifdef _OPENMP
-        int nthreads = omp_get_num_threads();
-        int tid      = omp_get_thread_num();
-#else
-        int nthreads = 1;
-        int tid      = 0;
+#pragma omp for schedule(dynamic, 1)
 #endif
-
-        J rows_per_thread = (m + nthreads - 1) / nthreads;
-        J chunk_begin     = rows_per_thread * tid;
-        J chunk_end       = std::min(chunk_begin + rows_per_thread, m);
-
-        // Loop over rows of A
-        for(J i = chunk_begin; i < chunk_end; ++i)
+        for(int p = 0; p < nparts; ++p)
         {
-            I row_begin_C = csr_row_ptr_C[i] - idx_base_C;
-            I row_end_C   = row_begin_C;
+            J row_begin = 0;
+            J row_end   = 0;
 
-            if(alpha)
+            if(m > 0)
             {
-                I row_begin_A = csr_row_ptr_A[i] - idx_base_A;
-                I row_end_A   = csr_row_ptr_A[i + 1] - idx_base_A;
-
-                // Loop over columns of A
-                for(I j = row_begin_A; j < row_end_A; ++j)
-                {
-                    // Current column of A
-                    J col_A = csr_col_ind_A[j] - idx_base_A;
-                    // Current value of A
-                    T val_A = testing_mult(*alpha, csr_val_A[j]);
+                host_csr_partition_rows(m, info->work.data(), p, nparts, row_begin, row_end);
+            }
 
-                    I row_begin_B = csr_row_ptr_B[col_A] - idx_base_B;
-                    I row_end_B   = csr_row_ptr_B[col_A + 1] - idx_base_B;
+            // Loop over rows of A
+            for(J i = row_begin; i < row_end; ++i)
+            {
+                const J* col_C       = info->col_ind.data() + info->row_ptr[i];
+                J        row_nnz     = info->row_ptr[i + 1] - info->row_ptr[i];
+                I        row_begin_C = csr_row_ptr_C[i] - idx_base_C;
+                T*       val_C       = csr_val_C + row_begin_C;
 
-                    // Loop over columns of B in row col_A
-                    for(I l = row_begin_B; l < row_end_B; ++l)
-                    {
-                        // Current column of B
-                        J col_B = csr_col_ind_B[l] - idx_base_B;
-                        // Current value of B
-                        T val_B = csr_val_B[l];
+                bool dense = static_cast<int64_t>(row_nnz) * HOST_CSRGEMM_DENSE_RATIO > n;
 
-                        // Check if a new nnz is generated or if the product is appended
-                        if(nnz[col_B] < row_begin_C)
-                        {
-                            nnz[col_B]               = row_end_C;
-                            csr_col_ind_C[row_end_C] = col_B + idx_base_C;
-                            csr_val_C[row_end_C]     = testing_mult(val_A, val_B);
-                            ++row_end_C;
-                        }
-                        else
-                        {
-                            csr_val_C[nnz[col_B]]
-                                = csr_val_C[nnz[col_B]] + testing_mult(val_A, val_B);
-                        }
-                    }
+                if(dense && slot.empty())
+                {
+                    slot.resize(n);
+                }
+                else if(!dense)
+                {
+                    hash.reset(row_nnz);
                 }
-            }
-
-            // Add nnz of D if beta != 0
-            if(beta)
-            {
-                I row_begin_D = csr_row_ptr_D[i] - idx_base_D;
-                I row_end_D   = csr_row_ptr_D[i + 1] - idx_base_D;
 
-                // Loop over columns of D
-                for(I j = row_begin_D; j < row_end_D; ++j)
+                // Position of each column within the row
+                for(J j = 0; j < row_nnz; ++j)
                 {
-                    // Current column of D
-                    J col_D = csr_col_ind_D[j] - idx_base_D;
-                    // Current value of D
-                    T val_D = testing_mult(*beta, csr_val_D[j]);
+                    csr_col_ind_C[row_begin_C + j] = col_C[j] + idx_base_C;
 
-                    // Check if a new nnz is generated or if the value is added
-                    if(nnz[col_D] < row_begin_C)
+                    if(dense)
                     {
-                        nnz[col_D] = row_end_C;
-
-                        csr_col_ind_C[row_end_C] = col_D + idx_base_C;
-                        csr_val_C[row_end_C]     = val_D;
-                        ++row_end_C;
+                        slot[col_C[j]] = j;
                     }
                     else
                     {
-                        csr_val_C[nnz[col_D]] = csr_val_C[nnz[col_D]] + val_D;
+                        bool inserted;
+                        hash.pos[hash.insert(col_C[j], inserted)] = j;
                     }
                 }
-            }
-        }
-    }
 
-    I nnz_C = csr_row_ptr_C[m] - idx_base_C;
+                seen.assign(row_nnz, 0);
 
-    std::vector<J> col(nnz_C);
-    std::vector<T> val(nnz_C);
+                // The first contribution to an entry is stored, all further contributions are
+                // added in the order they are generated
+                auto accumulate = [&](J c, T v) {
+                    bool inserted;
+                    J    j = dense ? slot[c] : hash.pos[hash.insert(c, inserted)];
 
-    memcpy(col.data(), csr_col_ind_C, sizeof(J) * nnz_C);
-    memcpy(val.data(), csr_val_C, sizeof(T) * nnz_C);
+                    if(seen[j])
+                    {
+                        val_C[j] = val_C[j] + v;
+                    }
+                    else
+                    {
+                        val_C[j] = v;
+                        seen[j]  = 1;
+                    }
+                };
 
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-    for(J i = 0; i < m; ++i)
-    {
-        I row_begin = csr_row_ptr_C[i] - idx_base_C;
-        I row_end   = csr_row_ptr_C[i + 1] - idx_base_C;
-        J row_nnz   = row_end - row_begin;
+                if(alpha)
+                {
+                    I row_begin_A = csr_row_ptr_A[i] - idx_base_A;
+                    I row_end_A   = csr_row_ptr_A[i + 1] - idx_base_A;
 
-        std::vector<J> perm(row_nnz);
-        for(J j = 0; j < row_nnz; ++j)
-        {
-            perm[j] = j;
-        }
+                    // Loop over columns of A
+                    for(I j = row_begin_A; j < row_end_A; ++j)
+                    {
+                        // Current column of A
+                        J col_A = csr_col_ind_A[j] - idx_base_A;
+                        // Current value of A
+                        T val_A = testing_mult(*alpha, csr_val_A[j]);
+
+                        I row_begin_B = csr_row_ptr_B[col_A] - idx_base_B;
+                        I row_end_B   = csr_row_ptr_B[col_A + 1] - idx_base_B;
 
-        J* col_entry = &col[row_begin];
-        T* val_entry = &val[row_begin];
+                        // Loop over columns of B in row col_A
+                        for(I l = row_begin_B; l < row_end_B; ++l)
+                        {
+                            accumulate(csr_col_ind_B[l] - idx_base_B,
+                                       testing_mult(val_A, csr_val_B[l]));
+                        }
+                    }
+                }
 
-        std::sort(perm.begin(), perm.end(), [&](const I& a, const I& b) {
-            return col_entry[a] <= col_entry[b];
-        });
+                // Add D if beta != 0
+                if(beta)
+                {
+                    I row_begin_D = csr_row_ptr_D[i] - idx_base_D;
+                    I row_end_D   = csr_row_ptr_D[i + 1] - idx_base_D;
 
-        for(J j = 0; j < row_nnz; ++j)
-        {
-            csr_col_ind_C[row_begin + j] = col_entry[perm[j]];
-            csr_val_C[row_begin + j]     = val_entry[perm[j]];
+                    // Loop over columns of D
+                    for(I j = row_begin_D; j < row_end_D; ++j)
+                    {
+                        accumulate(csr_col_ind_D[j] - idx_base_D,
+                                   testing_mult(*beta, csr_val_D[j]));
+                    }
+                }
+            }
         }
     }
 }
@@ -6618,6 +10199,19 @@ double get_time_us_sync(hipStream_t stream);
 }
 #endif
 
+/* ============================================================================================ */
+/*! \brief  Matrix used by a test if no file is given. */
+typedef enum hipsparse_matrix_init_
+{
+    hipsparse_matrix_random, /**< random matrix around the diagonal, see gen_matrix_coo */
+    hipsparse_matrix_laplace_2d, /**< 2D 5 point laplacian */
+    hipsparse_matrix_laplace_3d_7, /**< 3D 7 point laplacian */
+    hipsparse_matrix_laplace_3d_27, /**< 3D 27 point laplacian */
+    hipsparse_matrix_rmat, /**< R-MAT power law graph */
+    hipsparse_matrix_banded, /**< banded matrix */
+    hipsparse_matrix_block /**< 3D 7 point stencil of dense blocks */
+} hipsparse_matrix_init;
+
 /* ============================================================================================ */
 
 /*! \brief Class used to parse command arguments in both client & gtest   */
@@ -6681,6 +10275,10 @@ public:
     double boostval{};
     double boostvali{};
 
+    hipsparse_matrix_init matrix    = hipsparse_matrix_random;
+    int                   bandwidth = 2;
+    int                   degree    = 16;
+
     std::string filename = "";
 
     Arguments& operator=(const Arguments& rhs)
@@ -6738,12 +10336,149 @@ public:
         this->boostval     = rhs.boostval;
         this->boostvali    = rhs.boostvali;
 
+        this->matrix    = rhs.matrix;
+        this->bandwidth = rhs.bandwidth;
+        this->degree    = rhs.degree;
+
         this->filename = rhs.filename;
 
         return *this;
     }
 };
 
+/* ============================================================================================ */
+/*! \brief  Generate CSR matrix as selected by the arguments. The matrix is read from
+ *  argus.filename if given, otherwise it is generated as selected by argus.matrix. The grids of
+ *  the stencil matrices are sized to at most nrow rows. nrow and ncol are updated to the
+ *  dimensions of the generated matrix.
+ */
+template <typename I, typename J, typename T>
+bool generate_csr_matrix(const Arguments&     argus,
+                         J&                   nrow,
+                         J&                   ncol,
+                         I&                   nnz,
+                         std::vector<I>&      csr_row_ptr,
+                         std::vector<J>&      csr_col_ind,
+                         std::vector<T>&      csr_val,
+                         hipsparseIndexBase_t idx_base)
+{
+    if(argus.filename != "" || argus.matrix == hipsparse_matrix_random)
+    {
+        return generate_csr_matrix(
+            argus.filename, nrow, ncol, nnz, csr_row_ptr, csr_col_ind, csr_val, idx_base);
+    }
+
+    // Grid dimension of the stencil matrices
+    double rows = std::max(static_cast<double>(nrow), 0.0);
+    int    ndim = 0;
+
+    switch(argus.matrix)
+    {
+    case hipsparse_matrix_laplace_2d:
+        ndim = static_cast<int>(std::sqrt(rows) + 1e-6);
+        nrow = gen_2d_laplacian(ndim, csr_row_ptr, csr_col_ind, csr_val, idx_base);
+        ncol = nrow;
+        break;
+    case hipsparse_matrix_laplace_3d_7:
+    case hipsparse_matrix_laplace_3d_27:
+        ndim = static_cast<int>(std::cbrt(rows) + 1e-6);
+        nrow = gen_3d_laplacian(ndim,
+                                (argus.matrix == hipsparse_matrix_laplace_3d_7) ? 7 : 27,
+                                csr_row_ptr,
+                                csr_col_ind,
+                                csr_val,
+                                idx_base);
+        ncol = nrow;
+        break;
+    case hipsparse_matrix_block:
+        ndim = static_cast<int>(std::cbrt(rows / std::max(argus.block_dim, 1)) + 1e-6);
+        nrow = gen_3d_block_laplacian(
+            ndim, argus.block_dim, csr_row_ptr, csr_col_ind, csr_val, idx_base);
+        ncol = nrow;
+        break;
+    case hipsparse_matrix_rmat:
+    {
+        // Number of entries drawn, which has to fit into I
+        int64_t rmat_nnz = static_cast<int64_t>(nrow) * argus.degree;
+
+        if(rmat_nnz < 0 || rmat_nnz > static_cast<int64_t>(std::numeric_limits<I>::max()))
+        {
+            return false;
+        }
+
+        gen_rmat(
+            nrow, ncol, static_cast<I>(rmat_nnz), csr_row_ptr, csr_col_ind, csr_val, idx_base);
+        break;
+    }
+    case hipsparse_matrix_banded:
+        gen_banded(nrow,
+                   ncol,
+                   static_cast<J>(argus.bandwidth),
+                   csr_row_ptr,
+                   csr_col_ind,
+                   csr_val,
+                   idx_base);
+        break;
+    default:
+        return false;
+    }
+
+    if(nrow == 0)
+    {
+        csr_row_ptr.assign(1, idx_base);
+        csr_col_ind.clear();
+        csr_val.clear();
+    }
+
+    nnz = csr_row_ptr[nrow] - idx_base;
+
+    return true;
+}
+
+/*! \brief  Generate COO matrix as selected by the arguments, see generate_csr_matrix. */
+template <typename I, typename T>
+bool generate_coo_matrix(const Arguments&     argus,
+                         I&                   nrow,
+                         I&                   ncol,
+                         I&                   nnz,
+                         std::vector<I>&      coo_row_ind,
+                         std::vector<I>&      coo_col_ind,
+                         std::vector<T>&      coo_val,
+                         hipsparseIndexBase_t idx_base)
+{
+    if(argus.filename != "" || argus.matrix == hipsparse_matrix_random)
+    {
+        return generate_coo_matrix(
+            argus.filename, nrow, ncol, nnz, coo_row_ind, coo_col_ind, coo_val, idx_base);
+    }
+
+    std::vector<I> csr_row_ptr;
+
+    if(!generate_csr_matrix(
+           argus, nrow, ncol, nnz, csr_row_ptr, coo_col_ind, coo_val, idx_base))
+    {
+        return false;
+    }
+
+    coo_row_ind.resize(nnz);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(I i = 0; i < nrow; ++i)
+    {
+        I row_begin = csr_row_ptr[i] - idx_base;
+        I row_end   = csr_row_ptr[i + 1] - idx_base;
+
+        for(I j = row_begin; j < row_end; ++j)
+        {
+            coo_row_ind[j] = i + idx_base;
+        }
+    }
+
+    return true;
+}
+
 inline void missing_file_error_message(const char* filename)
 {
     std::cerr << "#" << std::endl;
@@ -0,0 +1,63 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_layer.hpp"
+#include "utility.hpp"
+
+#include <hipsparse.h>
+#include <vector>
+
+// The trace tests are run by the hipsparse-test-layer test, which sets up the environment
+TEST(layer_trace, layer_trace_float)
+{
+    if(!testing_layer_trace_enabled())
+    {
+        GTEST_SKIP();
+    }
+
+    Arguments arg;
+    arg.N        = 1000;
+    arg.nnz      = 100;
+    arg.idx_base = HIPSPARSE_INDEX_BASE_ZERO;
+    arg.timing   = 0;
+
+    hipsparseStatus_t status = testing_layer_trace<float>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST(layer_trace, layer_trace_double)
+{
+    if(!testing_layer_trace_enabled())
+    {
+        GTEST_SKIP();
+    }
+
+    Arguments arg;
+    arg.N        = 1000;
+    arg.nnz      = 100;
+    arg.idx_base = HIPSPARSE_INDEX_BASE_ONE;
+    arg.timing   = 0;
+
+    hipsparseStatus_t status = testing_layer_trace<double>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
@@ -0,0 +1,84 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_matrix_cache.hpp"
+#include "utility.hpp"
+
+#include <hipsparse.h>
+
+typedef std::tuple<int, int, hipsparseIndexBase_t> matrix_cache_tuple;
+
+int matrix_cache_M_range[] = {1, 100, 1000};
+int matrix_cache_N_range[] = {50, 1000};
+
+hipsparseIndexBase_t matrix_cache_idx_base_range[]
+    = {HIPSPARSE_INDEX_BASE_ZERO, HIPSPARSE_INDEX_BASE_ONE};
+
+class parameterized_matrix_cache : public testing::TestWithParam<matrix_cache_tuple>
+{
+protected:
+    parameterized_matrix_cache() {}
+    virtual ~parameterized_matrix_cache() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_matrix_cache_arguments(matrix_cache_tuple tup)
+{
+    Arguments arg;
+    arg.M        = std::get<0>(tup);
+    arg.N        = std::get<1>(tup);
+    arg.idx_base = std::get<2>(tup);
+    arg.timing   = 0;
+    return arg;
+}
+
+TEST_P(parameterized_matrix_cache, matrix_cache_i32_float)
+{
+    Arguments arg = setup_matrix_cache_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_matrix_cache<int32_t, int32_t, float>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_matrix_cache, matrix_cache_i64_double)
+{
+    Arguments arg = setup_matrix_cache_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_matrix_cache<int64_t, int64_t, double>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_matrix_cache, matrix_cache_i64_double_complex)
+{
+    Arguments arg = setup_matrix_cache_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_matrix_cache<int64_t, int64_t, hipDoubleComplex>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+INSTANTIATE_TEST_SUITE_P(matrix_cache,
+                         parameterized_matrix_cache,
+                         testing::Combine(testing::ValuesIn(matrix_cache_M_range),
+                                          testing::ValuesIn(matrix_cache_N_range),
+                                          testing::ValuesIn(matrix_cache_idx_base_range)));
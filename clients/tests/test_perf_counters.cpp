@@ -0,0 +1,80 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_perf_counters.hpp"
+#include "utility.hpp"
+
+#include <hipsparse.h>
+#include <vector>
+
+typedef std::tuple<int, hipsparseIndexBase_t> perf_counters_tuple;
+
+int perf_counters_nnz_range[] = {10, 100, 1000};
+
+hipsparseIndexBase_t perf_counters_idx_base_range[]
+    = {HIPSPARSE_INDEX_BASE_ZERO, HIPSPARSE_INDEX_BASE_ONE};
+
+class parameterized_perf_counters : public testing::TestWithParam<perf_counters_tuple>
+{
+protected:
+    parameterized_perf_counters() {}
+    virtual ~parameterized_perf_counters() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_perf_counters_arguments(perf_counters_tuple tup)
+{
+    Arguments arg;
+    arg.N        = 2000;
+    arg.nnz      = std::get<0>(tup);
+    arg.idx_base = std::get<1>(tup);
+    arg.timing   = 0;
+    return arg;
+}
+
+TEST(perf_counters_bad_arg, perf_counters)
+{
+    testing_perf_counters_bad_arg();
+}
+
+TEST_P(parameterized_perf_counters, perf_counters_float)
+{
+    Arguments arg = setup_perf_counters_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_perf_counters<float>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_perf_counters, perf_counters_double)
+{
+    Arguments arg = setup_perf_counters_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_perf_counters<double>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+INSTANTIATE_TEST_SUITE_P(perf_counters,
+                         parameterized_perf_counters,
+                         testing::Combine(testing::ValuesIn(perf_counters_nnz_range),
+                                          testing::ValuesIn(perf_counters_idx_base_range)));
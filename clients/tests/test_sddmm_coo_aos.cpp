@@ -52,9 +52,11 @@ int sddmm_coo_aos_K_range[] = {5};
 std::vector<double> sddmm_coo_aos_alpha_range = {2.0};
 std::vector<double> sddmm_coo_aos_beta_range  = {1.0};
 
-hipsparseOperation_t sddmm_coo_aos_transA_range[] = {HIPSPARSE_OPERATION_NON_TRANSPOSE};
-hipsparseOperation_t sddmm_coo_aos_transB_range[] = {HIPSPARSE_OPERATION_NON_TRANSPOSE};
-hipsparseOrder_t     sddmm_coo_aos_order_range[]  = {HIPSPARSE_ORDER_COL};
+hipsparseOperation_t sddmm_coo_aos_transA_range[]
+    = {HIPSPARSE_OPERATION_NON_TRANSPOSE, HIPSPARSE_OPERATION_TRANSPOSE};
+hipsparseOperation_t sddmm_coo_aos_transB_range[]
+    = {HIPSPARSE_OPERATION_NON_TRANSPOSE, HIPSPARSE_OPERATION_TRANSPOSE};
+hipsparseOrder_t     sddmm_coo_aos_order_range[]  = {HIPSPARSE_ORDER_COL, HIPSPARSE_ORDER_ROW};
 hipsparseIndexBase_t sddmm_coo_aos_idxbase_range[]
     = {HIPSPARSE_INDEX_BASE_ZERO, HIPSPARSE_INDEX_BASE_ONE};
 
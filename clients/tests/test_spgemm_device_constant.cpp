@@ -0,0 +1,99 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_spgemm_device_constant.hpp"
+#include "utility.hpp"
+
+#include <hipsparse.h>
+
+typedef std::tuple<int, int, double, hipsparseIndexBase_t> spgemm_device_constant_tuple;
+
+int spgemm_device_constant_M_range[] = {50, 647};
+int spgemm_device_constant_K_range[] = {50, 1149};
+
+double spgemm_device_constant_alpha_range[] = {2.0};
+
+hipsparseIndexBase_t spgemm_device_constant_idxbase_range[]
+    = {HIPSPARSE_INDEX_BASE_ZERO, HIPSPARSE_INDEX_BASE_ONE};
+
+class parameterized_spgemm_device_constant
+    : public testing::TestWithParam<spgemm_device_constant_tuple>
+{
+protected:
+    parameterized_spgemm_device_constant() {}
+    virtual ~parameterized_spgemm_device_constant() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_spgemm_device_constant_arguments(spgemm_device_constant_tuple tup)
+{
+    Arguments arg;
+    arg.M        = std::get<0>(tup);
+    arg.K        = std::get<1>(tup);
+    arg.alpha    = std::get<2>(tup);
+    arg.idx_base = std::get<3>(tup);
+    arg.timing   = 0;
+    return arg;
+}
+
+TEST_P(parameterized_spgemm_device_constant, spgemm_device_constant_i32_float)
+{
+    Arguments arg = setup_spgemm_device_constant_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_spgemm_device_constant<int32_t, int32_t, float>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_spgemm_device_constant, spgemm_device_constant_i32_float_complex)
+{
+    Arguments arg = setup_spgemm_device_constant_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_spgemm_device_constant<int32_t, int32_t, hipComplex>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_spgemm_device_constant, spgemm_device_constant_i64_double)
+{
+    Arguments arg = setup_spgemm_device_constant_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_spgemm_device_constant<int64_t, int64_t, double>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_spgemm_device_constant, spgemm_device_constant_i64_double_complex)
+{
+    Arguments arg = setup_spgemm_device_constant_arguments(GetParam());
+
+    hipsparseStatus_t status
+        = testing_spgemm_device_constant<int64_t, int64_t, hipDoubleComplex>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    spgemm_device_constant,
+    parameterized_spgemm_device_constant,
+    testing::Combine(testing::ValuesIn(spgemm_device_constant_M_range),
+                     testing::ValuesIn(spgemm_device_constant_K_range),
+                     testing::ValuesIn(spgemm_device_constant_alpha_range),
+                     testing::ValuesIn(spgemm_device_constant_idxbase_range)));
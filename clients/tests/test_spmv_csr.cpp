@@ -29,6 +29,7 @@ typedef std::tuple<int, int, double, double, hipsparseOperation_t, hipsparseInde
     spmv_csr_tuple;
 typedef std::tuple<double, double, hipsparseOperation_t, hipsparseIndexBase_t, std::string>
     spmv_csr_bin_tuple;
+typedef std::tuple<double, double, hipsparseIndexBase_t, hipsparse_matrix_init> spmv_csr_gen_tuple;
 
 int spmv_csr_M_range[] = {50};
 int spmv_csr_N_range[] = {84};
@@ -50,6 +51,13 @@ std::string spmv_csr_bin[] = {"nos1.bin",
                               "Chebyshev4.bin",
                               "shipsec1.bin"};
 
+hipsparse_matrix_init spmv_csr_gen[] = {hipsparse_matrix_laplace_2d,
+                                        hipsparse_matrix_laplace_3d_7,
+                                        hipsparse_matrix_laplace_3d_27,
+                                        hipsparse_matrix_rmat,
+                                        hipsparse_matrix_banded,
+                                        hipsparse_matrix_block};
+
 class parameterized_spmv_csr : public testing::TestWithParam<spmv_csr_tuple>
 {
 protected:
@@ -68,6 +76,15 @@ protected:
     virtual void TearDown() {}
 };
 
+class parameterized_spmv_csr_gen : public testing::TestWithParam<spmv_csr_gen_tuple>
+{
+protected:
+    parameterized_spmv_csr_gen() {}
+    virtual ~parameterized_spmv_csr_gen() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
 Arguments setup_spmv_csr_arguments(spmv_csr_tuple tup)
 {
     Arguments arg;
@@ -101,6 +118,21 @@ Arguments setup_spmv_csr_arguments(spmv_csr_bin_tuple tup)
     return arg;
 }
 
+Arguments setup_spmv_csr_arguments(spmv_csr_gen_tuple tup)
+{
+    Arguments arg;
+    arg.M         = 4000;
+    arg.N         = 4000;
+    arg.alpha     = std::get<0>(tup);
+    arg.beta      = std::get<1>(tup);
+    arg.transA    = HIPSPARSE_OPERATION_NON_TRANSPOSE;
+    arg.idx_base  = std::get<2>(tup);
+    arg.matrix    = std::get<3>(tup);
+    arg.block_dim = 3;
+    arg.timing    = 0;
+    return arg;
+}
+
 // csr format not supported in cusparse
 #if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11010)
 TEST(spmv_csr_bad_arg, spmv_csr_float)
@@ -156,6 +188,22 @@ TEST_P(parameterized_spmv_csr_bin, spmv_csr_bin_i64_double)
     EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
 }
 
+TEST_P(parameterized_spmv_csr_gen, spmv_csr_gen_i32_float)
+{
+    Arguments arg = setup_spmv_csr_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_spmv_csr<int32_t, int32_t, float>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_spmv_csr_gen, spmv_csr_gen_i64_double)
+{
+    Arguments arg = setup_spmv_csr_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_spmv_csr<int64_t, int64_t, double>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
 INSTANTIATE_TEST_SUITE_P(spmv_csr,
                          parameterized_spmv_csr,
                          testing::Combine(testing::ValuesIn(spmv_csr_M_range),
@@ -172,4 +220,11 @@ INSTANTIATE_TEST_SUITE_P(spmv_csr_bin,
                                           testing::ValuesIn(spmv_csr_transA_range),
                                           testing::ValuesIn(spmv_csr_idxbase_range),
                                           testing::ValuesIn(spmv_csr_bin)));
+
+INSTANTIATE_TEST_SUITE_P(spmv_csr_gen,
+                         parameterized_spmv_csr_gen,
+                         testing::Combine(testing::ValuesIn(spmv_csr_alpha_range),
+                                          testing::ValuesIn(spmv_csr_beta_range),
+                                          testing::ValuesIn(spmv_csr_idxbase_range),
+                                          testing::ValuesIn(spmv_csr_gen)));
 #endif
\ No newline at end of file
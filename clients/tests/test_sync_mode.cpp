@@ -0,0 +1,80 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_sync_mode.hpp"
+#include "utility.hpp"
+
+#include <hipsparse.h>
+#include <vector>
+
+typedef std::tuple<int, hipsparseIndexBase_t> sync_mode_tuple;
+
+int sync_mode_M_range[] = {10, 500, 2000};
+
+hipsparseIndexBase_t sync_mode_idx_base_range[]
+    = {HIPSPARSE_INDEX_BASE_ZERO, HIPSPARSE_INDEX_BASE_ONE};
+
+class parameterized_sync_mode : public testing::TestWithParam<sync_mode_tuple>
+{
+protected:
+    parameterized_sync_mode() {}
+    virtual ~parameterized_sync_mode() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_sync_mode_arguments(sync_mode_tuple tup)
+{
+    Arguments arg;
+    arg.M        = std::get<0>(tup);
+    arg.nnz      = arg.M / 2;
+    arg.idx_base = std::get<1>(tup);
+    arg.timing   = 0;
+    return arg;
+}
+
+TEST(sync_mode_bad_arg, sync_mode)
+{
+    testing_sync_mode_bad_arg();
+}
+
+TEST_P(parameterized_sync_mode, sync_mode_float)
+{
+    Arguments arg = setup_sync_mode_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_sync_mode<float>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_sync_mode, sync_mode_double_complex)
+{
+    Arguments arg = setup_sync_mode_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_sync_mode<hipDoubleComplex>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+INSTANTIATE_TEST_SUITE_P(sync_mode,
+                         parameterized_sync_mode,
+                         testing::Combine(testing::ValuesIn(sync_mode_M_range),
+                                          testing::ValuesIn(sync_mode_idx_base_range)));
@@ -0,0 +1,82 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_workspace.hpp"
+#include "utility.hpp"
+
+#include <hipsparse.h>
+#include <vector>
+
+typedef std::tuple<int, int, hipsparseIndexBase_t> workspace_tuple;
+
+int workspace_M_range[] = {0, 100, 1000};
+int workspace_N_range[] = {50, 1000};
+
+hipsparseIndexBase_t workspace_idx_base_range[]
+    = {HIPSPARSE_INDEX_BASE_ZERO, HIPSPARSE_INDEX_BASE_ONE};
+
+class parameterized_workspace : public testing::TestWithParam<workspace_tuple>
+{
+protected:
+    parameterized_workspace() {}
+    virtual ~parameterized_workspace() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_workspace_arguments(workspace_tuple tup)
+{
+    Arguments arg;
+    arg.M        = std::get<0>(tup);
+    arg.N        = std::get<1>(tup);
+    arg.idx_base = std::get<2>(tup);
+    arg.timing   = 0;
+    return arg;
+}
+
+TEST(workspace_bad_arg, workspace)
+{
+    testing_workspace_bad_arg();
+}
+
+TEST_P(parameterized_workspace, workspace_float)
+{
+    Arguments arg = setup_workspace_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_workspace<float>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_workspace, workspace_double_complex)
+{
+    Arguments arg = setup_workspace_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_workspace<hipDoubleComplex>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+INSTANTIATE_TEST_SUITE_P(workspace,
+                         parameterized_workspace,
+                         testing::Combine(testing::ValuesIn(workspace_M_range),
+                                          testing::ValuesIn(workspace_N_range),
+                                          testing::ValuesIn(workspace_idx_base_range)));
@@ -21,28 +21,135 @@
  *
  * ************************************************************************ */
 
+
 #include <algorithm>
+#include <chrono>
+#include <ctype.h>
+#include <inttypes.h>
 #include <math.h>
+#include <memory>
+#include <queue>
 #include <sstream>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <string>
 #include <vector>
 
-int read_mtx_matrix(const char*          filename,
-                    int&                 nrow,
-                    int&                 ncol,
-                    int&                 nnz,
-                    std::vector<int>&    row,
-                    std::vector<int>&    col,
-                    std::vector<double>& val)
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#ifdef _WIN32
+#define fseek64 _fseeki64
+#else
+#define fseek64 fseeko
+#endif
+
+// Binary matrix header, must match hipsparse_bin_header in clients/include/utility.hpp
+struct bin_header
 {
-    FILE* f = fopen(filename, "r");
-    if(!f)
+    char     magic[8];
+    uint32_t version;
+    uint32_t header_size;
+    uint8_t  ptr_width;
+    uint8_t  ind_width;
+    uint8_t  val_type;
+    uint8_t  val_width;
+    uint8_t  idx_base;
+    uint8_t  format;
+    uint8_t  reserved0[2];
+    int64_t  nrow;
+    int64_t  ncol;
+    int64_t  nnz;
+    uint64_t ptr_offset;
+    uint64_t ind_offset;
+    uint64_t val_offset;
+    uint64_t checksum;
+    int64_t  block_dim;
+    uint8_t  reserved1[40];
+};
+
+static_assert(sizeof(bin_header) == 128, "unexpected binary header size");
+
+// Storage format of the arrays behind the header, must match hipsparse_bin_format
+typedef enum bin_format_
+{
+    bin_format_csr = 0, // ptr: nrow + 1 row offsets, ind: column indices
+    bin_format_csc = 1, // ptr: ncol + 1 column offsets, ind: row indices
+    bin_format_coo = 2, // ptr: nnz row indices, ind: column indices
+    bin_format_bsr = 3 // as CSR over blocks, values of each block stored row major
+} bin_format;
+
+static const uint64_t bin_alignment = 64;
+
+static uint64_t align_offset(uint64_t offset)
+{
+    return (offset + bin_alignment - 1) / bin_alignment * bin_alignment;
+}
+
+// Must match hipsparse_bin_checksum in clients/include/utility.hpp
+static uint64_t checksum(const void* data, size_t bytes, uint64_t first_word)
+{
+    const unsigned char* ptr    = static_cast<const unsigned char*>(data);
+    uint64_t             nwords = bytes / 8;
+    uint64_t             sum    = 0;
+
+    for(uint64_t i = 0; i < nwords; ++i)
     {
-        return -1;
+        uint64_t w;
+        memcpy(&w, ptr + 8 * i, sizeof(uint64_t));
+        sum += (w ^ (w >> 29)) * (2 * (first_word + i) + 1);
     }
 
+    if(bytes % 8 != 0)
+    {
+        uint64_t w = 0;
+        memcpy(&w, ptr + 8 * nwords, bytes % 8);
+        sum += (w ^ (w >> 29)) * (2 * (first_word + nwords) + 1);
+    }
+
+    return sum;
+}
+
+static double elapsed(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+struct convert_options
+{
+    bin_format  format      = bin_format_csr;
+    int64_t     block_dim   = 2;
+    int         index_width = 0; // 0 selects 32 or 64 bits depending on the matrix
+    size_t      memory      = size_t(2048) << 20; // bytes for parsed entries in memory
+    bool        stats       = false;
+    std::string tmpdir;
+};
+
+/* ============================================================================================ */
+// Matrix Market parsing
+
+struct mtx_info
+{
+    int64_t nrow;
+    int64_t ncol;
+    int64_t nlines; // number of entries stated in the size line
+    bool    symm;
+    bool    pattern;
+};
+
+struct mtx_entry
+{
+    int64_t row;
+    int64_t col;
+    double  val;
+};
+
+// Read banner, comments and size line, leaves f at the first entry
+static int read_mtx_header(FILE* f, mtx_info& info)
+{
     char line[1024];
 
     // Check for banner
@@ -58,7 +165,7 @@ int read_mtx_matrix(const char*          filename,
     char type[16];
 
     // Extract banner
-    if(sscanf(line, "%s %s %s %s %s", banner, array, coord, data, type) != 5)
+    if(sscanf(line, "%15s %15s %15s %15s %15s", banner, array, coord, data, type) != 5)
     {
         return -1;
     }
@@ -103,8 +210,8 @@ int read_mtx_matrix(const char*          filename,
         return -1;
     }
 
-    // Symmetric flag
-    int symm = !strcmp(type, "symmetric");
+    info.symm    = !strcmp(type, "symmetric");
+    info.pattern = !strcmp(data, "pattern");
 
     // Skip comments
     while(fgets(line, 1024, f))
@@ -116,36 +223,77 @@ int read_mtx_matrix(const char*          filename,
     }
 
     // Read dimensions
-    int snnz;
+    if(sscanf(line, "%" SCNd64 " %" SCNd64 " %" SCNd64, &info.nrow, &info.ncol, &info.nlines)
+           != 3
+       || info.nrow < 0 || info.ncol < 0 || info.nlines < 0)
+    {
+        return -1;
+    }
 
-    sscanf(line, "%d %d %d", &nrow, &ncol, &snnz);
-    nnz = symm ? (snnz - nrow) * 2 + nrow : snnz;
+    return 0;
+}
 
-    std::vector<int>    unsorted_row(nnz);
-    std::vector<int>    unsorted_col(nnz);
-    std::vector<double> unsorted_val(nnz);
+// Parse the complete lines in [begin, end), expanding symmetric entries. The buffer must be
+// terminated behind end.
+static bool parse_mtx_entries(const char*             begin,
+                              const char*             end,
+                              const mtx_info&         info,
+                              std::vector<mtx_entry>& entries,
+                              int64_t&                nlines)
+{
+    const char* p = begin;
 
-    // Read entries
-    int idx = 0;
-    while(fgets(line, 1024, f))
+    while(p < end)
     {
-        if(idx >= nnz)
+        const char* eol = static_cast<const char*>(memchr(p, '\n', end - p));
+        if(eol == nullptr)
         {
-            return -1;
+            eol = end;
         }
 
-        int    irow;
-        int    icol;
-        double ival;
+        const char* q = p;
+        while(q < eol && isspace(static_cast<unsigned char>(*q)))
+        {
+            ++q;
+        }
 
-        if(!strcmp(data, "pattern"))
+        p = eol + 1;
+
+        // Skip blank lines and comments
+        if(q == eol || *q == '%')
         {
-            sscanf(line, "%d %d", &irow, &icol);
-            ival = 1.0;
+            continue;
         }
-        else
+
+        char* next;
+
+        int64_t irow = strtoll(q, &next, 10);
+        if(next == q || next > eol)
         {
-            sscanf(line, "%d %d %lg", &irow, &icol, &ival);
+            return false;
+        }
+        q = next;
+
+        int64_t icol = strtoll(q, &next, 10);
+        if(next == q || next > eol)
+        {
+            return false;
+        }
+        q = next;
+
+        double ival = 1.0;
+        if(!info.pattern)
+        {
+            ival = strtod(q, &next);
+            if(next == q || next > eol)
+            {
+                return false;
+            }
+        }
+
+        if(irow < 1 || irow > info.nrow || icol < 1 || icol > info.ncol)
+        {
+            return false;
         }
 
         --irow;
@@ -154,132 +302,913 @@ int read_mtx_matrix(const char*          filename,
         // Take absolute matrix value to avoid rounding issues when testing
         ival = std::abs(ival);
 
-        unsorted_row[idx] = irow;
-        unsorted_col[idx] = icol;
-        unsorted_val[idx] = ival;
+        entries.push_back({irow, icol, ival});
+
+        if(info.symm && irow != icol)
+        {
+            entries.push_back({icol, irow, ival});
+        }
+
+        ++nlines;
+    }
+
+    return true;
+}
 
-        ++idx;
+static const char* find_last_line_end(const char* data, size_t size)
+{
+    for(size_t i = size; i > 0; --i)
+    {
+        if(data[i - 1] == '\n')
+        {
+            return data + i - 1;
+        }
+    }
 
-        if(symm && irow != icol)
+    return nullptr;
+}
+
+/* ============================================================================================ */
+// Sorting and spilling of runs
+
+// Order of the entries as required by the output format
+struct entry_less
+{
+    bin_format format;
+    int64_t    block_dim;
+
+    bool operator()(const mtx_entry& a, const mtx_entry& b) const
+    {
+        if(this->format == bin_format_csc)
         {
-            if(idx >= nnz)
+            return a.col < b.col || (a.col == b.col && a.row < b.row);
+        }
+
+        if(this->format == bin_format_bsr)
+        {
+            int64_t abr = a.row / this->block_dim;
+            int64_t bbr = b.row / this->block_dim;
+            int64_t abc = a.col / this->block_dim;
+            int64_t bbc = b.col / this->block_dim;
+
+            if(abr != bbr)
             {
-                return -1;
+                return abr < bbr;
             }
 
-            unsorted_row[idx] = icol;
-            unsorted_col[idx] = irow;
-            unsorted_val[idx] = ival;
-            ++idx;
+            if(abc != bbc)
+            {
+                return abc < bbc;
+            }
         }
+
+        return a.row < b.row || (a.row == b.row && a.col < b.col);
     }
-    fclose(f);
+};
+
+// Stable parallel sort, slices are sorted independently and merged pairwise
+static void sort_entries(std::vector<mtx_entry>& entries, const entry_less& less)
+{
+    int64_t n      = entries.size();
+    int64_t nparts = 1;
+
+#ifdef _OPENMP
+    nparts = std::max<int64_t>(1, std::min<int64_t>(omp_get_max_threads(), n / 65536));
+#endif
+
+    std::vector<int64_t> bound(nparts + 1);
+    for(int64_t p = 0; p <= nparts; ++p)
+    {
+        bound[p] = n * p / nparts;
+    }
+
+    auto it = entries.begin();
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+    for(int64_t p = 0; p < nparts; ++p)
+    {
+        std::stable_sort(it + bound[p], it + bound[p + 1], less);
+    }
+
+    for(int64_t width = 1; width < nparts; width *= 2)
+    {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+        for(int64_t p = 0; p < nparts; p += 2 * width)
+        {
+            int64_t mid  = std::min(p + width, nparts);
+            int64_t last = std::min(p + 2 * width, nparts);
+
+            std::inplace_merge(it + bound[p], it + bound[mid], it + bound[last], less);
+        }
+    }
+}
 
-    row.resize(nnz);
-    col.resize(nnz);
-    val.resize(nnz);
+static int write_run(const std::string& filename, const std::vector<mtx_entry>& entries)
+{
+    FILE* f = fopen(filename.c_str(), "wb");
+    if(!f)
+    {
+        return -1;
+    }
+
+    bool ok = fwrite(entries.data(), sizeof(mtx_entry), entries.size(), f) == entries.size();
+
+    return (fclose(f) == 0 && ok) ? 0 : -1;
+}
+
+// Buffered reader of a sorted run on disk
+class run_reader
+{
+public:
+    run_reader(const std::string& filename, size_t capacity)
+        : f(fopen(filename.c_str(), "rb"))
+        , buffer(std::max<size_t>(capacity, 1))
+        , pos(0)
+        , size(0)
+    {
+    }
+
+    ~run_reader()
+    {
+        if(this->f)
+        {
+            fclose(this->f);
+        }
+    }
+
+    run_reader(const run_reader&) = delete;
+    run_reader& operator=(const run_reader&) = delete;
+
+    bool is_open() const
+    {
+        return this->f != nullptr;
+    }
+
+    bool next(mtx_entry& e)
+    {
+        if(this->pos == this->size)
+        {
+            this->size
+                = fread(this->buffer.data(), sizeof(mtx_entry), this->buffer.size(), this->f);
+            this->pos = 0;
+
+            if(this->size == 0)
+            {
+                return false;
+            }
+        }
+
+        e = this->buffer[this->pos++];
+        return true;
+    }
+
+private:
+    FILE*                  f;
+    std::vector<mtx_entry> buffer;
+    size_t                 pos;
+    size_t                 size;
+};
+
+// Sorted sequence of all entries, either an array in memory or the k-way merge of the runs
+class entry_source
+{
+public:
+    // Merges the runs if any, otherwise returns the sorted entries
+    entry_source(const std::vector<mtx_entry>&   entries,
+                 const std::vector<std::string>& runs,
+                 size_t                          memory,
+                 const entry_less&               less)
+        : entries(entries)
+        , pos(0)
+        , heap(heap_greater{less})
+    {
+        for(size_t r = 0; r < runs.size(); ++r)
+        {
+            this->readers.emplace_back(
+                new run_reader(runs[r], memory / sizeof(mtx_entry) / runs.size()));
+
+            mtx_entry e;
+            if(this->readers.back()->is_open() && this->readers.back()->next(e))
+            {
+                this->heap.push({e, r});
+            }
+        }
+    }
 
-    // Sort by row and column index
-    std::vector<int> perm(nnz);
-    for(int i = 0; i < nnz; ++i)
+    bool is_open() const
     {
-        perm[i] = i;
+        for(auto& r : this->readers)
+        {
+            if(!r->is_open())
+            {
+                return false;
+            }
+        }
+
+        return true;
     }
 
-    std::sort(perm.begin(), perm.end(), [&](const int& a, const int& b) {
-        if(unsorted_row[a] < unsorted_row[b])
+    bool next(mtx_entry& e)
+    {
+        if(this->readers.empty())
         {
+            if(this->pos == this->entries.size())
+            {
+                return false;
+            }
+
+            e = this->entries[this->pos++];
             return true;
         }
-        else if(unsorted_row[a] == unsorted_row[b])
+
+        if(this->heap.empty())
         {
-            return (unsorted_col[a] < unsorted_col[b]);
+            return false;
+        }
+
+        heap_item top = this->heap.top();
+        this->heap.pop();
+
+        e = top.e;
+
+        if(this->readers[top.run]->next(top.e))
+        {
+            this->heap.push(top);
+        }
+
+        return true;
+    }
+
+private:
+    struct heap_item
+    {
+        mtx_entry e;
+        size_t    run;
+    };
+
+    // Ties are taken from the earlier run first, such that the merge is stable
+    struct heap_greater
+    {
+        entry_less less;
+
+        bool operator()(const heap_item& a, const heap_item& b) const
+        {
+            return this->less(b.e, a.e) || (!this->less(a.e, b.e) && b.run < a.run);
+        }
+    };
+
+    const std::vector<mtx_entry>&                                        entries;
+    size_t                                                               pos;
+    std::vector<std::unique_ptr<run_reader>>                             readers;
+    std::priority_queue<heap_item, std::vector<heap_item>, heap_greater> heap;
+};
+
+/* ============================================================================================ */
+// Output
+
+// Buffered writer of one array at offset of a file, accumulating its checksum. The position
+// of the array behind base determines the checksum weights.
+class segment_writer
+{
+public:
+    segment_writer(FILE* f, uint64_t offset, uint64_t base = sizeof(bin_header))
+        : f(f)
+        , offset(offset)
+        , word((offset - base) / 8)
+        , sum(0)
+        , ok(true)
+    {
+        this->buffer.reserve(capacity + 8);
+    }
+
+    void write(const void* data, size_t bytes)
+    {
+        const char* src = static_cast<const char*>(data);
+        this->buffer.insert(this->buffer.end(), src, src + bytes);
+
+        if(this->buffer.size() >= capacity)
+        {
+            this->flush(false);
+        }
+    }
+
+    void write_index(int64_t v, int width)
+    {
+        if(width == 4)
+        {
+            int32_t v32 = static_cast<int32_t>(v);
+            this->write(&v32, 4);
         }
         else
         {
-            return false;
+            this->write(&v, 8);
         }
-    });
+    }
 
-    for(int i = 0; i < nnz; ++i)
+    // Writes the buffer, keeping a partial word unless this is the end of the array
+    void flush(bool last = true)
     {
-        row[i] = unsorted_row[perm[i]];
-        col[i] = unsorted_col[perm[i]];
-        val[i] = unsorted_val[perm[i]];
+        size_t bytes = last ? this->buffer.size() : this->buffer.size() / 8 * 8;
+
+        this->sum += checksum(this->buffer.data(), bytes, this->word);
+        this->ok = this->ok && fseek64(this->f, this->offset, SEEK_SET) == 0
+                   && fwrite(this->buffer.data(), 1, bytes, this->f) == bytes;
+
+        this->offset += bytes;
+        this->word += bytes / 8;
+        this->buffer.erase(this->buffer.begin(), this->buffer.begin() + bytes);
     }
 
-    return 0;
-}
+    uint64_t checksum_value() const
+    {
+        return this->sum;
+    }
 
-int write_bin_matrix(
-    const char* filename, int m, int n, int nnz, const int* ptr, const int* col, const double* val)
+    bool good() const
+    {
+        return this->ok;
+    }
+
+private:
+    static const size_t capacity = size_t(4) << 20;
+
+    FILE*             f;
+    uint64_t          offset;
+    uint64_t          word;
+    uint64_t          sum;
+    bool              ok;
+    std::vector<char> buffer;
+};
+
+// Copy a spooled array into the output file
+static bool copy_spool(const std::string& filename, segment_writer& dst)
 {
-    FILE* f = fopen(filename, "wb");
+    FILE* f = fopen(filename.c_str(), "rb");
     if(!f)
     {
-        return -1;
+        return false;
     }
 
-    int err;
-    err = fwrite(&m, sizeof(int), 1, f);
-    err |= fwrite(&n, sizeof(int), 1, f);
-    err |= fwrite(&nnz, sizeof(int), 1, f);
-    err |= fwrite(ptr, sizeof(int), m + 1, f);
-    err |= fwrite(col, sizeof(int), nnz, f);
-    err |= fwrite(val, sizeof(double), nnz, f);
+    std::vector<char> buffer(size_t(4) << 20);
+
+    size_t bytes;
+    while((bytes = fread(buffer.data(), 1, buffer.size(), f)) > 0)
+    {
+        dst.write(buffer.data(), bytes);
+    }
 
     fclose(f);
 
-    return 0;
+    return true;
 }
 
-int coo_to_csr(int m, int nnz, const int* src_row, std::vector<int>& dst_ptr)
+// Write the sorted entries in the requested format. The BSR arrays are spooled to temporary
+// files first, as the number of blocks is only known after the merge.
+static int write_bin_matrix(const char*            filename,
+                            const std::string&     tmp_prefix,
+                            const convert_options& opt,
+                            const mtx_info&        info,
+                            int64_t                nnz,
+                            entry_source&          src,
+                            uint64_t&              file_size)
 {
-    dst_ptr.resize(m + 1, 0);
+    bool    bsr       = opt.format == bin_format_bsr;
+    int64_t bdim      = bsr ? opt.block_dim : 1;
+    int64_t nrow      = bsr ? (info.nrow + bdim - 1) / bdim : info.nrow;
+    int64_t ncol      = bsr ? (info.ncol + bdim - 1) / bdim : info.ncol;
+    int64_t nptr      = (opt.format == bin_format_csc) ? ncol : nrow;
+    int64_t max_ptr   = (opt.format == bin_format_coo) ? nrow : nnz;
+    int64_t max_ind   = (opt.format == bin_format_csc) ? nrow : ncol;
+    int     ptr_width = opt.index_width;
+    int     ind_width = opt.index_width;
+
+    // Use 32-bit indices whenever possible
+    if(opt.index_width == 0)
+    {
+        ptr_width = (max_ptr <= INT32_MAX) ? 4 : 8;
+        ind_width = (max_ind <= INT32_MAX) ? 4 : 8;
+    }
+    else if(opt.index_width == 4 && (max_ptr > INT32_MAX || max_ind > INT32_MAX))
+    {
+        fprintf(stderr, "Matrix does not fit into 32-bit indices.\n");
+        return -1;
+    }
+
+    // Row or column offsets are accumulated during the merge
+    std::vector<int64_t> ptr(opt.format == bin_format_coo ? 0 : nptr + 1, 0);
+
+    FILE* f = fopen(filename, "wb");
+    if(!f)
+    {
+        return -1;
+    }
+
+    std::string ind_spool = tmp_prefix + ".ind.tmp";
+    std::string val_spool = tmp_prefix + ".val.tmp";
+
+    FILE* ind_file = bsr ? fopen(ind_spool.c_str(), "wb+") : f;
+    FILE* val_file = bsr ? fopen(val_spool.c_str(), "wb+") : f;
+
+    if(!ind_file || !val_file)
+    {
+        fclose(f);
+        return -1;
+    }
+
+    bin_header header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, "HSPCSRBN", 8);
+
+    header.version     = 1;
+    header.header_size = sizeof(header);
+    header.ptr_width   = ptr_width;
+    header.ind_width   = ind_width;
+    header.val_type    = 0;
+    header.val_width   = sizeof(double);
+    header.idx_base    = 0;
+    header.format      = opt.format;
+    header.nrow        = nrow;
+    header.ncol        = ncol;
+    header.block_dim   = bsr ? bdim : 0;
+    header.ptr_offset  = align_offset(sizeof(header));
+
+    uint64_t ptr_bytes = (opt.format == bin_format_coo ? nnz : nptr + 1) * ptr_width;
+
+    header.ind_offset = align_offset(header.ptr_offset + ptr_bytes);
+    header.val_offset = align_offset(header.ind_offset + nnz * ind_width);
 
-    // Compute nnz entries per row
-    for(int i = 0; i < nnz; ++i)
+    segment_writer ptr_out(f, header.ptr_offset);
+    segment_writer ind_out(ind_file, bsr ? 0 : header.ind_offset, bsr ? 0 : sizeof(header));
+    segment_writer val_out(val_file, bsr ? 0 : header.val_offset, bsr ? 0 : sizeof(header));
+
+    int64_t             nnzb      = 0;
+    int64_t             block_row = -1;
+    int64_t             block_col = -1;
+    std::vector<double> block(bdim * bdim);
+
+    auto flush_block = [&]() {
+        if(block_row >= 0)
+        {
+            ind_out.write_index(block_col, ind_width);
+            val_out.write(block.data(), sizeof(double) * block.size());
+            std::fill(block.begin(), block.end(), 0.0);
+        }
+    };
+
+    mtx_entry e;
+    while(src.next(e))
     {
-        ++dst_ptr[src_row[i] + 1];
+        if(bsr)
+        {
+            int64_t br = e.row / bdim;
+            int64_t bc = e.col / bdim;
+
+            // Entries arrive block by block, duplicates within a block are summed
+            if(br != block_row || bc != block_col)
+            {
+                flush_block();
+
+                block_row = br;
+                block_col = bc;
+
+                ++ptr[br + 1];
+                ++nnzb;
+            }
+
+            block[(e.row % bdim) * bdim + e.col % bdim] += e.val;
+        }
+        else if(opt.format == bin_format_csc)
+        {
+            ++ptr[e.col + 1];
+            ind_out.write_index(e.row, ind_width);
+            val_out.write(&e.val, sizeof(double));
+        }
+        else
+        {
+            if(opt.format == bin_format_coo)
+            {
+                ptr_out.write_index(e.row, ptr_width);
+            }
+            else
+            {
+                ++ptr[e.row + 1];
+            }
+
+            ind_out.write_index(e.col, ind_width);
+            val_out.write(&e.val, sizeof(double));
+        }
     }
 
+    flush_block();
+
     // Exclusive scan
-    for(int i = 0; i < m; ++i)
+    for(int64_t i = 0; i < static_cast<int64_t>(ptr.size()) - 1; ++i)
     {
-        dst_ptr[i + 1] += dst_ptr[i];
+        ptr[i + 1] += ptr[i];
     }
 
-    return 0;
+    for(size_t i = 0; i < ptr.size(); ++i)
+    {
+        ptr_out.write_index(ptr[i], ptr_width);
+    }
+
+    ptr_out.flush();
+    ind_out.flush();
+    val_out.flush();
+
+    bool ok = ptr_out.good() && ind_out.good() && val_out.good();
+
+    header.nnz = bsr ? nnzb : nnz;
+
+    uint64_t val_bytes = sizeof(double) * header.nnz * bdim * bdim;
+
+    if(bsr)
+    {
+        fclose(ind_file);
+        fclose(val_file);
+
+        header.val_offset = align_offset(header.ind_offset + nnzb * ind_width);
+
+        segment_writer ind_copy(f, header.ind_offset);
+        segment_writer val_copy(f, header.val_offset);
+
+        ok = ok && copy_spool(ind_spool, ind_copy) && copy_spool(val_spool, val_copy);
+
+        ind_copy.flush();
+        val_copy.flush();
+
+        ok = ok && ind_copy.good() && val_copy.good();
+
+        header.checksum
+            = ptr_out.checksum_value() + ind_copy.checksum_value() + val_copy.checksum_value();
+
+        remove(ind_spool.c_str());
+        remove(val_spool.c_str());
+    }
+    else
+    {
+        header.checksum
+            = ptr_out.checksum_value() + ind_out.checksum_value() + val_out.checksum_value();
+    }
+
+    // Header and zero padding up to the next aligned offset at the end of the file
+    static const char zeros[bin_alignment] = {};
+
+    uint64_t val_end = header.val_offset + val_bytes;
+
+    file_size = align_offset(val_end);
+
+    ok = ok && fseek64(f, 0, SEEK_SET) == 0 && fwrite(&header, sizeof(header), 1, f) == 1
+         && fseek64(f, val_end, SEEK_SET) == 0
+         && fwrite(zeros, 1, file_size - val_end, f) == file_size - val_end;
+
+    ok = (fclose(f) == 0) && ok;
+
+    return ok ? 0 : -1;
 }
 
-int main(int argc, char* argv[])
-{
-    int m;
-    int n;
-    int nnz;
+/* ============================================================================================ */
+// Conversion
 
-    std::vector<int>    ptr;
-    std::vector<int>    row;
-    std::vector<int>    col;
-    std::vector<double> val;
+// Parse the file in chunks, in parallel. Entries are collected up to the memory limit, then
+// sorted and spilled into a run on disk.
+static int convert(const char* input, const char* output, const convert_options& opt)
+{
+    auto start = std::chrono::steady_clock::now();
 
-    if(read_mtx_matrix(argv[1], m, n, nnz, row, col, val) != 0)
+    FILE* f = fopen(input, "rb");
+    if(!f)
     {
-        fprintf(stderr, "Cannot open [read] %s.\n", argv[1]);
+        fprintf(stderr, "Cannot open [read] %s.\n", input);
         return -1;
     }
 
-    if(coo_to_csr(m, nnz, row.data(), ptr) != 0)
+    mtx_info info;
+    if(read_mtx_header(f, info) != 0)
     {
-        fprintf(stderr, "Cannot convert %s from COO to CSR.\n", argv[1]);
+        fprintf(stderr, "Cannot parse Matrix Market header of %s.\n", input);
+        fclose(f);
         return -1;
     }
 
-    if(write_bin_matrix(argv[2], m, n, nnz, ptr.data(), col.data(), val.data()) != 0)
+    std::string tmp_prefix = output;
+    if(!opt.tmpdir.empty())
+    {
+        size_t slash = tmp_prefix.find_last_of("/\\");
+        tmp_prefix   = opt.tmpdir + "/" + tmp_prefix.substr(slash + 1);
+    }
+
+    entry_less less{opt.format, opt.block_dim};
+
+    int nthreads = 1;
+#ifdef _OPENMP
+    nthreads = omp_get_max_threads();
+#endif
+
+    // Chunks of the file are parsed at once, the parsed entries are spilled at capacity
+    size_t chunk_bytes = std::min<size_t>(size_t(64) << 20, opt.memory / 8);
+    size_t capacity    = std::max<size_t>(opt.memory / sizeof(mtx_entry), 1);
+
+    chunk_bytes = std::max<size_t>(chunk_bytes, 4096);
+
+    std::vector<mtx_entry>              entries;
+    std::vector<std::string>            runs;
+    std::vector<std::vector<mtx_entry>> local(nthreads);
+    std::vector<int64_t>                local_lines(nthreads);
+    std::vector<char>                   chunk(chunk_bytes + 1);
+
+    int64_t nnz        = 0;
+    int64_t nlines     = 0;
+    int64_t bytes_read = 0;
+    size_t  carry      = 0;
+    bool    eof        = false;
+    bool    ok         = true;
+    double  sort_time  = 0.0;
+
+    auto spill = [&]() {
+        auto t = std::chrono::steady_clock::now();
+
+        std::string run = tmp_prefix + ".run" + std::to_string(runs.size()) + ".tmp";
+
+        sort_entries(entries, less);
+        ok = ok && write_run(run, entries) == 0;
+
+        runs.push_back(run);
+        entries.clear();
+
+        sort_time += elapsed(t);
+    };
+
+    while(ok && !eof)
+    {
+        size_t got  = fread(chunk.data() + carry, 1, chunk_bytes - carry, f);
+        size_t size = carry + got;
+
+        eof = got < chunk_bytes - carry;
+        bytes_read += got;
+
+        // Parse complete lines only, the remainder is carried into the next chunk
+        size_t used = size;
+        if(!eof)
+        {
+            const char* last = find_last_line_end(chunk.data(), size);
+            if(last == nullptr)
+            {
+                fprintf(stderr, "Line exceeds the chunk size in %s.\n", input);
+                ok = false;
+                break;
+            }
+
+            used = last - chunk.data() + 1;
+        }
+
+        char saved  = chunk[used];
+        chunk[used] = '\0';
+
+        // Split into slices at line boundaries
+        std::vector<size_t> bound(nthreads + 1, used);
+        bound[0] = 0;
+        for(int t = 1; t < nthreads; ++t)
+        {
+            size_t b = std::max(bound[t - 1], used * t / nthreads);
+            while(b > 0 && b < used && chunk[b - 1] != '\n')
+            {
+                ++b;
+            }
+            bound[t] = b;
+        }
+
+        int parse_ok = 1;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static, 1) reduction(min : parse_ok)
+#endif
+        for(int t = 0; t < nthreads; ++t)
+        {
+            local[t].clear();
+            local_lines[t] = 0;
+
+            if(!parse_mtx_entries(chunk.data() + bound[t],
+                                  chunk.data() + bound[t + 1],
+                                  info,
+                                  local[t],
+                                  local_lines[t]))
+            {
+                parse_ok = 0;
+            }
+        }
+
+        if(!parse_ok)
+        {
+            fprintf(stderr, "Invalid entry in %s.\n", input);
+            ok = false;
+            break;
+        }
+
+        for(int t = 0; t < nthreads; ++t)
+        {
+            entries.insert(entries.end(), local[t].begin(), local[t].end());
+            nnz += local[t].size();
+            nlines += local_lines[t];
+        }
+
+        if(entries.size() >= capacity)
+        {
+            spill();
+        }
+
+        chunk[used] = saved;
+        carry       = size - used;
+        memmove(chunk.data(), chunk.data() + used, carry);
+    }
+
+    if(ferror(f))
+    {
+        ok = false;
+    }
+
+    fclose(f);
+
+    if(ok && nlines != info.nlines)
+    {
+        fprintf(stderr,
+                "Expected %" PRId64 " entries but found %" PRId64 " in %s.\n",
+                info.nlines,
+                nlines,
+                input);
+        ok = false;
+    }
+
+    double parse_time = elapsed(start) - sort_time;
+
+    // Spill the remainder if runs exist already, otherwise sort in memory
+    if(ok)
+    {
+        if(!runs.empty() && !entries.empty())
+        {
+            spill();
+        }
+        else if(runs.empty())
+        {
+            auto t = std::chrono::steady_clock::now();
+            sort_entries(entries, less);
+            sort_time += elapsed(t);
+        }
+    }
+
+    auto     write_start = std::chrono::steady_clock::now();
+    uint64_t file_size   = 0;
+
+    if(ok)
+    {
+        if(!runs.empty())
+        {
+            std::vector<mtx_entry>().swap(entries);
+        }
+
+        entry_source src(entries, runs, opt.memory, less);
+
+        if(!src.is_open()
+           || write_bin_matrix(output, tmp_prefix, opt, info, nnz, src, file_size) != 0)
+        {
+            fprintf(stderr, "Cannot open [write] %s.\n", output);
+            ok = false;
+        }
+    }
+
+    for(auto& run : runs)
+    {
+        remove(run.c_str());
+    }
+
+    if(!ok)
     {
-        fprintf(stderr, "Cannot open [write] %s.\n", argv[2]);
         return -1;
     }
 
+    if(opt.stats)
+    {
+        double write_time = elapsed(write_start);
+        double total_time = elapsed(start);
+
+        printf("Parsed  %" PRId64 " entries, %.1f MB in %.3f s (%.1f MB/s, %.1f M entries/s)\n",
+               nnz,
+               bytes_read / 1e6,
+               parse_time,
+               bytes_read / 1e6 / parse_time,
+               nnz / 1e6 / parse_time);
+        printf("Sorted  %zu run(s) in %.3f s\n", std::max<size_t>(runs.size(), 1), sort_time);
+        printf("Written %.1f MB in %.3f s (%.1f MB/s)\n",
+               file_size / 1e6,
+               write_time,
+               file_size / 1e6 / write_time);
+        printf("Total   %.3f s using %d thread(s)\n", total_time, nthreads);
+    }
+
     return 0;
 }
+
+static void usage(const char* name)
+{
+    fprintf(stderr,
+            "Usage: %s [options] input.mtx output.bin\n"
+            "  --format csr|csc|coo|bsr  storage format of the output (default csr)\n"
+            "  --blockdim n              block dimension of the bsr format (default 2)\n"
+            "  --index 32|64             index width (default 32 bits whenever possible)\n"
+            "  --memory n                MiB of parsed entries held in memory (default 2048)\n"
+            "  --tmpdir dir              directory of temporary files (default output dir)\n"
+            "  --stats                   print throughput statistics\n",
+            name);
+}
+
+int main(int argc, char* argv[])
+{
+    convert_options opt;
+
+    const char* input  = nullptr;
+    const char* output = nullptr;
+
+    for(int i = 1; i < argc; ++i)
+    {
+        std::string arg   = argv[i];
+        const char* value = (i + 1 < argc) ? argv[i + 1] : nullptr;
+
+        if(arg == "--stats")
+        {
+            opt.stats = true;
+        }
+        else if(arg.compare(0, 2, "--") == 0 && value == nullptr)
+        {
+            usage(argv[0]);
+            return -1;
+        }
+        else if(arg == "--format")
+        {
+            std::string format = argv[++i];
+
+            if(format == "csr")
+            {
+                opt.format = bin_format_csr;
+            }
+            else if(format == "csc")
+            {
+                opt.format = bin_format_csc;
+            }
+            else if(format == "coo")
+            {
+                opt.format = bin_format_coo;
+            }
+            else if(format == "bsr")
+            {
+                opt.format = bin_format_bsr;
+            }
+            else
+            {
+                usage(argv[0]);
+                return -1;
+            }
+        }
+        else if(arg == "--blockdim")
+        {
+            opt.block_dim = atoll(argv[++i]);
+        }
+        else if(arg == "--index")
+        {
+            opt.index_width = atoi(argv[++i]) / 8;
+        }
+        else if(arg == "--memory")
+        {
+            opt.memory = static_cast<size_t>(atoll(argv[++i])) << 20;
+        }
+        else if(arg == "--tmpdir")
+        {
+            opt.tmpdir = argv[++i];
+        }
+        else if(input == nullptr)
+        {
+            input = argv[i];
+        }
+        else if(output == nullptr)
+        {
+            output = argv[i];
+        }
+        else
+        {
+            usage(argv[0]);
+            return -1;
+        }
+    }
+
+    if(input == nullptr || output == nullptr || opt.block_dim < 1
+       || (opt.index_width != 0 && opt.index_width != 4 && opt.index_width != 8))
+    {
+        usage(argv[0]);
+        return -1;
+    }
+
+    return convert(input, output, opt);
+}
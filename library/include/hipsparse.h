@@ -348,6 +348,53 @@ typedef enum {
     HIPSPARSE_POINTER_MODE_DEVICE = 1 /**< Scalar pointers are in device memory */
 } hipsparsePointerMode_t;
 
+/*! \ingroup types_module
+ *  \brief Indicates if legacy routines block the host.
+ *
+ *  \details
+ *  The \ref hipsparseSyncMode_t indicates whether routines that are blocking in cuSPARSE,
+ *  such as hipsparseXdoti(), hipsparseXcsr2csc() or the analysis and zero pivot routines
+ *  of the incomplete factorizations, synchronize the stream of the library context before
+ *  returning. The \ref hipsparseSyncMode_t can be changed by hipsparseSetSyncMode(). The
+ *  currently used synchronization mode can be obtained by hipsparseGetSyncMode().
+ */
+typedef enum {
+    HIPSPARSE_SYNC_MODE_BLOCKING = 0, /**< Routines block as in cuSPARSE */
+    HIPSPARSE_SYNC_MODE_ASYNC    = 1 /**< Routines are stream ordered only */
+} hipsparseSyncMode_t;
+
+/*! \ingroup types_module
+ *  \brief Performance counters of a hipSPARSE library context.
+ *
+ *  \details
+ *  The \ref hipsparsePerfCounters_t holds the counters that a hipSPARSE library context
+ *  accumulates over all calls made with it. Only calls made by the application are counted,
+ *  routines that are implemented through other hipSPARSE routines count once. The counters
+ *  can be obtained by hipsparseGetPerfCounters() and reset by hipsparseResetPerfCounters().
+ */
+typedef struct
+{
+    uint64_t calls; /**< Number of calls */
+    uint64_t timeNs; /**< Cumulative host time spent in calls, in nanoseconds */
+    uint64_t workspaceBytes; /**< Bytes of device memory allocated internally */
+    uint64_t workspaceAllocations; /**< Number of internal device memory allocations */
+    uint64_t synchronizations; /**< Number of implicit stream synchronizations */
+} hipsparsePerfCounters_t;
+
+/*! \ingroup types_module
+ *  \brief Performance counters of a single hipSPARSE routine.
+ *
+ *  \details
+ *  The \ref hipsparseRoutineCounters_t holds the number of calls and the cumulative time
+ *  of one routine, as obtained by hipsparseGetPerfCounters().
+ */
+typedef struct
+{
+    const char* name; /**< Name of the routine */
+    uint64_t    calls; /**< Number of calls */
+    uint64_t    timeNs; /**< Cumulative host time spent in calls, in nanoseconds */
+} hipsparseRoutineCounters_t;
+
 /*! \ingroup types_module
  *  \brief Specify where the operation is performed on.
  *
@@ -595,6 +642,122 @@ hipsparseStatus_t hipsparseSetPointerMode(hipsparseHandle_t handle, hipsparsePoi
 HIPSPARSE_EXPORT
 hipsparseStatus_t hipsparseGetPointerMode(hipsparseHandle_t handle, hipsparsePointerMode_t* mode);
 
+/*! \ingroup aux_module
+ *  \brief Specify synchronization mode
+ *
+ *  \details
+ *  \p hipsparseSetSyncMode specifies the synchronization mode to be used by the hipSPARSE
+ *  library context and all subsequent function calls. By default, routines that are
+ *  blocking in cuSPARSE synchronize the stream of the library context before returning.
+ *  In \ref HIPSPARSE_SYNC_MODE_ASYNC, these routines are only ordered on the stream.
+ *  Routines that return a result through a host pointer still wait for that result,
+ *  such that \ref HIPSPARSE_POINTER_MODE_DEVICE is required for them to run fully
+ *  asynchronously. Completion can then be tracked by recording an event on the stream.
+ *
+ *  The default synchronization mode of new library contexts can be set through the
+ *  environment variable \p HIPSPARSE_SYNC_MODE, with the values \p blocking or \p async.
+ *
+ *  \note
+ *  With the cuSPARSE backend only \ref HIPSPARSE_SYNC_MODE_BLOCKING is supported.
+ */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSetSyncMode(hipsparseHandle_t handle, hipsparseSyncMode_t mode);
+
+/*! \ingroup aux_module
+ *  \brief Get current synchronization mode from library context
+ *
+ *  \details
+ *  \p hipsparseGetSyncMode gets the hipSPARSE library context synchronization mode which
+ *  is currently used for all subsequent function calls.
+ */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseGetSyncMode(hipsparseHandle_t handle, hipsparseSyncMode_t* mode);
+
+/*! \ingroup aux_module
+ *  \brief Reserve device workspace in the library context
+ *
+ *  \details
+ *  \p hipsparseReserveWorkspace grows the device workspace owned by the hipSPARSE library
+ *  context to at least \p sizeInBytes bytes. Legacy routines that require temporary device
+ *  storage without taking a user buffer, such as hipsparseXcsr2csc(), hipsparseXcsrgemm()
+ *  and hipsparseXhyb2csr(), carve it from this workspace instead of allocating and freeing
+ *  it on every call. The workspace only grows, and reserving it up front avoids any
+ *  allocation inside subsequent calls. The workspace is ordered on the stream that has
+ *  been set by hipsparseSetStream() and is released by hipsparseReleaseWorkspace() or
+ *  hipsparseDestroy().
+ *
+ *  \note
+ *  With the cuSPARSE backend this function does nothing.
+ */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseReserveWorkspace(hipsparseHandle_t handle, size_t sizeInBytes);
+
+/*! \ingroup aux_module
+ *  \brief Get the device workspace size of the library context
+ *
+ *  \details
+ *  \p hipsparseGetWorkspaceSize returns the number of bytes currently held by the
+ *  device workspace of the hipSPARSE library context in \p sizeInBytes, and the largest
+ *  amount of workspace requested by any call since the context has been created in
+ *  \p highWaterMark. Either pointer may be \p NULL.
+ */
+HIPSPARSE_EXPORT
+hipsparseStatus_t
+    hipsparseGetWorkspaceSize(hipsparseHandle_t handle, size_t* sizeInBytes, size_t* highWaterMark);
+
+/*! \ingroup aux_module
+ *  \brief Release the device workspace of the library context
+ *
+ *  \details
+ *  \p hipsparseReleaseWorkspace waits for all work that may still use the device
+ *  workspace of the hipSPARSE library context and frees it. The high-water mark is kept,
+ *  such that it can be passed to hipsparseReserveWorkspace() later on.
+ */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseReleaseWorkspace(hipsparseHandle_t handle);
+
+/*! \ingroup aux_module
+ *  \brief Get the performance counters of the library context
+ *
+ *  \details
+ *  \p hipsparseGetPerfCounters returns the performance counters accumulated by the
+ *  hipSPARSE library context since its creation or the last call to
+ *  hipsparseResetPerfCounters(). The counters are always enabled and are updated without
+ *  locks, such that they can be read while other threads use the library.
+ *
+ *  If \p routines is \p NULL, \p routineCount returns the number of routines that have
+ *  been called. Otherwise, \p routines is filled with the counters of up to
+ *  \p routineCount routines and \p routineCount returns the number of entries written.
+ *  Either \p counters or \p routineCount may be \p NULL.
+ *
+ *  \note
+ *  With the cuSPARSE backend all counters are zero.
+ *
+ *  @param[in]
+ *  handle          handle to the hipsparse library context queue.
+ *  @param[out]
+ *  counters        counters accumulated over all routines.
+ *  @param[out]
+ *  routines        array of \p routineCount per-routine counters.
+ *  @param[inout]
+ *  routineCount    size of \p routines on input, number of routines on output.
+ */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseGetPerfCounters(hipsparseHandle_t           handle,
+                                           hipsparsePerfCounters_t*    counters,
+                                           hipsparseRoutineCounters_t* routines,
+                                           int*                        routineCount);
+
+/*! \ingroup aux_module
+ *  \brief Reset the performance counters of the library context
+ *
+ *  \details
+ *  \p hipsparseResetPerfCounters sets all performance counters of the hipSPARSE library
+ *  context to zero.
+ */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseResetPerfCounters(hipsparseHandle_t handle);
+
 /*! \ingroup aux_module
  *  \brief Create a matrix descriptor
  *  \details
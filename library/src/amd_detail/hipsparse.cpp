@@ -22,14 +22,19 @@
 * ************************************************************************ */
 
 #include "hipsparse.h"
+#include "hipsparse_layer.hpp"
 
 #include <hip/hip_complex.h>
 #include <hip/hip_runtime_api.h>
 #include <rocsparse/rocsparse.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
+#include <algorithm>
+#include <atomic>
 #include <iostream>
+#include <mutex>
 
 #define TO_STR2(x) #x
 #define TO_STR(x) TO_STR2(x)
@@ -64,8 +69,9 @@
 // csru2csr struct - to hold permutation array
 struct csru2csrInfo
 {
-    int  size = 0;
-    int* P    = nullptr;
+    int  size     = 0;
+    int  capacity = 0;
+    int* P        = nullptr;
 };
 
 namespace hipsparse
@@ -668,6 +674,430 @@ namespace hipsparse
     }
 }
 
+namespace hipsparse
+{
+    // Device workspace owned by a handle. Legacy wrappers that need temporary device
+    // memory without taking a user buffer carve it from here. The buffer only grows and
+    // is ordered on the stream of the call that used it last.
+    struct workspace
+    {
+        void*       buffer     = nullptr;
+        size_t      size       = 0;
+        size_t      high_water = 0;
+        hipStream_t stream     = nullptr;
+        bool        pending    = false;
+    };
+
+    // State kept per handle in addition to the rocsparse handle
+    struct handle_state
+    {
+        workspace           ws;
+        void*               constants = nullptr;
+        hipsparseSyncMode_t sync_mode = defaultSyncMode();
+        layer_counters      counters;
+
+        // Default synchronization mode of new handles, from HIPSPARSE_SYNC_MODE
+        static hipsparseSyncMode_t defaultSyncMode()
+        {
+            static const char* env  = getenv("HIPSPARSE_SYNC_MODE");
+            static const bool  sync = env == nullptr || strcmp(env, "async") != 0;
+
+            return sync ? HIPSPARSE_SYNC_MODE_BLOCKING : HIPSPARSE_SYNC_MODE_ASYNC;
+        }
+    };
+
+    // hipsparseHandle_t is the rocsparse handle itself, such that the handle state has to
+    // live in a side table keyed by the handle. Every call looks its state up, so lookups
+    // never lock: the table is open addressed with atomic handle/state slots, which are
+    // filled by hipsparseCreate and tombstoned by hipsparseDestroy under stateMutex().
+    // A table that reaches half load chains to one of twice the size. Tables are only
+    // freed at exit, such that lookups may run concurrently with creating and destroying
+    // handles.
+    struct state_slot
+    {
+        std::atomic<hipsparseHandle_t> handle{nullptr};
+        std::atomic<handle_state*>     state{nullptr};
+    };
+
+    // Handle value of a slot whose state was destroyed. Probing continues past it and
+    // insertions reuse it.
+    static hipsparseHandle_t stateTombstone()
+    {
+        return reinterpret_cast<hipsparseHandle_t>(static_cast<uintptr_t>(1));
+    }
+
+    struct state_table
+    {
+        explicit state_table(size_t capacity)
+            : capacity(capacity)
+            , slots(new state_slot[capacity])
+        {
+        }
+
+        // Frees the chained tables and the states of handles that were never destroyed,
+        // such as rocsparse handles that were not created through hipsparseCreate
+        ~state_table()
+        {
+            for(size_t i = 0; i < this->capacity; ++i)
+            {
+                hipsparseHandle_t key = this->slots[i].handle.load(std::memory_order_relaxed);
+
+                if(key != nullptr && key != stateTombstone())
+                {
+                    delete this->slots[i].state.load(std::memory_order_relaxed);
+                }
+            }
+
+            delete[] this->slots;
+            delete this->next.load(std::memory_order_relaxed);
+        }
+
+        const size_t              capacity;
+        size_t                    used = 0; // Slots ever filled, guarded by stateMutex()
+        state_slot* const         slots;
+        std::atomic<state_table*> next{nullptr};
+    };
+
+    static std::mutex& stateMutex()
+    {
+        static std::mutex mutex;
+        return mutex;
+    }
+
+    static state_table& stateTables()
+    {
+        static state_table tables(256);
+        return tables;
+    }
+
+    static size_t stateHash(hipsparseHandle_t handle, size_t capacity)
+    {
+        uint64_t key = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(handle)) >> 4;
+
+        return static_cast<size_t>((key * 0x9E3779B97F4A7C15ull) >> 32) & (capacity - 1);
+    }
+
+    // Lock free lookup of the slot holding handle, nullptr if there is none
+    static state_slot* findSlot(hipsparseHandle_t handle)
+    {
+        for(state_table* table = &stateTables(); table != nullptr;
+            table              = table->next.load(std::memory_order_acquire))
+        {
+            size_t i = stateHash(handle, table->capacity);
+
+            for(size_t n = 0; n < table->capacity; ++n, i = (i + 1) & (table->capacity - 1))
+            {
+                hipsparseHandle_t key = table->slots[i].handle.load(std::memory_order_acquire);
+
+                if(key == handle)
+                {
+                    return &table->slots[i];
+                }
+
+                if(key == nullptr)
+                {
+                    break;
+                }
+            }
+        }
+
+        return nullptr;
+    }
+
+    // Store the state of handle, the caller holds stateMutex(). The state is published
+    // before the handle, such that a lookup that finds the handle also sees its state.
+    static void insertState(hipsparseHandle_t handle, handle_state* state)
+    {
+        for(state_table* table = &stateTables();;)
+        {
+            size_t i = stateHash(handle, table->capacity);
+
+            for(size_t n = 0; n < table->capacity; ++n, i = (i + 1) & (table->capacity - 1))
+            {
+                state_slot&       slot = table->slots[i];
+                hipsparseHandle_t key  = slot.handle.load(std::memory_order_relaxed);
+
+                if(key == nullptr && 2 * (table->used + 1) > table->capacity)
+                {
+                    break;
+                }
+
+                if(key == nullptr || key == stateTombstone())
+                {
+                    table->used += (key == nullptr) ? 1 : 0;
+
+                    slot.state.store(state, std::memory_order_release);
+                    slot.handle.store(handle, std::memory_order_release);
+
+                    return;
+                }
+            }
+
+            state_table* next = table->next.load(std::memory_order_relaxed);
+
+            if(next == nullptr)
+            {
+                next = new state_table(2 * table->capacity);
+                table->next.store(next, std::memory_order_release);
+            }
+
+            table = next;
+        }
+    }
+
+    // Allocate the state of a handle. hipsparseCreate does this for its handles, other
+    // rocsparse handles passed to hipSPARSE get their state on first use.
+    static handle_state* createState(hipsparseHandle_t handle)
+    {
+        std::lock_guard<std::mutex> lock(stateMutex());
+
+        state_slot* slot = findSlot(handle);
+
+        if(slot != nullptr)
+        {
+            return slot->state.load(std::memory_order_relaxed);
+        }
+
+        handle_state* state = new handle_state;
+        insertState(handle, state);
+
+        return state;
+    }
+
+    // Tombstone the slot of handle and hand its state over to the caller
+    static handle_state* removeState(hipsparseHandle_t handle)
+    {
+        std::lock_guard<std::mutex> lock(stateMutex());
+
+        state_slot* slot = findSlot(handle);
+
+        if(slot == nullptr)
+        {
+            return nullptr;
+        }
+
+        handle_state* state = slot->state.load(std::memory_order_relaxed);
+
+        slot->handle.store(stateTombstone(), std::memory_order_release);
+        slot->state.store(nullptr, std::memory_order_relaxed);
+
+        return state;
+    }
+
+    static handle_state& getState(hipsparseHandle_t handle)
+    {
+        state_slot*   slot  = findSlot(handle);
+        handle_state* state = (slot != nullptr) ? slot->state.load(std::memory_order_acquire)
+                                                : nullptr;
+
+        return (state != nullptr) ? *state : *createState(handle);
+    }
+
+    layer_counters* layerCounters(hipsparseHandle_t handle)
+    {
+        return &getState(handle).counters;
+    }
+
+    // Wait for work on another stream that may still read the workspace, then make
+    // the workspace belong to the current handle stream
+    static hipsparseStatus_t workspaceFence(hipsparseHandle_t handle, handle_state& state)
+    {
+        workspace& ws = state.ws;
+
+        hipStream_t stream;
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_get_stream((rocsparse_handle)handle, &stream));
+
+        if(ws.pending && ws.stream != stream)
+        {
+            RETURN_IF_HIP_ERROR(hipStreamSynchronize(ws.stream));
+            state.counters.synchronization();
+        }
+
+        ws.stream  = stream;
+        ws.pending = true;
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    static hipsparseStatus_t workspaceGrow(handle_state& state, size_t size)
+    {
+        workspace& ws = state.ws;
+
+        if(size <= ws.size)
+        {
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
+
+        // Round up to avoid re-allocating for small size fluctuations
+        size = ((size - 1) / 4096 + 1) * 4096;
+
+        if(ws.buffer != nullptr)
+        {
+            if(ws.pending)
+            {
+                RETURN_IF_HIP_ERROR(hipStreamSynchronize(ws.stream));
+                state.counters.synchronization();
+            }
+
+            RETURN_IF_HIP_ERROR(hipFree(ws.buffer));
+
+            ws.buffer = nullptr;
+            ws.size   = 0;
+        }
+
+        RETURN_IF_HIP_ERROR(hipMalloc(&ws.buffer, size));
+        ws.size = size;
+
+        state.counters.allocation(size);
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    // Release the workspace buffers. The buffers are dropped even if waiting for or freeing
+    // them fails, such that the workspace is always left empty; the first error is returned.
+    static hipsparseStatus_t workspaceRelease(workspace& ws)
+    {
+        hipError_t err = hipSuccess;
+
+        if(ws.pending)
+        {
+            err        = hipStreamSynchronize(ws.stream);
+            ws.pending = false;
+        }
+
+        if(ws.buffer != nullptr)
+        {
+            hipError_t free_err = hipFree(ws.buffer);
+            err                 = (err != hipSuccess) ? err : free_err;
+
+            ws.buffer = nullptr;
+            ws.size   = 0;
+        }
+
+        return (err != hipSuccess) ? hipErrorToHIPSPARSEStatus(err) : HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    // Synchronize the handle stream in routines that are blocking in cuSPARSE, unless the
+    // handle is in asynchronous mode. Results written through host pointers are always
+    // waited for.
+    static hipsparseStatus_t
+        syncStream(hipsparseHandle_t handle, hipStream_t stream, bool host_result = false)
+    {
+        if(getState(handle).sync_mode == HIPSPARSE_SYNC_MODE_ASYNC)
+        {
+            rocsparse_pointer_mode pointer_mode = rocsparse_pointer_mode_device;
+
+            if(host_result)
+            {
+                RETURN_IF_ROCSPARSE_ERROR(
+                    rocsparse_get_pointer_mode((rocsparse_handle)handle, &pointer_mode));
+            }
+
+            if(pointer_mode == rocsparse_pointer_mode_device)
+            {
+                return HIPSPARSE_STATUS_SUCCESS;
+            }
+        }
+
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+        getState(handle).counters.synchronization();
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    // Obtain size bytes of temporary device memory, valid on the handle stream until
+    // the next call on the same handle
+    static hipsparseStatus_t workspaceAcquire(hipsparseHandle_t handle, size_t size, void** buffer)
+    {
+        handle_state& state = getState(handle);
+
+        RETURN_IF_HIPSPARSE_ERROR(workspaceFence(handle, state));
+        RETURN_IF_HIPSPARSE_ERROR(workspaceGrow(state, size));
+
+        state.ws.high_water = std::max(state.ws.high_water, size);
+        *buffer             = state.ws.buffer;
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    // Obtain a device pointer to the constant 0 or 1 of the given value type. The table
+    // is allocated on first use and shared by all streams, each value takes a 16 byte slot.
+    static hipsparseStatus_t
+        deviceConstant(hipsparseHandle_t handle, hipDataType type, int value, const void** constant)
+    {
+        int slot;
+
+        switch(type)
+        {
+        case HIP_R_32F:
+        {
+            slot = 0;
+            break;
+        }
+        case HIP_R_64F:
+        {
+            slot = 2;
+            break;
+        }
+        case HIP_C_32F:
+        {
+            slot = 4;
+            break;
+        }
+        case HIP_C_64F:
+        {
+            slot = 6;
+            break;
+        }
+        default:
+        {
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+        }
+
+        if(value != 0 && value != 1)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        handle_state& state = getState(handle);
+
+        if(state.constants == nullptr)
+        {
+            float            sone = 1.0f;
+            double           done = 1.0;
+            hipComplex       cone = make_hipComplex(1.0f, 0.0f);
+            hipDoubleComplex zone = make_hipDoubleComplex(1.0, 0.0);
+
+            // Zeros of all types are all bits zero
+            char host[8 * 16] = {};
+            memcpy(host + 1 * 16, &sone, sizeof(sone));
+            memcpy(host + 3 * 16, &done, sizeof(done));
+            memcpy(host + 5 * 16, &cone, sizeof(cone));
+            memcpy(host + 7 * 16, &zone, sizeof(zone));
+
+            void* constants;
+            RETURN_IF_HIP_ERROR(hipMalloc(&constants, sizeof(host)));
+            state.counters.allocation(sizeof(host));
+
+            // Blocking copy, such that the table can be read on any stream afterwards
+            hipError_t err = hipMemcpy(constants, host, sizeof(host), hipMemcpyHostToDevice);
+
+            if(err != hipSuccess)
+            {
+                hipFree(constants);
+                return hipErrorToHIPSPARSEStatus(err);
+            }
+
+            state.constants = constants;
+        }
+
+        *constant = static_cast<const char*>(state.constants) + (slot + value) * 16;
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+}
+
 hipsparseStatus_t hipsparseCreate(hipsparseHandle_t* handle)
 {
     // Check if handle is valid
@@ -686,13 +1116,52 @@ hipsparseStatus_t hipsparseCreate(hipsparseHandle_t* handle)
         retval = hipsparse::rocSPARSEStatusToHIPStatus(
             rocsparse_create_handle((rocsparse_handle*)handle));
     }
+
+    // Allocate the handle state up front, such that calls never take the table lock
+    if(retval == HIPSPARSE_STATUS_SUCCESS)
+    {
+        hipsparse::createState(*handle);
+    }
+
     return retval;
 }
 
 hipsparseStatus_t hipsparseDestroy(hipsparseHandle_t handle)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
+    // Write the timings of calls made with the handle that are still in flight and the
+    // buffered log lines
+    if(hipsparse::layerMode() != hipsparse::layer_mode_none)
+    {
+        hipsparse::layer_log::instance().flush(handle);
+    }
+
+    // Release the state and workspace owned by the handle, if any. Failures are recorded
+    // but do not stop the teardown, such that the rocsparse handle is always destroyed.
+    hipsparseStatus_t status = HIPSPARSE_STATUS_SUCCESS;
+
+    hipsparse::handle_state* state = hipsparse::removeState(handle);
+
+    if(state != nullptr)
+    {
+        status = hipsparse::workspaceRelease(state->ws);
+
+        if(state->constants != nullptr)
+        {
+            hipError_t err = hipFree(state->constants);
+
+            if(err != hipSuccess && status == HIPSPARSE_STATUS_SUCCESS)
+            {
+                status = hipsparse::hipErrorToHIPSPARSEStatus(err);
+            }
+        }
+
+        delete state;
+    }
+
+    hipsparseStatus_t destroy_status = hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_destroy_handle((rocsparse_handle)handle));
+
+    return (status != HIPSPARSE_STATUS_SUCCESS) ? status : destroy_status;
 }
 
 const char* hipsparseGetErrorName(hipsparseStatus_t status)
@@ -707,6 +1176,8 @@ const char* hipsparseGetErrorString(hipsparseStatus_t status)
 
 hipsparseStatus_t hipsparseGetVersion(hipsparseHandle_t handle, int* version)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, version);
+
     if(handle == nullptr)
     {
         return HIPSPARSE_STATUS_NOT_INITIALIZED;
@@ -719,6 +1190,8 @@ hipsparseStatus_t hipsparseGetVersion(hipsparseHandle_t handle, int* version)
 
 hipsparseStatus_t hipsparseGetGitRevision(hipsparseHandle_t handle, char* rev)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, rev);
+
     // Get hipSPARSE revision
     if(handle == nullptr)
     {
@@ -757,30 +1230,210 @@ hipsparseStatus_t hipsparseGetGitRevision(hipsparseHandle_t handle, char* rev)
 
 hipsparseStatus_t hipsparseSetStream(hipsparseHandle_t handle, hipStream_t streamId)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, streamId);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_set_stream((rocsparse_handle)handle, streamId));
 }
 
 hipsparseStatus_t hipsparseGetStream(hipsparseHandle_t handle, hipStream_t* streamId)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, streamId);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_get_stream((rocsparse_handle)handle, streamId));
 }
 
 hipsparseStatus_t hipsparseSetPointerMode(hipsparseHandle_t handle, hipsparsePointerMode_t mode)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, mode);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_set_pointer_mode(
         (rocsparse_handle)handle, hipsparse::hipPtrModeToHCCPtrMode(mode)));
 }
 
 hipsparseStatus_t hipsparseGetPointerMode(hipsparseHandle_t handle, hipsparsePointerMode_t* mode)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, mode);
+
     rocsparse_pointer_mode_ rocsparse_mode;
     rocsparse_status status = rocsparse_get_pointer_mode((rocsparse_handle)handle, &rocsparse_mode);
     *mode                   = hipsparse::HCCPtrModeToHIPPtrMode(rocsparse_mode);
     return hipsparse::rocSPARSEStatusToHIPStatus(status);
 }
 
+hipsparseStatus_t hipsparseSetSyncMode(hipsparseHandle_t handle, hipsparseSyncMode_t mode)
+{
+    HIPSPARSE_LAYER_SCOPE(handle, mode);
+
+    if(handle == nullptr)
+    {
+        return HIPSPARSE_STATUS_NOT_INITIALIZED;
+    }
+
+    if(mode != HIPSPARSE_SYNC_MODE_BLOCKING && mode != HIPSPARSE_SYNC_MODE_ASYNC)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    hipsparse::getState(handle).sync_mode = mode;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseGetSyncMode(hipsparseHandle_t handle, hipsparseSyncMode_t* mode)
+{
+    HIPSPARSE_LAYER_SCOPE(handle, mode);
+
+    if(handle == nullptr)
+    {
+        return HIPSPARSE_STATUS_NOT_INITIALIZED;
+    }
+
+    if(mode == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *mode = hipsparse::getState(handle).sync_mode;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseReserveWorkspace(hipsparseHandle_t handle, size_t sizeInBytes)
+{
+    HIPSPARSE_LAYER_SCOPE(handle, sizeInBytes);
+
+    if(handle == nullptr)
+    {
+        return HIPSPARSE_STATUS_NOT_INITIALIZED;
+    }
+
+    hipsparse::handle_state& state = hipsparse::getState(handle);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::workspaceFence(handle, state));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::workspaceGrow(state, sizeInBytes));
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t
+    hipsparseGetWorkspaceSize(hipsparseHandle_t handle, size_t* sizeInBytes, size_t* highWaterMark)
+{
+    HIPSPARSE_LAYER_SCOPE(handle, sizeInBytes, highWaterMark);
+
+    if(handle == nullptr)
+    {
+        return HIPSPARSE_STATUS_NOT_INITIALIZED;
+    }
+
+    const hipsparse::workspace& ws = hipsparse::getState(handle).ws;
+
+    if(sizeInBytes != nullptr)
+    {
+        *sizeInBytes = ws.size;
+    }
+
+    if(highWaterMark != nullptr)
+    {
+        *highWaterMark = ws.high_water;
+    }
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseReleaseWorkspace(hipsparseHandle_t handle)
+{
+    HIPSPARSE_LAYER_SCOPE(handle);
+
+    if(handle == nullptr)
+    {
+        return HIPSPARSE_STATUS_NOT_INITIALIZED;
+    }
+
+    return hipsparse::workspaceRelease(hipsparse::getState(handle).ws);
+}
+
+hipsparseStatus_t hipsparseGetPerfCounters(hipsparseHandle_t           handle,
+                                           hipsparsePerfCounters_t*    counters,
+                                           hipsparseRoutineCounters_t* routines,
+                                           int*                        routineCount)
+{
+    if(handle == nullptr)
+    {
+        return HIPSPARSE_STATUS_NOT_INITIALIZED;
+    }
+
+    if(routines != nullptr && routineCount == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    const hipsparse::layer_counters& c = hipsparse::getState(handle).counters;
+
+    int capacity = (routines != nullptr) ? *routineCount : 0;
+    int count    = 0;
+
+    uint64_t total_calls   = 0;
+    uint64_t total_time_ns = 0;
+
+    for(int i = 0; i < hipsparse::layer_routine_count; ++i)
+    {
+        uint64_t calls   = c.routine_calls[i].load(std::memory_order_relaxed);
+        uint64_t time_ns = c.routine_time_ns[i].load(std::memory_order_relaxed);
+
+        if(calls == 0)
+        {
+            continue;
+        }
+
+        total_calls += calls;
+        total_time_ns += time_ns;
+
+        if(routines != nullptr)
+        {
+            if(count == capacity)
+            {
+                continue;
+            }
+
+            routines[count].name   = hipsparse::layerRoutineNames()[i].load();
+            routines[count].calls  = calls;
+            routines[count].timeNs = time_ns;
+        }
+
+        ++count;
+    }
+
+    if(counters != nullptr)
+    {
+        counters->calls                = total_calls;
+        counters->timeNs               = total_time_ns;
+        counters->workspaceBytes       = c.workspace_bytes.load(std::memory_order_relaxed);
+        counters->workspaceAllocations = c.workspace_allocations.load(std::memory_order_relaxed);
+        counters->synchronizations     = c.synchronizations.load(std::memory_order_relaxed);
+    }
+
+    if(routineCount != nullptr)
+    {
+        *routineCount = count;
+    }
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseResetPerfCounters(hipsparseHandle_t handle)
+{
+    if(handle == nullptr)
+    {
+        return HIPSPARSE_STATUS_NOT_INITIALIZED;
+    }
+
+    hipsparse::getState(handle).counters.reset();
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
 hipsparseStatus_t hipsparseCreateMatDescr(hipsparseMatDescr_t* descrA)
 {
     return hipsparse::rocSPARSEStatusToHIPStatus(
@@ -999,8 +1652,9 @@ hipsparseStatus_t hipsparseCreateCsru2csrInfo(csru2csrInfo_t* info)
     *info = new csru2csrInfo;
 
     // Initialize permutation array with nullptr
-    (*info)->size = 0;
-    (*info)->P    = nullptr;
+    (*info)->size     = 0;
+    (*info)->capacity = 0;
+    (*info)->P        = nullptr;
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -1014,7 +1668,8 @@ hipsparseStatus_t hipsparseDestroyCsru2csrInfo(csru2csrInfo_t info)
         if(info->P != nullptr)
         {
             RETURN_IF_HIP_ERROR(hipFree(info->P));
-            info->size = 0;
+            info->size     = 0;
+            info->capacity = 0;
         }
 
         delete info;
@@ -1031,6 +1686,8 @@ hipsparseStatus_t hipsparseSaxpyi(hipsparseHandle_t    handle,
                                   float*               y,
                                   hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, nnz, alpha, xVal, xInd, y, idxBase);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_saxpyi(
         (rocsparse_handle)handle, nnz, alpha, xVal, xInd, y, hipsparse::hipBaseToHCCBase(idxBase)));
 }
@@ -1043,6 +1700,8 @@ hipsparseStatus_t hipsparseDaxpyi(hipsparseHandle_t    handle,
                                   double*              y,
                                   hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, nnz, alpha, xVal, xInd, y, idxBase);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_daxpyi(
         (rocsparse_handle)handle, nnz, alpha, xVal, xInd, y, hipsparse::hipBaseToHCCBase(idxBase)));
 }
@@ -1055,6 +1714,8 @@ hipsparseStatus_t hipsparseCaxpyi(hipsparseHandle_t    handle,
                                   hipComplex*          y,
                                   hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, nnz, alpha, xVal, xInd, y, idxBase);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_caxpyi((rocsparse_handle)handle,
                          nnz,
@@ -1073,6 +1734,8 @@ hipsparseStatus_t hipsparseZaxpyi(hipsparseHandle_t       handle,
                                   hipDoubleComplex*       y,
                                   hipsparseIndexBase_t    idxBase)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, nnz, alpha, xVal, xInd, y, idxBase);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zaxpyi((rocsparse_handle)handle,
                          nnz,
@@ -1091,6 +1754,8 @@ hipsparseStatus_t hipsparseSdoti(hipsparseHandle_t    handle,
                                  float*               result,
                                  hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, nnz, xVal, xInd, y, result, idxBase);
+
     // Obtain stream, to explicitly sync (cusparse doti is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -1105,7 +1770,7 @@ hipsparseStatus_t hipsparseSdoti(hipsparseHandle_t    handle,
                                               hipsparse::hipBaseToHCCBase(idxBase)));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::syncStream(handle, stream, true));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -1118,6 +1783,8 @@ hipsparseStatus_t hipsparseDdoti(hipsparseHandle_t    handle,
                                  double*              result,
                                  hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, nnz, xVal, xInd, y, result, idxBase);
+
     // Obtain stream, to explicitly sync (cusparse doti is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -1132,7 +1799,7 @@ hipsparseStatus_t hipsparseDdoti(hipsparseHandle_t    handle,
                                               hipsparse::hipBaseToHCCBase(idxBase)));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::syncStream(handle, stream, true));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -1145,6 +1812,8 @@ hipsparseStatus_t hipsparseCdoti(hipsparseHandle_t    handle,
                                  hipComplex*          result,
                                  hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, nnz, xVal, xInd, y, result, idxBase);
+
     // Obtain stream, to explicitly sync (cusparse doti is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -1159,7 +1828,7 @@ hipsparseStatus_t hipsparseCdoti(hipsparseHandle_t    handle,
                                               hipsparse::hipBaseToHCCBase(idxBase)));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::syncStream(handle, stream, true));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -1172,6 +1841,8 @@ hipsparseStatus_t hipsparseZdoti(hipsparseHandle_t       handle,
                                  hipDoubleComplex*       result,
                                  hipsparseIndexBase_t    idxBase)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, nnz, xVal, xInd, y, result, idxBase);
+
     // Obtain stream, to explicitly sync (cusparse doti is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -1186,7 +1857,7 @@ hipsparseStatus_t hipsparseZdoti(hipsparseHandle_t       handle,
                                               hipsparse::hipBaseToHCCBase(idxBase)));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::syncStream(handle, stream, true));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -1199,6 +1870,8 @@ hipsparseStatus_t hipsparseCdotci(hipsparseHandle_t    handle,
                                   hipComplex*          result,
                                   hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, nnz, xVal, xInd, y, result, idxBase);
+
     // Obtain stream, to explicitly sync (cusparse dotci is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -1213,7 +1886,7 @@ hipsparseStatus_t hipsparseCdotci(hipsparseHandle_t    handle,
                                                hipsparse::hipBaseToHCCBase(idxBase)));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::syncStream(handle, stream, true));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -1226,6 +1899,8 @@ hipsparseStatus_t hipsparseZdotci(hipsparseHandle_t       handle,
                                   hipDoubleComplex*       result,
                                   hipsparseIndexBase_t    idxBase)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, nnz, xVal, xInd, y, result, idxBase);
+
     // Obtain stream, to explicitly sync (cusparse dotci is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -1240,7 +1915,7 @@ hipsparseStatus_t hipsparseZdotci(hipsparseHandle_t       handle,
                                                hipsparse::hipBaseToHCCBase(idxBase)));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::syncStream(handle, stream, true));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -1252,6 +1927,8 @@ hipsparseStatus_t hipsparseSgthr(hipsparseHandle_t    handle,
                                  const int*           xInd,
                                  hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, nnz, y, xVal, xInd, idxBase);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_sgthr(
         (rocsparse_handle)handle, nnz, y, xVal, xInd, hipsparse::hipBaseToHCCBase(idxBase)));
 }
@@ -1263,6 +1940,8 @@ hipsparseStatus_t hipsparseDgthr(hipsparseHandle_t    handle,
                                  const int*           xInd,
                                  hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, nnz, y, xVal, xInd, idxBase);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_dgthr(
         (rocsparse_handle)handle, nnz, y, xVal, xInd, hipsparse::hipBaseToHCCBase(idxBase)));
 }
@@ -1274,6 +1953,8 @@ hipsparseStatus_t hipsparseCgthr(hipsparseHandle_t    handle,
                                  const int*           xInd,
                                  hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, nnz, y, xVal, xInd, idxBase);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_cgthr((rocsparse_handle)handle,
                         nnz,
@@ -1290,6 +1971,8 @@ hipsparseStatus_t hipsparseZgthr(hipsparseHandle_t       handle,
                                  const int*              xInd,
                                  hipsparseIndexBase_t    idxBase)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, nnz, y, xVal, xInd, idxBase);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zgthr((rocsparse_handle)handle,
                         nnz,
@@ -1306,6 +1989,8 @@ hipsparseStatus_t hipsparseSgthrz(hipsparseHandle_t    handle,
                                   const int*           xInd,
                                   hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, nnz, y, xVal, xInd, idxBase);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_sgthrz(
         (rocsparse_handle)handle, nnz, y, xVal, xInd, hipsparse::hipBaseToHCCBase(idxBase)));
 }
@@ -1317,6 +2002,8 @@ hipsparseStatus_t hipsparseDgthrz(hipsparseHandle_t    handle,
                                   const int*           xInd,
                                   hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, nnz, y, xVal, xInd, idxBase);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_dgthrz(
         (rocsparse_handle)handle, nnz, y, xVal, xInd, hipsparse::hipBaseToHCCBase(idxBase)));
 }
@@ -1328,6 +2015,8 @@ hipsparseStatus_t hipsparseCgthrz(hipsparseHandle_t    handle,
                                   const int*           xInd,
                                   hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, nnz, y, xVal, xInd, idxBase);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_cgthrz((rocsparse_handle)handle,
                          nnz,
@@ -1344,6 +2033,8 @@ hipsparseStatus_t hipsparseZgthrz(hipsparseHandle_t    handle,
                                   const int*           xInd,
                                   hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, nnz, y, xVal, xInd, idxBase);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zgthrz((rocsparse_handle)handle,
                          nnz,
@@ -1362,6 +2053,8 @@ hipsparseStatus_t hipsparseSroti(hipsparseHandle_t    handle,
                                  const float*         s,
                                  hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, nnz, xVal, xInd, y, c, s, idxBase);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_sroti(
         (rocsparse_handle)handle, nnz, xVal, xInd, y, c, s, hipsparse::hipBaseToHCCBase(idxBase)));
 }
@@ -1375,6 +2068,8 @@ hipsparseStatus_t hipsparseDroti(hipsparseHandle_t    handle,
                                  const double*        s,
                                  hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, nnz, xVal, xInd, y, c, s, idxBase);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_droti(
         (rocsparse_handle)handle, nnz, xVal, xInd, y, c, s, hipsparse::hipBaseToHCCBase(idxBase)));
 }
@@ -1386,6 +2081,8 @@ hipsparseStatus_t hipsparseSsctr(hipsparseHandle_t    handle,
                                  float*               y,
                                  hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, nnz, xVal, xInd, y, idxBase);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_ssctr(
         (rocsparse_handle)handle, nnz, xVal, xInd, y, hipsparse::hipBaseToHCCBase(idxBase)));
 }
@@ -1397,6 +2094,8 @@ hipsparseStatus_t hipsparseDsctr(hipsparseHandle_t    handle,
                                  double*              y,
                                  hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, nnz, xVal, xInd, y, idxBase);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_dsctr(
         (rocsparse_handle)handle, nnz, xVal, xInd, y, hipsparse::hipBaseToHCCBase(idxBase)));
 }
@@ -1408,6 +2107,8 @@ hipsparseStatus_t hipsparseCsctr(hipsparseHandle_t    handle,
                                  hipComplex*          y,
                                  hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, nnz, xVal, xInd, y, idxBase);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_csctr((rocsparse_handle)handle,
                         nnz,
@@ -1424,6 +2125,8 @@ hipsparseStatus_t hipsparseZsctr(hipsparseHandle_t       handle,
                                  hipDoubleComplex*       y,
                                  hipsparseIndexBase_t    idxBase)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, nnz, xVal, xInd, y, idxBase);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zsctr((rocsparse_handle)handle,
                         nnz,
@@ -1447,6 +2150,20 @@ hipsparseStatus_t hipsparseScsrmv(hipsparseHandle_t         handle,
                                   const float*              beta,
                                   float*                    y)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          transA,
+                          m,
+                          n,
+                          nnz,
+                          alpha,
+                          descrA,
+                          csrSortedValA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          x,
+                          beta,
+                          y);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_scsrmv((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
@@ -1478,6 +2195,20 @@ hipsparseStatus_t hipsparseDcsrmv(hipsparseHandle_t         handle,
                                   const double*             beta,
                                   double*                   y)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          transA,
+                          m,
+                          n,
+                          nnz,
+                          alpha,
+                          descrA,
+                          csrSortedValA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          x,
+                          beta,
+                          y);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dcsrmv((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
@@ -1509,6 +2240,20 @@ hipsparseStatus_t hipsparseCcsrmv(hipsparseHandle_t         handle,
                                   const hipComplex*         beta,
                                   hipComplex*               y)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          transA,
+                          m,
+                          n,
+                          nnz,
+                          alpha,
+                          descrA,
+                          csrSortedValA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          x,
+                          beta,
+                          y);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_ccsrmv((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
@@ -1540,6 +2285,20 @@ hipsparseStatus_t hipsparseZcsrmv(hipsparseHandle_t         handle,
                                   const hipDoubleComplex*   beta,
                                   hipDoubleComplex*         y)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          transA,
+                          m,
+                          n,
+                          nnz,
+                          alpha,
+                          descrA,
+                          csrSortedValA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          x,
+                          beta,
+                          y);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrmv((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
@@ -1560,6 +2319,8 @@ hipsparseStatus_t hipsparseZcsrmv(hipsparseHandle_t         handle,
 hipsparseStatus_t
     hipsparseXcsrsv2_zeroPivot(hipsparseHandle_t handle, csrsv2Info_t info, int* position)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, info, position);
+
     // Obtain stream, to explicitly sync (cusparse csrsv2_zeropivot is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -1569,7 +2330,7 @@ hipsparseStatus_t
         (rocsparse_handle)handle, nullptr, (rocsparse_mat_info)info, position));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::syncStream(handle, stream, true));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -1585,6 +2346,17 @@ hipsparseStatus_t hipsparseScsrsv2_bufferSize(hipsparseHandle_t         handle,
                                               csrsv2Info_t              info,
                                               int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          transA,
+                          m,
+                          nnz,
+                          descrA,
+                          csrSortedValA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          info,
+                          pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -1620,6 +2392,17 @@ hipsparseStatus_t hipsparseDcsrsv2_bufferSize(hipsparseHandle_t         handle,
                                               csrsv2Info_t              info,
                                               int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          transA,
+                          m,
+                          nnz,
+                          descrA,
+                          csrSortedValA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          info,
+                          pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -1655,6 +2438,17 @@ hipsparseStatus_t hipsparseCcsrsv2_bufferSize(hipsparseHandle_t         handle,
                                               csrsv2Info_t              info,
                                               int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          transA,
+                          m,
+                          nnz,
+                          descrA,
+                          csrSortedValA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          info,
+                          pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -1690,6 +2484,17 @@ hipsparseStatus_t hipsparseZcsrsv2_bufferSize(hipsparseHandle_t         handle,
                                               csrsv2Info_t              info,
                                               int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          transA,
+                          m,
+                          nnz,
+                          descrA,
+                          csrSortedValA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          info,
+                          pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -1725,6 +2530,17 @@ hipsparseStatus_t hipsparseScsrsv2_bufferSizeExt(hipsparseHandle_t         handl
                                                  csrsv2Info_t              info,
                                                  size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          transA,
+                          m,
+                          nnz,
+                          descrA,
+                          csrSortedValA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          info,
+                          pBufferSizeInBytes);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_scsrsv_buffer_size((rocsparse_handle)handle,
                                      hipsparse::hipOperationToHCCOperation(transA),
@@ -1749,6 +2565,17 @@ hipsparseStatus_t hipsparseDcsrsv2_bufferSizeExt(hipsparseHandle_t         handl
                                                  csrsv2Info_t              info,
                                                  size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          transA,
+                          m,
+                          nnz,
+                          descrA,
+                          csrSortedValA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          info,
+                          pBufferSizeInBytes);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dcsrsv_buffer_size((rocsparse_handle)handle,
                                      hipsparse::hipOperationToHCCOperation(transA),
@@ -1773,6 +2600,17 @@ hipsparseStatus_t hipsparseCcsrsv2_bufferSizeExt(hipsparseHandle_t         handl
                                                  csrsv2Info_t              info,
                                                  size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          transA,
+                          m,
+                          nnz,
+                          descrA,
+                          csrSortedValA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          info,
+                          pBufferSizeInBytes);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_ccsrsv_buffer_size((rocsparse_handle)handle,
                                      hipsparse::hipOperationToHCCOperation(transA),
@@ -1797,6 +2635,17 @@ hipsparseStatus_t hipsparseZcsrsv2_bufferSizeExt(hipsparseHandle_t         handl
                                                  csrsv2Info_t              info,
                                                  size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          transA,
+                          m,
+                          nnz,
+                          descrA,
+                          csrSortedValA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          info,
+                          pBufferSizeInBytes);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrsv_buffer_size((rocsparse_handle)handle,
                                      hipsparse::hipOperationToHCCOperation(transA),
@@ -1822,6 +2671,18 @@ hipsparseStatus_t hipsparseScsrsv2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          transA,
+                          m,
+                          nnz,
+                          descrA,
+                          csrSortedValA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          info,
+                          policy,
+                          pBuffer);
+
     // Obtain stream, to explicitly sync (cusparse csrsv2_analysis is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -1842,7 +2703,7 @@ hipsparseStatus_t hipsparseScsrsv2_analysis(hipsparseHandle_t         handle,
                                   pBuffer));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::syncStream(handle, stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -1859,6 +2720,18 @@ hipsparseStatus_t hipsparseDcsrsv2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          transA,
+                          m,
+                          nnz,
+                          descrA,
+                          csrSortedValA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          info,
+                          policy,
+                          pBuffer);
+
     // Obtain stream, to explicitly sync (cusparse csrsv2_analysis is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -1879,7 +2752,7 @@ hipsparseStatus_t hipsparseDcsrsv2_analysis(hipsparseHandle_t         handle,
                                   pBuffer));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::syncStream(handle, stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -1896,6 +2769,18 @@ hipsparseStatus_t hipsparseCcsrsv2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          transA,
+                          m,
+                          nnz,
+                          descrA,
+                          csrSortedValA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          info,
+                          policy,
+                          pBuffer);
+
     // Obtain stream, to explicitly sync (cusparse csrsv2_analysis is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -1916,7 +2801,7 @@ hipsparseStatus_t hipsparseCcsrsv2_analysis(hipsparseHandle_t         handle,
                                   pBuffer));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::syncStream(handle, stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -1933,6 +2818,18 @@ hipsparseStatus_t hipsparseZcsrsv2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          transA,
+                          m,
+                          nnz,
+                          descrA,
+                          csrSortedValA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          info,
+                          policy,
+                          pBuffer);
+
     // Obtain stream, to explicitly sync (cusparse csrsv2_analysis is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -1953,7 +2850,7 @@ hipsparseStatus_t hipsparseZcsrsv2_analysis(hipsparseHandle_t         handle,
                                   pBuffer));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::syncStream(handle, stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -1973,6 +2870,21 @@ hipsparseStatus_t hipsparseScsrsv2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          transA,
+                          m,
+                          nnz,
+                          alpha,
+                          descrA,
+                          csrSortedValA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          info,
+                          f,
+                          x,
+                          policy,
+                          pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_scsrsv_solve((rocsparse_handle)handle,
                                hipsparse::hipOperationToHCCOperation(transA),
@@ -2005,6 +2917,21 @@ hipsparseStatus_t hipsparseDcsrsv2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          transA,
+                          m,
+                          nnz,
+                          alpha,
+                          descrA,
+                          csrSortedValA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          info,
+                          f,
+                          x,
+                          policy,
+                          pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dcsrsv_solve((rocsparse_handle)handle,
                                hipsparse::hipOperationToHCCOperation(transA),
@@ -2037,6 +2964,21 @@ hipsparseStatus_t hipsparseCcsrsv2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          transA,
+                          m,
+                          nnz,
+                          alpha,
+                          descrA,
+                          csrSortedValA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          info,
+                          f,
+                          x,
+                          policy,
+                          pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_ccsrsv_solve((rocsparse_handle)handle,
                                hipsparse::hipOperationToHCCOperation(transA),
@@ -2069,6 +3011,21 @@ hipsparseStatus_t hipsparseZcsrsv2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          transA,
+                          m,
+                          nnz,
+                          alpha,
+                          descrA,
+                          csrSortedValA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          info,
+                          f,
+                          x,
+                          policy,
+                          pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrsv_solve((rocsparse_handle)handle,
                                hipsparse::hipOperationToHCCOperation(transA),
@@ -2095,6 +3052,8 @@ hipsparseStatus_t hipsparseShybmv(hipsparseHandle_t         handle,
                                   const float*              beta,
                                   float*                    y)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, transA, alpha, descrA, hybA, x, beta, y);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_shybmv((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
@@ -2115,6 +3074,8 @@ hipsparseStatus_t hipsparseDhybmv(hipsparseHandle_t         handle,
                                   const double*             beta,
                                   double*                   y)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, transA, alpha, descrA, hybA, x, beta, y);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dhybmv((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
@@ -2135,6 +3096,8 @@ hipsparseStatus_t hipsparseChybmv(hipsparseHandle_t         handle,
                                   const hipComplex*         beta,
                                   hipComplex*               y)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, transA, alpha, descrA, hybA, x, beta, y);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_chybmv((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
@@ -2155,6 +3118,8 @@ hipsparseStatus_t hipsparseZhybmv(hipsparseHandle_t         handle,
                                   const hipDoubleComplex*   beta,
                                   hipDoubleComplex*         y)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, transA, alpha, descrA, hybA, x, beta, y);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zhybmv((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
@@ -2182,6 +3147,22 @@ hipsparseStatus_t hipsparseSbsrmv(hipsparseHandle_t         handle,
                                   const float*              beta,
                                   float*                    y)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dirA,
+                          transA,
+                          mb,
+                          nb,
+                          nnzb,
+                          alpha,
+                          descrA,
+                          bsrSortedValA,
+                          bsrSortedRowPtrA,
+                          bsrSortedColIndA,
+                          blockDim,
+                          x,
+                          beta,
+                          y);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sbsrmv((rocsparse_handle)handle,
                          hipsparse::hipDirectionToHCCDirection(dirA),
@@ -2217,6 +3198,22 @@ hipsparseStatus_t hipsparseDbsrmv(hipsparseHandle_t         handle,
                                   const double*             beta,
                                   double*                   y)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dirA,
+                          transA,
+                          mb,
+                          nb,
+                          nnzb,
+                          alpha,
+                          descrA,
+                          bsrSortedValA,
+                          bsrSortedRowPtrA,
+                          bsrSortedColIndA,
+                          blockDim,
+                          x,
+                          beta,
+                          y);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dbsrmv((rocsparse_handle)handle,
                          hipsparse::hipDirectionToHCCDirection(dirA),
@@ -2252,6 +3249,22 @@ hipsparseStatus_t hipsparseCbsrmv(hipsparseHandle_t         handle,
                                   const hipComplex*         beta,
                                   hipComplex*               y)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dirA,
+                          transA,
+                          mb,
+                          nb,
+                          nnzb,
+                          alpha,
+                          descrA,
+                          bsrSortedValA,
+                          bsrSortedRowPtrA,
+                          bsrSortedColIndA,
+                          blockDim,
+                          x,
+                          beta,
+                          y);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_cbsrmv((rocsparse_handle)handle,
                          hipsparse::hipDirectionToHCCDirection(dirA),
@@ -2287,6 +3300,22 @@ hipsparseStatus_t hipsparseZbsrmv(hipsparseHandle_t         handle,
                                   const hipDoubleComplex*   beta,
                                   hipDoubleComplex*         y)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dirA,
+                          transA,
+                          mb,
+                          nb,
+                          nnzb,
+                          alpha,
+                          descrA,
+                          bsrSortedValA,
+                          bsrSortedRowPtrA,
+                          bsrSortedColIndA,
+                          blockDim,
+                          x,
+                          beta,
+                          y);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zbsrmv((rocsparse_handle)handle,
                          hipsparse::hipDirectionToHCCDirection(dirA),
@@ -2325,6 +3354,25 @@ hipsparseStatus_t hipsparseSbsrxmv(hipsparseHandle_t         handle,
                                    const float*              beta,
                                    float*                    y)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dir,
+                          trans,
+                          sizeOfMask,
+                          mb,
+                          nb,
+                          nnzb,
+                          alpha,
+                          descr,
+                          bsrVal,
+                          bsrMaskPtr,
+                          bsrRowPtr,
+                          bsrEndPtr,
+                          bsrColInd,
+                          blockDim,
+                          x,
+                          beta,
+                          y);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sbsrxmv((rocsparse_handle)handle,
                           hipsparse::hipDirectionToHCCDirection(dir),
@@ -2365,6 +3413,25 @@ hipsparseStatus_t hipsparseDbsrxmv(hipsparseHandle_t         handle,
                                    const double*             beta,
                                    double*                   y)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dir,
+                          trans,
+                          sizeOfMask,
+                          mb,
+                          nb,
+                          nnzb,
+                          alpha,
+                          descr,
+                          bsrVal,
+                          bsrMaskPtr,
+                          bsrRowPtr,
+                          bsrEndPtr,
+                          bsrColInd,
+                          blockDim,
+                          x,
+                          beta,
+                          y);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dbsrxmv((rocsparse_handle)handle,
                           hipsparse::hipDirectionToHCCDirection(dir),
@@ -2405,6 +3472,25 @@ hipsparseStatus_t hipsparseCbsrxmv(hipsparseHandle_t         handle,
                                    const hipComplex*         beta,
                                    hipComplex*               y)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dir,
+                          trans,
+                          sizeOfMask,
+                          mb,
+                          nb,
+                          nnzb,
+                          alpha,
+                          descr,
+                          bsrVal,
+                          bsrMaskPtr,
+                          bsrRowPtr,
+                          bsrEndPtr,
+                          bsrColInd,
+                          blockDim,
+                          x,
+                          beta,
+                          y);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_cbsrxmv((rocsparse_handle)handle,
                           hipsparse::hipDirectionToHCCDirection(dir),
@@ -2445,6 +3531,25 @@ hipsparseStatus_t hipsparseZbsrxmv(hipsparseHandle_t         handle,
                                    const hipDoubleComplex*   beta,
                                    hipDoubleComplex*         y)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dir,
+                          trans,
+                          sizeOfMask,
+                          mb,
+                          nb,
+                          nnzb,
+                          alpha,
+                          descr,
+                          bsrVal,
+                          bsrMaskPtr,
+                          bsrRowPtr,
+                          bsrEndPtr,
+                          bsrColInd,
+                          blockDim,
+                          x,
+                          beta,
+                          y);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zbsrxmv((rocsparse_handle)handle,
                           hipsparse::hipDirectionToHCCDirection(dir),
@@ -2469,6 +3574,8 @@ hipsparseStatus_t hipsparseZbsrxmv(hipsparseHandle_t         handle,
 hipsparseStatus_t
     hipsparseXbsrsv2_zeroPivot(hipsparseHandle_t handle, bsrsv2Info_t info, int* position)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, info, position);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_bsrsv_zero_pivot((rocsparse_handle)handle, (rocsparse_mat_info)info, position));
 }
@@ -2486,6 +3593,19 @@ hipsparseStatus_t hipsparseSbsrsv2_bufferSize(hipsparseHandle_t         handle,
                                               bsrsv2Info_t              info,
                                               int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dir,
+                          transA,
+                          mb,
+                          nnzb,
+                          descrA,
+                          bsrSortedValA,
+                          bsrSortedRowPtrA,
+                          bsrSortedColIndA,
+                          blockDim,
+                          info,
+                          pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -2525,6 +3645,19 @@ hipsparseStatus_t hipsparseDbsrsv2_bufferSize(hipsparseHandle_t         handle,
                                               bsrsv2Info_t              info,
                                               int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dir,
+                          transA,
+                          mb,
+                          nnzb,
+                          descrA,
+                          bsrSortedValA,
+                          bsrSortedRowPtrA,
+                          bsrSortedColIndA,
+                          blockDim,
+                          info,
+                          pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -2564,6 +3697,19 @@ hipsparseStatus_t hipsparseCbsrsv2_bufferSize(hipsparseHandle_t         handle,
                                               bsrsv2Info_t              info,
                                               int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dir,
+                          transA,
+                          mb,
+                          nnzb,
+                          descrA,
+                          bsrSortedValA,
+                          bsrSortedRowPtrA,
+                          bsrSortedColIndA,
+                          blockDim,
+                          info,
+                          pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -2603,6 +3749,19 @@ hipsparseStatus_t hipsparseZbsrsv2_bufferSize(hipsparseHandle_t         handle,
                                               bsrsv2Info_t              info,
                                               int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dir,
+                          transA,
+                          mb,
+                          nnzb,
+                          descrA,
+                          bsrSortedValA,
+                          bsrSortedRowPtrA,
+                          bsrSortedColIndA,
+                          blockDim,
+                          info,
+                          pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -2642,6 +3801,19 @@ hipsparseStatus_t hipsparseSbsrsv2_bufferSizeExt(hipsparseHandle_t         handl
                                                  bsrsv2Info_t              info,
                                                  size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dir,
+                          transA,
+                          mb,
+                          nnzb,
+                          descrA,
+                          bsrSortedValA,
+                          bsrSortedRowPtrA,
+                          bsrSortedColIndA,
+                          blockDim,
+                          info,
+                          pBufferSizeInBytes);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sbsrsv_buffer_size((rocsparse_handle)handle,
                                      hipsparse::hipDirectionToHCCDirection(dir),
@@ -2670,6 +3842,19 @@ hipsparseStatus_t hipsparseDbsrsv2_bufferSizeExt(hipsparseHandle_t         handl
                                                  bsrsv2Info_t              info,
                                                  size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dir,
+                          transA,
+                          mb,
+                          nnzb,
+                          descrA,
+                          bsrSortedValA,
+                          bsrSortedRowPtrA,
+                          bsrSortedColIndA,
+                          blockDim,
+                          info,
+                          pBufferSizeInBytes);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dbsrsv_buffer_size((rocsparse_handle)handle,
                                      hipsparse::hipDirectionToHCCDirection(dir),
@@ -2698,6 +3883,19 @@ hipsparseStatus_t hipsparseCbsrsv2_bufferSizeExt(hipsparseHandle_t         handl
                                                  bsrsv2Info_t              info,
                                                  size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dir,
+                          transA,
+                          mb,
+                          nnzb,
+                          descrA,
+                          bsrSortedValA,
+                          bsrSortedRowPtrA,
+                          bsrSortedColIndA,
+                          blockDim,
+                          info,
+                          pBufferSizeInBytes);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_cbsrsv_buffer_size((rocsparse_handle)handle,
                                      hipsparse::hipDirectionToHCCDirection(dir),
@@ -2726,6 +3924,19 @@ hipsparseStatus_t hipsparseZbsrsv2_bufferSizeExt(hipsparseHandle_t         handl
                                                  bsrsv2Info_t              info,
                                                  size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dir,
+                          transA,
+                          mb,
+                          nnzb,
+                          descrA,
+                          bsrSortedValA,
+                          bsrSortedRowPtrA,
+                          bsrSortedColIndA,
+                          blockDim,
+                          info,
+                          pBufferSizeInBytes);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zbsrsv_buffer_size((rocsparse_handle)handle,
                                      hipsparse::hipDirectionToHCCDirection(dir),
@@ -2755,6 +3966,20 @@ hipsparseStatus_t hipsparseSbsrsv2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dir,
+                          transA,
+                          mb,
+                          nnzb,
+                          descrA,
+                          bsrSortedValA,
+                          bsrSortedRowPtrA,
+                          bsrSortedColIndA,
+                          blockDim,
+                          info,
+                          policy,
+                          pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sbsrsv_analysis((rocsparse_handle)handle,
                                   hipsparse::hipDirectionToHCCDirection(dir),
@@ -2786,6 +4011,20 @@ hipsparseStatus_t hipsparseDbsrsv2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dir,
+                          transA,
+                          mb,
+                          nnzb,
+                          descrA,
+                          bsrSortedValA,
+                          bsrSortedRowPtrA,
+                          bsrSortedColIndA,
+                          blockDim,
+                          info,
+                          policy,
+                          pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dbsrsv_analysis((rocsparse_handle)handle,
                                   hipsparse::hipDirectionToHCCDirection(dir),
@@ -2817,6 +4056,20 @@ hipsparseStatus_t hipsparseCbsrsv2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dir,
+                          transA,
+                          mb,
+                          nnzb,
+                          descrA,
+                          bsrSortedValA,
+                          bsrSortedRowPtrA,
+                          bsrSortedColIndA,
+                          blockDim,
+                          info,
+                          policy,
+                          pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_cbsrsv_analysis((rocsparse_handle)handle,
                                   hipsparse::hipDirectionToHCCDirection(dir),
@@ -2848,6 +4101,20 @@ hipsparseStatus_t hipsparseZbsrsv2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dir,
+                          transA,
+                          mb,
+                          nnzb,
+                          descrA,
+                          bsrSortedValA,
+                          bsrSortedRowPtrA,
+                          bsrSortedColIndA,
+                          blockDim,
+                          info,
+                          policy,
+                          pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zbsrsv_analysis((rocsparse_handle)handle,
                                   hipsparse::hipDirectionToHCCDirection(dir),
@@ -2882,6 +4149,23 @@ hipsparseStatus_t hipsparseSbsrsv2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dir,
+                          transA,
+                          mb,
+                          nnzb,
+                          alpha,
+                          descrA,
+                          bsrSortedValA,
+                          bsrSortedRowPtrA,
+                          bsrSortedColIndA,
+                          blockDim,
+                          info,
+                          f,
+                          x,
+                          policy,
+                          pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sbsrsv_solve((rocsparse_handle)handle,
                                hipsparse::hipDirectionToHCCDirection(dir),
@@ -2918,6 +4202,23 @@ hipsparseStatus_t hipsparseDbsrsv2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dir,
+                          transA,
+                          mb,
+                          nnzb,
+                          alpha,
+                          descrA,
+                          bsrSortedValA,
+                          bsrSortedRowPtrA,
+                          bsrSortedColIndA,
+                          blockDim,
+                          info,
+                          f,
+                          x,
+                          policy,
+                          pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dbsrsv_solve((rocsparse_handle)handle,
                                hipsparse::hipDirectionToHCCDirection(dir),
@@ -2954,6 +4255,23 @@ hipsparseStatus_t hipsparseCbsrsv2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dir,
+                          transA,
+                          mb,
+                          nnzb,
+                          alpha,
+                          descrA,
+                          bsrSortedValA,
+                          bsrSortedRowPtrA,
+                          bsrSortedColIndA,
+                          blockDim,
+                          info,
+                          f,
+                          x,
+                          policy,
+                          pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_cbsrsv_solve((rocsparse_handle)handle,
                                hipsparse::hipDirectionToHCCDirection(dir),
@@ -2990,6 +4308,23 @@ hipsparseStatus_t hipsparseZbsrsv2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dir,
+                          transA,
+                          mb,
+                          nnzb,
+                          alpha,
+                          descrA,
+                          bsrSortedValA,
+                          bsrSortedRowPtrA,
+                          bsrSortedColIndA,
+                          blockDim,
+                          info,
+                          f,
+                          x,
+                          policy,
+                          pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zbsrsv_solve((rocsparse_handle)handle,
                                hipsparse::hipDirectionToHCCDirection(dir),
@@ -3016,6 +4351,8 @@ hipsparseStatus_t hipsparseSgemvi_bufferSize(hipsparseHandle_t    handle,
                                              int                  nnz,
                                              int*                 pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, transA, m, n, nnz, pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -3043,6 +4380,8 @@ hipsparseStatus_t hipsparseDgemvi_bufferSize(hipsparseHandle_t    handle,
                                              int                  nnz,
                                              int*                 pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, transA, m, n, nnz, pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -3070,6 +4409,8 @@ hipsparseStatus_t hipsparseCgemvi_bufferSize(hipsparseHandle_t    handle,
                                              int                  nnz,
                                              int*                 pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, transA, m, n, nnz, pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -3097,6 +4438,8 @@ hipsparseStatus_t hipsparseZgemvi_bufferSize(hipsparseHandle_t    handle,
                                              int                  nnz,
                                              int*                 pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, transA, m, n, nnz, pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -3132,6 +4475,9 @@ hipsparseStatus_t hipsparseSgemvi(hipsparseHandle_t    handle,
                                   hipsparseIndexBase_t idxBase,
                                   void*                pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(
+        handle, transA, m, n, alpha, A, lda, nnz, x, xInd, beta, y, idxBase, pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sgemvi((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
@@ -3164,6 +4510,9 @@ hipsparseStatus_t hipsparseDgemvi(hipsparseHandle_t    handle,
                                   hipsparseIndexBase_t idxBase,
                                   void*                pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(
+        handle, transA, m, n, alpha, A, lda, nnz, x, xInd, beta, y, idxBase, pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dgemvi((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
@@ -3196,6 +4545,9 @@ hipsparseStatus_t hipsparseCgemvi(hipsparseHandle_t    handle,
                                   hipsparseIndexBase_t idxBase,
                                   void*                pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(
+        handle, transA, m, n, alpha, A, lda, nnz, x, xInd, beta, y, idxBase, pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_cgemvi((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
@@ -3228,6 +4580,9 @@ hipsparseStatus_t hipsparseZgemvi(hipsparseHandle_t       handle,
                                   hipsparseIndexBase_t    idxBase,
                                   void*                   pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(
+        handle, transA, m, n, alpha, A, lda, nnz, x, xInd, beta, y, idxBase, pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zgemvi((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
@@ -3265,6 +4620,26 @@ hipsparseStatus_t hipsparseSbsrmm(hipsparseHandle_t         handle,
                                   float*                    C,
                                   int                       ldc)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dirA,
+                          transA,
+                          transB,
+                          mb,
+                          n,
+                          kb,
+                          nnzb,
+                          alpha,
+                          descrA,
+                          bsrValA,
+                          bsrRowPtrA,
+                          bsrColIndA,
+                          blockDim,
+                          B,
+                          ldb,
+                          beta,
+                          C,
+                          ldc);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sbsrmm((rocsparse_handle)handle,
                          hipsparse::hipDirectionToHCCDirection(dirA),
@@ -3307,6 +4682,26 @@ hipsparseStatus_t hipsparseDbsrmm(hipsparseHandle_t         handle,
                                   double*                   C,
                                   int                       ldc)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dirA,
+                          transA,
+                          transB,
+                          mb,
+                          n,
+                          kb,
+                          nnzb,
+                          alpha,
+                          descrA,
+                          bsrValA,
+                          bsrRowPtrA,
+                          bsrColIndA,
+                          blockDim,
+                          B,
+                          ldb,
+                          beta,
+                          C,
+                          ldc);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dbsrmm((rocsparse_handle)handle,
                          hipsparse::hipDirectionToHCCDirection(dirA),
@@ -3349,6 +4744,26 @@ hipsparseStatus_t hipsparseCbsrmm(hipsparseHandle_t         handle,
                                   hipComplex*               C,
                                   int                       ldc)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dirA,
+                          transA,
+                          transB,
+                          mb,
+                          n,
+                          kb,
+                          nnzb,
+                          alpha,
+                          descrA,
+                          bsrValA,
+                          bsrRowPtrA,
+                          bsrColIndA,
+                          blockDim,
+                          B,
+                          ldb,
+                          beta,
+                          C,
+                          ldc);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_cbsrmm((rocsparse_handle)handle,
                          hipsparse::hipDirectionToHCCDirection(dirA),
@@ -3391,6 +4806,26 @@ hipsparseStatus_t hipsparseZbsrmm(hipsparseHandle_t         handle,
                                   hipDoubleComplex*         C,
                                   int                       ldc)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dirA,
+                          transA,
+                          transB,
+                          mb,
+                          n,
+                          kb,
+                          nnzb,
+                          alpha,
+                          descrA,
+                          bsrValA,
+                          bsrRowPtrA,
+                          bsrColIndA,
+                          blockDim,
+                          B,
+                          ldb,
+                          beta,
+                          C,
+                          ldc);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zbsrmm((rocsparse_handle)handle,
                          hipsparse::hipDirectionToHCCDirection(dirA),
@@ -3430,6 +4865,23 @@ hipsparseStatus_t hipsparseScsrmm(hipsparseHandle_t         handle,
                                   float*                    C,
                                   int                       ldc)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          transA,
+                          m,
+                          n,
+                          k,
+                          nnz,
+                          alpha,
+                          descrA,
+                          csrSortedValA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          B,
+                          ldb,
+                          beta,
+                          C,
+                          ldc);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_scsrmm((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
@@ -3467,6 +4919,23 @@ hipsparseStatus_t hipsparseDcsrmm(hipsparseHandle_t         handle,
                                   double*                   C,
                                   int                       ldc)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          transA,
+                          m,
+                          n,
+                          k,
+                          nnz,
+                          alpha,
+                          descrA,
+                          csrSortedValA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          B,
+                          ldb,
+                          beta,
+                          C,
+                          ldc);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dcsrmm((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
@@ -3504,6 +4973,23 @@ hipsparseStatus_t hipsparseCcsrmm(hipsparseHandle_t         handle,
                                   hipComplex*               C,
                                   int                       ldc)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          transA,
+                          m,
+                          n,
+                          k,
+                          nnz,
+                          alpha,
+                          descrA,
+                          csrSortedValA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          B,
+                          ldb,
+                          beta,
+                          C,
+                          ldc);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_ccsrmm((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
@@ -3541,6 +5027,23 @@ hipsparseStatus_t hipsparseZcsrmm(hipsparseHandle_t         handle,
                                   hipDoubleComplex*         C,
                                   int                       ldc)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          transA,
+                          m,
+                          n,
+                          k,
+                          nnz,
+                          alpha,
+                          descrA,
+                          csrSortedValA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          B,
+                          ldb,
+                          beta,
+                          C,
+                          ldc);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrmm((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
@@ -3579,6 +5082,24 @@ hipsparseStatus_t hipsparseScsrmm2(hipsparseHandle_t         handle,
                                    float*                    C,
                                    int                       ldc)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          transA,
+                          transB,
+                          m,
+                          n,
+                          k,
+                          nnz,
+                          alpha,
+                          descrA,
+                          csrSortedValA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          B,
+                          ldb,
+                          beta,
+                          C,
+                          ldc);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_scsrmm((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
@@ -3617,6 +5138,24 @@ hipsparseStatus_t hipsparseDcsrmm2(hipsparseHandle_t         handle,
                                    double*                   C,
                                    int                       ldc)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          transA,
+                          transB,
+                          m,
+                          n,
+                          k,
+                          nnz,
+                          alpha,
+                          descrA,
+                          csrSortedValA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          B,
+                          ldb,
+                          beta,
+                          C,
+                          ldc);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dcsrmm((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
@@ -3655,6 +5194,24 @@ hipsparseStatus_t hipsparseCcsrmm2(hipsparseHandle_t         handle,
                                    hipComplex*               C,
                                    int                       ldc)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          transA,
+                          transB,
+                          m,
+                          n,
+                          k,
+                          nnz,
+                          alpha,
+                          descrA,
+                          csrSortedValA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          B,
+                          ldb,
+                          beta,
+                          C,
+                          ldc);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_ccsrmm((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
@@ -3693,6 +5250,24 @@ hipsparseStatus_t hipsparseZcsrmm2(hipsparseHandle_t         handle,
                                    hipDoubleComplex*         C,
                                    int                       ldc)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          transA,
+                          transB,
+                          m,
+                          n,
+                          k,
+                          nnz,
+                          alpha,
+                          descrA,
+                          csrSortedValA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          B,
+                          ldb,
+                          beta,
+                          C,
+                          ldc);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrmm((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
@@ -3716,6 +5291,8 @@ hipsparseStatus_t hipsparseZcsrmm2(hipsparseHandle_t         handle,
 hipsparseStatus_t
     hipsparseXbsrsm2_zeroPivot(hipsparseHandle_t handle, bsrsm2Info_t info, int* position)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, info, position);
+
     // Obtain stream, to explicitly sync (cusparse bsrsm2_zeropivot is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -3725,7 +5302,7 @@ hipsparseStatus_t
         rocsparse_bsrsm_zero_pivot((rocsparse_handle)handle, (rocsparse_mat_info)info, position));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::syncStream(handle, stream, true));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -3745,6 +5322,21 @@ hipsparseStatus_t hipsparseSbsrsm2_bufferSize(hipsparseHandle_t         handle,
                                               bsrsm2Info_t              info,
                                               int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dirA,
+                          transA,
+                          transX,
+                          mb,
+                          nrhs,
+                          nnzb,
+                          descrA,
+                          bsrSortedValA,
+                          bsrSortedRowPtrA,
+                          bsrSortedColIndA,
+                          blockDim,
+                          info,
+                          pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -3788,6 +5380,21 @@ hipsparseStatus_t hipsparseDbsrsm2_bufferSize(hipsparseHandle_t         handle,
                                               bsrsm2Info_t              info,
                                               int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dirA,
+                          transA,
+                          transX,
+                          mb,
+                          nrhs,
+                          nnzb,
+                          descrA,
+                          bsrSortedValA,
+                          bsrSortedRowPtrA,
+                          bsrSortedColIndA,
+                          blockDim,
+                          info,
+                          pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -3831,6 +5438,21 @@ hipsparseStatus_t hipsparseCbsrsm2_bufferSize(hipsparseHandle_t         handle,
                                               bsrsm2Info_t              info,
                                               int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dirA,
+                          transA,
+                          transX,
+                          mb,
+                          nrhs,
+                          nnzb,
+                          descrA,
+                          bsrSortedValA,
+                          bsrSortedRowPtrA,
+                          bsrSortedColIndA,
+                          blockDim,
+                          info,
+                          pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -3874,6 +5496,21 @@ hipsparseStatus_t hipsparseZbsrsm2_bufferSize(hipsparseHandle_t         handle,
                                               bsrsm2Info_t              info,
                                               int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dirA,
+                          transA,
+                          transX,
+                          mb,
+                          nrhs,
+                          nnzb,
+                          descrA,
+                          bsrSortedValA,
+                          bsrSortedRowPtrA,
+                          bsrSortedColIndA,
+                          blockDim,
+                          info,
+                          pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -3918,6 +5555,22 @@ hipsparseStatus_t hipsparseSbsrsm2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dirA,
+                          transA,
+                          transX,
+                          mb,
+                          nrhs,
+                          nnzb,
+                          descrA,
+                          bsrSortedValA,
+                          bsrSortedRowPtrA,
+                          bsrSortedColIndA,
+                          blockDim,
+                          info,
+                          policy,
+                          pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sbsrsm_analysis((rocsparse_handle)handle,
                                   hipsparse::hipDirectionToHCCDirection(dirA),
@@ -3953,6 +5606,22 @@ hipsparseStatus_t hipsparseDbsrsm2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dirA,
+                          transA,
+                          transX,
+                          mb,
+                          nrhs,
+                          nnzb,
+                          descrA,
+                          bsrSortedValA,
+                          bsrSortedRowPtrA,
+                          bsrSortedColIndA,
+                          blockDim,
+                          info,
+                          policy,
+                          pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dbsrsm_analysis((rocsparse_handle)handle,
                                   hipsparse::hipDirectionToHCCDirection(dirA),
@@ -3988,6 +5657,22 @@ hipsparseStatus_t hipsparseCbsrsm2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dirA,
+                          transA,
+                          transX,
+                          mb,
+                          nrhs,
+                          nnzb,
+                          descrA,
+                          bsrSortedValA,
+                          bsrSortedRowPtrA,
+                          bsrSortedColIndA,
+                          blockDim,
+                          info,
+                          policy,
+                          pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_cbsrsm_analysis((rocsparse_handle)handle,
                                   hipsparse::hipDirectionToHCCDirection(dirA),
@@ -4023,6 +5708,22 @@ hipsparseStatus_t hipsparseZbsrsm2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dirA,
+                          transA,
+                          transX,
+                          mb,
+                          nrhs,
+                          nnzb,
+                          descrA,
+                          bsrSortedValA,
+                          bsrSortedRowPtrA,
+                          bsrSortedColIndA,
+                          blockDim,
+                          info,
+                          policy,
+                          pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zbsrsm_analysis((rocsparse_handle)handle,
                                   hipsparse::hipDirectionToHCCDirection(dirA),
@@ -4063,6 +5764,27 @@ hipsparseStatus_t hipsparseSbsrsm2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dirA,
+                          transA,
+                          transX,
+                          mb,
+                          nrhs,
+                          nnzb,
+                          alpha,
+                          descrA,
+                          bsrSortedValA,
+                          bsrSortedRowPtrA,
+                          bsrSortedColIndA,
+                          blockDim,
+                          info,
+                          B,
+                          ldb,
+                          X,
+                          ldx,
+                          policy,
+                          pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sbsrsm_solve((rocsparse_handle)handle,
                                hipsparse::hipDirectionToHCCDirection(dirA),
@@ -4107,6 +5829,27 @@ hipsparseStatus_t hipsparseDbsrsm2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dirA,
+                          transA,
+                          transX,
+                          mb,
+                          nrhs,
+                          nnzb,
+                          alpha,
+                          descrA,
+                          bsrSortedValA,
+                          bsrSortedRowPtrA,
+                          bsrSortedColIndA,
+                          blockDim,
+                          info,
+                          B,
+                          ldb,
+                          X,
+                          ldx,
+                          policy,
+                          pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dbsrsm_solve((rocsparse_handle)handle,
                                hipsparse::hipDirectionToHCCDirection(dirA),
@@ -4151,6 +5894,27 @@ hipsparseStatus_t hipsparseCbsrsm2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dirA,
+                          transA,
+                          transX,
+                          mb,
+                          nrhs,
+                          nnzb,
+                          alpha,
+                          descrA,
+                          bsrSortedValA,
+                          bsrSortedRowPtrA,
+                          bsrSortedColIndA,
+                          blockDim,
+                          info,
+                          B,
+                          ldb,
+                          X,
+                          ldx,
+                          policy,
+                          pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_cbsrsm_solve((rocsparse_handle)handle,
                                hipsparse::hipDirectionToHCCDirection(dirA),
@@ -4195,6 +5959,27 @@ hipsparseStatus_t hipsparseZbsrsm2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dirA,
+                          transA,
+                          transX,
+                          mb,
+                          nrhs,
+                          nnzb,
+                          alpha,
+                          descrA,
+                          bsrSortedValA,
+                          bsrSortedRowPtrA,
+                          bsrSortedColIndA,
+                          blockDim,
+                          info,
+                          B,
+                          ldb,
+                          X,
+                          ldx,
+                          policy,
+                          pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zbsrsm_solve((rocsparse_handle)handle,
                                hipsparse::hipDirectionToHCCDirection(dirA),
@@ -4221,6 +6006,8 @@ hipsparseStatus_t hipsparseZbsrsm2_solve(hipsparseHandle_t         handle,
 hipsparseStatus_t
     hipsparseXcsrsm2_zeroPivot(hipsparseHandle_t handle, csrsm2Info_t info, int* position)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, info, position);
+
     // Obtain stream, to explicitly sync (cusparse csrsm2_zeropivot is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -4230,7 +6017,7 @@ hipsparseStatus_t
         rocsparse_csrsm_zero_pivot((rocsparse_handle)handle, (rocsparse_mat_info)info, position));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::syncStream(handle, stream, true));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -4253,6 +6040,24 @@ hipsparseStatus_t hipsparseScsrsm2_bufferSizeExt(hipsparseHandle_t         handl
                                                  hipsparseSolvePolicy_t    policy,
                                                  size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          algo,
+                          transA,
+                          transB,
+                          m,
+                          nrhs,
+                          nnz,
+                          alpha,
+                          descrA,
+                          csrSortedValA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          B,
+                          ldb,
+                          info,
+                          policy,
+                          pBufferSizeInBytes);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_scsrsm_buffer_size((rocsparse_handle)handle,
                                      hipsparse::hipOperationToHCCOperation(transA),
@@ -4290,6 +6095,24 @@ hipsparseStatus_t hipsparseDcsrsm2_bufferSizeExt(hipsparseHandle_t         handl
                                                  hipsparseSolvePolicy_t    policy,
                                                  size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          algo,
+                          transA,
+                          transB,
+                          m,
+                          nrhs,
+                          nnz,
+                          alpha,
+                          descrA,
+                          csrSortedValA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          B,
+                          ldb,
+                          info,
+                          policy,
+                          pBufferSizeInBytes);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dcsrsm_buffer_size((rocsparse_handle)handle,
                                      hipsparse::hipOperationToHCCOperation(transA),
@@ -4327,6 +6150,24 @@ hipsparseStatus_t hipsparseCcsrsm2_bufferSizeExt(hipsparseHandle_t         handl
                                                  hipsparseSolvePolicy_t    policy,
                                                  size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          algo,
+                          transA,
+                          transB,
+                          m,
+                          nrhs,
+                          nnz,
+                          alpha,
+                          descrA,
+                          csrSortedValA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          B,
+                          ldb,
+                          info,
+                          policy,
+                          pBufferSizeInBytes);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_ccsrsm_buffer_size((rocsparse_handle)handle,
                                      hipsparse::hipOperationToHCCOperation(transA),
@@ -4364,6 +6205,24 @@ hipsparseStatus_t hipsparseZcsrsm2_bufferSizeExt(hipsparseHandle_t         handl
                                                  hipsparseSolvePolicy_t    policy,
                                                  size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          algo,
+                          transA,
+                          transB,
+                          m,
+                          nrhs,
+                          nnz,
+                          alpha,
+                          descrA,
+                          csrSortedValA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          B,
+                          ldb,
+                          info,
+                          policy,
+                          pBufferSizeInBytes);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrsm_buffer_size((rocsparse_handle)handle,
                                      hipsparse::hipOperationToHCCOperation(transA),
@@ -4401,6 +6260,24 @@ hipsparseStatus_t hipsparseScsrsm2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          algo,
+                          transA,
+                          transB,
+                          m,
+                          nrhs,
+                          nnz,
+                          alpha,
+                          descrA,
+                          csrSortedValA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          B,
+                          ldb,
+                          info,
+                          policy,
+                          pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_scsrsm_analysis((rocsparse_handle)handle,
                                   hipsparse::hipOperationToHCCOperation(transA),
@@ -4439,6 +6316,24 @@ hipsparseStatus_t hipsparseDcsrsm2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          algo,
+                          transA,
+                          transB,
+                          m,
+                          nrhs,
+                          nnz,
+                          alpha,
+                          descrA,
+                          csrSortedValA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          B,
+                          ldb,
+                          info,
+                          policy,
+                          pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dcsrsm_analysis((rocsparse_handle)handle,
                                   hipsparse::hipOperationToHCCOperation(transA),
@@ -4477,6 +6372,24 @@ hipsparseStatus_t hipsparseCcsrsm2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          algo,
+                          transA,
+                          transB,
+                          m,
+                          nrhs,
+                          nnz,
+                          alpha,
+                          descrA,
+                          csrSortedValA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          B,
+                          ldb,
+                          info,
+                          policy,
+                          pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_ccsrsm_analysis((rocsparse_handle)handle,
                                   hipsparse::hipOperationToHCCOperation(transA),
@@ -4515,6 +6428,24 @@ hipsparseStatus_t hipsparseZcsrsm2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          algo,
+                          transA,
+                          transB,
+                          m,
+                          nrhs,
+                          nnz,
+                          alpha,
+                          descrA,
+                          csrSortedValA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          B,
+                          ldb,
+                          info,
+                          policy,
+                          pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrsm_analysis((rocsparse_handle)handle,
                                   hipsparse::hipOperationToHCCOperation(transA),
@@ -4553,6 +6484,24 @@ hipsparseStatus_t hipsparseScsrsm2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          algo,
+                          transA,
+                          transB,
+                          m,
+                          nrhs,
+                          nnz,
+                          alpha,
+                          descrA,
+                          csrSortedValA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          B,
+                          ldb,
+                          info,
+                          policy,
+                          pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_scsrsm_solve((rocsparse_handle)handle,
                                hipsparse::hipOperationToHCCOperation(transA),
@@ -4590,6 +6539,24 @@ hipsparseStatus_t hipsparseDcsrsm2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          algo,
+                          transA,
+                          transB,
+                          m,
+                          nrhs,
+                          nnz,
+                          alpha,
+                          descrA,
+                          csrSortedValA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          B,
+                          ldb,
+                          info,
+                          policy,
+                          pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dcsrsm_solve((rocsparse_handle)handle,
                                hipsparse::hipOperationToHCCOperation(transA),
@@ -4627,6 +6594,24 @@ hipsparseStatus_t hipsparseCcsrsm2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          algo,
+                          transA,
+                          transB,
+                          m,
+                          nrhs,
+                          nnz,
+                          alpha,
+                          descrA,
+                          csrSortedValA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          B,
+                          ldb,
+                          info,
+                          policy,
+                          pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_ccsrsm_solve((rocsparse_handle)handle,
                                hipsparse::hipOperationToHCCOperation(transA),
@@ -4664,6 +6649,24 @@ hipsparseStatus_t hipsparseZcsrsm2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          algo,
+                          transA,
+                          transB,
+                          m,
+                          nrhs,
+                          nnz,
+                          alpha,
+                          descrA,
+                          csrSortedValA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          B,
+                          ldb,
+                          info,
+                          policy,
+                          pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrsm_solve((rocsparse_handle)handle,
                                hipsparse::hipOperationToHCCOperation(transA),
@@ -4698,6 +6701,9 @@ hipsparseStatus_t hipsparseSgemmi(hipsparseHandle_t handle,
                                   float*            C,
                                   int               ldc)
 {
+    HIPSPARSE_LAYER_SCOPE(
+        handle, m, n, k, nnz, alpha, A, lda, cscValB, cscColPtrB, cscRowIndB, beta, C, ldc);
+
     rocsparse_mat_descr descr;
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_mat_descr(&descr));
     hipsparseStatus_t status
@@ -4746,6 +6752,9 @@ hipsparseStatus_t hipsparseDgemmi(hipsparseHandle_t handle,
                                   double*           C,
                                   int               ldc)
 {
+    HIPSPARSE_LAYER_SCOPE(
+        handle, m, n, k, nnz, alpha, A, lda, cscValB, cscColPtrB, cscRowIndB, beta, C, ldc);
+
     rocsparse_mat_descr descr;
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_mat_descr(&descr));
     hipsparseStatus_t status
@@ -4794,6 +6803,9 @@ hipsparseStatus_t hipsparseCgemmi(hipsparseHandle_t handle,
                                   hipComplex*       C,
                                   int               ldc)
 {
+    HIPSPARSE_LAYER_SCOPE(
+        handle, m, n, k, nnz, alpha, A, lda, cscValB, cscColPtrB, cscRowIndB, beta, C, ldc);
+
     rocsparse_mat_descr descr;
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_mat_descr(&descr));
     hipsparseStatus_t status = hipsparse::rocSPARSEStatusToHIPStatus(
@@ -4842,6 +6854,9 @@ hipsparseStatus_t hipsparseZgemmi(hipsparseHandle_t       handle,
                                   hipDoubleComplex*       C,
                                   int                     ldc)
 {
+    HIPSPARSE_LAYER_SCOPE(
+        handle, m, n, k, nnz, alpha, A, lda, cscValB, cscColPtrB, cscRowIndB, beta, C, ldc);
+
     rocsparse_mat_descr descr;
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_mat_descr(&descr));
     hipsparseStatus_t status = hipsparse::rocSPARSEStatusToHIPStatus(
@@ -4890,6 +6905,21 @@ hipsparseStatus_t hipsparseXcsrgeamNnz(hipsparseHandle_t         handle,
                                        int*                      csrRowPtrC,
                                        int*                      nnzTotalDevHostPtr)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          n,
+                          descrA,
+                          nnzA,
+                          csrRowPtrA,
+                          csrColIndA,
+                          descrB,
+                          nnzB,
+                          csrRowPtrB,
+                          csrColIndB,
+                          descrC,
+                          csrRowPtrC,
+                          nnzTotalDevHostPtr);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_csrgeam_nnz((rocsparse_handle)handle,
                               m,
@@ -4927,6 +6957,26 @@ hipsparseStatus_t hipsparseScsrgeam(hipsparseHandle_t         handle,
                                     int*                      csrRowPtrC,
                                     int*                      csrColIndC)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          n,
+                          alpha,
+                          descrA,
+                          nnzA,
+                          csrValA,
+                          csrRowPtrA,
+                          csrColIndA,
+                          beta,
+                          descrB,
+                          nnzB,
+                          csrValB,
+                          csrRowPtrB,
+                          csrColIndB,
+                          descrC,
+                          csrValC,
+                          csrRowPtrC,
+                          csrColIndC);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_scsrgeam((rocsparse_handle)handle,
                            m,
@@ -4969,6 +7019,26 @@ hipsparseStatus_t hipsparseDcsrgeam(hipsparseHandle_t         handle,
                                     int*                      csrRowPtrC,
                                     int*                      csrColIndC)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          n,
+                          alpha,
+                          descrA,
+                          nnzA,
+                          csrValA,
+                          csrRowPtrA,
+                          csrColIndA,
+                          beta,
+                          descrB,
+                          nnzB,
+                          csrValB,
+                          csrRowPtrB,
+                          csrColIndB,
+                          descrC,
+                          csrValC,
+                          csrRowPtrC,
+                          csrColIndC);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dcsrgeam((rocsparse_handle)handle,
                            m,
@@ -5011,6 +7081,26 @@ hipsparseStatus_t hipsparseCcsrgeam(hipsparseHandle_t         handle,
                                     int*                      csrRowPtrC,
                                     int*                      csrColIndC)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          n,
+                          alpha,
+                          descrA,
+                          nnzA,
+                          csrValA,
+                          csrRowPtrA,
+                          csrColIndA,
+                          beta,
+                          descrB,
+                          nnzB,
+                          csrValB,
+                          csrRowPtrB,
+                          csrColIndB,
+                          descrC,
+                          csrValC,
+                          csrRowPtrC,
+                          csrColIndC);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_ccsrgeam((rocsparse_handle)handle,
                            m,
@@ -5053,6 +7143,26 @@ hipsparseStatus_t hipsparseZcsrgeam(hipsparseHandle_t         handle,
                                     int*                      csrRowPtrC,
                                     int*                      csrColIndC)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          n,
+                          alpha,
+                          descrA,
+                          nnzA,
+                          csrValA,
+                          csrRowPtrA,
+                          csrColIndA,
+                          beta,
+                          descrB,
+                          nnzB,
+                          csrValB,
+                          csrRowPtrB,
+                          csrColIndB,
+                          descrC,
+                          csrValC,
+                          csrRowPtrC,
+                          csrColIndC);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrgeam((rocsparse_handle)handle,
                            m,
@@ -5096,6 +7206,27 @@ hipsparseStatus_t hipsparseScsrgeam2_bufferSizeExt(hipsparseHandle_t         han
                                                    const int*                csrSortedColIndC,
                                                    size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          n,
+                          alpha,
+                          descrA,
+                          nnzA,
+                          csrSortedValA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          beta,
+                          descrB,
+                          nnzB,
+                          csrSortedValB,
+                          csrSortedRowPtrB,
+                          csrSortedColIndB,
+                          descrC,
+                          csrSortedValC,
+                          csrSortedRowPtrC,
+                          csrSortedColIndC,
+                          pBufferSizeInBytes);
+
     *pBufferSizeInBytes = 4;
 
     return HIPSPARSE_STATUS_SUCCESS;
@@ -5122,6 +7253,27 @@ hipsparseStatus_t hipsparseDcsrgeam2_bufferSizeExt(hipsparseHandle_t         han
                                                    const int*                csrSortedColIndC,
                                                    size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          n,
+                          alpha,
+                          descrA,
+                          nnzA,
+                          csrSortedValA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          beta,
+                          descrB,
+                          nnzB,
+                          csrSortedValB,
+                          csrSortedRowPtrB,
+                          csrSortedColIndB,
+                          descrC,
+                          csrSortedValC,
+                          csrSortedRowPtrC,
+                          csrSortedColIndC,
+                          pBufferSizeInBytes);
+
     *pBufferSizeInBytes = 4;
 
     return HIPSPARSE_STATUS_SUCCESS;
@@ -5148,6 +7300,27 @@ hipsparseStatus_t hipsparseCcsrgeam2_bufferSizeExt(hipsparseHandle_t         han
                                                    const int*                csrSortedColIndC,
                                                    size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          n,
+                          alpha,
+                          descrA,
+                          nnzA,
+                          csrSortedValA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          beta,
+                          descrB,
+                          nnzB,
+                          csrSortedValB,
+                          csrSortedRowPtrB,
+                          csrSortedColIndB,
+                          descrC,
+                          csrSortedValC,
+                          csrSortedRowPtrC,
+                          csrSortedColIndC,
+                          pBufferSizeInBytes);
+
     *pBufferSizeInBytes = 4;
 
     return HIPSPARSE_STATUS_SUCCESS;
@@ -5174,6 +7347,27 @@ hipsparseStatus_t hipsparseZcsrgeam2_bufferSizeExt(hipsparseHandle_t         han
                                                    const int*                csrSortedColIndC,
                                                    size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          n,
+                          alpha,
+                          descrA,
+                          nnzA,
+                          csrSortedValA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          beta,
+                          descrB,
+                          nnzB,
+                          csrSortedValB,
+                          csrSortedRowPtrB,
+                          csrSortedColIndB,
+                          descrC,
+                          csrSortedValC,
+                          csrSortedRowPtrC,
+                          csrSortedColIndC,
+                          pBufferSizeInBytes);
+
     *pBufferSizeInBytes = 4;
 
     return HIPSPARSE_STATUS_SUCCESS;
@@ -5195,6 +7389,22 @@ hipsparseStatus_t hipsparseXcsrgeam2Nnz(hipsparseHandle_t         handle,
                                         int*                      nnzTotalDevHostPtr,
                                         void*                     workspace)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          n,
+                          descrA,
+                          nnzA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          descrB,
+                          nnzB,
+                          csrSortedRowPtrB,
+                          csrSortedColIndB,
+                          descrC,
+                          csrSortedRowPtrC,
+                          nnzTotalDevHostPtr,
+                          workspace);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_csrgeam_nnz((rocsparse_handle)handle,
                               m,
@@ -5233,6 +7443,27 @@ hipsparseStatus_t hipsparseScsrgeam2(hipsparseHandle_t         handle,
                                      int*                      csrSortedColIndC,
                                      void*                     pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          n,
+                          alpha,
+                          descrA,
+                          nnzA,
+                          csrSortedValA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          beta,
+                          descrB,
+                          nnzB,
+                          csrSortedValB,
+                          csrSortedRowPtrB,
+                          csrSortedColIndB,
+                          descrC,
+                          csrSortedValC,
+                          csrSortedRowPtrC,
+                          csrSortedColIndC,
+                          pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_scsrgeam((rocsparse_handle)handle,
                            m,
@@ -5276,6 +7507,27 @@ hipsparseStatus_t hipsparseDcsrgeam2(hipsparseHandle_t         handle,
                                      int*                      csrSortedColIndC,
                                      void*                     pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          n,
+                          alpha,
+                          descrA,
+                          nnzA,
+                          csrSortedValA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          beta,
+                          descrB,
+                          nnzB,
+                          csrSortedValB,
+                          csrSortedRowPtrB,
+                          csrSortedColIndB,
+                          descrC,
+                          csrSortedValC,
+                          csrSortedRowPtrC,
+                          csrSortedColIndC,
+                          pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dcsrgeam((rocsparse_handle)handle,
                            m,
@@ -5319,6 +7571,27 @@ hipsparseStatus_t hipsparseCcsrgeam2(hipsparseHandle_t         handle,
                                      int*                      csrSortedColIndC,
                                      void*                     pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          n,
+                          alpha,
+                          descrA,
+                          nnzA,
+                          csrSortedValA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          beta,
+                          descrB,
+                          nnzB,
+                          csrSortedValB,
+                          csrSortedRowPtrB,
+                          csrSortedColIndB,
+                          descrC,
+                          csrSortedValC,
+                          csrSortedRowPtrC,
+                          csrSortedColIndC,
+                          pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_ccsrgeam((rocsparse_handle)handle,
                            m,
@@ -5362,6 +7635,27 @@ hipsparseStatus_t hipsparseZcsrgeam2(hipsparseHandle_t         handle,
                                      int*                      csrSortedColIndC,
                                      void*                     pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          n,
+                          alpha,
+                          descrA,
+                          nnzA,
+                          csrSortedValA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          beta,
+                          descrB,
+                          nnzB,
+                          csrSortedValB,
+                          csrSortedRowPtrB,
+                          csrSortedColIndB,
+                          descrC,
+                          csrSortedValC,
+                          csrSortedRowPtrC,
+                          csrSortedColIndC,
+                          pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrgeam((rocsparse_handle)handle,
                            m,
@@ -5402,6 +7696,24 @@ hipsparseStatus_t hipsparseXcsrgemmNnz(hipsparseHandle_t         handle,
                                        int*                      csrRowPtrC,
                                        int*                      nnzTotalDevHostPtr)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          transA,
+                          transB,
+                          m,
+                          n,
+                          k,
+                          descrA,
+                          nnzA,
+                          csrRowPtrA,
+                          csrColIndA,
+                          descrB,
+                          nnzB,
+                          csrRowPtrB,
+                          csrColIndB,
+                          descrC,
+                          csrRowPtrC,
+                          nnzTotalDevHostPtr);
+
     // Create matrix info
     rocsparse_mat_info info;
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_mat_info(&info));
@@ -5411,8 +7723,8 @@ hipsparseStatus_t hipsparseXcsrgemmNnz(hipsparseHandle_t         handle,
     void*  temp_buffer;
 
     // Initialize alpha = 1.0
-    hipDoubleComplex  one = make_hipDoubleComplex(1.0, 0.0);
-    hipDoubleComplex* alpha;
+    hipDoubleComplex  one   = make_hipDoubleComplex(1.0, 0.0);
+    hipDoubleComplex* alpha = &one;
 
     hipsparseStatus_t status;
 
@@ -5428,16 +7740,17 @@ hipsparseStatus_t hipsparseXcsrgemmNnz(hipsparseHandle_t         handle,
         return status;
     }
 
-    if(pointer_mode == rocsparse_pointer_mode_host)
-    {
-        alpha  = (hipDoubleComplex*)malloc(sizeof(hipDoubleComplex));
-        *alpha = one;
-    }
-    else
+    if(pointer_mode == rocsparse_pointer_mode_device)
     {
-        RETURN_IF_HIP_ERROR(hipMalloc((void**)&alpha, sizeof(hipDoubleComplex)));
-        RETURN_IF_HIP_ERROR(
-            hipMemcpy(alpha, &one, sizeof(hipDoubleComplex), hipMemcpyHostToDevice));
+        // Device alpha from the handle constant table
+        status = hipsparse::deviceConstant(handle, HIP_C_64F, 1, (const void**)&alpha);
+
+        if(status != HIPSPARSE_STATUS_SUCCESS)
+        {
+            rocsparse_destroy_mat_info(info);
+
+            return status;
+        }
     }
 
     // Obtain temporary buffer size
@@ -5467,22 +7780,20 @@ hipsparseStatus_t hipsparseXcsrgemmNnz(hipsparseHandle_t         handle,
 
     if(status != HIPSPARSE_STATUS_SUCCESS)
     {
-        if(pointer_mode == rocsparse_pointer_mode_host)
-        {
-            free(alpha);
-        }
-        else
-        {
-            RETURN_IF_HIP_ERROR(hipFree(alpha));
-        }
+        rocsparse_destroy_mat_info(info);
+
+        return status;
+    }
 
+    status = hipsparse::workspaceAcquire(handle, buffer_size, &temp_buffer);
+
+    if(status != HIPSPARSE_STATUS_SUCCESS)
+    {
         rocsparse_destroy_mat_info(info);
 
         return status;
     }
 
-    RETURN_IF_HIP_ERROR(hipMalloc(&temp_buffer, buffer_size));
-
     // Determine nnz
     status = hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_csrgemm_nnz((rocsparse_handle)handle,
@@ -5509,17 +7820,6 @@ hipsparseStatus_t hipsparseXcsrgemmNnz(hipsparseHandle_t         handle,
                               info,
                               temp_buffer));
 
-    if(pointer_mode == rocsparse_pointer_mode_host)
-    {
-        free(alpha);
-    }
-    else
-    {
-        RETURN_IF_HIP_ERROR(hipFree(alpha));
-    }
-
-    RETURN_IF_HIP_ERROR(hipFree(temp_buffer));
-
     if(status != HIPSPARSE_STATUS_SUCCESS)
     {
         rocsparse_destroy_mat_info(info);
@@ -5553,6 +7853,27 @@ hipsparseStatus_t hipsparseScsrgemm(hipsparseHandle_t         handle,
                                     const int*                csrRowPtrC,
                                     int*                      csrColIndC)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          transA,
+                          transB,
+                          m,
+                          n,
+                          k,
+                          descrA,
+                          nnzA,
+                          csrValA,
+                          csrRowPtrA,
+                          csrColIndA,
+                          descrB,
+                          nnzB,
+                          csrValB,
+                          csrRowPtrB,
+                          csrColIndB,
+                          descrC,
+                          csrValC,
+                          csrRowPtrC,
+                          csrColIndC);
+
     // Create matrix info
     rocsparse_mat_info info;
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_mat_info(&info));
@@ -5562,8 +7883,8 @@ hipsparseStatus_t hipsparseScsrgemm(hipsparseHandle_t         handle,
     void*  temp_buffer;
 
     // Initialize alpha = 1.0
-    float  one = 1.0f;
-    float* alpha;
+    float  one   = 1.0f;
+    float* alpha = &one;
 
     hipsparseStatus_t status;
 
@@ -5579,15 +7900,17 @@ hipsparseStatus_t hipsparseScsrgemm(hipsparseHandle_t         handle,
         return status;
     }
 
-    if(pointer_mode == rocsparse_pointer_mode_host)
-    {
-        alpha  = (float*)malloc(sizeof(float));
-        *alpha = one;
-    }
-    else
+    if(pointer_mode == rocsparse_pointer_mode_device)
     {
-        RETURN_IF_HIP_ERROR(hipMalloc((void**)&alpha, sizeof(float)));
-        RETURN_IF_HIP_ERROR(hipMemcpy(alpha, &one, sizeof(float), hipMemcpyHostToDevice));
+        // Device alpha from the handle constant table
+        status = hipsparse::deviceConstant(handle, HIP_R_32F, 1, (const void**)&alpha);
+
+        if(status != HIPSPARSE_STATUS_SUCCESS)
+        {
+            rocsparse_destroy_mat_info(info);
+
+            return status;
+        }
     }
 
     // Obtain temporary buffer size
@@ -5617,21 +7940,19 @@ hipsparseStatus_t hipsparseScsrgemm(hipsparseHandle_t         handle,
 
     if(status != HIPSPARSE_STATUS_SUCCESS)
     {
-        if(pointer_mode == rocsparse_pointer_mode_host)
-        {
-            free(alpha);
-        }
-        else
-        {
-            RETURN_IF_HIP_ERROR(hipFree(alpha));
-        }
-
         rocsparse_destroy_mat_info(info);
 
         return status;
     }
 
-    RETURN_IF_HIP_ERROR(hipMalloc(&temp_buffer, buffer_size));
+    status = hipsparse::workspaceAcquire(handle, buffer_size, &temp_buffer);
+
+    if(status != HIPSPARSE_STATUS_SUCCESS)
+    {
+        rocsparse_destroy_mat_info(info);
+
+        return status;
+    }
 
     // Perform csrgemm computation
     status = hipsparse::rocSPARSEStatusToHIPStatus(
@@ -5665,17 +7986,6 @@ hipsparseStatus_t hipsparseScsrgemm(hipsparseHandle_t         handle,
                            info,
                            temp_buffer));
 
-    if(pointer_mode == rocsparse_pointer_mode_host)
-    {
-        free(alpha);
-    }
-    else
-    {
-        RETURN_IF_HIP_ERROR(hipFree(alpha));
-    }
-
-    RETURN_IF_HIP_ERROR(hipFree(temp_buffer));
-
     if(status != HIPSPARSE_STATUS_SUCCESS)
     {
         rocsparse_destroy_mat_info(info);
@@ -5709,6 +8019,27 @@ hipsparseStatus_t hipsparseDcsrgemm(hipsparseHandle_t         handle,
                                     const int*                csrRowPtrC,
                                     int*                      csrColIndC)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          transA,
+                          transB,
+                          m,
+                          n,
+                          k,
+                          descrA,
+                          nnzA,
+                          csrValA,
+                          csrRowPtrA,
+                          csrColIndA,
+                          descrB,
+                          nnzB,
+                          csrValB,
+                          csrRowPtrB,
+                          csrColIndB,
+                          descrC,
+                          csrValC,
+                          csrRowPtrC,
+                          csrColIndC);
+
     // Create matrix info
     rocsparse_mat_info info;
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_mat_info(&info));
@@ -5718,8 +8049,8 @@ hipsparseStatus_t hipsparseDcsrgemm(hipsparseHandle_t         handle,
     void*  temp_buffer;
 
     // Initialize alpha = 1.0
-    double  one = 1.0;
-    double* alpha;
+    double  one   = 1.0;
+    double* alpha = &one;
 
     hipsparseStatus_t status;
 
@@ -5735,15 +8066,17 @@ hipsparseStatus_t hipsparseDcsrgemm(hipsparseHandle_t         handle,
         return status;
     }
 
-    if(pointer_mode == rocsparse_pointer_mode_host)
-    {
-        alpha  = (double*)malloc(sizeof(double));
-        *alpha = one;
-    }
-    else
+    if(pointer_mode == rocsparse_pointer_mode_device)
     {
-        RETURN_IF_HIP_ERROR(hipMalloc((void**)&alpha, sizeof(double)));
-        RETURN_IF_HIP_ERROR(hipMemcpy(alpha, &one, sizeof(double), hipMemcpyHostToDevice));
+        // Device alpha from the handle constant table
+        status = hipsparse::deviceConstant(handle, HIP_R_64F, 1, (const void**)&alpha);
+
+        if(status != HIPSPARSE_STATUS_SUCCESS)
+        {
+            rocsparse_destroy_mat_info(info);
+
+            return status;
+        }
     }
 
     // Obtain temporary buffer size
@@ -5773,21 +8106,19 @@ hipsparseStatus_t hipsparseDcsrgemm(hipsparseHandle_t         handle,
 
     if(status != HIPSPARSE_STATUS_SUCCESS)
     {
-        if(pointer_mode == rocsparse_pointer_mode_host)
-        {
-            free(alpha);
-        }
-        else
-        {
-            RETURN_IF_HIP_ERROR(hipFree(alpha));
-        }
-
         rocsparse_destroy_mat_info(info);
 
         return status;
     }
 
-    RETURN_IF_HIP_ERROR(hipMalloc(&temp_buffer, buffer_size));
+    status = hipsparse::workspaceAcquire(handle, buffer_size, &temp_buffer);
+
+    if(status != HIPSPARSE_STATUS_SUCCESS)
+    {
+        rocsparse_destroy_mat_info(info);
+
+        return status;
+    }
 
     // Perform csrgemm computation
     status = hipsparse::rocSPARSEStatusToHIPStatus(
@@ -5821,17 +8152,6 @@ hipsparseStatus_t hipsparseDcsrgemm(hipsparseHandle_t         handle,
                            info,
                            temp_buffer));
 
-    if(pointer_mode == rocsparse_pointer_mode_host)
-    {
-        free(alpha);
-    }
-    else
-    {
-        RETURN_IF_HIP_ERROR(hipFree(alpha));
-    }
-
-    RETURN_IF_HIP_ERROR(hipFree(temp_buffer));
-
     if(status != HIPSPARSE_STATUS_SUCCESS)
     {
         rocsparse_destroy_mat_info(info);
@@ -5865,6 +8185,27 @@ hipsparseStatus_t hipsparseCcsrgemm(hipsparseHandle_t         handle,
                                     const int*                csrRowPtrC,
                                     int*                      csrColIndC)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          transA,
+                          transB,
+                          m,
+                          n,
+                          k,
+                          descrA,
+                          nnzA,
+                          csrValA,
+                          csrRowPtrA,
+                          csrColIndA,
+                          descrB,
+                          nnzB,
+                          csrValB,
+                          csrRowPtrB,
+                          csrColIndB,
+                          descrC,
+                          csrValC,
+                          csrRowPtrC,
+                          csrColIndC);
+
     // Create matrix info
     rocsparse_mat_info info;
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_mat_info(&info));
@@ -5874,8 +8215,8 @@ hipsparseStatus_t hipsparseCcsrgemm(hipsparseHandle_t         handle,
     void*  temp_buffer;
 
     // Initialize alpha = 1.0
-    hipComplex  one = make_hipComplex(1.0f, 0.0f);
-    hipComplex* alpha;
+    hipComplex  one   = make_hipComplex(1.0f, 0.0f);
+    hipComplex* alpha = &one;
 
     hipsparseStatus_t status;
 
@@ -5891,15 +8232,17 @@ hipsparseStatus_t hipsparseCcsrgemm(hipsparseHandle_t         handle,
         return status;
     }
 
-    if(pointer_mode == rocsparse_pointer_mode_host)
-    {
-        alpha  = (hipComplex*)malloc(sizeof(hipComplex));
-        *alpha = one;
-    }
-    else
+    if(pointer_mode == rocsparse_pointer_mode_device)
     {
-        RETURN_IF_HIP_ERROR(hipMalloc((void**)&alpha, sizeof(hipComplex)));
-        RETURN_IF_HIP_ERROR(hipMemcpy(alpha, &one, sizeof(hipComplex), hipMemcpyHostToDevice));
+        // Device alpha from the handle constant table
+        status = hipsparse::deviceConstant(handle, HIP_C_32F, 1, (const void**)&alpha);
+
+        if(status != HIPSPARSE_STATUS_SUCCESS)
+        {
+            rocsparse_destroy_mat_info(info);
+
+            return status;
+        }
     }
 
     // Obtain temporary buffer size
@@ -5929,21 +8272,19 @@ hipsparseStatus_t hipsparseCcsrgemm(hipsparseHandle_t         handle,
 
     if(status != HIPSPARSE_STATUS_SUCCESS)
     {
-        if(pointer_mode == rocsparse_pointer_mode_host)
-        {
-            free(alpha);
-        }
-        else
-        {
-            RETURN_IF_HIP_ERROR(hipFree(alpha));
-        }
-
         rocsparse_destroy_mat_info(info);
 
         return status;
     }
 
-    RETURN_IF_HIP_ERROR(hipMalloc(&temp_buffer, buffer_size));
+    status = hipsparse::workspaceAcquire(handle, buffer_size, &temp_buffer);
+
+    if(status != HIPSPARSE_STATUS_SUCCESS)
+    {
+        rocsparse_destroy_mat_info(info);
+
+        return status;
+    }
 
     // Perform csrgemm computation
     status = hipsparse::rocSPARSEStatusToHIPStatus(
@@ -5977,17 +8318,6 @@ hipsparseStatus_t hipsparseCcsrgemm(hipsparseHandle_t         handle,
                            info,
                            temp_buffer));
 
-    if(pointer_mode == rocsparse_pointer_mode_host)
-    {
-        free(alpha);
-    }
-    else
-    {
-        RETURN_IF_HIP_ERROR(hipFree(alpha));
-    }
-
-    RETURN_IF_HIP_ERROR(hipFree(temp_buffer));
-
     if(status != HIPSPARSE_STATUS_SUCCESS)
     {
         rocsparse_destroy_mat_info(info);
@@ -6021,6 +8351,27 @@ hipsparseStatus_t hipsparseZcsrgemm(hipsparseHandle_t         handle,
                                     const int*                csrRowPtrC,
                                     int*                      csrColIndC)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          transA,
+                          transB,
+                          m,
+                          n,
+                          k,
+                          descrA,
+                          nnzA,
+                          csrValA,
+                          csrRowPtrA,
+                          csrColIndA,
+                          descrB,
+                          nnzB,
+                          csrValB,
+                          csrRowPtrB,
+                          csrColIndB,
+                          descrC,
+                          csrValC,
+                          csrRowPtrC,
+                          csrColIndC);
+
     // Create matrix info
     rocsparse_mat_info info;
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_mat_info(&info));
@@ -6030,8 +8381,8 @@ hipsparseStatus_t hipsparseZcsrgemm(hipsparseHandle_t         handle,
     void*  temp_buffer;
 
     // Initialize alpha = 1.0
-    hipDoubleComplex  one = make_hipDoubleComplex(1.0, 0.0);
-    hipDoubleComplex* alpha;
+    hipDoubleComplex  one   = make_hipDoubleComplex(1.0, 0.0);
+    hipDoubleComplex* alpha = &one;
 
     hipsparseStatus_t status;
 
@@ -6047,16 +8398,17 @@ hipsparseStatus_t hipsparseZcsrgemm(hipsparseHandle_t         handle,
         return status;
     }
 
-    if(pointer_mode == rocsparse_pointer_mode_host)
-    {
-        alpha  = (hipDoubleComplex*)malloc(sizeof(hipDoubleComplex));
-        *alpha = one;
-    }
-    else
+    if(pointer_mode == rocsparse_pointer_mode_device)
     {
-        RETURN_IF_HIP_ERROR(hipMalloc((void**)&alpha, sizeof(hipDoubleComplex)));
-        RETURN_IF_HIP_ERROR(
-            hipMemcpy(alpha, &one, sizeof(hipDoubleComplex), hipMemcpyHostToDevice));
+        // Device alpha from the handle constant table
+        status = hipsparse::deviceConstant(handle, HIP_C_64F, 1, (const void**)&alpha);
+
+        if(status != HIPSPARSE_STATUS_SUCCESS)
+        {
+            rocsparse_destroy_mat_info(info);
+
+            return status;
+        }
     }
 
     // Obtain temporary buffer size
@@ -6086,21 +8438,19 @@ hipsparseStatus_t hipsparseZcsrgemm(hipsparseHandle_t         handle,
 
     if(status != HIPSPARSE_STATUS_SUCCESS)
     {
-        if(pointer_mode == rocsparse_pointer_mode_host)
-        {
-            free(alpha);
-        }
-        else
-        {
-            RETURN_IF_HIP_ERROR(hipFree(alpha));
-        }
-
         rocsparse_destroy_mat_info(info);
 
         return status;
     }
 
-    RETURN_IF_HIP_ERROR(hipMalloc(&temp_buffer, buffer_size));
+    status = hipsparse::workspaceAcquire(handle, buffer_size, &temp_buffer);
+
+    if(status != HIPSPARSE_STATUS_SUCCESS)
+    {
+        rocsparse_destroy_mat_info(info);
+
+        return status;
+    }
 
     // Perform csrgemm computation
     status = hipsparse::rocSPARSEStatusToHIPStatus(
@@ -6134,17 +8484,6 @@ hipsparseStatus_t hipsparseZcsrgemm(hipsparseHandle_t         handle,
                            info,
                            temp_buffer));
 
-    if(pointer_mode == rocsparse_pointer_mode_host)
-    {
-        free(alpha);
-    }
-    else
-    {
-        RETURN_IF_HIP_ERROR(hipFree(alpha));
-    }
-
-    RETURN_IF_HIP_ERROR(hipFree(temp_buffer));
-
     if(status != HIPSPARSE_STATUS_SUCCESS)
     {
         rocsparse_destroy_mat_info(info);
@@ -6178,6 +8517,27 @@ hipsparseStatus_t hipsparseScsrgemm2_bufferSizeExt(hipsparseHandle_t         han
                                                    csrgemm2Info_t            info,
                                                    size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          n,
+                          k,
+                          alpha,
+                          descrA,
+                          nnzA,
+                          csrRowPtrA,
+                          csrColIndA,
+                          descrB,
+                          nnzB,
+                          csrRowPtrB,
+                          csrColIndB,
+                          beta,
+                          descrD,
+                          nnzD,
+                          csrRowPtrD,
+                          csrColIndD,
+                          info,
+                          pBufferSizeInBytes);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_scsrgemm_buffer_size((rocsparse_handle)handle,
                                        rocsparse_operation_none,
@@ -6224,6 +8584,27 @@ hipsparseStatus_t hipsparseDcsrgemm2_bufferSizeExt(hipsparseHandle_t         han
                                                    csrgemm2Info_t            info,
                                                    size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          n,
+                          k,
+                          alpha,
+                          descrA,
+                          nnzA,
+                          csrRowPtrA,
+                          csrColIndA,
+                          descrB,
+                          nnzB,
+                          csrRowPtrB,
+                          csrColIndB,
+                          beta,
+                          descrD,
+                          nnzD,
+                          csrRowPtrD,
+                          csrColIndD,
+                          info,
+                          pBufferSizeInBytes);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dcsrgemm_buffer_size((rocsparse_handle)handle,
                                        rocsparse_operation_none,
@@ -6270,6 +8651,27 @@ hipsparseStatus_t hipsparseCcsrgemm2_bufferSizeExt(hipsparseHandle_t         han
                                                    csrgemm2Info_t            info,
                                                    size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          n,
+                          k,
+                          alpha,
+                          descrA,
+                          nnzA,
+                          csrRowPtrA,
+                          csrColIndA,
+                          descrB,
+                          nnzB,
+                          csrRowPtrB,
+                          csrColIndB,
+                          beta,
+                          descrD,
+                          nnzD,
+                          csrRowPtrD,
+                          csrColIndD,
+                          info,
+                          pBufferSizeInBytes);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_ccsrgemm_buffer_size((rocsparse_handle)handle,
                                        rocsparse_operation_none,
@@ -6316,6 +8718,27 @@ hipsparseStatus_t hipsparseZcsrgemm2_bufferSizeExt(hipsparseHandle_t         han
                                                    csrgemm2Info_t            info,
                                                    size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          n,
+                          k,
+                          alpha,
+                          descrA,
+                          nnzA,
+                          csrRowPtrA,
+                          csrColIndA,
+                          descrB,
+                          nnzB,
+                          csrRowPtrB,
+                          csrColIndB,
+                          beta,
+                          descrD,
+                          nnzD,
+                          csrRowPtrD,
+                          csrColIndD,
+                          info,
+                          pBufferSizeInBytes);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrgemm_buffer_size((rocsparse_handle)handle,
                                        rocsparse_operation_none,
@@ -6363,6 +8786,28 @@ hipsparseStatus_t hipsparseXcsrgemm2Nnz(hipsparseHandle_t         handle,
                                         const csrgemm2Info_t      info,
                                         void*                     pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          n,
+                          k,
+                          descrA,
+                          nnzA,
+                          csrRowPtrA,
+                          csrColIndA,
+                          descrB,
+                          nnzB,
+                          csrRowPtrB,
+                          csrColIndB,
+                          descrD,
+                          nnzD,
+                          csrRowPtrD,
+                          csrColIndD,
+                          descrC,
+                          csrRowPtrC,
+                          nnzTotalDevHostPtr,
+                          info,
+                          pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_csrgemm_nnz((rocsparse_handle)handle,
                                                                        rocsparse_operation_none,
                                                                        rocsparse_operation_none,
@@ -6416,6 +8861,34 @@ hipsparseStatus_t hipsparseScsrgemm2(hipsparseHandle_t         handle,
                                      const csrgemm2Info_t      info,
                                      void*                     pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          n,
+                          k,
+                          alpha,
+                          descrA,
+                          nnzA,
+                          csrValA,
+                          csrRowPtrA,
+                          csrColIndA,
+                          descrB,
+                          nnzB,
+                          csrValB,
+                          csrRowPtrB,
+                          csrColIndB,
+                          beta,
+                          descrD,
+                          nnzD,
+                          csrValD,
+                          csrRowPtrD,
+                          csrColIndD,
+                          descrC,
+                          csrValC,
+                          csrRowPtrC,
+                          csrColIndC,
+                          info,
+                          pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_scsrgemm((rocsparse_handle)handle,
                                                                     rocsparse_operation_none,
                                                                     rocsparse_operation_none,
@@ -6475,6 +8948,34 @@ hipsparseStatus_t hipsparseDcsrgemm2(hipsparseHandle_t         handle,
                                      const csrgemm2Info_t      info,
                                      void*                     pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          n,
+                          k,
+                          alpha,
+                          descrA,
+                          nnzA,
+                          csrValA,
+                          csrRowPtrA,
+                          csrColIndA,
+                          descrB,
+                          nnzB,
+                          csrValB,
+                          csrRowPtrB,
+                          csrColIndB,
+                          beta,
+                          descrD,
+                          nnzD,
+                          csrValD,
+                          csrRowPtrD,
+                          csrColIndD,
+                          descrC,
+                          csrValC,
+                          csrRowPtrC,
+                          csrColIndC,
+                          info,
+                          pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_dcsrgemm((rocsparse_handle)handle,
                                                                     rocsparse_operation_none,
                                                                     rocsparse_operation_none,
@@ -6534,6 +9035,34 @@ hipsparseStatus_t hipsparseCcsrgemm2(hipsparseHandle_t         handle,
                                      const csrgemm2Info_t      info,
                                      void*                     pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          n,
+                          k,
+                          alpha,
+                          descrA,
+                          nnzA,
+                          csrValA,
+                          csrRowPtrA,
+                          csrColIndA,
+                          descrB,
+                          nnzB,
+                          csrValB,
+                          csrRowPtrB,
+                          csrColIndB,
+                          beta,
+                          descrD,
+                          nnzD,
+                          csrValD,
+                          csrRowPtrD,
+                          csrColIndD,
+                          descrC,
+                          csrValC,
+                          csrRowPtrC,
+                          csrColIndC,
+                          info,
+                          pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_ccsrgemm((rocsparse_handle)handle,
                            rocsparse_operation_none,
@@ -6594,6 +9123,34 @@ hipsparseStatus_t hipsparseZcsrgemm2(hipsparseHandle_t         handle,
                                      const csrgemm2Info_t      info,
                                      void*                     pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          n,
+                          k,
+                          alpha,
+                          descrA,
+                          nnzA,
+                          csrValA,
+                          csrRowPtrA,
+                          csrColIndA,
+                          descrB,
+                          nnzB,
+                          csrValB,
+                          csrRowPtrB,
+                          csrColIndB,
+                          beta,
+                          descrD,
+                          nnzD,
+                          csrValD,
+                          csrRowPtrD,
+                          csrColIndD,
+                          descrC,
+                          csrValC,
+                          csrRowPtrC,
+                          csrColIndC,
+                          info,
+                          pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrgemm((rocsparse_handle)handle,
                            rocsparse_operation_none,
@@ -6629,6 +9186,8 @@ hipsparseStatus_t hipsparseZcsrgemm2(hipsparseHandle_t         handle,
 hipsparseStatus_t
     hipsparseXbsrilu02_zeroPivot(hipsparseHandle_t handle, bsrilu02Info_t info, int* position)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, info, position);
+
     // Obtain stream, to explicitly sync (cusparse bsrilu02_zeropivot is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -6638,7 +9197,7 @@ hipsparseStatus_t
         rocsparse_bsrilu0_zero_pivot((rocsparse_handle)handle, (rocsparse_mat_info)info, position));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::syncStream(handle, stream, true));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -6646,6 +9205,8 @@ hipsparseStatus_t
 hipsparseStatus_t hipsparseSbsrilu02_numericBoost(
     hipsparseHandle_t handle, bsrilu02Info_t info, int enable_boost, double* tol, float* boost_val)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, info, enable_boost, tol, boost_val);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_dsbsrilu0_numeric_boost(
         (rocsparse_handle)handle, (rocsparse_mat_info)info, enable_boost, tol, boost_val));
 }
@@ -6653,6 +9214,8 @@ hipsparseStatus_t hipsparseSbsrilu02_numericBoost(
 hipsparseStatus_t hipsparseDbsrilu02_numericBoost(
     hipsparseHandle_t handle, bsrilu02Info_t info, int enable_boost, double* tol, double* boost_val)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, info, enable_boost, tol, boost_val);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_dbsrilu0_numeric_boost(
         (rocsparse_handle)handle, (rocsparse_mat_info)info, enable_boost, tol, boost_val));
 }
@@ -6663,6 +9226,8 @@ hipsparseStatus_t hipsparseCbsrilu02_numericBoost(hipsparseHandle_t handle,
                                                   double*           tol,
                                                   hipComplex*       boost_val)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, info, enable_boost, tol, boost_val);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dcbsrilu0_numeric_boost((rocsparse_handle)handle,
                                           (rocsparse_mat_info)info,
@@ -6677,6 +9242,8 @@ hipsparseStatus_t hipsparseZbsrilu02_numericBoost(hipsparseHandle_t handle,
                                                   double*           tol,
                                                   hipDoubleComplex* boost_val)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, info, enable_boost, tol, boost_val);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zbsrilu0_numeric_boost((rocsparse_handle)handle,
                                          (rocsparse_mat_info)info,
@@ -6697,6 +9264,18 @@ hipsparseStatus_t hipsparseSbsrilu02_bufferSize(hipsparseHandle_t         handle
                                                 bsrilu02Info_t            info,
                                                 int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dirA,
+                          mb,
+                          nnzb,
+                          descrA,
+                          bsrValA,
+                          bsrRowPtrA,
+                          bsrColIndA,
+                          blockDim,
+                          info,
+                          pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -6734,6 +9313,18 @@ hipsparseStatus_t hipsparseDbsrilu02_bufferSize(hipsparseHandle_t         handle
                                                 bsrilu02Info_t            info,
                                                 int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dirA,
+                          mb,
+                          nnzb,
+                          descrA,
+                          bsrValA,
+                          bsrRowPtrA,
+                          bsrColIndA,
+                          blockDim,
+                          info,
+                          pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -6771,6 +9362,18 @@ hipsparseStatus_t hipsparseCbsrilu02_bufferSize(hipsparseHandle_t         handle
                                                 bsrilu02Info_t            info,
                                                 int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dirA,
+                          mb,
+                          nnzb,
+                          descrA,
+                          bsrValA,
+                          bsrRowPtrA,
+                          bsrColIndA,
+                          blockDim,
+                          info,
+                          pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -6808,6 +9411,18 @@ hipsparseStatus_t hipsparseZbsrilu02_bufferSize(hipsparseHandle_t         handle
                                                 bsrilu02Info_t            info,
                                                 int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dirA,
+                          mb,
+                          nnzb,
+                          descrA,
+                          bsrValA,
+                          bsrRowPtrA,
+                          bsrColIndA,
+                          blockDim,
+                          info,
+                          pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -6846,6 +9461,19 @@ hipsparseStatus_t hipsparseSbsrilu02_analysis(hipsparseHandle_t         handle,
                                               hipsparseSolvePolicy_t    policy,
                                               void*                     pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dirA,
+                          mb,
+                          nnzb,
+                          descrA,
+                          bsrValA,
+                          bsrRowPtrA,
+                          bsrColIndA,
+                          blockDim,
+                          info,
+                          policy,
+                          pBuffer);
+
     // Obtain stream, to explicitly sync (cusparse bsrilu02_analysis is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -6867,7 +9495,7 @@ hipsparseStatus_t hipsparseSbsrilu02_analysis(hipsparseHandle_t         handle,
                                     pBuffer));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::syncStream(handle, stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -6885,6 +9513,19 @@ hipsparseStatus_t hipsparseDbsrilu02_analysis(hipsparseHandle_t         handle,
                                               hipsparseSolvePolicy_t    policy,
                                               void*                     pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dirA,
+                          mb,
+                          nnzb,
+                          descrA,
+                          bsrValA,
+                          bsrRowPtrA,
+                          bsrColIndA,
+                          blockDim,
+                          info,
+                          policy,
+                          pBuffer);
+
     // Obtain stream, to explicitly sync (cusparse bsrilu02_analysis is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -6906,7 +9547,7 @@ hipsparseStatus_t hipsparseDbsrilu02_analysis(hipsparseHandle_t         handle,
                                     pBuffer));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::syncStream(handle, stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -6924,6 +9565,19 @@ hipsparseStatus_t hipsparseCbsrilu02_analysis(hipsparseHandle_t         handle,
                                               hipsparseSolvePolicy_t    policy,
                                               void*                     pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dirA,
+                          mb,
+                          nnzb,
+                          descrA,
+                          bsrValA,
+                          bsrRowPtrA,
+                          bsrColIndA,
+                          blockDim,
+                          info,
+                          policy,
+                          pBuffer);
+
     // Obtain stream, to explicitly sync (cusparse bsrilu02_analysis is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -6945,7 +9599,7 @@ hipsparseStatus_t hipsparseCbsrilu02_analysis(hipsparseHandle_t         handle,
                                     pBuffer));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::syncStream(handle, stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -6963,6 +9617,19 @@ hipsparseStatus_t hipsparseZbsrilu02_analysis(hipsparseHandle_t         handle,
                                               hipsparseSolvePolicy_t    policy,
                                               void*                     pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dirA,
+                          mb,
+                          nnzb,
+                          descrA,
+                          bsrValA,
+                          bsrRowPtrA,
+                          bsrColIndA,
+                          blockDim,
+                          info,
+                          policy,
+                          pBuffer);
+
     // Obtain stream, to explicitly sync (cusparse bsrilu02_analysis is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -6984,7 +9651,7 @@ hipsparseStatus_t hipsparseZbsrilu02_analysis(hipsparseHandle_t         handle,
                                     pBuffer));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::syncStream(handle, stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -7002,6 +9669,19 @@ hipsparseStatus_t hipsparseSbsrilu02(hipsparseHandle_t         handle,
                                      hipsparseSolvePolicy_t    policy,
                                      void*                     pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dirA,
+                          mb,
+                          nnzb,
+                          descrA,
+                          bsrValA,
+                          bsrRowPtrA,
+                          bsrColIndA,
+                          blockDim,
+                          info,
+                          policy,
+                          pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sbsrilu0((rocsparse_handle)handle,
                            hipsparse::hipDirectionToHCCDirection(dirA),
@@ -7030,6 +9710,19 @@ hipsparseStatus_t hipsparseDbsrilu02(hipsparseHandle_t         handle,
                                      hipsparseSolvePolicy_t    policy,
                                      void*                     pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dirA,
+                          mb,
+                          nnzb,
+                          descrA,
+                          bsrValA,
+                          bsrRowPtrA,
+                          bsrColIndA,
+                          blockDim,
+                          info,
+                          policy,
+                          pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dbsrilu0((rocsparse_handle)handle,
                            hipsparse::hipDirectionToHCCDirection(dirA),
@@ -7058,6 +9751,19 @@ hipsparseStatus_t hipsparseCbsrilu02(hipsparseHandle_t         handle,
                                      hipsparseSolvePolicy_t    policy,
                                      void*                     pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dirA,
+                          mb,
+                          nnzb,
+                          descrA,
+                          bsrValA,
+                          bsrRowPtrA,
+                          bsrColIndA,
+                          blockDim,
+                          info,
+                          policy,
+                          pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_cbsrilu0((rocsparse_handle)handle,
                            hipsparse::hipDirectionToHCCDirection(dirA),
@@ -7086,6 +9792,19 @@ hipsparseStatus_t hipsparseZbsrilu02(hipsparseHandle_t         handle,
                                      hipsparseSolvePolicy_t    policy,
                                      void*                     pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dirA,
+                          mb,
+                          nnzb,
+                          descrA,
+                          bsrValA,
+                          bsrRowPtrA,
+                          bsrColIndA,
+                          blockDim,
+                          info,
+                          policy,
+                          pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zbsrilu0((rocsparse_handle)handle,
                            hipsparse::hipDirectionToHCCDirection(dirA),
@@ -7104,6 +9823,8 @@ hipsparseStatus_t hipsparseZbsrilu02(hipsparseHandle_t         handle,
 hipsparseStatus_t
     hipsparseXcsrilu02_zeroPivot(hipsparseHandle_t handle, csrilu02Info_t info, int* position)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, info, position);
+
     // Obtain stream, to explicitly sync (cusparse csrilu02_zeropivot is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -7113,7 +9834,7 @@ hipsparseStatus_t
         rocsparse_csrilu0_zero_pivot((rocsparse_handle)handle, (rocsparse_mat_info)info, position));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::syncStream(handle, stream, true));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -7121,6 +9842,8 @@ hipsparseStatus_t
 hipsparseStatus_t hipsparseScsrilu02_numericBoost(
     hipsparseHandle_t handle, csrilu02Info_t info, int enable_boost, double* tol, float* boost_val)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, info, enable_boost, tol, boost_val);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_dscsrilu0_numeric_boost(
         (rocsparse_handle)handle, (rocsparse_mat_info)info, enable_boost, tol, boost_val));
 }
@@ -7128,6 +9851,8 @@ hipsparseStatus_t hipsparseScsrilu02_numericBoost(
 hipsparseStatus_t hipsparseDcsrilu02_numericBoost(
     hipsparseHandle_t handle, csrilu02Info_t info, int enable_boost, double* tol, double* boost_val)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, info, enable_boost, tol, boost_val);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_dcsrilu0_numeric_boost(
         (rocsparse_handle)handle, (rocsparse_mat_info)info, enable_boost, tol, boost_val));
 }
@@ -7138,6 +9863,8 @@ hipsparseStatus_t hipsparseCcsrilu02_numericBoost(hipsparseHandle_t handle,
                                                   double*           tol,
                                                   hipComplex*       boost_val)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, info, enable_boost, tol, boost_val);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dccsrilu0_numeric_boost((rocsparse_handle)handle,
                                           (rocsparse_mat_info)info,
@@ -7152,6 +9879,8 @@ hipsparseStatus_t hipsparseZcsrilu02_numericBoost(hipsparseHandle_t handle,
                                                   double*           tol,
                                                   hipDoubleComplex* boost_val)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, info, enable_boost, tol, boost_val);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrilu0_numeric_boost((rocsparse_handle)handle,
                                          (rocsparse_mat_info)info,
@@ -7170,6 +9899,16 @@ hipsparseStatus_t hipsparseScsrilu02_bufferSize(hipsparseHandle_t         handle
                                                 csrilu02Info_t            info,
                                                 int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          nnz,
+                          descrA,
+                          csrSortedValA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          info,
+                          pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -7203,6 +9942,16 @@ hipsparseStatus_t hipsparseDcsrilu02_bufferSize(hipsparseHandle_t         handle
                                                 csrilu02Info_t            info,
                                                 int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          nnz,
+                          descrA,
+                          csrSortedValA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          info,
+                          pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -7236,6 +9985,16 @@ hipsparseStatus_t hipsparseCcsrilu02_bufferSize(hipsparseHandle_t         handle
                                                 csrilu02Info_t            info,
                                                 int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          nnz,
+                          descrA,
+                          csrSortedValA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          info,
+                          pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -7269,6 +10028,16 @@ hipsparseStatus_t hipsparseZcsrilu02_bufferSize(hipsparseHandle_t         handle
                                                 csrilu02Info_t            info,
                                                 int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          nnz,
+                          descrA,
+                          csrSortedValA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          info,
+                          pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -7302,6 +10071,16 @@ hipsparseStatus_t hipsparseScsrilu02_bufferSizeExt(hipsparseHandle_t         han
                                                    csrilu02Info_t            info,
                                                    size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          nnz,
+                          descrA,
+                          csrSortedValA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          info,
+                          pBufferSizeInBytes);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_scsrilu0_buffer_size((rocsparse_handle)handle,
                                        m,
@@ -7324,6 +10103,16 @@ hipsparseStatus_t hipsparseDcsrilu02_bufferSizeExt(hipsparseHandle_t         han
                                                    csrilu02Info_t            info,
                                                    size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          nnz,
+                          descrA,
+                          csrSortedValA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          info,
+                          pBufferSizeInBytes);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dcsrilu0_buffer_size((rocsparse_handle)handle,
                                        m,
@@ -7346,6 +10135,16 @@ hipsparseStatus_t hipsparseCcsrilu02_bufferSizeExt(hipsparseHandle_t         han
                                                    csrilu02Info_t            info,
                                                    size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          nnz,
+                          descrA,
+                          csrSortedValA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          info,
+                          pBufferSizeInBytes);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_ccsrilu0_buffer_size((rocsparse_handle)handle,
                                        m,
@@ -7368,6 +10167,16 @@ hipsparseStatus_t hipsparseZcsrilu02_bufferSizeExt(hipsparseHandle_t         han
                                                    csrilu02Info_t            info,
                                                    size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          nnz,
+                          descrA,
+                          csrSortedValA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          info,
+                          pBufferSizeInBytes);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrilu0_buffer_size((rocsparse_handle)handle,
                                        m,
@@ -7391,6 +10200,17 @@ hipsparseStatus_t hipsparseScsrilu02_analysis(hipsparseHandle_t         handle,
                                               hipsparseSolvePolicy_t    policy,
                                               void*                     pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          nnz,
+                          descrA,
+                          csrSortedValA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          info,
+                          policy,
+                          pBuffer);
+
     // Obtain stream, to explicitly sync (cusparse csrilu02_analysis is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -7409,7 +10229,7 @@ hipsparseStatus_t hipsparseScsrilu02_analysis(hipsparseHandle_t         handle,
                                                           pBuffer));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::syncStream(handle, stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -7425,6 +10245,17 @@ hipsparseStatus_t hipsparseDcsrilu02_analysis(hipsparseHandle_t         handle,
                                               hipsparseSolvePolicy_t    policy,
                                               void*                     pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          nnz,
+                          descrA,
+                          csrSortedValA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          info,
+                          policy,
+                          pBuffer);
+
     // Obtain stream, to explicitly sync (cusparse csrilu02_analysis is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -7443,7 +10274,7 @@ hipsparseStatus_t hipsparseDcsrilu02_analysis(hipsparseHandle_t         handle,
                                                           pBuffer));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::syncStream(handle, stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -7459,6 +10290,17 @@ hipsparseStatus_t hipsparseCcsrilu02_analysis(hipsparseHandle_t         handle,
                                               hipsparseSolvePolicy_t    policy,
                                               void*                     pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          nnz,
+                          descrA,
+                          csrSortedValA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          info,
+                          policy,
+                          pBuffer);
+
     // Obtain stream, to explicitly sync (cusparse csrilu02_analysis is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -7478,7 +10320,7 @@ hipsparseStatus_t hipsparseCcsrilu02_analysis(hipsparseHandle_t         handle,
                                     pBuffer));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::syncStream(handle, stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -7494,6 +10336,17 @@ hipsparseStatus_t hipsparseZcsrilu02_analysis(hipsparseHandle_t         handle,
                                               hipsparseSolvePolicy_t    policy,
                                               void*                     pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          nnz,
+                          descrA,
+                          csrSortedValA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          info,
+                          policy,
+                          pBuffer);
+
     // Obtain stream, to explicitly sync (cusparse csrilu02_analysis is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -7513,7 +10366,7 @@ hipsparseStatus_t hipsparseZcsrilu02_analysis(hipsparseHandle_t         handle,
                                     pBuffer));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::syncStream(handle, stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -7531,6 +10384,17 @@ hipsparseStatus_t hipsparseScsrilu02(hipsparseHandle_t         handle,
                                      hipsparseSolvePolicy_t policy,
                                      void*                  pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          nnz,
+                          descrA,
+                          csrSortedValA_valM,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          info,
+                          policy,
+                          pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_scsrilu0((rocsparse_handle)handle,
                                                                     m,
                                                                     nnz,
@@ -7556,6 +10420,17 @@ hipsparseStatus_t hipsparseDcsrilu02(hipsparseHandle_t         handle,
                                      hipsparseSolvePolicy_t policy,
                                      void*                  pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          nnz,
+                          descrA,
+                          csrSortedValA_valM,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          info,
+                          policy,
+                          pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_dcsrilu0((rocsparse_handle)handle,
                                                                     m,
                                                                     nnz,
@@ -7581,6 +10456,17 @@ hipsparseStatus_t hipsparseCcsrilu02(hipsparseHandle_t         handle,
                                      hipsparseSolvePolicy_t policy,
                                      void*                  pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          nnz,
+                          descrA,
+                          csrSortedValA_valM,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          info,
+                          policy,
+                          pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_ccsrilu0((rocsparse_handle)handle,
                            m,
@@ -7607,6 +10493,17 @@ hipsparseStatus_t hipsparseZcsrilu02(hipsparseHandle_t         handle,
                                      hipsparseSolvePolicy_t policy,
                                      void*                  pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          nnz,
+                          descrA,
+                          csrSortedValA_valM,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          info,
+                          policy,
+                          pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrilu0((rocsparse_handle)handle,
                            m,
@@ -7623,6 +10520,8 @@ hipsparseStatus_t hipsparseZcsrilu02(hipsparseHandle_t         handle,
 hipsparseStatus_t
     hipsparseXbsric02_zeroPivot(hipsparseHandle_t handle, bsric02Info_t info, int* position)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, info, position);
+
     // Obtain stream, to explicitly sync (cusparse bsric02_zeropivot is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -7632,7 +10531,7 @@ hipsparseStatus_t
         rocsparse_bsric0_zero_pivot((rocsparse_handle)handle, (rocsparse_mat_info)info, position));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::syncStream(handle, stream, true));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -7649,6 +10548,18 @@ hipsparseStatus_t hipsparseSbsric02_bufferSize(hipsparseHandle_t         handle,
                                                bsric02Info_t             info,
                                                int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dirA,
+                          mb,
+                          nnzb,
+                          descrA,
+                          bsrValA,
+                          bsrRowPtrA,
+                          bsrColIndA,
+                          blockDim,
+                          info,
+                          pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -7686,6 +10597,18 @@ hipsparseStatus_t hipsparseDbsric02_bufferSize(hipsparseHandle_t         handle,
                                                bsric02Info_t             info,
                                                int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dirA,
+                          mb,
+                          nnzb,
+                          descrA,
+                          bsrValA,
+                          bsrRowPtrA,
+                          bsrColIndA,
+                          blockDim,
+                          info,
+                          pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -7723,6 +10646,18 @@ hipsparseStatus_t hipsparseCbsric02_bufferSize(hipsparseHandle_t         handle,
                                                bsric02Info_t             info,
                                                int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dirA,
+                          mb,
+                          nnzb,
+                          descrA,
+                          bsrValA,
+                          bsrRowPtrA,
+                          bsrColIndA,
+                          blockDim,
+                          info,
+                          pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -7760,6 +10695,18 @@ hipsparseStatus_t hipsparseZbsric02_bufferSize(hipsparseHandle_t         handle,
                                                bsric02Info_t             info,
                                                int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dirA,
+                          mb,
+                          nnzb,
+                          descrA,
+                          bsrValA,
+                          bsrRowPtrA,
+                          bsrColIndA,
+                          blockDim,
+                          info,
+                          pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -7798,6 +10745,19 @@ hipsparseStatus_t hipsparseSbsric02_analysis(hipsparseHandle_t         handle,
                                              hipsparseSolvePolicy_t    policy,
                                              void*                     pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dirA,
+                          mb,
+                          nnzb,
+                          descrA,
+                          bsrValA,
+                          bsrRowPtrA,
+                          bsrColIndA,
+                          blockDim,
+                          info,
+                          policy,
+                          pBuffer);
+
     // Obtain stream, to explicitly sync (cusparse bsric02_analysis is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -7819,7 +10779,7 @@ hipsparseStatus_t hipsparseSbsric02_analysis(hipsparseHandle_t         handle,
                                    pBuffer));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::syncStream(handle, stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -7837,6 +10797,19 @@ hipsparseStatus_t hipsparseDbsric02_analysis(hipsparseHandle_t         handle,
                                              hipsparseSolvePolicy_t    policy,
                                              void*                     pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dirA,
+                          mb,
+                          nnzb,
+                          descrA,
+                          bsrValA,
+                          bsrRowPtrA,
+                          bsrColIndA,
+                          blockDim,
+                          info,
+                          policy,
+                          pBuffer);
+
     // Obtain stream, to explicitly sync (cusparse bsric02_analysis is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -7858,7 +10831,7 @@ hipsparseStatus_t hipsparseDbsric02_analysis(hipsparseHandle_t         handle,
                                    pBuffer));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::syncStream(handle, stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -7876,6 +10849,19 @@ hipsparseStatus_t hipsparseCbsric02_analysis(hipsparseHandle_t         handle,
                                              hipsparseSolvePolicy_t    policy,
                                              void*                     pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dirA,
+                          mb,
+                          nnzb,
+                          descrA,
+                          bsrValA,
+                          bsrRowPtrA,
+                          bsrColIndA,
+                          blockDim,
+                          info,
+                          policy,
+                          pBuffer);
+
     // Obtain stream, to explicitly sync (cusparse bsric02_analysis is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -7897,7 +10883,7 @@ hipsparseStatus_t hipsparseCbsric02_analysis(hipsparseHandle_t         handle,
                                    pBuffer));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::syncStream(handle, stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -7915,6 +10901,19 @@ hipsparseStatus_t hipsparseZbsric02_analysis(hipsparseHandle_t         handle,
                                              hipsparseSolvePolicy_t    policy,
                                              void*                     pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dirA,
+                          mb,
+                          nnzb,
+                          descrA,
+                          bsrValA,
+                          bsrRowPtrA,
+                          bsrColIndA,
+                          blockDim,
+                          info,
+                          policy,
+                          pBuffer);
+
     // Obtain stream, to explicitly sync (cusparse bsric02_analysis is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -7936,7 +10935,7 @@ hipsparseStatus_t hipsparseZbsric02_analysis(hipsparseHandle_t         handle,
                                    pBuffer));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::syncStream(handle, stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -7954,6 +10953,19 @@ hipsparseStatus_t hipsparseSbsric02(hipsparseHandle_t         handle,
                                     hipsparseSolvePolicy_t    policy,
                                     void*                     pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dirA,
+                          mb,
+                          nnzb,
+                          descrA,
+                          bsrValA,
+                          bsrRowPtrA,
+                          bsrColIndA,
+                          blockDim,
+                          info,
+                          policy,
+                          pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sbsric0((rocsparse_handle)handle,
                           hipsparse::hipDirectionToHCCDirection(dirA),
@@ -7982,6 +10994,19 @@ hipsparseStatus_t hipsparseDbsric02(hipsparseHandle_t         handle,
                                     hipsparseSolvePolicy_t    policy,
                                     void*                     pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dirA,
+                          mb,
+                          nnzb,
+                          descrA,
+                          bsrValA,
+                          bsrRowPtrA,
+                          bsrColIndA,
+                          blockDim,
+                          info,
+                          policy,
+                          pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dbsric0((rocsparse_handle)handle,
                           hipsparse::hipDirectionToHCCDirection(dirA),
@@ -8010,6 +11035,19 @@ hipsparseStatus_t hipsparseCbsric02(hipsparseHandle_t         handle,
                                     hipsparseSolvePolicy_t    policy,
                                     void*                     pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dirA,
+                          mb,
+                          nnzb,
+                          descrA,
+                          bsrValA,
+                          bsrRowPtrA,
+                          bsrColIndA,
+                          blockDim,
+                          info,
+                          policy,
+                          pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_cbsric0((rocsparse_handle)handle,
                           hipsparse::hipDirectionToHCCDirection(dirA),
@@ -8038,6 +11076,19 @@ hipsparseStatus_t hipsparseZbsric02(hipsparseHandle_t         handle,
                                     hipsparseSolvePolicy_t    policy,
                                     void*                     pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dirA,
+                          mb,
+                          nnzb,
+                          descrA,
+                          bsrValA,
+                          bsrRowPtrA,
+                          bsrColIndA,
+                          blockDim,
+                          info,
+                          policy,
+                          pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zbsric0((rocsparse_handle)handle,
                           hipsparse::hipDirectionToHCCDirection(dirA),
@@ -8056,6 +11107,8 @@ hipsparseStatus_t hipsparseZbsric02(hipsparseHandle_t         handle,
 hipsparseStatus_t
     hipsparseXcsric02_zeroPivot(hipsparseHandle_t handle, csric02Info_t info, int* position)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, info, position);
+
     // Obtain stream, to explicitly sync (cusparse csric02_zeropivot is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -8065,7 +11118,7 @@ hipsparseStatus_t
         rocsparse_csric0_zero_pivot((rocsparse_handle)handle, (rocsparse_mat_info)info, position));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::syncStream(handle, stream, true));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -8080,6 +11133,16 @@ hipsparseStatus_t hipsparseScsric02_bufferSize(hipsparseHandle_t         handle,
                                                csric02Info_t             info,
                                                int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          nnz,
+                          descrA,
+                          csrSortedValA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          info,
+                          pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -8113,6 +11176,16 @@ hipsparseStatus_t hipsparseDcsric02_bufferSize(hipsparseHandle_t         handle,
                                                csric02Info_t             info,
                                                int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          nnz,
+                          descrA,
+                          csrSortedValA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          info,
+                          pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -8146,6 +11219,16 @@ hipsparseStatus_t hipsparseCcsric02_bufferSize(hipsparseHandle_t         handle,
                                                csric02Info_t             info,
                                                int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          nnz,
+                          descrA,
+                          csrSortedValA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          info,
+                          pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -8179,6 +11262,16 @@ hipsparseStatus_t hipsparseZcsric02_bufferSize(hipsparseHandle_t         handle,
                                                csric02Info_t             info,
                                                int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          nnz,
+                          descrA,
+                          csrSortedValA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          info,
+                          pBufferSizeInBytes);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -8212,6 +11305,16 @@ hipsparseStatus_t hipsparseScsric02_bufferSizeExt(hipsparseHandle_t         hand
                                                   csric02Info_t             info,
                                                   size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          nnz,
+                          descrA,
+                          csrSortedValA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          info,
+                          pBufferSizeInBytes);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_scsric0_buffer_size((rocsparse_handle)handle,
                                       m,
@@ -8234,6 +11337,16 @@ hipsparseStatus_t hipsparseDcsric02_bufferSizeExt(hipsparseHandle_t         hand
                                                   csric02Info_t             info,
                                                   size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          nnz,
+                          descrA,
+                          csrSortedValA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          info,
+                          pBufferSizeInBytes);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dcsric0_buffer_size((rocsparse_handle)handle,
                                       m,
@@ -8256,6 +11369,16 @@ hipsparseStatus_t hipsparseCcsric02_bufferSizeExt(hipsparseHandle_t         hand
                                                   csric02Info_t             info,
                                                   size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          nnz,
+                          descrA,
+                          csrSortedValA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          info,
+                          pBufferSizeInBytes);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_ccsric0_buffer_size((rocsparse_handle)handle,
                                       m,
@@ -8278,6 +11401,16 @@ hipsparseStatus_t hipsparseZcsric02_bufferSizeExt(hipsparseHandle_t         hand
                                                   csric02Info_t             info,
                                                   size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          nnz,
+                          descrA,
+                          csrSortedValA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          info,
+                          pBufferSizeInBytes);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsric0_buffer_size((rocsparse_handle)handle,
                                       m,
@@ -8301,6 +11434,17 @@ hipsparseStatus_t hipsparseScsric02_analysis(hipsparseHandle_t         handle,
                                              hipsparseSolvePolicy_t    policy,
                                              void*                     pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          nnz,
+                          descrA,
+                          csrSortedValA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          info,
+                          policy,
+                          pBuffer);
+
     // Obtain stream, to explicitly sync (cusparse csric02_analysis is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -8319,7 +11463,7 @@ hipsparseStatus_t hipsparseScsric02_analysis(hipsparseHandle_t         handle,
                                                          pBuffer));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::syncStream(handle, stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -8335,6 +11479,17 @@ hipsparseStatus_t hipsparseDcsric02_analysis(hipsparseHandle_t         handle,
                                              hipsparseSolvePolicy_t    policy,
                                              void*                     pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          nnz,
+                          descrA,
+                          csrSortedValA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          info,
+                          policy,
+                          pBuffer);
+
     // Obtain stream, to explicitly sync (cusparse csric02_analysis is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -8353,7 +11508,7 @@ hipsparseStatus_t hipsparseDcsric02_analysis(hipsparseHandle_t         handle,
                                                          pBuffer));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::syncStream(handle, stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -8369,6 +11524,17 @@ hipsparseStatus_t hipsparseCcsric02_analysis(hipsparseHandle_t         handle,
                                              hipsparseSolvePolicy_t    policy,
                                              void*                     pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          nnz,
+                          descrA,
+                          csrSortedValA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          info,
+                          policy,
+                          pBuffer);
+
     // Obtain stream, to explicitly sync (cusparse csric02_analysis is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -8388,7 +11554,7 @@ hipsparseStatus_t hipsparseCcsric02_analysis(hipsparseHandle_t         handle,
                                    pBuffer));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::syncStream(handle, stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -8404,6 +11570,17 @@ hipsparseStatus_t hipsparseZcsric02_analysis(hipsparseHandle_t         handle,
                                              hipsparseSolvePolicy_t    policy,
                                              void*                     pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          nnz,
+                          descrA,
+                          csrSortedValA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          info,
+                          policy,
+                          pBuffer);
+
     // Obtain stream, to explicitly sync (cusparse csric02_analysis is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -8423,7 +11600,7 @@ hipsparseStatus_t hipsparseZcsric02_analysis(hipsparseHandle_t         handle,
                                    pBuffer));
 
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::syncStream(handle, stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
@@ -8441,6 +11618,17 @@ hipsparseStatus_t hipsparseScsric02(hipsparseHandle_t         handle,
                                     hipsparseSolvePolicy_t policy,
                                     void*                  pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          nnz,
+                          descrA,
+                          csrSortedValA_valM,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          info,
+                          policy,
+                          pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_scsric0((rocsparse_handle)handle,
                                                                    m,
                                                                    nnz,
@@ -8466,6 +11654,17 @@ hipsparseStatus_t hipsparseDcsric02(hipsparseHandle_t         handle,
                                     hipsparseSolvePolicy_t policy,
                                     void*                  pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          nnz,
+                          descrA,
+                          csrSortedValA_valM,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          info,
+                          policy,
+                          pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_dcsric0((rocsparse_handle)handle,
                                                                    m,
                                                                    nnz,
@@ -8491,6 +11690,17 @@ hipsparseStatus_t hipsparseCcsric02(hipsparseHandle_t         handle,
                                     hipsparseSolvePolicy_t policy,
                                     void*                  pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          nnz,
+                          descrA,
+                          csrSortedValA_valM,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          info,
+                          policy,
+                          pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_ccsric0((rocsparse_handle)handle,
                           m,
@@ -8517,6 +11727,17 @@ hipsparseStatus_t hipsparseZcsric02(hipsparseHandle_t         handle,
                                     hipsparseSolvePolicy_t policy,
                                     void*                  pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          nnz,
+                          descrA,
+                          csrSortedValA_valM,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          info,
+                          policy,
+                          pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsric0((rocsparse_handle)handle,
                           m,
@@ -8537,6 +11758,8 @@ hipsparseStatus_t hipsparseXcsr2coo(hipsparseHandle_t    handle,
                                     int*                 cooRowInd,
                                     hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, csrRowPtr, nnz, m, cooRowInd, idxBase);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_csr2coo((rocsparse_handle)handle,
                           csrRowPtr,
@@ -8559,6 +11782,19 @@ hipsparseStatus_t hipsparseScsr2csc(hipsparseHandle_t    handle,
                                     hipsparseAction_t    copyValues,
                                     hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          n,
+                          nnz,
+                          csrSortedVal,
+                          csrSortedRowPtr,
+                          csrSortedColInd,
+                          cscSortedVal,
+                          cscSortedRowInd,
+                          cscSortedColPtr,
+                          copyValues,
+                          idxBase);
+
     // Determine buffer size
     size_t buffer_size = 0;
     RETURN_IF_ROCSPARSE_ERROR(
@@ -8571,9 +11807,9 @@ hipsparseStatus_t hipsparseScsr2csc(hipsparseHandle_t    handle,
                                       hipsparse::hipActionToHCCAction(copyValues),
                                       &buffer_size));
 
-    // Allocate buffer
+    // Obtain buffer from the handle workspace
     void* buffer = nullptr;
-    RETURN_IF_HIP_ERROR(hipMalloc(&buffer, buffer_size));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::workspaceAcquire(handle, buffer_size, &buffer));
 
     // Obtain stream, to explicitly sync (cusparse csr2csc is blocking)
     hipStream_t       stream;
@@ -8581,8 +11817,6 @@ hipsparseStatus_t hipsparseScsr2csc(hipsparseHandle_t    handle,
 
     if(status != HIPSPARSE_STATUS_SUCCESS)
     {
-        RETURN_IF_HIP_ERROR(hipFree(buffer));
-
         return status;
     }
 
@@ -8602,11 +11836,8 @@ hipsparseStatus_t hipsparseScsr2csc(hipsparseHandle_t    handle,
                            hipsparse::hipBaseToHCCBase(idxBase),
                            buffer));
 
-    // Free buffer
-    RETURN_IF_HIP_ERROR(hipFree(buffer));
-
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::syncStream(handle, stream));
 
     return status;
 }
@@ -8624,6 +11855,19 @@ hipsparseStatus_t hipsparseDcsr2csc(hipsparseHandle_t    handle,
                                     hipsparseAction_t    copyValues,
                                     hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          n,
+                          nnz,
+                          csrSortedVal,
+                          csrSortedRowPtr,
+                          csrSortedColInd,
+                          cscSortedVal,
+                          cscSortedRowInd,
+                          cscSortedColPtr,
+                          copyValues,
+                          idxBase);
+
     // Determine buffer size
     size_t buffer_size = 0;
     RETURN_IF_ROCSPARSE_ERROR(
@@ -8636,9 +11880,9 @@ hipsparseStatus_t hipsparseDcsr2csc(hipsparseHandle_t    handle,
                                       hipsparse::hipActionToHCCAction(copyValues),
                                       &buffer_size));
 
-    // Allocate buffer
+    // Obtain buffer from the handle workspace
     void* buffer = nullptr;
-    RETURN_IF_HIP_ERROR(hipMalloc(&buffer, buffer_size));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::workspaceAcquire(handle, buffer_size, &buffer));
 
     // Obtain stream, to explicitly sync (cusparse csr2csc is blocking)
     hipStream_t       stream;
@@ -8646,8 +11890,6 @@ hipsparseStatus_t hipsparseDcsr2csc(hipsparseHandle_t    handle,
 
     if(status != HIPSPARSE_STATUS_SUCCESS)
     {
-        RETURN_IF_HIP_ERROR(hipFree(buffer));
-
         return status;
     }
 
@@ -8667,11 +11909,8 @@ hipsparseStatus_t hipsparseDcsr2csc(hipsparseHandle_t    handle,
                            hipsparse::hipBaseToHCCBase(idxBase),
                            buffer));
 
-    // Free buffer
-    RETURN_IF_HIP_ERROR(hipFree(buffer));
-
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::syncStream(handle, stream));
 
     return status;
 }
@@ -8689,6 +11928,19 @@ hipsparseStatus_t hipsparseCcsr2csc(hipsparseHandle_t    handle,
                                     hipsparseAction_t    copyValues,
                                     hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          n,
+                          nnz,
+                          csrSortedVal,
+                          csrSortedRowPtr,
+                          csrSortedColInd,
+                          cscSortedVal,
+                          cscSortedRowInd,
+                          cscSortedColPtr,
+                          copyValues,
+                          idxBase);
+
     // Determine buffer size
     size_t buffer_size = 0;
     RETURN_IF_ROCSPARSE_ERROR(
@@ -8701,9 +11953,9 @@ hipsparseStatus_t hipsparseCcsr2csc(hipsparseHandle_t    handle,
                                       hipsparse::hipActionToHCCAction(copyValues),
                                       &buffer_size));
 
-    // Allocate buffer
+    // Obtain buffer from the handle workspace
     void* buffer = nullptr;
-    RETURN_IF_HIP_ERROR(hipMalloc(&buffer, buffer_size));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::workspaceAcquire(handle, buffer_size, &buffer));
 
     // Obtain stream, to explicitly sync (cusparse csr2csc is blocking)
     hipStream_t       stream;
@@ -8711,8 +11963,6 @@ hipsparseStatus_t hipsparseCcsr2csc(hipsparseHandle_t    handle,
 
     if(status != HIPSPARSE_STATUS_SUCCESS)
     {
-        RETURN_IF_HIP_ERROR(hipFree(buffer));
-
         return status;
     }
 
@@ -8732,11 +11982,8 @@ hipsparseStatus_t hipsparseCcsr2csc(hipsparseHandle_t    handle,
                            hipsparse::hipBaseToHCCBase(idxBase),
                            buffer));
 
-    // Free buffer
-    RETURN_IF_HIP_ERROR(hipFree(buffer));
-
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::syncStream(handle, stream));
 
     return status;
 }
@@ -8754,6 +12001,19 @@ hipsparseStatus_t hipsparseZcsr2csc(hipsparseHandle_t       handle,
                                     hipsparseAction_t       copyValues,
                                     hipsparseIndexBase_t    idxBase)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          n,
+                          nnz,
+                          csrSortedVal,
+                          csrSortedRowPtr,
+                          csrSortedColInd,
+                          cscSortedVal,
+                          cscSortedRowInd,
+                          cscSortedColPtr,
+                          copyValues,
+                          idxBase);
+
     // Determine buffer size
     size_t buffer_size = 0;
     RETURN_IF_ROCSPARSE_ERROR(
@@ -8766,9 +12026,9 @@ hipsparseStatus_t hipsparseZcsr2csc(hipsparseHandle_t       handle,
                                       hipsparse::hipActionToHCCAction(copyValues),
                                       &buffer_size));
 
-    // Allocate buffer
+    // Obtain buffer from the handle workspace
     void* buffer = nullptr;
-    RETURN_IF_HIP_ERROR(hipMalloc(&buffer, buffer_size));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::workspaceAcquire(handle, buffer_size, &buffer));
 
     // Obtain stream, to explicitly sync (cusparse csr2csc is blocking)
     hipStream_t       stream;
@@ -8776,8 +12036,6 @@ hipsparseStatus_t hipsparseZcsr2csc(hipsparseHandle_t       handle,
 
     if(status != HIPSPARSE_STATUS_SUCCESS)
     {
-        RETURN_IF_HIP_ERROR(hipFree(buffer));
-
         return status;
     }
 
@@ -8797,11 +12055,8 @@ hipsparseStatus_t hipsparseZcsr2csc(hipsparseHandle_t       handle,
                            hipsparse::hipBaseToHCCBase(idxBase),
                            buffer));
 
-    // Free buffer
-    RETURN_IF_HIP_ERROR(hipFree(buffer));
-
     // Synchronize stream
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::syncStream(handle, stream));
 
     return status;
 }
@@ -8822,6 +12077,22 @@ hipsparseStatus_t hipsparseCsr2cscEx2_bufferSize(hipsparseHandle_t     handle,
                                                  hipsparseCsr2CscAlg_t alg,
                                                  size_t*               bufferSize)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          n,
+                          nnz,
+                          csrVal,
+                          csrRowPtr,
+                          csrColInd,
+                          cscVal,
+                          cscColPtr,
+                          cscRowInd,
+                          valType,
+                          copyValues,
+                          idxBase,
+                          alg,
+                          bufferSize);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_csr2csc_buffer_size((rocsparse_handle)handle,
                                       m,
@@ -8849,6 +12120,22 @@ hipsparseStatus_t hipsparseCsr2cscEx2(hipsparseHandle_t     handle,
                                       hipsparseCsr2CscAlg_t alg,
                                       void*                 buffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          n,
+                          nnz,
+                          csrVal,
+                          csrRowPtr,
+                          csrColInd,
+                          cscVal,
+                          cscColPtr,
+                          cscRowInd,
+                          valType,
+                          copyValues,
+                          idxBase,
+                          alg,
+                          buffer);
+
     switch(valType)
     {
     case HIP_R_32F:
@@ -8953,6 +12240,17 @@ hipsparseStatus_t hipsparseScsr2hyb(hipsparseHandle_t         handle,
                                     int                       userEllWidth,
                                     hipsparseHybPartition_t   partitionType)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          n,
+                          descrA,
+                          csrSortedValA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          hybA,
+                          userEllWidth,
+                          partitionType);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_scsr2hyb((rocsparse_handle)handle,
                            m,
@@ -8977,6 +12275,17 @@ hipsparseStatus_t hipsparseDcsr2hyb(hipsparseHandle_t         handle,
                                     int                       userEllWidth,
                                     hipsparseHybPartition_t   partitionType)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          n,
+                          descrA,
+                          csrSortedValA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          hybA,
+                          userEllWidth,
+                          partitionType);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dcsr2hyb((rocsparse_handle)handle,
                            m,
@@ -9001,6 +12310,17 @@ hipsparseStatus_t hipsparseCcsr2hyb(hipsparseHandle_t         handle,
                                     int                       userEllWidth,
                                     hipsparseHybPartition_t   partitionType)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          n,
+                          descrA,
+                          csrSortedValA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          hybA,
+                          userEllWidth,
+                          partitionType);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_ccsr2hyb((rocsparse_handle)handle,
                            m,
@@ -9025,6 +12345,17 @@ hipsparseStatus_t hipsparseZcsr2hyb(hipsparseHandle_t         handle,
                                     int                       userEllWidth,
                                     hipsparseHybPartition_t   partitionType)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          n,
+                          descrA,
+                          csrSortedValA,
+                          csrSortedRowPtrA,
+                          csrSortedColIndA,
+                          hybA,
+                          userEllWidth,
+                          partitionType);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsr2hyb((rocsparse_handle)handle,
                            m,
@@ -9049,6 +12380,17 @@ hipsparseStatus_t hipsparseSgebsr2gebsc_bufferSize(hipsparseHandle_t handle,
                                                    int               col_block_dim,
                                                    size_t*           p_buffer_size)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          mb,
+                          nb,
+                          nnzb,
+                          bsr_val,
+                          bsr_row_ptr,
+                          bsr_col_ind,
+                          row_block_dim,
+                          col_block_dim,
+                          p_buffer_size);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_sgebsr2gebsc_buffer_size((rocsparse_handle)handle,
                                                                  mb,
                                                                  nb,
@@ -9073,6 +12415,17 @@ hipsparseStatus_t hipsparseDgebsr2gebsc_bufferSize(hipsparseHandle_t handle,
                                                    int               col_block_dim,
                                                    size_t*           p_buffer_size)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          mb,
+                          nb,
+                          nnzb,
+                          bsr_val,
+                          bsr_row_ptr,
+                          bsr_col_ind,
+                          row_block_dim,
+                          col_block_dim,
+                          p_buffer_size);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_dgebsr2gebsc_buffer_size((rocsparse_handle)handle,
                                                                  mb,
                                                                  nb,
@@ -9097,6 +12450,17 @@ hipsparseStatus_t hipsparseCgebsr2gebsc_bufferSize(hipsparseHandle_t handle,
                                                    int               col_block_dim,
                                                    size_t*           p_buffer_size)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          mb,
+                          nb,
+                          nnzb,
+                          bsr_val,
+                          bsr_row_ptr,
+                          bsr_col_ind,
+                          row_block_dim,
+                          col_block_dim,
+                          p_buffer_size);
+
 
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_cgebsr2gebsc_buffer_size((rocsparse_handle)handle,
@@ -9123,6 +12487,17 @@ hipsparseStatus_t hipsparseZgebsr2gebsc_bufferSize(hipsparseHandle_t       handl
                                                    int                     col_block_dim,
                                                    size_t*                 p_buffer_size)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          mb,
+                          nb,
+                          nnzb,
+                          bsr_val,
+                          bsr_row_ptr,
+                          bsr_col_ind,
+                          row_block_dim,
+                          col_block_dim,
+                          p_buffer_size);
+
 
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_zgebsr2gebsc_buffer_size((rocsparse_handle)handle,
@@ -9154,6 +12529,22 @@ hipsparseStatus_t hipsparseSgebsr2gebsc(hipsparseHandle_t    handle,
                                         hipsparseIndexBase_t idx_base,
                                         void*                temp_buffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          mb,
+                          nb,
+                          nnzb,
+                          bsr_val,
+                          bsr_row_ptr,
+                          bsr_col_ind,
+                          row_block_dim,
+                          col_block_dim,
+                          bsc_val,
+                          bsc_row_ind,
+                          bsc_col_ptr,
+                          copy_values,
+                          idx_base,
+                          temp_buffer);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_sgebsr2gebsc((rocsparse_handle)handle,
                                                      mb,
                                                      nb,
@@ -9188,6 +12579,22 @@ hipsparseStatus_t hipsparseDgebsr2gebsc(hipsparseHandle_t    handle,
                                         hipsparseIndexBase_t idx_base,
                                         void*                temp_buffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          mb,
+                          nb,
+                          nnzb,
+                          bsr_val,
+                          bsr_row_ptr,
+                          bsr_col_ind,
+                          row_block_dim,
+                          col_block_dim,
+                          bsc_val,
+                          bsc_row_ind,
+                          bsc_col_ptr,
+                          copy_values,
+                          idx_base,
+                          temp_buffer);
+
 
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_dgebsr2gebsc((rocsparse_handle)handle,
                                                      mb,
@@ -9223,6 +12630,22 @@ hipsparseStatus_t hipsparseCgebsr2gebsc(hipsparseHandle_t    handle,
                                         hipsparseIndexBase_t idx_base,
                                         void*                temp_buffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          mb,
+                          nb,
+                          nnzb,
+                          bsr_val,
+                          bsr_row_ptr,
+                          bsr_col_ind,
+                          row_block_dim,
+                          col_block_dim,
+                          bsc_val,
+                          bsc_row_ind,
+                          bsc_col_ptr,
+                          copy_values,
+                          idx_base,
+                          temp_buffer);
+
 
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_cgebsr2gebsc((rocsparse_handle)handle,
                                                      mb,
@@ -9258,6 +12681,22 @@ hipsparseStatus_t hipsparseZgebsr2gebsc(hipsparseHandle_t       handle,
                                         hipsparseIndexBase_t    idx_base,
                                         void*                   temp_buffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          mb,
+                          nb,
+                          nnzb,
+                          bsr_val,
+                          bsr_row_ptr,
+                          bsr_col_ind,
+                          row_block_dim,
+                          col_block_dim,
+                          bsc_val,
+                          bsc_row_ind,
+                          bsc_col_ptr,
+                          copy_values,
+                          idx_base,
+                          temp_buffer);
+
 
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_zgebsr2gebsc((rocsparse_handle)handle,
                                                      mb,
@@ -9289,6 +12728,18 @@ hipsparseStatus_t hipsparseScsr2gebsr_bufferSize(hipsparseHandle_t         handl
                                                  int                       col_block_dim,
                                                  size_t*                   p_buffer_size)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dir,
+                          m,
+                          n,
+                          csr_descr,
+                          csr_val,
+                          csr_row_ptr,
+                          csr_col_ind,
+                          row_block_dim,
+                          col_block_dim,
+                          p_buffer_size);
+
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_scsr2gebsr_buffer_size((rocsparse_handle)handle,
                                          hipsparse::hipDirectionToHCCDirection(dir),
@@ -9316,6 +12767,18 @@ hipsparseStatus_t hipsparseDcsr2gebsr_bufferSize(hipsparseHandle_t         handl
                                                  int                       col_block_dim,
                                                  size_t*                   p_buffer_size)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dir,
+                          m,
+                          n,
+                          csr_descr,
+                          csr_val,
+                          csr_row_ptr,
+                          csr_col_ind,
+                          row_block_dim,
+                          col_block_dim,
+                          p_buffer_size);
+
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_dcsr2gebsr_buffer_size((rocsparse_handle)handle,
                                          hipsparse::hipDirectionToHCCDirection(dir),
@@ -9343,6 +12806,18 @@ hipsparseStatus_t hipsparseCcsr2gebsr_bufferSize(hipsparseHandle_t         handl
                                                  int                       col_block_dim,
                                                  size_t*                   p_buffer_size)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dir,
+                          m,
+                          n,
+                          csr_descr,
+                          csr_val,
+                          csr_row_ptr,
+                          csr_col_ind,
+                          row_block_dim,
+                          col_block_dim,
+                          p_buffer_size);
+
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_ccsr2gebsr_buffer_size((rocsparse_handle)handle,
                                          hipsparse::hipDirectionToHCCDirection(dir),
@@ -9370,6 +12845,18 @@ hipsparseStatus_t hipsparseZcsr2gebsr_bufferSize(hipsparseHandle_t         handl
                                                  int                       col_block_dim,
                                                  size_t*                   p_buffer_size)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dir,
+                          m,
+                          n,
+                          csr_descr,
+                          csr_val,
+                          csr_row_ptr,
+                          csr_col_ind,
+                          row_block_dim,
+                          col_block_dim,
+                          p_buffer_size);
+
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_zcsr2gebsr_buffer_size((rocsparse_handle)handle,
                                          hipsparse::hipDirectionToHCCDirection(dir),
@@ -9399,6 +12886,20 @@ hipsparseStatus_t hipsparseXcsr2gebsrNnz(hipsparseHandle_t         handle,
                                          int*                      bsr_nnz_devhost,
                                          void*                     p_buffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dir,
+                          m,
+                          n,
+                          csr_descr,
+                          csr_row_ptr,
+                          csr_col_ind,
+                          bsr_descr,
+                          bsr_row_ptr,
+                          row_block_dim,
+                          col_block_dim,
+                          bsr_nnz_devhost,
+                          p_buffer);
+
 
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_csr2gebsr_nnz((rocsparse_handle)handle,
                                                       hipsparse::hipDirectionToHCCDirection(dir),
@@ -9432,6 +12933,22 @@ hipsparseStatus_t hipsparseScsr2gebsr(hipsparseHandle_t         handle,
                                       int                       col_block_dim,
                                       void*                     p_buffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dir,
+                          m,
+                          n,
+                          csr_descr,
+                          csr_val,
+                          csr_row_ptr,
+                          csr_col_ind,
+                          bsr_descr,
+                          bsr_val,
+                          bsr_row_ptr,
+                          bsr_col_ind,
+                          row_block_dim,
+                          col_block_dim,
+                          p_buffer);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_scsr2gebsr((rocsparse_handle)handle,
                                                    hipsparse::hipDirectionToHCCDirection(dir),
                                                    m,
@@ -9466,6 +12983,22 @@ hipsparseStatus_t hipsparseDcsr2gebsr(hipsparseHandle_t         handle,
                                       int                       col_block_dim,
                                       void*                     p_buffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dir,
+                          m,
+                          n,
+                          csr_descr,
+                          csr_val,
+                          csr_row_ptr,
+                          csr_col_ind,
+                          bsr_descr,
+                          bsr_val,
+                          bsr_row_ptr,
+                          bsr_col_ind,
+                          row_block_dim,
+                          col_block_dim,
+                          p_buffer);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_dcsr2gebsr((rocsparse_handle)handle,
                                                    hipsparse::hipDirectionToHCCDirection(dir),
                                                    m,
@@ -9500,6 +13033,22 @@ hipsparseStatus_t hipsparseCcsr2gebsr(hipsparseHandle_t         handle,
                                       int                       col_block_dim,
                                       void*                     p_buffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dir,
+                          m,
+                          n,
+                          csr_descr,
+                          csr_val,
+                          csr_row_ptr,
+                          csr_col_ind,
+                          bsr_descr,
+                          bsr_val,
+                          bsr_row_ptr,
+                          bsr_col_ind,
+                          row_block_dim,
+                          col_block_dim,
+                          p_buffer);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_ccsr2gebsr((rocsparse_handle)handle,
                                                    hipsparse::hipDirectionToHCCDirection(dir),
                                                    m,
@@ -9534,6 +13083,22 @@ hipsparseStatus_t hipsparseZcsr2gebsr(hipsparseHandle_t         handle,
                                       int                       col_block_dim,
                                       void*                     p_buffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dir,
+                          m,
+                          n,
+                          csr_descr,
+                          csr_val,
+                          csr_row_ptr,
+                          csr_col_ind,
+                          bsr_descr,
+                          bsr_val,
+                          bsr_row_ptr,
+                          bsr_col_ind,
+                          row_block_dim,
+                          col_block_dim,
+                          p_buffer);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_zcsr2gebsr((rocsparse_handle)handle,
                                                    hipsparse::hipDirectionToHCCDirection(dir),
                                                    m,
@@ -9566,6 +13131,20 @@ hipsparseStatus_t hipsparseScsr2bsr(hipsparseHandle_t         handle,
                                     int*                      bsrRowPtrC,
                                     int*                      bsrColIndC)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dirA,
+                          m,
+                          n,
+                          descrA,
+                          csrValA,
+                          csrRowPtrA,
+                          csrColIndA,
+                          blockDim,
+                          descrC,
+                          bsrValC,
+                          bsrRowPtrC,
+                          bsrColIndC);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_scsr2bsr((rocsparse_handle)handle,
                                                  hipsparse::hipDirectionToHCCDirection(dirA),
                                                  m,
@@ -9596,6 +13175,20 @@ hipsparseStatus_t hipsparseDcsr2bsr(hipsparseHandle_t         handle,
                                     int*                      bsrRowPtrC,
                                     int*                      bsrColIndC)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dirA,
+                          m,
+                          n,
+                          descrA,
+                          csrValA,
+                          csrRowPtrA,
+                          csrColIndA,
+                          blockDim,
+                          descrC,
+                          bsrValC,
+                          bsrRowPtrC,
+                          bsrColIndC);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_dcsr2bsr((rocsparse_handle)handle,
                                                  hipsparse::hipDirectionToHCCDirection(dirA),
                                                  m,
@@ -9626,6 +13219,20 @@ hipsparseStatus_t hipsparseCcsr2bsr(hipsparseHandle_t         handle,
                                     int*                      bsrRowPtrC,
                                     int*                      bsrColIndC)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dirA,
+                          m,
+                          n,
+                          descrA,
+                          csrValA,
+                          csrRowPtrA,
+                          csrColIndA,
+                          blockDim,
+                          descrC,
+                          bsrValC,
+                          bsrRowPtrC,
+                          bsrColIndC);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_ccsr2bsr((rocsparse_handle)handle,
                                                  hipsparse::hipDirectionToHCCDirection(dirA),
                                                  m,
@@ -9656,6 +13263,20 @@ hipsparseStatus_t hipsparseZcsr2bsr(hipsparseHandle_t         handle,
                                     int*                      bsrRowPtrC,
                                     int*                      bsrColIndC)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dirA,
+                          m,
+                          n,
+                          descrA,
+                          csrValA,
+                          csrRowPtrA,
+                          csrColIndA,
+                          blockDim,
+                          descrC,
+                          bsrValC,
+                          bsrRowPtrC,
+                          bsrColIndC);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_zcsr2bsr((rocsparse_handle)handle,
                                                  hipsparse::hipDirectionToHCCDirection(dirA),
                                                  m,
@@ -9686,6 +13307,20 @@ hipsparseStatus_t hipsparseSbsr2csr(hipsparseHandle_t         handle,
                                     int*                      csrRowPtrC,
                                     int*                      csrColIndC)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dirA,
+                          mb,
+                          nb,
+                          descrA,
+                          bsrValA,
+                          bsrRowPtrA,
+                          bsrColIndA,
+                          blockDim,
+                          descrC,
+                          csrValC,
+                          csrRowPtrC,
+                          csrColIndC);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_sbsr2csr((rocsparse_handle)handle,
                                                  hipsparse::hipDirectionToHCCDirection(dirA),
                                                  mb,
@@ -9716,6 +13351,20 @@ hipsparseStatus_t hipsparseDbsr2csr(hipsparseHandle_t         handle,
                                     int*                      csrRowPtrC,
                                     int*                      csrColIndC)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dirA,
+                          mb,
+                          nb,
+                          descrA,
+                          bsrValA,
+                          bsrRowPtrA,
+                          bsrColIndA,
+                          blockDim,
+                          descrC,
+                          csrValC,
+                          csrRowPtrC,
+                          csrColIndC);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_dbsr2csr((rocsparse_handle)handle,
                                                  hipsparse::hipDirectionToHCCDirection(dirA),
                                                  mb,
@@ -9746,6 +13395,20 @@ hipsparseStatus_t hipsparseCbsr2csr(hipsparseHandle_t         handle,
                                     int*                      csrRowPtrC,
                                     int*                      csrColIndC)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dirA,
+                          mb,
+                          nb,
+                          descrA,
+                          bsrValA,
+                          bsrRowPtrA,
+                          bsrColIndA,
+                          blockDim,
+                          descrC,
+                          csrValC,
+                          csrRowPtrC,
+                          csrColIndC);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_cbsr2csr((rocsparse_handle)handle,
                                                  hipsparse::hipDirectionToHCCDirection(dirA),
                                                  mb,
@@ -9776,6 +13439,20 @@ hipsparseStatus_t hipsparseZbsr2csr(hipsparseHandle_t         handle,
                                     int*                      csrRowPtrC,
                                     int*                      csrColIndC)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dirA,
+                          mb,
+                          nb,
+                          descrA,
+                          bsrValA,
+                          bsrRowPtrA,
+                          bsrColIndA,
+                          blockDim,
+                          descrC,
+                          csrValC,
+                          csrRowPtrC,
+                          csrColIndC);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_zbsr2csr((rocsparse_handle)handle,
                                                  hipsparse::hipDirectionToHCCDirection(dirA),
                                                  mb,
@@ -9807,6 +13484,21 @@ hipsparseStatus_t hipsparseSgebsr2csr(hipsparseHandle_t         handle,
                                       int*                      csrRowPtrC,
                                       int*                      csrColIndC)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dirA,
+                          mb,
+                          nb,
+                          descrA,
+                          bsrValA,
+                          bsrRowPtrA,
+                          bsrColIndA,
+                          rowBlockDim,
+                          colBlockDim,
+                          descrC,
+                          csrValC,
+                          csrRowPtrC,
+                          csrColIndC);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_sgebsr2csr((rocsparse_handle)handle,
                                                    hipsparse::hipDirectionToHCCDirection(dirA),
                                                    mb,
@@ -9839,6 +13531,21 @@ hipsparseStatus_t hipsparseDgebsr2csr(hipsparseHandle_t         handle,
                                       int*                      csrRowPtrC,
                                       int*                      csrColIndC)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dirA,
+                          mb,
+                          nb,
+                          descrA,
+                          bsrValA,
+                          bsrRowPtrA,
+                          bsrColIndA,
+                          rowBlockDim,
+                          colBlockDim,
+                          descrC,
+                          csrValC,
+                          csrRowPtrC,
+                          csrColIndC);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_dgebsr2csr((rocsparse_handle)handle,
                                                    hipsparse::hipDirectionToHCCDirection(dirA),
                                                    mb,
@@ -9871,6 +13578,21 @@ hipsparseStatus_t hipsparseCgebsr2csr(hipsparseHandle_t         handle,
                                       int*                      csrRowPtrC,
                                       int*                      csrColIndC)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dirA,
+                          mb,
+                          nb,
+                          descrA,
+                          bsrValA,
+                          bsrRowPtrA,
+                          bsrColIndA,
+                          rowBlockDim,
+                          colBlockDim,
+                          descrC,
+                          csrValC,
+                          csrRowPtrC,
+                          csrColIndC);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_cgebsr2csr((rocsparse_handle)handle,
                                                    hipsparse::hipDirectionToHCCDirection(dirA),
                                                    mb,
@@ -9903,6 +13625,21 @@ hipsparseStatus_t hipsparseZgebsr2csr(hipsparseHandle_t         handle,
                                       int*                      csrRowPtrC,
                                       int*                      csrColIndC)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dirA,
+                          mb,
+                          nb,
+                          descrA,
+                          bsrValA,
+                          bsrRowPtrA,
+                          bsrColIndA,
+                          rowBlockDim,
+                          colBlockDim,
+                          descrC,
+                          csrValC,
+                          csrRowPtrC,
+                          csrColIndC);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_zgebsr2csr((rocsparse_handle)handle,
                                                    hipsparse::hipDirectionToHCCDirection(dirA),
                                                    mb,
@@ -9934,6 +13671,20 @@ hipsparseStatus_t hipsparseScsr2csr_compress(hipsparseHandle_t         handle,
                                              int*                      csrRowPtrC,
                                              float                     tol)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          n,
+                          descrA,
+                          csrValA,
+                          csrColIndA,
+                          csrRowPtrA,
+                          nnzA,
+                          nnzPerRow,
+                          csrValC,
+                          csrColIndC,
+                          csrRowPtrC,
+                          tol);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_scsr2csr_compress((rocsparse_handle)handle,
                                     m,
@@ -9964,6 +13715,20 @@ hipsparseStatus_t hipsparseDcsr2csr_compress(hipsparseHandle_t         handle,
                                              int*                      csrRowPtrC,
                                              double                    tol)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          n,
+                          descrA,
+                          csrValA,
+                          csrColIndA,
+                          csrRowPtrA,
+                          nnzA,
+                          nnzPerRow,
+                          csrValC,
+                          csrColIndC,
+                          csrRowPtrC,
+                          tol);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dcsr2csr_compress((rocsparse_handle)handle,
                                     m,
@@ -9994,6 +13759,20 @@ hipsparseStatus_t hipsparseCcsr2csr_compress(hipsparseHandle_t         handle,
                                              int*                      csrRowPtrC,
                                              hipComplex                tol)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          n,
+                          descrA,
+                          csrValA,
+                          csrColIndA,
+                          csrRowPtrA,
+                          nnzA,
+                          nnzPerRow,
+                          csrValC,
+                          csrColIndC,
+                          csrRowPtrC,
+                          tol);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_ccsr2csr_compress((rocsparse_handle)handle,
                                     m,
@@ -10024,6 +13803,20 @@ hipsparseStatus_t hipsparseZcsr2csr_compress(hipsparseHandle_t         handle,
                                              int*                      csrRowPtrC,
                                              hipDoubleComplex          tol)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          n,
+                          descrA,
+                          csrValA,
+                          csrColIndA,
+                          csrRowPtrA,
+                          nnzA,
+                          nnzPerRow,
+                          csrValC,
+                          csrColIndC,
+                          csrRowPtrC,
+                          tol);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsr2csr_compress((rocsparse_handle)handle,
                                     m,
@@ -10055,6 +13848,21 @@ hipsparseStatus_t hipsparseSpruneCsr2csr_bufferSize(hipsparseHandle_t         ha
                                                     const int*                csrColIndC,
                                                     size_t*                   bufferSize)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          n,
+                          nnzA,
+                          descrA,
+                          csrValA,
+                          csrRowPtrA,
+                          csrColIndA,
+                          threshold,
+                          descrC,
+                          csrValC,
+                          csrRowPtrC,
+                          csrColIndC,
+                          bufferSize);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sprune_csr2csr_buffer_size((rocsparse_handle)handle,
                                              m,
@@ -10087,6 +13895,21 @@ hipsparseStatus_t hipsparseDpruneCsr2csr_bufferSize(hipsparseHandle_t         ha
                                                     const int*                csrColIndC,
                                                     size_t*                   bufferSize)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          n,
+                          nnzA,
+                          descrA,
+                          csrValA,
+                          csrRowPtrA,
+                          csrColIndA,
+                          threshold,
+                          descrC,
+                          csrValC,
+                          csrRowPtrC,
+                          csrColIndC,
+                          bufferSize);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dprune_csr2csr_buffer_size((rocsparse_handle)handle,
                                              m,
@@ -10119,6 +13942,21 @@ hipsparseStatus_t hipsparseSpruneCsr2csr_bufferSizeExt(hipsparseHandle_t
                                                        const int*                csrColIndC,
                                                        size_t*                   bufferSize)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          n,
+                          nnzA,
+                          descrA,
+                          csrValA,
+                          csrRowPtrA,
+                          csrColIndA,
+                          threshold,
+                          descrC,
+                          csrValC,
+                          csrRowPtrC,
+                          csrColIndC,
+                          bufferSize);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sprune_csr2csr_buffer_size((rocsparse_handle)handle,
                                              m,
@@ -10151,6 +13989,21 @@ hipsparseStatus_t hipsparseDpruneCsr2csr_bufferSizeExt(hipsparseHandle_t
                                                        const int*                csrColIndC,
                                                        size_t*                   bufferSize)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          n,
+                          nnzA,
+                          descrA,
+                          csrValA,
+                          csrRowPtrA,
+                          csrColIndA,
+                          threshold,
+                          descrC,
+                          csrValC,
+                          csrRowPtrC,
+                          csrColIndC,
+                          bufferSize);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dprune_csr2csr_buffer_size((rocsparse_handle)handle,
                                              m,
@@ -10182,6 +14035,20 @@ hipsparseStatus_t hipsparseSpruneCsr2csrNnz(hipsparseHandle_t         handle,
                                             int*                      nnzTotalDevHostPtr,
                                             void*                     buffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          n,
+                          nnzA,
+                          descrA,
+                          csrValA,
+                          csrRowPtrA,
+                          csrColIndA,
+                          threshold,
+                          descrC,
+                          csrRowPtrC,
+                          nnzTotalDevHostPtr,
+                          buffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sprune_csr2csr_nnz((rocsparse_handle)handle,
                                      m,
@@ -10212,6 +14079,20 @@ hipsparseStatus_t hipsparseDpruneCsr2csrNnz(hipsparseHandle_t         handle,
                                             int*                      nnzTotalDevHostPtr,
                                             void*                     buffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          n,
+                          nnzA,
+                          descrA,
+                          csrValA,
+                          csrRowPtrA,
+                          csrColIndA,
+                          threshold,
+                          descrC,
+                          csrRowPtrC,
+                          nnzTotalDevHostPtr,
+                          buffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dprune_csr2csr_nnz((rocsparse_handle)handle,
                                      m,
@@ -10243,6 +14124,21 @@ hipsparseStatus_t hipsparseSpruneCsr2csr(hipsparseHandle_t         handle,
                                          int*                      csrColIndC,
                                          void*                     buffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          n,
+                          nnzA,
+                          descrA,
+                          csrValA,
+                          csrRowPtrA,
+                          csrColIndA,
+                          threshold,
+                          descrC,
+                          csrValC,
+                          csrRowPtrC,
+                          csrColIndC,
+                          buffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sprune_csr2csr((rocsparse_handle)handle,
                                  m,
@@ -10275,6 +14171,21 @@ hipsparseStatus_t hipsparseDpruneCsr2csr(hipsparseHandle_t         handle,
                                          int*                      csrColIndC,
                                          void*                     buffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          n,
+                          nnzA,
+                          descrA,
+                          csrValA,
+                          csrRowPtrA,
+                          csrColIndA,
+                          threshold,
+                          descrC,
+                          csrValC,
+                          csrRowPtrC,
+                          csrColIndC,
+                          buffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dprune_csr2csr((rocsparse_handle)handle,
                                  m,
@@ -10308,6 +14219,22 @@ hipsparseStatus_t hipsparseSpruneCsr2csrByPercentage_bufferSize(hipsparseHandle_
                                                                 pruneInfo_t info,
                                                                 size_t*     bufferSize)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          n,
+                          nnzA,
+                          descrA,
+                          csrValA,
+                          csrRowPtrA,
+                          csrColIndA,
+                          percentage,
+                          descrC,
+                          csrValC,
+                          csrRowPtrC,
+                          csrColIndC,
+                          info,
+                          bufferSize);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sprune_csr2csr_by_percentage_buffer_size((rocsparse_handle)handle,
                                                            m,
@@ -10342,6 +14269,22 @@ hipsparseStatus_t hipsparseDpruneCsr2csrByPercentage_bufferSize(hipsparseHandle_
                                                                 pruneInfo_t info,
                                                                 size_t*     bufferSize)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          n,
+                          nnzA,
+                          descrA,
+                          csrValA,
+                          csrRowPtrA,
+                          csrColIndA,
+                          percentage,
+                          descrC,
+                          csrValC,
+                          csrRowPtrC,
+                          csrColIndC,
+                          info,
+                          bufferSize);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dprune_csr2csr_by_percentage_buffer_size((rocsparse_handle)handle,
                                                            m,
@@ -10376,6 +14319,22 @@ hipsparseStatus_t hipsparseSpruneCsr2csrByPercentage_bufferSizeExt(hipsparseHand
                                                                    pruneInfo_t  info,
                                                                    size_t*      bufferSize)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          n,
+                          nnzA,
+                          descrA,
+                          csrValA,
+                          csrRowPtrA,
+                          csrColIndA,
+                          percentage,
+                          descrC,
+                          csrValC,
+                          csrRowPtrC,
+                          csrColIndC,
+                          info,
+                          bufferSize);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sprune_csr2csr_by_percentage_buffer_size((rocsparse_handle)handle,
                                                            m,
@@ -10410,6 +14369,22 @@ hipsparseStatus_t hipsparseDpruneCsr2csrByPercentage_bufferSizeExt(hipsparseHand
                                                                    pruneInfo_t   info,
                                                                    size_t*       bufferSize)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          n,
+                          nnzA,
+                          descrA,
+                          csrValA,
+                          csrRowPtrA,
+                          csrColIndA,
+                          percentage,
+                          descrC,
+                          csrValC,
+                          csrRowPtrC,
+                          csrColIndC,
+                          info,
+                          bufferSize);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dprune_csr2csr_by_percentage_buffer_size((rocsparse_handle)handle,
                                                            m,
@@ -10443,6 +14418,21 @@ hipsparseStatus_t hipsparseSpruneCsr2csrNnzByPercentage(hipsparseHandle_t
                                                         pruneInfo_t info,
                                                         void*       buffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          n,
+                          nnzA,
+                          descrA,
+                          csrValA,
+                          csrRowPtrA,
+                          csrColIndA,
+                          percentage,
+                          descrC,
+                          csrRowPtrC,
+                          nnzTotalDevHostPtr,
+                          info,
+                          buffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sprune_csr2csr_nnz_by_percentage((rocsparse_handle)handle,
                                                    m,
@@ -10475,6 +14465,21 @@ hipsparseStatus_t hipsparseDpruneCsr2csrNnzByPercentage(hipsparseHandle_t
                                                         pruneInfo_t info,
                                                         void*       buffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          n,
+                          nnzA,
+                          descrA,
+                          csrValA,
+                          csrRowPtrA,
+                          csrColIndA,
+                          percentage,
+                          descrC,
+                          csrRowPtrC,
+                          nnzTotalDevHostPtr,
+                          info,
+                          buffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dprune_csr2csr_nnz_by_percentage((rocsparse_handle)handle,
                                                    m,
@@ -10508,6 +14513,22 @@ hipsparseStatus_t hipsparseSpruneCsr2csrByPercentage(hipsparseHandle_t         h
                                                      pruneInfo_t               info,
                                                      void*                     buffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          n,
+                          nnzA,
+                          descrA,
+                          csrValA,
+                          csrRowPtrA,
+                          csrColIndA,
+                          percentage,
+                          descrC,
+                          csrValC,
+                          csrRowPtrC,
+                          csrColIndC,
+                          info,
+                          buffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sprune_csr2csr_by_percentage((rocsparse_handle)handle,
                                                m,
@@ -10542,6 +14563,22 @@ hipsparseStatus_t hipsparseDpruneCsr2csrByPercentage(hipsparseHandle_t         h
                                                      pruneInfo_t               info,
                                                      void*                     buffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          n,
+                          nnzA,
+                          descrA,
+                          csrValA,
+                          csrRowPtrA,
+                          csrColIndA,
+                          percentage,
+                          descrC,
+                          csrValC,
+                          csrRowPtrC,
+                          csrColIndC,
+                          info,
+                          buffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dprune_csr2csr_by_percentage((rocsparse_handle)handle,
                                                m,
@@ -10567,6 +14604,8 @@ hipsparseStatus_t hipsparseShyb2csr(hipsparseHandle_t         handle,
                                     int*                      csrSortedRowPtrA,
                                     int*                      csrSortedColIndA)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, descrA, hybA, csrSortedValA, csrSortedRowPtrA, csrSortedColIndA);
+
     // Determine buffer size
     size_t buffer_size = 0;
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_hyb2csr_buffer_size((rocsparse_handle)handle,
@@ -10575,9 +14614,9 @@ hipsparseStatus_t hipsparseShyb2csr(hipsparseHandle_t         handle,
                                                             csrSortedRowPtrA,
                                                             &buffer_size));
 
-    // Allocate buffer
+    // Obtain buffer from the handle workspace
     void* buffer = nullptr;
-    RETURN_IF_HIP_ERROR(hipMalloc(&buffer, buffer_size));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::workspaceAcquire(handle, buffer_size, &buffer));
 
     // Format conversion
     hipsparseStatus_t status = hipsparse::rocSPARSEStatusToHIPStatus(
@@ -10589,9 +14628,6 @@ hipsparseStatus_t hipsparseShyb2csr(hipsparseHandle_t         handle,
                            csrSortedColIndA,
                            buffer));
 
-    // Free buffer
-    RETURN_IF_HIP_ERROR(hipFree(buffer));
-
     return status;
 }
 
@@ -10602,6 +14638,8 @@ hipsparseStatus_t hipsparseDhyb2csr(hipsparseHandle_t         handle,
                                     int*                      csrSortedRowPtrA,
                                     int*                      csrSortedColIndA)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, descrA, hybA, csrSortedValA, csrSortedRowPtrA, csrSortedColIndA);
+
     // Determine buffer size
     size_t buffer_size = 0;
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_hyb2csr_buffer_size((rocsparse_handle)handle,
@@ -10610,9 +14648,9 @@ hipsparseStatus_t hipsparseDhyb2csr(hipsparseHandle_t         handle,
                                                             csrSortedRowPtrA,
                                                             &buffer_size));
 
-    // Allocate buffer
+    // Obtain buffer from the handle workspace
     void* buffer = nullptr;
-    RETURN_IF_HIP_ERROR(hipMalloc(&buffer, buffer_size));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::workspaceAcquire(handle, buffer_size, &buffer));
 
     // Format conversion
     hipsparseStatus_t status = hipsparse::rocSPARSEStatusToHIPStatus(
@@ -10624,9 +14662,6 @@ hipsparseStatus_t hipsparseDhyb2csr(hipsparseHandle_t         handle,
                            csrSortedColIndA,
                            buffer));
 
-    // Free buffer
-    RETURN_IF_HIP_ERROR(hipFree(buffer));
-
     return status;
 }
 
@@ -10637,6 +14672,8 @@ hipsparseStatus_t hipsparseChyb2csr(hipsparseHandle_t         handle,
                                     int*                      csrSortedRowPtrA,
                                     int*                      csrSortedColIndA)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, descrA, hybA, csrSortedValA, csrSortedRowPtrA, csrSortedColIndA);
+
     // Determine buffer size
     size_t buffer_size = 0;
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_hyb2csr_buffer_size((rocsparse_handle)handle,
@@ -10645,9 +14682,9 @@ hipsparseStatus_t hipsparseChyb2csr(hipsparseHandle_t         handle,
                                                             csrSortedRowPtrA,
                                                             &buffer_size));
 
-    // Allocate buffer
+    // Obtain buffer from the handle workspace
     void* buffer = nullptr;
-    RETURN_IF_HIP_ERROR(hipMalloc(&buffer, buffer_size));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::workspaceAcquire(handle, buffer_size, &buffer));
 
     // Format conversion
     hipsparseStatus_t status = hipsparse::rocSPARSEStatusToHIPStatus(
@@ -10659,9 +14696,6 @@ hipsparseStatus_t hipsparseChyb2csr(hipsparseHandle_t         handle,
                            csrSortedColIndA,
                            buffer));
 
-    // Free buffer
-    RETURN_IF_HIP_ERROR(hipFree(buffer));
-
     return status;
 }
 
@@ -10672,6 +14706,8 @@ hipsparseStatus_t hipsparseZhyb2csr(hipsparseHandle_t         handle,
                                     int*                      csrSortedRowPtrA,
                                     int*                      csrSortedColIndA)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, descrA, hybA, csrSortedValA, csrSortedRowPtrA, csrSortedColIndA);
+
     // Determine buffer size
     size_t buffer_size = 0;
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_hyb2csr_buffer_size((rocsparse_handle)handle,
@@ -10680,9 +14716,9 @@ hipsparseStatus_t hipsparseZhyb2csr(hipsparseHandle_t         handle,
                                                             csrSortedRowPtrA,
                                                             &buffer_size));
 
-    // Allocate buffer
+    // Obtain buffer from the handle workspace
     void* buffer = nullptr;
-    RETURN_IF_HIP_ERROR(hipMalloc(&buffer, buffer_size));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::workspaceAcquire(handle, buffer_size, &buffer));
 
     // Format conversion
     hipsparseStatus_t status = hipsparse::rocSPARSEStatusToHIPStatus(
@@ -10694,9 +14730,6 @@ hipsparseStatus_t hipsparseZhyb2csr(hipsparseHandle_t         handle,
                            csrSortedColIndA,
                            buffer));
 
-    // Free buffer
-    RETURN_IF_HIP_ERROR(hipFree(buffer));
-
     return status;
 }
 
@@ -10710,6 +14743,8 @@ hipsparseStatus_t hipsparseSnnz(hipsparseHandle_t         handle,
                                 int*                      nnzPerRowColumn,
                                 int*                      nnzTotalDevHostPtr)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, dirA, m, n, descrA, A, lda, nnzPerRowColumn, nnzTotalDevHostPtr);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_snnz((rocsparse_handle)handle,
                                              hipsparse::hipDirectionToHCCDirection(dirA),
                                              m,
@@ -10732,6 +14767,8 @@ hipsparseStatus_t hipsparseDnnz(hipsparseHandle_t         handle,
                                 int*                      nnzPerRowColumn,
                                 int*                      nnzTotalDevHostPtr)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, dirA, m, n, descrA, A, lda, nnzPerRowColumn, nnzTotalDevHostPtr);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_dnnz((rocsparse_handle)handle,
                                              hipsparse::hipDirectionToHCCDirection(dirA),
                                              m,
@@ -10754,6 +14791,8 @@ hipsparseStatus_t hipsparseCnnz(hipsparseHandle_t         handle,
                                 int*                      nnzPerRowColumn,
                                 int*                      nnzTotalDevHostPtr)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, dirA, m, n, descrA, A, lda, nnzPerRowColumn, nnzTotalDevHostPtr);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_cnnz((rocsparse_handle)handle,
                                              hipsparse::hipDirectionToHCCDirection(dirA),
                                              m,
@@ -10776,6 +14815,8 @@ hipsparseStatus_t hipsparseZnnz(hipsparseHandle_t         handle,
                                 int*                      nnzPerRowColumn,
                                 int*                      nnzTotalDevHostPtr)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, dirA, m, n, descrA, A, lda, nnzPerRowColumn, nnzTotalDevHostPtr);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_znnz((rocsparse_handle)handle,
                                              hipsparse::hipDirectionToHCCDirection(dirA),
                                              m,
@@ -10799,6 +14840,8 @@ hipsparseStatus_t hipsparseSdense2csr(hipsparseHandle_t         handle,
                                       int*                      csrRowPtr,
                                       int*                      csrColInd)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, m, n, descr, A, ld, nnzPerRow, csrVal, csrRowPtr, csrColInd);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_sdense2csr((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -10823,6 +14866,8 @@ hipsparseStatus_t hipsparseDdense2csr(hipsparseHandle_t         handle,
                                       int*                      csrRowPtr,
                                       int*                      csrColInd)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, m, n, descr, A, ld, nnzPerRow, csrVal, csrRowPtr, csrColInd);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_ddense2csr((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -10847,6 +14892,8 @@ hipsparseStatus_t hipsparseCdense2csr(hipsparseHandle_t         handle,
                                       int*                      csrRowPtr,
                                       int*                      csrColInd)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, m, n, descr, A, ld, nnzPerRow, csrVal, csrRowPtr, csrColInd);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_cdense2csr((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -10871,6 +14918,8 @@ hipsparseStatus_t hipsparseZdense2csr(hipsparseHandle_t         handle,
                                       int*                      csrRowPtr,
                                       int*                      csrColInd)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, m, n, descr, A, ld, nnzPerRow, csrVal, csrRowPtr, csrColInd);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_zdense2csr((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -10896,6 +14945,9 @@ hipsparseStatus_t hipsparseSpruneDense2csr_bufferSize(hipsparseHandle_t
                                                       const int*                csrColInd,
                                                       size_t*                   bufferSize)
 {
+    HIPSPARSE_LAYER_SCOPE(
+        handle, m, n, A, lda, threshold, descr, csrVal, csrRowPtr, csrColInd, bufferSize);
+
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_sprune_dense2csr_buffer_size((rocsparse_handle)handle,
                                                m,
@@ -10924,6 +14976,9 @@ hipsparseStatus_t hipsparseDpruneDense2csr_bufferSize(hipsparseHandle_t
                                                       const int*                csrColInd,
                                                       size_t*                   bufferSize)
 {
+    HIPSPARSE_LAYER_SCOPE(
+        handle, m, n, A, lda, threshold, descr, csrVal, csrRowPtr, csrColInd, bufferSize);
+
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_dprune_dense2csr_buffer_size((rocsparse_handle)handle,
                                                m,
@@ -10952,6 +15007,9 @@ hipsparseStatus_t hipsparseSpruneDense2csr_bufferSizeExt(hipsparseHandle_t
                                                          const int*                csrColInd,
                                                          size_t*                   bufferSize)
 {
+    HIPSPARSE_LAYER_SCOPE(
+        handle, m, n, A, lda, threshold, descr, csrVal, csrRowPtr, csrColInd, bufferSize);
+
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_sprune_dense2csr_buffer_size((rocsparse_handle)handle,
                                                m,
@@ -10980,6 +15038,9 @@ hipsparseStatus_t hipsparseDpruneDense2csr_bufferSizeExt(hipsparseHandle_t
                                                          const int*                csrColInd,
                                                          size_t*                   bufferSize)
 {
+    HIPSPARSE_LAYER_SCOPE(
+        handle, m, n, A, lda, threshold, descr, csrVal, csrRowPtr, csrColInd, bufferSize);
+
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_dprune_dense2csr_buffer_size((rocsparse_handle)handle,
                                                m,
@@ -11007,6 +15068,9 @@ hipsparseStatus_t hipsparseSpruneDense2csrNnz(hipsparseHandle_t         handle,
                                               int*                      nnzTotalDevHostPtr,
                                               void*                     buffer)
 {
+    HIPSPARSE_LAYER_SCOPE(
+        handle, m, n, A, lda, threshold, descr, csrRowPtr, nnzTotalDevHostPtr, buffer);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_sprune_dense2csr_nnz((rocsparse_handle)handle,
                                                              m,
                                                              n,
@@ -11032,6 +15096,9 @@ hipsparseStatus_t hipsparseDpruneDense2csrNnz(hipsparseHandle_t         handle,
                                               int*                      nnzTotalDevHostPtr,
                                               void*                     buffer)
 {
+    HIPSPARSE_LAYER_SCOPE(
+        handle, m, n, A, lda, threshold, descr, csrRowPtr, nnzTotalDevHostPtr, buffer);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_dprune_dense2csr_nnz((rocsparse_handle)handle,
                                                              m,
                                                              n,
@@ -11058,6 +15125,9 @@ hipsparseStatus_t hipsparseSpruneDense2csr(hipsparseHandle_t         handle,
                                            int*                      csrColInd,
                                            void*                     buffer)
 {
+    HIPSPARSE_LAYER_SCOPE(
+        handle, m, n, A, lda, threshold, descr, csrVal, csrRowPtr, csrColInd, buffer);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_sprune_dense2csr((rocsparse_handle)handle,
                                                          m,
                                                          n,
@@ -11085,6 +15155,9 @@ hipsparseStatus_t hipsparseDpruneDense2csr(hipsparseHandle_t         handle,
                                            int*                      csrColInd,
                                            void*                     buffer)
 {
+    HIPSPARSE_LAYER_SCOPE(
+        handle, m, n, A, lda, threshold, descr, csrVal, csrRowPtr, csrColInd, buffer);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_dprune_dense2csr((rocsparse_handle)handle,
                                                          m,
                                                          n,
@@ -11113,6 +15186,9 @@ hipsparseStatus_t hipsparseSpruneDense2csrByPercentage_bufferSize(hipsparseHandl
                                                                   pruneInfo_t info,
                                                                   size_t*     bufferSize)
 {
+    HIPSPARSE_LAYER_SCOPE(
+        handle, m, n, A, lda, percentage, descr, csrVal, csrRowPtr, csrColInd, info, bufferSize);
+
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_sprune_dense2csr_by_percentage_buffer_size((rocsparse_handle)handle,
                                                              m,
@@ -11143,6 +15219,9 @@ hipsparseStatus_t hipsparseDpruneDense2csrByPercentage_bufferSize(hipsparseHandl
                                                                   pruneInfo_t info,
                                                                   size_t*     bufferSize)
 {
+    HIPSPARSE_LAYER_SCOPE(
+        handle, m, n, A, lda, percentage, descr, csrVal, csrRowPtr, csrColInd, info, bufferSize);
+
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_dprune_dense2csr_by_percentage_buffer_size((rocsparse_handle)handle,
                                                              m,
@@ -11174,6 +15253,9 @@ hipsparseStatus_t
                                                        pruneInfo_t               info,
                                                        size_t*                   bufferSize)
 {
+    HIPSPARSE_LAYER_SCOPE(
+        handle, m, n, A, lda, percentage, descr, csrVal, csrRowPtr, csrColInd, info, bufferSize);
+
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_sprune_dense2csr_by_percentage_buffer_size((rocsparse_handle)handle,
                                                              m,
@@ -11205,6 +15287,9 @@ hipsparseStatus_t
                                                        pruneInfo_t               info,
                                                        size_t*                   bufferSize)
 {
+    HIPSPARSE_LAYER_SCOPE(
+        handle, m, n, A, lda, percentage, descr, csrVal, csrRowPtr, csrColInd, info, bufferSize);
+
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_dprune_dense2csr_by_percentage_buffer_size((rocsparse_handle)handle,
                                                              m,
@@ -11234,6 +15319,9 @@ hipsparseStatus_t hipsparseSpruneDense2csrNnzByPercentage(hipsparseHandle_t
                                                           pruneInfo_t info,
                                                           void*       buffer)
 {
+    HIPSPARSE_LAYER_SCOPE(
+        handle, m, n, A, lda, percentage, descr, csrRowPtr, nnzTotalDevHostPtr, info, buffer);
+
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_sprune_dense2csr_nnz_by_percentage((rocsparse_handle)handle,
                                                      m,
@@ -11262,6 +15350,9 @@ hipsparseStatus_t hipsparseDpruneDense2csrNnzByPercentage(hipsparseHandle_t
                                                           pruneInfo_t info,
                                                           void*       buffer)
 {
+    HIPSPARSE_LAYER_SCOPE(
+        handle, m, n, A, lda, percentage, descr, csrRowPtr, nnzTotalDevHostPtr, info, buffer);
+
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_dprune_dense2csr_nnz_by_percentage((rocsparse_handle)handle,
                                                      m,
@@ -11291,6 +15382,9 @@ hipsparseStatus_t hipsparseSpruneDense2csrByPercentage(hipsparseHandle_t
                                                        pruneInfo_t               info,
                                                        void*                     buffer)
 {
+    HIPSPARSE_LAYER_SCOPE(
+        handle, m, n, A, lda, percentage, descr, csrVal, csrRowPtr, csrColInd, info, buffer);
+
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_sprune_dense2csr_by_percentage((rocsparse_handle)handle,
                                                  m,
@@ -11321,6 +15415,9 @@ hipsparseStatus_t hipsparseDpruneDense2csrByPercentage(hipsparseHandle_t
                                                        pruneInfo_t               info,
                                                        void*                     buffer)
 {
+    HIPSPARSE_LAYER_SCOPE(
+        handle, m, n, A, lda, percentage, descr, csrVal, csrRowPtr, csrColInd, info, buffer);
+
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_dprune_dense2csr_by_percentage((rocsparse_handle)handle,
                                                  m,
@@ -11349,6 +15446,9 @@ hipsparseStatus_t hipsparseSdense2csc(hipsparseHandle_t         handle,
                                       int*                      cscRowInd,
                                       int*                      cscColPtr)
 {
+    HIPSPARSE_LAYER_SCOPE(
+        handle, m, n, descr, A, ld, nnz_per_columns, cscVal, cscRowInd, cscColPtr);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_sdense2csc((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -11373,6 +15473,9 @@ hipsparseStatus_t hipsparseDdense2csc(hipsparseHandle_t         handle,
                                       int*                      cscRowInd,
                                       int*                      cscColPtr)
 {
+    HIPSPARSE_LAYER_SCOPE(
+        handle, m, n, descr, A, ld, nnz_per_columns, cscVal, cscRowInd, cscColPtr);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_ddense2csc((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -11397,6 +15500,9 @@ hipsparseStatus_t hipsparseCdense2csc(hipsparseHandle_t         handle,
                                       int*                      cscRowInd,
                                       int*                      cscColPtr)
 {
+    HIPSPARSE_LAYER_SCOPE(
+        handle, m, n, descr, A, ld, nnz_per_columns, cscVal, cscRowInd, cscColPtr);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_cdense2csc((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -11421,6 +15527,9 @@ hipsparseStatus_t hipsparseZdense2csc(hipsparseHandle_t         handle,
                                       int*                      cscRowInd,
                                       int*                      cscColPtr)
 {
+    HIPSPARSE_LAYER_SCOPE(
+        handle, m, n, descr, A, ld, nnz_per_columns, cscVal, cscRowInd, cscColPtr);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_zdense2csc((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -11444,6 +15553,8 @@ hipsparseStatus_t hipsparseScsr2dense(hipsparseHandle_t         handle,
                                       float*                    A,
                                       int                       ld)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, m, n, descr, csrVal, csrRowPtr, csrColInd, A, ld);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_scsr2dense((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -11466,6 +15577,8 @@ hipsparseStatus_t hipsparseDcsr2dense(hipsparseHandle_t         handle,
                                       double*                   A,
                                       int                       ld)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, m, n, descr, csrVal, csrRowPtr, csrColInd, A, ld);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_dcsr2dense((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -11488,6 +15601,8 @@ hipsparseStatus_t hipsparseCcsr2dense(hipsparseHandle_t         handle,
                                       hipComplex*               A,
                                       int                       ld)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, m, n, descr, csrVal, csrRowPtr, csrColInd, A, ld);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_ccsr2dense((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -11510,6 +15625,8 @@ hipsparseStatus_t hipsparseZcsr2dense(hipsparseHandle_t         handle,
                                       hipDoubleComplex*         A,
                                       int                       ld)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, m, n, descr, csrVal, csrRowPtr, csrColInd, A, ld);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_zcsr2dense((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -11532,6 +15649,8 @@ hipsparseStatus_t hipsparseScsc2dense(hipsparseHandle_t         handle,
                                       float*                    A,
                                       int                       ld)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, m, n, descr, cscVal, cscRowInd, cscColPtr, A, ld);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_scsc2dense((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -11554,6 +15673,8 @@ hipsparseStatus_t hipsparseDcsc2dense(hipsparseHandle_t         handle,
                                       double*                   A,
                                       int                       ld)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, m, n, descr, cscVal, cscRowInd, cscColPtr, A, ld);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_dcsc2dense((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -11576,6 +15697,8 @@ hipsparseStatus_t hipsparseCcsc2dense(hipsparseHandle_t         handle,
                                       hipComplex*               A,
                                       int                       ld)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, m, n, descr, cscVal, cscRowInd, cscColPtr, A, ld);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_ccsc2dense((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -11598,6 +15721,8 @@ hipsparseStatus_t hipsparseZcsc2dense(hipsparseHandle_t         handle,
                                       hipDoubleComplex*         A,
                                       int                       ld)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, m, n, descr, cscVal, cscRowInd, cscColPtr, A, ld);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_zcsc2dense((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -11622,6 +15747,9 @@ hipsparseStatus_t hipsparseXcsr2bsrNnz(hipsparseHandle_t         handle,
                                        int*                      bsrRowPtrC,
                                        int*                      bsrNnzb)
 {
+    HIPSPARSE_LAYER_SCOPE(
+        handle, dirA, m, n, descrA, csrRowPtrA, csrColIndA, blockDim, descrC, bsrRowPtrC, bsrNnzb);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_csr2bsr_nnz((rocsparse_handle)handle,
                                                     hipsparse::hipDirectionToHCCDirection(dirA),
                                                     m,
@@ -11646,6 +15774,8 @@ hipsparseStatus_t hipsparseSnnz_compress(hipsparseHandle_t         handle,
                                          int*                      nnzC,
                                          float                     tol)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, m, descrA, csrValA, csrRowPtrA, nnzPerRow, nnzC, tol);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_snnz_compress((rocsparse_handle)handle,
                                                       m,
                                                       (const rocsparse_mat_descr)descrA,
@@ -11666,6 +15796,8 @@ hipsparseStatus_t hipsparseDnnz_compress(hipsparseHandle_t         handle,
                                          int*                      nnzC,
                                          double                    tol)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, m, descrA, csrValA, csrRowPtrA, nnzPerRow, nnzC, tol);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_dnnz_compress((rocsparse_handle)handle,
                                                       m,
                                                       (const rocsparse_mat_descr)descrA,
@@ -11686,6 +15818,8 @@ hipsparseStatus_t hipsparseCnnz_compress(hipsparseHandle_t         handle,
                                          int*                      nnzC,
                                          hipComplex                tol)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, m, descrA, csrValA, csrRowPtrA, nnzPerRow, nnzC, tol);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_cnnz_compress((rocsparse_handle)handle,
                                                       m,
                                                       (const rocsparse_mat_descr)descrA,
@@ -11706,6 +15840,8 @@ hipsparseStatus_t hipsparseZnnz_compress(hipsparseHandle_t         handle,
                                          int*                      nnzC,
                                          hipDoubleComplex          tol)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, m, descrA, csrValA, csrRowPtrA, nnzPerRow, nnzC, tol);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_znnz_compress((rocsparse_handle)handle,
                                                       m,
                                                       (const rocsparse_mat_descr)descrA,
@@ -11724,6 +15860,8 @@ hipsparseStatus_t hipsparseXcoo2csr(hipsparseHandle_t    handle,
                                     int*                 csrRowPtr,
                                     hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, cooRowInd, nnz, m, csrRowPtr, idxBase);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_coo2csr((rocsparse_handle)handle,
                           cooRowInd,
@@ -11735,6 +15873,8 @@ hipsparseStatus_t hipsparseXcoo2csr(hipsparseHandle_t    handle,
 
 hipsparseStatus_t hipsparseCreateIdentityPermutation(hipsparseHandle_t handle, int n, int* p)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, n, p);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_create_identity_permutation((rocsparse_handle)handle, n, p));
 }
@@ -11747,6 +15887,8 @@ hipsparseStatus_t hipsparseXcsrsort_bufferSizeExt(hipsparseHandle_t handle,
                                                   const int*        csrColInd,
                                                   size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, m, n, nnz, csrRowPtr, csrColInd, pBufferSizeInBytes);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_csrsort_buffer_size(
         (rocsparse_handle)handle, m, n, nnz, csrRowPtr, csrColInd, pBufferSizeInBytes));
 }
@@ -11761,6 +15903,8 @@ hipsparseStatus_t hipsparseXcsrsort(hipsparseHandle_t         handle,
                                     int*                      P,
                                     void*                     pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, m, n, nnz, descrA, csrRowPtr, csrColInd, P, pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_csrsort((rocsparse_handle)handle,
                                                                    m,
                                                                    n,
@@ -11780,6 +15924,8 @@ hipsparseStatus_t hipsparseXcscsort_bufferSizeExt(hipsparseHandle_t handle,
                                                   const int*        cscRowInd,
                                                   size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, m, n, nnz, cscColPtr, cscRowInd, pBufferSizeInBytes);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_cscsort_buffer_size(
         (rocsparse_handle)handle, m, n, nnz, cscColPtr, cscRowInd, pBufferSizeInBytes));
 }
@@ -11794,6 +15940,8 @@ hipsparseStatus_t hipsparseXcscsort(hipsparseHandle_t         handle,
                                     int*                      P,
                                     void*                     pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, m, n, nnz, descrA, cscColPtr, cscRowInd, P, pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_cscsort((rocsparse_handle)handle,
                                                                    m,
                                                                    n,
@@ -11813,6 +15961,8 @@ hipsparseStatus_t hipsparseXcoosort_bufferSizeExt(hipsparseHandle_t handle,
                                                   const int*        cooCols,
                                                   size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, m, n, nnz, cooRows, cooCols, pBufferSizeInBytes);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_coosort_buffer_size(
         (rocsparse_handle)handle, m, n, nnz, cooRows, cooCols, pBufferSizeInBytes));
 }
@@ -11826,6 +15976,8 @@ hipsparseStatus_t hipsparseXcoosortByRow(hipsparseHandle_t handle,
                                          int*              P,
                                          void*             pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, m, n, nnz, cooRows, cooCols, P, pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_coosort_by_row(
         (rocsparse_handle)handle, m, n, nnz, cooRows, cooCols, P, pBuffer));
 }
@@ -11839,6 +15991,8 @@ hipsparseStatus_t hipsparseXcoosortByColumn(hipsparseHandle_t handle,
                                             int*              P,
                                             void*             pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, m, n, nnz, cooRows, cooCols, P, pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_coosort_by_column(
         (rocsparse_handle)handle, m, n, nnz, cooRows, cooCols, P, pBuffer));
 }
@@ -11858,6 +16012,21 @@ hipsparseStatus_t hipsparseSgebsr2gebsr_bufferSize(hipsparseHandle_t         han
                                                    int                       colBlockDimC,
                                                    int*                      bufferSize)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dirA,
+                          mb,
+                          nb,
+                          nnzb,
+                          descrA,
+                          bsrValA,
+                          bsrRowPtrA,
+                          bsrColIndA,
+                          rowBlockDimA,
+                          colBlockDimA,
+                          rowBlockDimC,
+                          colBlockDimC,
+                          bufferSize);
+
     size_t bufSize;
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_sgebsr2gebsr_buffer_size((rocsparse_handle)handle,
@@ -11897,6 +16066,21 @@ hipsparseStatus_t hipsparseDgebsr2gebsr_bufferSize(hipsparseHandle_t         han
                                                    int                       colBlockDimC,
                                                    int*                      bufferSize)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dirA,
+                          mb,
+                          nb,
+                          nnzb,
+                          descrA,
+                          bsrValA,
+                          bsrRowPtrA,
+                          bsrColIndA,
+                          rowBlockDimA,
+                          colBlockDimA,
+                          rowBlockDimC,
+                          colBlockDimC,
+                          bufferSize);
+
     size_t bufSize;
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_dgebsr2gebsr_buffer_size((rocsparse_handle)handle,
@@ -11935,6 +16119,21 @@ hipsparseStatus_t hipsparseCgebsr2gebsr_bufferSize(hipsparseHandle_t         han
                                                    int                       colBlockDimC,
                                                    int*                      bufferSize)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dirA,
+                          mb,
+                          nb,
+                          nnzb,
+                          descrA,
+                          bsrValA,
+                          bsrRowPtrA,
+                          bsrColIndA,
+                          rowBlockDimA,
+                          colBlockDimA,
+                          rowBlockDimC,
+                          colBlockDimC,
+                          bufferSize);
+
     size_t bufSize;
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_cgebsr2gebsr_buffer_size((rocsparse_handle)handle,
@@ -11973,6 +16172,21 @@ hipsparseStatus_t hipsparseZgebsr2gebsr_bufferSize(hipsparseHandle_t         han
                                                    int                       colBlockDimC,
                                                    int*                      bufferSize)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dirA,
+                          mb,
+                          nb,
+                          nnzb,
+                          descrA,
+                          bsrValA,
+                          bsrRowPtrA,
+                          bsrColIndA,
+                          rowBlockDimA,
+                          colBlockDimA,
+                          rowBlockDimC,
+                          colBlockDimC,
+                          bufferSize);
+
     size_t bufSize;
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_zgebsr2gebsr_buffer_size((rocsparse_handle)handle,
@@ -12013,6 +16227,23 @@ hipsparseStatus_t hipsparseXgebsr2gebsrNnz(hipsparseHandle_t         handle,
                                            int*                      nnzTotalDevHostPtr,
                                            void*                     buffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dirA,
+                          mb,
+                          nb,
+                          nnzb,
+                          descrA,
+                          bsrRowPtrA,
+                          bsrColIndA,
+                          rowBlockDimA,
+                          colBlockDimA,
+                          descrC,
+                          bsrRowPtrC,
+                          rowBlockDimC,
+                          colBlockDimC,
+                          nnzTotalDevHostPtr,
+                          buffer);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_gebsr2gebsr_nnz((rocsparse_handle)handle,
                                                         hipsparse::hipDirectionToHCCDirection(dirA),
                                                         mb,
@@ -12051,6 +16282,25 @@ hipsparseStatus_t hipsparseSgebsr2gebsr(hipsparseHandle_t         handle,
                                         int                       colBlockDimC,
                                         void*                     buffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dirA,
+                          mb,
+                          nb,
+                          nnzb,
+                          descrA,
+                          bsrValA,
+                          bsrRowPtrA,
+                          bsrColIndA,
+                          rowBlockDimA,
+                          colBlockDimA,
+                          descrC,
+                          bsrValC,
+                          bsrRowPtrC,
+                          bsrColIndC,
+                          rowBlockDimC,
+                          colBlockDimC,
+                          buffer);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_sgebsr2gebsr((rocsparse_handle)handle,
                                                      hipsparse::hipDirectionToHCCDirection(dirA),
                                                      mb,
@@ -12091,6 +16341,25 @@ hipsparseStatus_t hipsparseDgebsr2gebsr(hipsparseHandle_t         handle,
                                         int                       colBlockDimC,
                                         void*                     buffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dirA,
+                          mb,
+                          nb,
+                          nnzb,
+                          descrA,
+                          bsrValA,
+                          bsrRowPtrA,
+                          bsrColIndA,
+                          rowBlockDimA,
+                          colBlockDimA,
+                          descrC,
+                          bsrValC,
+                          bsrRowPtrC,
+                          bsrColIndC,
+                          rowBlockDimC,
+                          colBlockDimC,
+                          buffer);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_dgebsr2gebsr((rocsparse_handle)handle,
                                                      hipsparse::hipDirectionToHCCDirection(dirA),
                                                      mb,
@@ -12131,6 +16400,25 @@ hipsparseStatus_t hipsparseCgebsr2gebsr(hipsparseHandle_t         handle,
                                         int                       colBlockDimC,
                                         void*                     buffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dirA,
+                          mb,
+                          nb,
+                          nnzb,
+                          descrA,
+                          bsrValA,
+                          bsrRowPtrA,
+                          bsrColIndA,
+                          rowBlockDimA,
+                          colBlockDimA,
+                          descrC,
+                          bsrValC,
+                          bsrRowPtrC,
+                          bsrColIndC,
+                          rowBlockDimC,
+                          colBlockDimC,
+                          buffer);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_cgebsr2gebsr((rocsparse_handle)handle,
                                                      hipsparse::hipDirectionToHCCDirection(dirA),
                                                      mb,
@@ -12171,6 +16459,25 @@ hipsparseStatus_t hipsparseZgebsr2gebsr(hipsparseHandle_t         handle,
                                         int                       colBlockDimC,
                                         void*                     buffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          dirA,
+                          mb,
+                          nb,
+                          nnzb,
+                          descrA,
+                          bsrValA,
+                          bsrRowPtrA,
+                          bsrColIndA,
+                          rowBlockDimA,
+                          colBlockDimA,
+                          descrC,
+                          bsrValC,
+                          bsrRowPtrC,
+                          bsrColIndC,
+                          rowBlockDimC,
+                          colBlockDimC,
+                          buffer);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_zgebsr2gebsr((rocsparse_handle)handle,
                                                      hipsparse::hipDirectionToHCCDirection(dirA),
                                                      mb,
@@ -12202,6 +16509,9 @@ hipsparseStatus_t hipsparseScsru2csr_bufferSizeExt(hipsparseHandle_t handle,
                                                    csru2csrInfo_t    info,
                                                    size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(
+        handle, m, n, nnz, csrVal, csrRowPtr, csrColInd, info, pBufferSizeInBytes);
+
     // Test for bad args
     if(handle == nullptr)
     {
@@ -12256,6 +16566,9 @@ hipsparseStatus_t hipsparseDcsru2csr_bufferSizeExt(hipsparseHandle_t handle,
                                                    csru2csrInfo_t    info,
                                                    size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(
+        handle, m, n, nnz, csrVal, csrRowPtr, csrColInd, info, pBufferSizeInBytes);
+
     // Test for bad args
     if(handle == nullptr)
     {
@@ -12310,6 +16623,9 @@ hipsparseStatus_t hipsparseCcsru2csr_bufferSizeExt(hipsparseHandle_t handle,
                                                    csru2csrInfo_t    info,
                                                    size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(
+        handle, m, n, nnz, csrVal, csrRowPtr, csrColInd, info, pBufferSizeInBytes);
+
     // Test for bad args
     if(handle == nullptr)
     {
@@ -12364,6 +16680,9 @@ hipsparseStatus_t hipsparseZcsru2csr_bufferSizeExt(hipsparseHandle_t handle,
                                                    csru2csrInfo_t    info,
                                                    size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(
+        handle, m, n, nnz, csrVal, csrRowPtr, csrColInd, info, pBufferSizeInBytes);
+
     // Test for bad args
     if(handle == nullptr)
     {
@@ -12419,6 +16738,8 @@ hipsparseStatus_t hipsparseScsru2csr(hipsparseHandle_t         handle,
                                      csru2csrInfo_t            info,
                                      void*                     pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, m, n, nnz, descrA, csrVal, csrRowPtr, csrColInd, info, pBuffer);
+
     // Test for bad args
     if(handle == nullptr)
     {
@@ -12450,25 +16771,25 @@ hipsparseStatus_t hipsparseScsru2csr(hipsparseHandle_t         handle,
         return HIPSPARSE_STATUS_INVALID_VALUE;
     }
 
-    // De-allocate permutation array, if already allocated but sizes do not match
-    if(info->P != nullptr && info->size != nnz)
-    {
-        RETURN_IF_HIP_ERROR(hipFree(info->P));
-        info->size = 0;
-    }
-
-    // Allocate memory inside info structure to keep track of the permutation
-    // if it has not yet been allocated with matching size
-    if(info->P == nullptr)
+    // Grow the permutation array inside the info structure, if it cannot hold nnz
+    // entries. It is never shrunk, such that repeated calls do not re-allocate.
+    if(info->capacity < nnz)
     {
-        // size must be 0
-        assert(info->size == 0);
+        if(info->P != nullptr)
+        {
+            RETURN_IF_HIP_ERROR(hipFree(info->P));
+            info->P        = nullptr;
+            info->capacity = 0;
+        }
 
         RETURN_IF_HIP_ERROR(hipMalloc((void**)&info->P, sizeof(int) * nnz));
+        hipsparse::layerCounters(handle)->allocation(sizeof(int) * nnz);
 
-        info->size = nnz;
+        info->capacity = nnz;
     }
 
+    info->size = nnz;
+
     // Initialize permutation with identity
     RETURN_IF_HIPSPARSE_ERROR(hipsparseCreateIdentityPermutation(handle, nnz, info->P));
 
@@ -12502,6 +16823,8 @@ hipsparseStatus_t hipsparseDcsru2csr(hipsparseHandle_t         handle,
                                      csru2csrInfo_t            info,
                                      void*                     pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, m, n, nnz, descrA, csrVal, csrRowPtr, csrColInd, info, pBuffer);
+
     // Test for bad args
     if(handle == nullptr)
     {
@@ -12533,25 +16856,25 @@ hipsparseStatus_t hipsparseDcsru2csr(hipsparseHandle_t         handle,
         return HIPSPARSE_STATUS_INVALID_VALUE;
     }
 
-    // De-allocate permutation array, if already allocated but sizes do not match
-    if(info->P != nullptr && info->size != nnz)
-    {
-        RETURN_IF_HIP_ERROR(hipFree(info->P));
-        info->size = 0;
-    }
-
-    // Allocate memory inside info structure to keep track of the permutation
-    // if it has not yet been allocated with matching size
-    if(info->P == nullptr)
+    // Grow the permutation array inside the info structure, if it cannot hold nnz
+    // entries. It is never shrunk, such that repeated calls do not re-allocate.
+    if(info->capacity < nnz)
     {
-        // size must be 0
-        assert(info->size == 0);
+        if(info->P != nullptr)
+        {
+            RETURN_IF_HIP_ERROR(hipFree(info->P));
+            info->P        = nullptr;
+            info->capacity = 0;
+        }
 
         RETURN_IF_HIP_ERROR(hipMalloc((void**)&info->P, sizeof(int) * nnz));
+        hipsparse::layerCounters(handle)->allocation(sizeof(int) * nnz);
 
-        info->size = nnz;
+        info->capacity = nnz;
     }
 
+    info->size = nnz;
+
     // Initialize permutation with identity
     RETURN_IF_HIPSPARSE_ERROR(hipsparseCreateIdentityPermutation(handle, nnz, info->P));
 
@@ -12585,6 +16908,8 @@ hipsparseStatus_t hipsparseCcsru2csr(hipsparseHandle_t         handle,
                                      csru2csrInfo_t            info,
                                      void*                     pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, m, n, nnz, descrA, csrVal, csrRowPtr, csrColInd, info, pBuffer);
+
     // Test for bad args
     if(handle == nullptr)
     {
@@ -12616,25 +16941,25 @@ hipsparseStatus_t hipsparseCcsru2csr(hipsparseHandle_t         handle,
         return HIPSPARSE_STATUS_INVALID_VALUE;
     }
 
-    // De-allocate permutation array, if already allocated but sizes do not match
-    if(info->P != nullptr && info->size != nnz)
-    {
-        RETURN_IF_HIP_ERROR(hipFree(info->P));
-        info->size = 0;
-    }
-
-    // Allocate memory inside info structure to keep track of the permutation
-    // if it has not yet been allocated with matching size
-    if(info->P == nullptr)
+    // Grow the permutation array inside the info structure, if it cannot hold nnz
+    // entries. It is never shrunk, such that repeated calls do not re-allocate.
+    if(info->capacity < nnz)
     {
-        // size must be 0
-        assert(info->size == 0);
+        if(info->P != nullptr)
+        {
+            RETURN_IF_HIP_ERROR(hipFree(info->P));
+            info->P        = nullptr;
+            info->capacity = 0;
+        }
 
         RETURN_IF_HIP_ERROR(hipMalloc((void**)&info->P, sizeof(int) * nnz));
+        hipsparse::layerCounters(handle)->allocation(sizeof(int) * nnz);
 
-        info->size = nnz;
+        info->capacity = nnz;
     }
 
+    info->size = nnz;
+
     // Initialize permutation with identity
     RETURN_IF_HIPSPARSE_ERROR(hipsparseCreateIdentityPermutation(handle, nnz, info->P));
 
@@ -12668,6 +16993,8 @@ hipsparseStatus_t hipsparseZcsru2csr(hipsparseHandle_t         handle,
                                      csru2csrInfo_t            info,
                                      void*                     pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, m, n, nnz, descrA, csrVal, csrRowPtr, csrColInd, info, pBuffer);
+
     // Test for bad args
     if(handle == nullptr)
     {
@@ -12699,25 +17026,25 @@ hipsparseStatus_t hipsparseZcsru2csr(hipsparseHandle_t         handle,
         return HIPSPARSE_STATUS_INVALID_VALUE;
     }
 
-    // De-allocate permutation array, if already allocated but sizes do not match
-    if(info->P != nullptr && info->size != nnz)
+    // Grow the permutation array inside the info structure, if it cannot hold nnz
+    // entries. It is never shrunk, such that repeated calls do not re-allocate.
+    if(info->capacity < nnz)
     {
-        RETURN_IF_HIP_ERROR(hipFree(info->P));
-        info->size = 0;
-    }
-
-    // Allocate memory inside info structure to keep track of the permutation
-    // if it has not yet been allocated with matching size
-    if(info->P == nullptr)
-    {
-        // size must be 0
-        assert(info->size == 0);
+        if(info->P != nullptr)
+        {
+            RETURN_IF_HIP_ERROR(hipFree(info->P));
+            info->P        = nullptr;
+            info->capacity = 0;
+        }
 
         RETURN_IF_HIP_ERROR(hipMalloc((void**)&info->P, sizeof(int) * nnz));
+        hipsparse::layerCounters(handle)->allocation(sizeof(int) * nnz);
 
-        info->size = nnz;
+        info->capacity = nnz;
     }
 
+    info->size = nnz;
+
     // Initialize permutation with identity
     RETURN_IF_HIPSPARSE_ERROR(hipsparseCreateIdentityPermutation(handle, nnz, info->P));
 
@@ -12751,6 +17078,8 @@ hipsparseStatus_t hipsparseScsr2csru(hipsparseHandle_t         handle,
                                      csru2csrInfo_t            info,
                                      void*                     pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, m, n, nnz, descrA, csrVal, csrRowPtr, csrColInd, info, pBuffer);
+
     // Test for bad args
     if(handle == nullptr)
     {
@@ -12826,6 +17155,8 @@ hipsparseStatus_t hipsparseDcsr2csru(hipsparseHandle_t         handle,
                                      csru2csrInfo_t            info,
                                      void*                     pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, m, n, nnz, descrA, csrVal, csrRowPtr, csrColInd, info, pBuffer);
+
     // Test for bad args
     if(handle == nullptr)
     {
@@ -12901,6 +17232,8 @@ hipsparseStatus_t hipsparseCcsr2csru(hipsparseHandle_t         handle,
                                      csru2csrInfo_t            info,
                                      void*                     pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, m, n, nnz, descrA, csrVal, csrRowPtr, csrColInd, info, pBuffer);
+
     // Test for bad args
     if(handle == nullptr)
     {
@@ -12976,6 +17309,8 @@ hipsparseStatus_t hipsparseZcsr2csru(hipsparseHandle_t         handle,
                                      csru2csrInfo_t            info,
                                      void*                     pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, m, n, nnz, descrA, csrVal, csrRowPtr, csrColInd, info, pBuffer);
+
     // Test for bad args
     if(handle == nullptr)
     {
@@ -14097,6 +18432,8 @@ hipsparseStatus_t hipsparseAxpby(hipsparseHandle_t          handle,
                                  const void*                beta,
                                  hipsparseDnVecDescr_t      vecY)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, alpha, vecX, beta, vecY);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_axpby((rocsparse_handle)handle,
                                                                  alpha,
                                                                  (rocsparse_const_spvec_descr)vecX,
@@ -14108,6 +18445,8 @@ hipsparseStatus_t hipsparseGather(hipsparseHandle_t          handle,
                                   hipsparseConstDnVecDescr_t vecY,
                                   hipsparseSpVecDescr_t      vecX)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, vecY, vecX);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_gather(
         (rocsparse_handle)handle, (rocsparse_const_dnvec_descr)vecY, (rocsparse_spvec_descr)vecX));
 }
@@ -14116,6 +18455,8 @@ hipsparseStatus_t hipsparseScatter(hipsparseHandle_t          handle,
                                    hipsparseConstSpVecDescr_t vecX,
                                    hipsparseDnVecDescr_t      vecY)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, vecX, vecY);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_scatter(
         (rocsparse_handle)handle, (rocsparse_const_spvec_descr)vecX, (rocsparse_dnvec_descr)vecY));
 }
@@ -14126,6 +18467,8 @@ hipsparseStatus_t hipsparseRot(hipsparseHandle_t     handle,
                                hipsparseSpVecDescr_t vecX,
                                hipsparseDnVecDescr_t vecY)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, c_coeff, s_coeff, vecX, vecY);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_rot((rocsparse_handle)handle,
                                                                c_coeff,
                                                                s_coeff,
@@ -14139,6 +18482,8 @@ hipsparseStatus_t hipsparseSparseToDense_bufferSize(hipsparseHandle_t
                                                     hipsparseSparseToDenseAlg_t alg,
                                                     size_t*                     bufferSize)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, hipsparse::layer_spmat(matA), matB, alg, bufferSize);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sparse_to_dense((rocsparse_handle)handle,
                                   (rocsparse_const_spmat_descr)matA,
@@ -14154,6 +18499,8 @@ hipsparseStatus_t hipsparseSparseToDense(hipsparseHandle_t           handle,
                                          hipsparseSparseToDenseAlg_t alg,
                                          void*                       externalBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, hipsparse::layer_spmat(matA), matB, alg, externalBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sparse_to_dense((rocsparse_handle)handle,
                                   (rocsparse_const_spmat_descr)matA,
@@ -14169,6 +18516,8 @@ hipsparseStatus_t hipsparseDenseToSparse_bufferSize(hipsparseHandle_t
                                                     hipsparseDenseToSparseAlg_t alg,
                                                     size_t*                     bufferSize)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, matA, hipsparse::layer_spmat(matB), alg, bufferSize);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dense_to_sparse((rocsparse_handle)handle,
                                   (rocsparse_const_dnmat_descr)matA,
@@ -14184,6 +18533,8 @@ hipsparseStatus_t hipsparseDenseToSparse_analysis(hipsparseHandle_t           ha
                                                   hipsparseDenseToSparseAlg_t alg,
                                                   void*                       externalBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, matA, hipsparse::layer_spmat(matB), alg, externalBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dense_to_sparse((rocsparse_handle)handle,
                                   (rocsparse_const_dnmat_descr)matA,
@@ -14199,6 +18550,8 @@ hipsparseStatus_t hipsparseDenseToSparse_convert(hipsparseHandle_t           han
                                                  hipsparseDenseToSparseAlg_t alg,
                                                  void*                       externalBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, matA, hipsparse::layer_spmat(matB), alg, externalBuffer);
+
     size_t bufferSize = 4;
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dense_to_sparse((rocsparse_handle)handle,
@@ -14217,6 +18570,8 @@ hipsparseStatus_t hipsparseSpVV_bufferSize(hipsparseHandle_t          handle,
                                            hipDataType                computeType,
                                            size_t*                    bufferSize)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, opX, vecX, vecY, result, computeType, bufferSize);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_spvv((rocsparse_handle)handle,
                        hipsparse::hipOperationToHCCOperation(opX),
@@ -14236,6 +18591,8 @@ hipsparseStatus_t hipsparseSpVV(hipsparseHandle_t          handle,
                                 hipDataType                computeType,
                                 void*                      externalBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, opX, vecX, vecY, result, computeType, externalBuffer);
+
     size_t bufferSize;
 
     // Check for buffer == nullptr as this is not done in rocsparse
@@ -14266,6 +18623,17 @@ hipsparseStatus_t hipsparseSpMV_bufferSize(hipsparseHandle_t           handle,
                                            hipsparseSpMVAlg_t          alg,
                                            size_t*                     bufferSize)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          opA,
+                          alpha,
+                          hipsparse::layer_spmat(matA),
+                          vecX,
+                          beta,
+                          vecY,
+                          computeType,
+                          alg,
+                          bufferSize);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_spmv((rocsparse_handle)handle,
                        hipsparse::hipOperationToHCCOperation(opA),
@@ -14292,6 +18660,17 @@ hipsparseStatus_t hipsparseSpMV_preprocess(hipsparseHandle_t           handle,
                                            hipsparseSpMVAlg_t          alg,
                                            void*                       externalBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          opA,
+                          alpha,
+                          hipsparse::layer_spmat(matA),
+                          vecX,
+                          beta,
+                          vecY,
+                          computeType,
+                          alg,
+                          externalBuffer);
+
     size_t bufferSize;
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_spmv((rocsparse_handle)handle,
@@ -14319,6 +18698,17 @@ hipsparseStatus_t hipsparseSpMV(hipsparseHandle_t           handle,
                                 hipsparseSpMVAlg_t          alg,
                                 void*                       externalBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          opA,
+                          alpha,
+                          hipsparse::layer_spmat(matA),
+                          vecX,
+                          beta,
+                          vecY,
+                          computeType,
+                          alg,
+                          externalBuffer);
+
     size_t bufferSize;
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_spmv((rocsparse_handle)handle,
@@ -14347,6 +18737,18 @@ hipsparseStatus_t hipsparseSpMM_bufferSize(hipsparseHandle_t           handle,
                                            hipsparseSpMMAlg_t          alg,
                                            size_t*                     bufferSize)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          opA,
+                          opB,
+                          alpha,
+                          hipsparse::layer_spmat(matA),
+                          matB,
+                          beta,
+                          matC,
+                          computeType,
+                          alg,
+                          bufferSize);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_spmm((rocsparse_handle)handle,
                        hipsparse::hipOperationToHCCOperation(opA),
@@ -14375,6 +18777,18 @@ hipsparseStatus_t hipsparseSpMM_preprocess(hipsparseHandle_t           handle,
                                            hipsparseSpMMAlg_t          alg,
                                            void*                       externalBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          opA,
+                          opB,
+                          alpha,
+                          hipsparse::layer_spmat(matA),
+                          matB,
+                          beta,
+                          matC,
+                          computeType,
+                          alg,
+                          externalBuffer);
+
     size_t bufferSize;
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_spmm((rocsparse_handle)handle,
@@ -14404,6 +18818,18 @@ hipsparseStatus_t hipsparseSpMM(hipsparseHandle_t           handle,
                                 hipsparseSpMMAlg_t          alg,
                                 void*                       externalBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          opA,
+                          opB,
+                          alpha,
+                          hipsparse::layer_spmat(matA),
+                          matB,
+                          beta,
+                          matC,
+                          computeType,
+                          alg,
+                          externalBuffer);
+
     size_t bufferSize;
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_spmm((rocsparse_handle)handle,
@@ -14536,6 +18962,20 @@ hipsparseStatus_t hipsparseSpGEMM_workEstimation(hipsparseHandle_t          hand
                                                  size_t*                    bufferSize1,
                                                  void*                      externalBuffer1)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          opA,
+                          opB,
+                          alpha,
+                          hipsparse::layer_spmat(matA),
+                          hipsparse::layer_spmat(matB),
+                          beta,
+                          hipsparse::layer_spmat(matC),
+                          computeType,
+                          alg,
+                          spgemmDescr,
+                          bufferSize1,
+                          externalBuffer1);
+
     // Match cusparse error handling
     if(handle == nullptr || alpha == nullptr || beta == nullptr || matA == nullptr
        || matB == nullptr || matC == nullptr || bufferSize1 == nullptr || spgemmDescr == nullptr)
@@ -14638,6 +19078,20 @@ hipsparseStatus_t hipsparseSpGEMM_compute(hipsparseHandle_t          handle,
                                           size_t*                    bufferSize2,
                                           void*                      externalBuffer2)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          opA,
+                          opB,
+                          alpha,
+                          hipsparse::layer_spmat(matA),
+                          hipsparse::layer_spmat(matB),
+                          beta,
+                          hipsparse::layer_spmat(matC),
+                          computeType,
+                          alg,
+                          spgemmDescr,
+                          bufferSize2,
+                          externalBuffer2);
+
     if(handle == nullptr || alpha == nullptr || beta == nullptr || matA == nullptr
        || matB == nullptr || matC == nullptr || bufferSize2 == nullptr)
     {
@@ -14673,9 +19127,6 @@ hipsparseStatus_t hipsparseSpGEMM_compute(hipsparseHandle_t          handle,
     RETURN_IF_HIPSPARSE_ERROR(hipsparse::getIndexTypeSize(csrColIndTypeC, csrColIndTypeSizeC));
     RETURN_IF_HIPSPARSE_ERROR(hipsparse::getDataTypeSize(csrValueTypeC, csrValueTypeSizeC));
 
-    size_t computeTypeSize;
-    RETURN_IF_HIPSPARSE_ERROR(hipsparse::getDataTypeSize(computeType, computeTypeSize));
-
     if(externalBuffer2 == nullptr)
     {
         *bufferSize2 = 0;
@@ -14687,9 +19138,6 @@ hipsparseStatus_t hipsparseSpGEMM_compute(hipsparseHandle_t          handle,
         // Need to store temporary space for indices array used in hipsparseSpGEMM_copy Axpby
         *bufferSize2 += ((csrColIndTypeSizeC * nnzC - 1) / 256 + 1) * 256;
 
-        // Need to store temporary space for host/device 1 value used in hipsparseSpGEMM_copy Axpby
-        *bufferSize2 += ((computeTypeSize - 1) / 256 + 1) * 256;
-
         spgemmDescr->bufferSize2 = *bufferSize2;
     }
     else
@@ -14746,6 +19194,18 @@ hipsparseStatus_t hipsparseSpGEMM_copy(hipsparseHandle_t          handle,
                                        hipsparseSpGEMMAlg_t       alg,
                                        hipsparseSpGEMMDescr_t     spgemmDescr)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          opA,
+                          opB,
+                          alpha,
+                          hipsparse::layer_spmat(matA),
+                          hipsparse::layer_spmat(matB),
+                          beta,
+                          hipsparse::layer_spmat(matC),
+                          computeType,
+                          alg,
+                          spgemmDescr);
+
     if(handle == nullptr || alpha == nullptr || beta == nullptr || matA == nullptr
        || matB == nullptr || matC == nullptr || spgemmDescr == nullptr)
     {
@@ -14791,9 +19251,6 @@ hipsparseStatus_t hipsparseSpGEMM_copy(hipsparseHandle_t          handle,
     byteOffset2 += ((csrValueTypeSizeC * nnzC - 1) / 256 + 1) * 256;
 
     void* indicesArray = (static_cast<char*>(spgemmDescr->externalBuffer2) + byteOffset2);
-    byteOffset2 += ((csrColIndTypeSizeC * nnzC - 1) / 256 + 1) * 256;
-
-    void* device_one = (static_cast<char*>(spgemmDescr->externalBuffer2) + byteOffset2);
 
     // Get pointer mode
     hipsparsePointerMode_t pointer_mode;
@@ -14821,28 +19278,8 @@ hipsparseStatus_t hipsparseSpGEMM_copy(hipsparseHandle_t          handle,
     }
     else
     {
-        if(computeType == HIP_R_32F)
-        {
-            hipMemcpyAsync(device_one, &host_sone, sizeof(float), hipMemcpyHostToDevice, stream);
-            one = device_one;
-        }
-        if(computeType == HIP_R_64F)
-        {
-            hipMemcpyAsync(device_one, &host_done, sizeof(double), hipMemcpyHostToDevice, stream);
-            one = device_one;
-        }
-        if(computeType == HIP_C_32F)
-        {
-            hipMemcpyAsync(
-                device_one, &host_cone, sizeof(hipComplex), hipMemcpyHostToDevice, stream);
-            one = device_one;
-        }
-        if(computeType == HIP_C_64F)
-        {
-            hipMemcpyAsync(
-                device_one, &host_zone, sizeof(hipDoubleComplex), hipMemcpyHostToDevice, stream);
-            one = device_one;
-        }
+        RETURN_IF_HIPSPARSE_ERROR(
+            hipsparse::deviceConstant(handle, computeType, 1, (const void**)&one));
     }
 
     if(csrColIndTypeC == HIPSPARSE_INDEX_32I)
@@ -14918,6 +19355,17 @@ hipsparseStatus_t hipsparseSpGEMMreuse_workEstimation(hipsparseHandle_t
                                                       size_t*                    bufferSize1,
                                                       void*                      externalBuffer1)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          opA,
+                          opB,
+                          hipsparse::layer_spmat(matA),
+                          hipsparse::layer_spmat(matB),
+                          hipsparse::layer_spmat(matC),
+                          alg,
+                          spgemmDescr,
+                          bufferSize1,
+                          externalBuffer1);
+
     const void* alpha = (const void*)0x4;
     const void* beta  = (const void*)0x4;
 
@@ -14974,6 +19422,21 @@ hipsparseStatus_t hipsparseSpGEMMreuse_nnz(hipsparseHandle_t          handle,
                                            size_t*                    bufferSize4,
                                            void*                      externalBuffer4)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          opA,
+                          opB,
+                          hipsparse::layer_spmat(matA),
+                          hipsparse::layer_spmat(matB),
+                          hipsparse::layer_spmat(matC),
+                          alg,
+                          spgemmDescr,
+                          bufferSize2,
+                          externalBuffer2,
+                          bufferSize3,
+                          externalBuffer3,
+                          bufferSize4,
+                          externalBuffer4);
+
     // Match cusparse error handling
     if(handle == nullptr || matA == nullptr || matB == nullptr || matC == nullptr
        || spgemmDescr == nullptr || bufferSize2 == nullptr || bufferSize3 == nullptr
@@ -15098,6 +19561,17 @@ hipsparseStatus_t hipsparseSpGEMMreuse_copy(hipsparseHandle_t          handle,
                                             size_t*                    bufferSize5,
                                             void*                      externalBuffer5)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          opA,
+                          opB,
+                          hipsparse::layer_spmat(matA),
+                          hipsparse::layer_spmat(matB),
+                          hipsparse::layer_spmat(matC),
+                          alg,
+                          spgemmDescr,
+                          bufferSize5,
+                          externalBuffer5);
+
     if(handle == nullptr || matA == nullptr || matB == nullptr || matC == nullptr
        || bufferSize5 == nullptr || spgemmDescr == nullptr)
     {
@@ -15143,9 +19617,6 @@ hipsparseStatus_t hipsparseSpGEMMreuse_copy(hipsparseHandle_t          handle,
         // Need to store temporary space for indices array used in hipsparseSpGEMM_copy Axpby
         *bufferSize5 += ((csrColIndTypeSizeC * nnzC - 1) / 256 + 1) * 256;
 
-        // Need to store temporary space for host/device 1 value used in hipsparseSpGEMM_copy Axpby
-        *bufferSize5 += ((16 - 1) / 256 + 1) * 256;
-
         spgemmDescr->bufferSize5 = *bufferSize5;
     }
     else
@@ -15185,6 +19656,18 @@ hipsparseStatus_t hipsparseSpGEMMreuse_compute(hipsparseHandle_t          handle
                                                hipsparseSpGEMMAlg_t       alg,
                                                hipsparseSpGEMMDescr_t     spgemmDescr)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          opA,
+                          opB,
+                          alpha,
+                          hipsparse::layer_spmat(matA),
+                          hipsparse::layer_spmat(matB),
+                          beta,
+                          hipsparse::layer_spmat(matC),
+                          computeType,
+                          alg,
+                          spgemmDescr);
+
     if(handle == nullptr || alpha == nullptr || beta == nullptr || spgemmDescr == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -15226,9 +19709,6 @@ hipsparseStatus_t hipsparseSpGEMMreuse_compute(hipsparseHandle_t          handle
     byteOffset5 += ((csrValueTypeSizeC * nnzC - 1) / 256 + 1) * 256;
 
     void* indicesArray = (static_cast<char*>(spgemmDescr->externalBuffer5) + byteOffset5);
-    byteOffset5 += ((csrColIndTypeSizeC * nnzC - 1) / 256 + 1) * 256;
-
-    void* device_one = (static_cast<char*>(spgemmDescr->externalBuffer5) + byteOffset5);
 
     // Use external buffer for values array as the original values array may have data in it
     // that must be accounted for when multiplying by beta. See below.
@@ -15256,9 +19736,6 @@ hipsparseStatus_t hipsparseSpGEMMreuse_compute(hipsparseHandle_t          handle
     hipsparsePointerMode_t pointer_mode;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetPointerMode(handle, &pointer_mode));
 
-    hipStream_t stream;
-    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
-
     float            host_sone = 1.0f;
     double           host_done = 1.0f;
     hipComplex       host_cone = make_hipComplex(1.0f, 0.0f);
@@ -15278,28 +19755,8 @@ hipsparseStatus_t hipsparseSpGEMMreuse_compute(hipsparseHandle_t          handle
     }
     else
     {
-        if(computeType == HIP_R_32F)
-        {
-            hipMemcpyAsync(device_one, &host_sone, sizeof(float), hipMemcpyHostToDevice, stream);
-            one = device_one;
-        }
-        if(computeType == HIP_R_64F)
-        {
-            hipMemcpyAsync(device_one, &host_done, sizeof(double), hipMemcpyHostToDevice, stream);
-            one = device_one;
-        }
-        if(computeType == HIP_C_32F)
-        {
-            hipMemcpyAsync(
-                device_one, &host_cone, sizeof(hipComplex), hipMemcpyHostToDevice, stream);
-            one = device_one;
-        }
-        if(computeType == HIP_C_64F)
-        {
-            hipMemcpyAsync(
-                device_one, &host_zone, sizeof(hipDoubleComplex), hipMemcpyHostToDevice, stream);
-            one = device_one;
-        }
+        RETURN_IF_HIPSPARSE_ERROR(
+            hipsparse::deviceConstant(handle, computeType, 1, (const void**)&one));
     }
 
     if(csrColIndTypeC == HIPSPARSE_INDEX_32I)
@@ -15362,6 +19819,18 @@ hipsparseStatus_t hipsparseSDDMM(hipsparseHandle_t          handle,
                                  hipsparseSDDMMAlg_t        alg,
                                  void*                      tempBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          opA,
+                          opB,
+                          alpha,
+                          matA,
+                          matB,
+                          beta,
+                          hipsparse::layer_spmat(matC),
+                          computeType,
+                          alg,
+                          tempBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sddmm((rocsparse_handle)handle,
                         hipsparse::hipOperationToHCCOperation(opA),
@@ -15388,6 +19857,18 @@ hipsparseStatus_t hipsparseSDDMM_bufferSize(hipsparseHandle_t          handle,
                                             hipsparseSDDMMAlg_t        alg,
                                             size_t*                    bufferSize)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          opA,
+                          opB,
+                          alpha,
+                          matA,
+                          matB,
+                          beta,
+                          hipsparse::layer_spmat(matC),
+                          computeType,
+                          alg,
+                          bufferSize);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sddmm_buffer_size((rocsparse_handle)handle,
                                     hipsparse::hipOperationToHCCOperation(opA),
@@ -15414,6 +19895,18 @@ hipsparseStatus_t hipsparseSDDMM_preprocess(hipsparseHandle_t          handle,
                                             hipsparseSDDMMAlg_t        alg,
                                             void*                      tempBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          opA,
+                          opB,
+                          alpha,
+                          matA,
+                          matB,
+                          beta,
+                          hipsparse::layer_spmat(matC),
+                          computeType,
+                          alg,
+                          tempBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sddmm_preprocess((rocsparse_handle)handle,
                                    hipsparse::hipOperationToHCCOperation(opA),
@@ -15461,6 +19954,17 @@ hipsparseStatus_t hipsparseSpSV_bufferSize(hipsparseHandle_t           handle,
                                            hipsparseSpSVDescr_t        spsvDescr,
                                            size_t*                     bufferSize)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          opA,
+                          alpha,
+                          hipsparse::layer_spmat(matA),
+                          x,
+                          y,
+                          computeType,
+                          alg,
+                          spsvDescr,
+                          bufferSize);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_spsv((rocsparse_handle)handle,
                        hipsparse::hipOperationToHCCOperation(opA),
@@ -15486,6 +19990,17 @@ hipsparseStatus_t hipsparseSpSV_analysis(hipsparseHandle_t           handle,
                                          hipsparseSpSVDescr_t        spsvDescr,
                                          void*                       externalBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          opA,
+                          alpha,
+                          hipsparse::layer_spmat(matA),
+                          x,
+                          y,
+                          computeType,
+                          alg,
+                          spsvDescr,
+                          externalBuffer);
+
 
     if(spsvDescr == nullptr)
     {
@@ -15516,6 +20031,9 @@ hipsparseStatus_t hipsparseSpSV_solve(hipsparseHandle_t           handle,
                                       hipsparseSpSVAlg_t          alg,
                                       hipsparseSpSVDescr_t        spsvDescr)
 {
+    HIPSPARSE_LAYER_SCOPE(
+        handle, opA, alpha, hipsparse::layer_spmat(matA), x, y, computeType, alg, spsvDescr);
+
     if(spsvDescr == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -15568,6 +20086,18 @@ hipsparseStatus_t hipsparseSpSM_bufferSize(hipsparseHandle_t           handle,
                                            hipsparseSpSMDescr_t        spsmDescr,
                                            size_t*                     bufferSize)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          opA,
+                          opB,
+                          alpha,
+                          hipsparse::layer_spmat(matA),
+                          matB,
+                          matC,
+                          computeType,
+                          alg,
+                          spsmDescr,
+                          bufferSize);
+
     if(spsmDescr == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -15603,6 +20133,18 @@ hipsparseStatus_t hipsparseSpSM_analysis(hipsparseHandle_t           handle,
                                          hipsparseSpSMDescr_t        spsmDescr,
                                          void*                       externalBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          opA,
+                          opB,
+                          alpha,
+                          hipsparse::layer_spmat(matA),
+                          matB,
+                          matC,
+                          computeType,
+                          alg,
+                          spsmDescr,
+                          externalBuffer);
+
     if(spsmDescr == nullptr || externalBuffer == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -15638,6 +20180,18 @@ hipsparseStatus_t hipsparseSpSM_solve(hipsparseHandle_t           handle,
                                       hipsparseSpSMDescr_t        spsmDescr,
                                       void*                       externalBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          opA,
+                          opB,
+                          alpha,
+                          hipsparse::layer_spmat(matA),
+                          matB,
+                          matC,
+                          computeType,
+                          alg,
+                          spsmDescr,
+                          externalBuffer);
+
     if(spsmDescr == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -15668,6 +20222,8 @@ hipsparseStatus_t hipsparseSgtsv2StridedBatch_bufferSizeExt(hipsparseHandle_t ha
                                                             int               batchStride,
                                                             size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, m, dl, d, du, x, batchCount, batchStride, pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
@@ -15695,6 +20251,8 @@ hipsparseStatus_t hipsparseDgtsv2StridedBatch_bufferSizeExt(hipsparseHandle_t ha
                                                             int               batchStride,
                                                             size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, m, dl, d, du, x, batchCount, batchStride, pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
@@ -15722,6 +20280,8 @@ hipsparseStatus_t hipsparseCgtsv2StridedBatch_bufferSizeExt(hipsparseHandle_t ha
                                                             int               batchStride,
                                                             size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, m, dl, d, du, x, batchCount, batchStride, pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
@@ -15749,6 +20309,8 @@ hipsparseStatus_t hipsparseZgtsv2StridedBatch_bufferSizeExt(hipsparseHandle_t
                                                             int                     batchStride,
                                                             size_t* pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, m, dl, d, du, x, batchCount, batchStride, pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
@@ -15777,6 +20339,8 @@ hipsparseStatus_t hipsparseSgtsv2StridedBatch(hipsparseHandle_t handle,
                                               void*             pBuffer)
 
 {
+    HIPSPARSE_LAYER_SCOPE(handle, m, dl, d, du, x, batchCount, batchStride, pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_sgtsv_no_pivot_strided_batch(
         (rocsparse_handle)handle, m, dl, d, du, x, batchCount, batchStride, pBuffer));
 }
@@ -15792,6 +20356,8 @@ hipsparseStatus_t hipsparseDgtsv2StridedBatch(hipsparseHandle_t handle,
                                               void*             pBuffer)
 
 {
+    HIPSPARSE_LAYER_SCOPE(handle, m, dl, d, du, x, batchCount, batchStride, pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_dgtsv_no_pivot_strided_batch(
         (rocsparse_handle)handle, m, dl, d, du, x, batchCount, batchStride, pBuffer));
 }
@@ -15806,6 +20372,8 @@ hipsparseStatus_t hipsparseCgtsv2StridedBatch(hipsparseHandle_t handle,
                                               int               batchStride,
                                               void*             pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, m, dl, d, du, x, batchCount, batchStride, pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_cgtsv_no_pivot_strided_batch((rocsparse_handle)handle,
                                                m,
@@ -15829,6 +20397,8 @@ hipsparseStatus_t hipsparseZgtsv2StridedBatch(hipsparseHandle_t       handle,
                                               void*                   pBuffer)
 
 {
+    HIPSPARSE_LAYER_SCOPE(handle, m, dl, d, du, x, batchCount, batchStride, pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zgtsv_no_pivot_strided_batch((rocsparse_handle)handle,
                                                m,
@@ -15851,6 +20421,8 @@ hipsparseStatus_t hipsparseSgtsv2_bufferSizeExt(hipsparseHandle_t handle,
                                                 int               ldb,
                                                 size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, m, n, dl, d, du, B, ldb, pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
@@ -15870,6 +20442,8 @@ hipsparseStatus_t hipsparseDgtsv2_bufferSizeExt(hipsparseHandle_t handle,
                                                 int               ldb,
                                                 size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, m, n, dl, d, du, B, ldb, pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
@@ -15889,6 +20463,8 @@ hipsparseStatus_t hipsparseCgtsv2_bufferSizeExt(hipsparseHandle_t handle,
                                                 int               ldb,
                                                 size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, m, n, dl, d, du, B, ldb, pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
@@ -15916,6 +20492,8 @@ hipsparseStatus_t hipsparseZgtsv2_bufferSizeExt(hipsparseHandle_t       handle,
                                                 int                     ldb,
                                                 size_t*                 pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, m, n, dl, d, du, B, ldb, pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
@@ -15944,6 +20522,8 @@ hipsparseStatus_t hipsparseSgtsv2(hipsparseHandle_t handle,
                                   void*             pBuffer)
 
 {
+    HIPSPARSE_LAYER_SCOPE(handle, m, n, dl, d, du, B, ldb, pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sgtsv((rocsparse_handle)handle, m, n, dl, d, du, B, ldb, pBuffer));
 }
@@ -15959,6 +20539,8 @@ hipsparseStatus_t hipsparseDgtsv2(hipsparseHandle_t handle,
                                   void*             pBuffer)
 
 {
+    HIPSPARSE_LAYER_SCOPE(handle, m, n, dl, d, du, B, ldb, pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dgtsv((rocsparse_handle)handle, m, n, dl, d, du, B, ldb, pBuffer));
 }
@@ -15973,6 +20555,8 @@ hipsparseStatus_t hipsparseCgtsv2(hipsparseHandle_t handle,
                                   int               ldb,
                                   void*             pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, m, n, dl, d, du, B, ldb, pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_cgtsv((rocsparse_handle)handle,
                                                                  m,
                                                                  n,
@@ -15995,6 +20579,8 @@ hipsparseStatus_t hipsparseZgtsv2(hipsparseHandle_t       handle,
                                   void*                   pBuffer)
 
 {
+    HIPSPARSE_LAYER_SCOPE(handle, m, n, dl, d, du, B, ldb, pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zgtsv((rocsparse_handle)handle,
                         m,
@@ -16017,6 +20603,8 @@ hipsparseStatus_t hipsparseSgtsv2_nopivot_bufferSizeExt(hipsparseHandle_t handle
                                                         int               ldb,
                                                         size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, m, n, dl, d, du, B, ldb, pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
@@ -16036,6 +20624,8 @@ hipsparseStatus_t hipsparseDgtsv2_nopivot_bufferSizeExt(hipsparseHandle_t handle
                                                         int               ldb,
                                                         size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, m, n, dl, d, du, B, ldb, pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
@@ -16055,6 +20645,8 @@ hipsparseStatus_t hipsparseCgtsv2_nopivot_bufferSizeExt(hipsparseHandle_t handle
                                                         int               ldb,
                                                         size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, m, n, dl, d, du, B, ldb, pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
@@ -16082,6 +20674,8 @@ hipsparseStatus_t hipsparseZgtsv2_nopivot_bufferSizeExt(hipsparseHandle_t
                                                         int                     ldb,
                                                         size_t*                 pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, m, n, dl, d, du, B, ldb, pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
@@ -16110,6 +20704,8 @@ hipsparseStatus_t hipsparseSgtsv2_nopivot(hipsparseHandle_t handle,
                                           void*             pBuffer)
 
 {
+    HIPSPARSE_LAYER_SCOPE(handle, m, n, dl, d, du, B, ldb, pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sgtsv_no_pivot((rocsparse_handle)handle, m, n, dl, d, du, B, ldb, pBuffer));
 }
@@ -16125,6 +20721,8 @@ hipsparseStatus_t hipsparseDgtsv2_nopivot(hipsparseHandle_t handle,
                                           void*             pBuffer)
 
 {
+    HIPSPARSE_LAYER_SCOPE(handle, m, n, dl, d, du, B, ldb, pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dgtsv_no_pivot((rocsparse_handle)handle, m, n, dl, d, du, B, ldb, pBuffer));
 }
@@ -16140,6 +20738,8 @@ hipsparseStatus_t hipsparseCgtsv2_nopivot(hipsparseHandle_t handle,
                                           void*             pBuffer)
 
 {
+    HIPSPARSE_LAYER_SCOPE(handle, m, n, dl, d, du, B, ldb, pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_cgtsv_no_pivot((rocsparse_handle)handle,
                                  m,
@@ -16163,6 +20763,8 @@ hipsparseStatus_t hipsparseZgtsv2_nopivot(hipsparseHandle_t       handle,
                                           void*                   pBuffer)
 
 {
+    HIPSPARSE_LAYER_SCOPE(handle, m, n, dl, d, du, B, ldb, pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zgtsv_no_pivot((rocsparse_handle)handle,
                                  m,
@@ -16185,6 +20787,8 @@ hipsparseStatus_t hipsparseSgtsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t
                                                                int               batchCount,
                                                                size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, algo, m, dl, d, du, x, batchCount, pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
@@ -16213,6 +20817,8 @@ hipsparseStatus_t hipsparseDgtsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t
                                                                int               batchCount,
                                                                size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, algo, m, dl, d, du, x, batchCount, pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
@@ -16241,6 +20847,8 @@ hipsparseStatus_t hipsparseCgtsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t
                                                                int               batchCount,
                                                                size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, algo, m, dl, d, du, x, batchCount, pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
@@ -16269,6 +20877,8 @@ hipsparseStatus_t hipsparseZgtsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t
                                                                int                     batchCount,
                                                                size_t* pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, algo, m, dl, d, du, x, batchCount, pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
@@ -16298,6 +20908,8 @@ hipsparseStatus_t hipsparseSgtsvInterleavedBatch(hipsparseHandle_t handle,
                                                  void*             pBuffer)
 
 {
+    HIPSPARSE_LAYER_SCOPE(handle, algo, m, dl, d, du, x, batchCount, pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sgtsv_interleaved_batch((rocsparse_handle)handle,
                                           (rocsparse_gtsv_interleaved_alg)algo,
@@ -16322,6 +20934,8 @@ hipsparseStatus_t hipsparseDgtsvInterleavedBatch(hipsparseHandle_t handle,
                                                  void*             pBuffer)
 
 {
+    HIPSPARSE_LAYER_SCOPE(handle, algo, m, dl, d, du, x, batchCount, pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dgtsv_interleaved_batch((rocsparse_handle)handle,
                                           (rocsparse_gtsv_interleaved_alg)algo,
@@ -16345,6 +20959,8 @@ hipsparseStatus_t hipsparseCgtsvInterleavedBatch(hipsparseHandle_t handle,
                                                  int               batchCount,
                                                  void*             pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, algo, m, dl, d, du, x, batchCount, pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_cgtsv_interleaved_batch((rocsparse_handle)handle,
                                           (rocsparse_gtsv_interleaved_alg)algo,
@@ -16369,6 +20985,8 @@ hipsparseStatus_t hipsparseZgtsvInterleavedBatch(hipsparseHandle_t handle,
                                                  void*             pBuffer)
 
 {
+    HIPSPARSE_LAYER_SCOPE(handle, algo, m, dl, d, du, x, batchCount, pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zgtsv_interleaved_batch((rocsparse_handle)handle,
                                           (rocsparse_gtsv_interleaved_alg)algo,
@@ -16394,6 +21012,8 @@ hipsparseStatus_t hipsparseSgpsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t
                                                                int               batchCount,
                                                                size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, algo, m, ds, dl, d, du, dw, x, batchCount, pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
@@ -16426,6 +21046,8 @@ hipsparseStatus_t hipsparseDgpsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t
                                                                int               batchCount,
                                                                size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, algo, m, ds, dl, d, du, dw, x, batchCount, pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
@@ -16458,6 +21080,8 @@ hipsparseStatus_t hipsparseCgpsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t
                                                                int               batchCount,
                                                                size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, algo, m, ds, dl, d, du, dw, x, batchCount, pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
@@ -16490,6 +21114,8 @@ hipsparseStatus_t hipsparseZgpsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t
                                                                int                     batchCount,
                                                                size_t* pBufferSizeInBytes)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, algo, m, ds, dl, d, du, dw, x, batchCount, pBufferSizeInBytes);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
@@ -16522,6 +21148,8 @@ hipsparseStatus_t hipsparseSgpsvInterleavedBatch(hipsparseHandle_t handle,
                                                  int               batchCount,
                                                  void*             pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, algo, m, ds, dl, d, du, dw, x, batchCount, pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sgpsv_interleaved_batch((rocsparse_handle)handle,
                                           (rocsparse_gpsv_interleaved_alg)algo,
@@ -16549,6 +21177,8 @@ hipsparseStatus_t hipsparseDgpsvInterleavedBatch(hipsparseHandle_t handle,
                                                  int               batchCount,
                                                  void*             pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, algo, m, ds, dl, d, du, dw, x, batchCount, pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dgpsv_interleaved_batch((rocsparse_handle)handle,
                                           (rocsparse_gpsv_interleaved_alg)algo,
@@ -16576,6 +21206,8 @@ hipsparseStatus_t hipsparseCgpsvInterleavedBatch(hipsparseHandle_t handle,
                                                  int               batchCount,
                                                  void*             pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, algo, m, ds, dl, d, du, dw, x, batchCount, pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_cgpsv_interleaved_batch((rocsparse_handle)handle,
                                           (rocsparse_gpsv_interleaved_alg)algo,
@@ -16603,6 +21235,8 @@ hipsparseStatus_t hipsparseZgpsvInterleavedBatch(hipsparseHandle_t handle,
                                                  int               batchCount,
                                                  void*             pBuffer)
 {
+    HIPSPARSE_LAYER_SCOPE(handle, algo, m, ds, dl, d, du, dw, x, batchCount, pBuffer);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zgpsv_interleaved_batch((rocsparse_handle)handle,
                                           (rocsparse_gpsv_interleaved_alg)algo,
@@ -16631,6 +21265,19 @@ hipsparseStatus_t hipsparseScsrcolor(hipsparseHandle_t         handle,
                                      int*                      reordering,
                                      hipsparseColorInfo_t      info)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          nnz,
+                          descrA,
+                          csrValA,
+                          csrRowPtrA,
+                          csrColIndA,
+                          fractionToColor,
+                          ncolors,
+                          coloring,
+                          reordering,
+                          info);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_scsrcolor((rocsparse_handle)handle,
                             m,
@@ -16659,6 +21306,19 @@ hipsparseStatus_t hipsparseDcsrcolor(hipsparseHandle_t         handle,
                                      int*                      reordering,
                                      hipsparseColorInfo_t      info)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          nnz,
+                          descrA,
+                          csrValA,
+                          csrRowPtrA,
+                          csrColIndA,
+                          fractionToColor,
+                          ncolors,
+                          coloring,
+                          reordering,
+                          info);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dcsrcolor((rocsparse_handle)handle,
                             m,
@@ -16687,6 +21347,19 @@ hipsparseStatus_t hipsparseCcsrcolor(hipsparseHandle_t         handle,
                                      int*                      reordering,
                                      hipsparseColorInfo_t      info)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          nnz,
+                          descrA,
+                          csrValA,
+                          csrRowPtrA,
+                          csrColIndA,
+                          fractionToColor,
+                          ncolors,
+                          coloring,
+                          reordering,
+                          info);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_ccsrcolor((rocsparse_handle)handle,
                             m,
@@ -16715,6 +21388,19 @@ hipsparseStatus_t hipsparseZcsrcolor(hipsparseHandle_t         handle,
                                      int*                      reordering,
                                      hipsparseColorInfo_t      info)
 {
+    HIPSPARSE_LAYER_SCOPE(handle,
+                          m,
+                          nnz,
+                          descrA,
+                          csrValA,
+                          csrRowPtrA,
+                          csrColIndA,
+                          fractionToColor,
+                          ncolors,
+                          coloring,
+                          reordering,
+                          info);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrcolor((rocsparse_handle)handle,
                             m,
@@ -16729,3 +21415,15 @@ hipsparseStatus_t hipsparseZcsrcolor(hipsparseHandle_t         handle,
                             reordering,
                             (rocsparse_mat_info)info));
 }
+
+namespace hipsparse
+{
+    // One id was taken by each HIPSPARSE_LAYER_SCOPE above
+    extern const int layer_routine_count = __COUNTER__;
+
+    std::atomic<const char*>* layerRoutineNames()
+    {
+        static std::atomic<const char*> names[layer_routine_count];
+        return names;
+    }
+}
@@ -0,0 +1,756 @@
+/* ************************************************************************
+* Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*
+* ************************************************************************ */
+
+#pragma once
+#ifndef HIPSPARSE_LAYER_HPP
+#define HIPSPARSE_LAYER_HPP
+
+#include "hipsparse.h"
+
+#include <hip/hip_complex.h>
+#include <hip/hip_runtime_api.h>
+#include <rocsparse/rocsparse.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/* ==================================================================================== */
+/*! \brief  Logging layer of the hipSPARSE wrappers, controlled by HIPSPARSE_LAYER.
+ *
+ *  HIPSPARSE_LAYER is a bit mask:
+ *  - 1 logs every call with its arguments and the pointer mode (HIPSPARSE_LOG_TRACE_PATH)
+ *  - 2 logs a rocsparse-bench command line per call (HIPSPARSE_LOG_BENCH_PATH)
+ *  - 4 logs the host and stream ordered duration of every call as CSV
+ *    (HIPSPARSE_LOG_TIMING_PATH)
+ *
+ *  Logs go to stderr if the corresponding path is not set. Only calls made by the
+ *  application are logged, calls that wrappers make to other wrappers are not. Log lines
+ *  are buffered in memory and written when the buffer is full, when a handle is destroyed
+ *  and at exit. When HIPSPARSE_LAYER is unset, a call only updates the performance
+ *  counters of its handle.
+ */
+#define HIPSPARSE_LAYER_SCOPE(...)                                                 \
+    static const int hipsparse_layer_routine                                      \
+        = hipsparse::layerRoutine(__COUNTER__, __func__);                         \
+    hipsparse::layer_scope hipsparse_layer_scope(                                 \
+        hipsparse_layer_routine, __func__, #__VA_ARGS__, __VA_ARGS__)
+
+namespace hipsparse
+{
+    enum layer_mode
+    {
+        layer_mode_none       = 0,
+        layer_mode_log_trace  = 1,
+        layer_mode_log_bench  = 2,
+        layer_mode_log_timing = 4
+    };
+
+    // Read once, a single copy is shared by all translation units
+    inline int layerMode()
+    {
+        static const int mode
+            = (getenv("HIPSPARSE_LAYER") != nullptr) ? atoi(getenv("HIPSPARSE_LAYER")) : 0;
+
+        return mode;
+    }
+
+    // Every HIPSPARSE_LAYER_SCOPE takes its id from __COUNTER__, such that the ids are
+    // dense and all wrappers, which live in a single translation unit, are counted. The
+    // number of ids is defined after the last wrapper.
+    extern const int layer_routine_count;
+
+    // Wrapper names, indexed by id and set on the first call of each wrapper
+    std::atomic<const char*>* layerRoutineNames();
+
+    inline int layerRoutine(int id, const char* name)
+    {
+        layerRoutineNames()[id].store(name, std::memory_order_release);
+        return id;
+    }
+
+    /* ================================================================================ */
+    /*! \brief  Performance counters of a handle. Updated with relaxed atomics, such that
+     *  threads sharing the library never wait on each other. Calls and time are only kept
+     *  per routine, their totals are summed up when the counters are read.
+     */
+    struct layer_counters
+    {
+        layer_counters()
+            : routine_calls(new std::atomic<uint64_t>[layer_routine_count])
+            , routine_time_ns(new std::atomic<uint64_t>[layer_routine_count])
+        {
+            this->reset();
+        }
+
+        void reset()
+        {
+            this->workspace_bytes.store(0, std::memory_order_relaxed);
+            this->workspace_allocations.store(0, std::memory_order_relaxed);
+            this->synchronizations.store(0, std::memory_order_relaxed);
+
+            for(int i = 0; i < layer_routine_count; ++i)
+            {
+                this->routine_calls[i].store(0, std::memory_order_relaxed);
+                this->routine_time_ns[i].store(0, std::memory_order_relaxed);
+            }
+        }
+
+        void allocation(size_t bytes)
+        {
+            this->workspace_bytes.fetch_add(bytes, std::memory_order_relaxed);
+            this->workspace_allocations.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        void synchronization()
+        {
+            this->synchronizations.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        std::atomic<uint64_t>                    workspace_bytes;
+        std::atomic<uint64_t>                    workspace_allocations;
+        std::atomic<uint64_t>                    synchronizations;
+        std::unique_ptr<std::atomic<uint64_t>[]> routine_calls;
+        std::unique_ptr<std::atomic<uint64_t>[]> routine_time_ns;
+    };
+
+    // Counters of a handle, defined together with the handle state
+    layer_counters* layerCounters(hipsparseHandle_t handle);
+
+    // Sparse matrix descriptors are opaque pointers; wrapping them logs their sizes
+    struct layer_spmat
+    {
+        explicit layer_spmat(hipsparseConstSpMatDescr_t descr)
+            : descr(descr)
+        {
+        }
+
+        hipsparseConstSpMatDescr_t descr;
+    };
+
+    /* ================================================================================ */
+    /*! \brief  Argument formatting. Enums are logged by value, opaque objects by address. */
+    template <typename T>
+    inline typename std::enable_if<std::is_arithmetic<T>::value>::type
+        layerFormat(std::ostream& os, T value)
+    {
+        os << value;
+    }
+
+    template <typename T>
+    inline typename std::enable_if<std::is_enum<T>::value>::type layerFormat(std::ostream& os,
+                                                                             T             value)
+    {
+        os << static_cast<int64_t>(value);
+    }
+
+    template <typename T>
+    inline void layerFormat(std::ostream& os, const T* ptr)
+    {
+        os << static_cast<const void*>(ptr);
+    }
+
+    inline void layerFormat(std::ostream& os, hipFloatComplex value)
+    {
+        os << hipCrealf(value) << (hipCimagf(value) < 0 ? "" : "+") << hipCimagf(value) << 'i';
+    }
+
+    inline void layerFormat(std::ostream& os, hipDoubleComplex value)
+    {
+        os << hipCreal(value) << (hipCimag(value) < 0 ? "" : "+") << hipCimag(value) << 'i';
+    }
+
+    inline void layerFormat(std::ostream& os, layer_spmat mat)
+    {
+        os << mat.descr;
+
+        int64_t rows, cols, nnz;
+        if(mat.descr != nullptr
+           && rocsparse_spmat_get_size((rocsparse_const_spmat_descr)mat.descr, &rows, &cols, &nnz)
+                  == rocsparse_status_success)
+        {
+            os << '(' << rows << 'x' << cols << ":nnz=" << nnz << ')';
+        }
+    }
+
+    // Calls per stream whose device durations are waited for before more are queued
+    static const size_t layer_max_pending = 4096;
+
+    // Bytes of log lines collected per file before they are written
+    static const size_t layer_buffer_size = 1 << 16;
+
+    /* ================================================================================ */
+    /*! \brief  Log file whose lines are collected in memory and written in blocks. */
+    class layer_file
+    {
+    public:
+        void open(bool enabled, const char* env)
+        {
+            if(!enabled)
+            {
+                return;
+            }
+
+            const char* path = getenv(env);
+            this->file       = (path != nullptr) ? fopen(path, "w") : nullptr;
+            this->file       = (this->file != nullptr) ? this->file : stderr;
+
+            this->buffer.reserve(layer_buffer_size);
+        }
+
+        void close()
+        {
+            this->flush();
+
+            if(this->file != nullptr && this->file != stderr)
+            {
+                fclose(this->file);
+            }
+
+            this->file = nullptr;
+        }
+
+        void line(const std::string& text)
+        {
+            this->buffer.append(text);
+            this->buffer.push_back('\n');
+
+            if(this->buffer.size() >= layer_buffer_size)
+            {
+                this->flush();
+            }
+        }
+
+        __attribute__((format(printf, 2, 3))) void print(const char* format, ...)
+        {
+            char text[512];
+
+            va_list args;
+            va_start(args, format);
+            int size = vsnprintf(text, sizeof(text), format, args);
+            va_end(args);
+
+            if(size > 0)
+            {
+                this->buffer.append(text, std::min(static_cast<size_t>(size), sizeof(text) - 1));
+            }
+
+            if(this->buffer.size() >= layer_buffer_size)
+            {
+                this->flush();
+            }
+        }
+
+        void flush()
+        {
+            if(this->file != nullptr && !this->buffer.empty())
+            {
+                fwrite(this->buffer.data(), 1, this->buffer.size(), this->file);
+                fflush(this->file);
+            }
+
+            this->buffer.clear();
+        }
+
+    private:
+        FILE*       file = nullptr;
+        std::string buffer;
+    };
+
+    /* ================================================================================ */
+    /*! \brief  Log files and the queues of calls whose device duration is not known yet. */
+    class layer_log
+    {
+    public:
+        static layer_log& instance()
+        {
+            static layer_log log;
+            return log;
+        }
+
+        void write(int mode, const std::string& line)
+        {
+            std::lock_guard<std::mutex> lock(this->mutex);
+
+            layer_file& file = (mode == layer_mode_log_trace) ? this->trace_file : this->bench_file;
+            file.line(line);
+        }
+
+        // Record the start of a call on the stream. Returns false if no event could be
+        // recorded, e.g. while the stream is being captured.
+        bool start(hipStream_t stream, hipEvent_t& start, hipEvent_t& stop)
+        {
+            {
+                std::lock_guard<std::mutex> lock(this->mutex);
+
+                while(this->events.size() < 2)
+                {
+                    hipEvent_t event;
+                    if(hipEventCreate(&event) != hipSuccess)
+                    {
+                        return false;
+                    }
+
+                    this->events.push_back(event);
+                }
+
+                start = this->events.back();
+                this->events.pop_back();
+                stop = this->events.back();
+                this->events.pop_back();
+            }
+
+            if(hipEventRecord(start, stream) != hipSuccess)
+            {
+                this->recycle(start, stop);
+                return false;
+            }
+
+            return true;
+        }
+
+        // Record the end of a call. Its device duration is written once the stop event
+        // has completed, which is checked on later calls and in flush().
+        void stop(const char*       name,
+                  double            host_us,
+                  bool              timed,
+                  hipsparseHandle_t handle,
+                  hipStream_t       stream,
+                  hipEvent_t        start,
+                  hipEvent_t        stop)
+        {
+            if(timed && hipEventRecord(stop, stream) != hipSuccess)
+            {
+                this->recycle(start, stop);
+                timed = false;
+            }
+
+            std::lock_guard<std::mutex> lock(this->mutex);
+
+            if(timed)
+            {
+                std::deque<timed_call>& queue = this->pending[{handle, stream}];
+                queue.push_back({name, host_us, start, stop});
+
+                // Bound the queue of a stream that runs far behind the host
+                if(queue.size() > layer_max_pending)
+                {
+                    this->poll(queue, 1);
+                }
+            }
+            else
+            {
+                this->timing_file.print("%s,%.3f,\n", name, host_us);
+            }
+
+            this->poll();
+        }
+
+        // Write the device durations of all pending calls made with the handle, then write
+        // out the buffered lines of all logs
+        void flush(hipsparseHandle_t handle)
+        {
+            std::lock_guard<std::mutex> lock(this->mutex);
+
+            auto it = this->pending.lower_bound({handle, nullptr});
+            while(it != this->pending.end() && it->first.first == handle)
+            {
+                this->poll(it->second, it->second.size());
+                it = this->pending.erase(it);
+            }
+
+            this->trace_file.flush();
+            this->bench_file.flush();
+            this->timing_file.flush();
+        }
+
+    private:
+        struct timed_call
+        {
+            const char* name;
+            double      host_us;
+            hipEvent_t  start;
+            hipEvent_t  stop;
+        };
+
+        layer_log()
+        {
+            int mode = layerMode();
+
+            this->trace_file.open(mode & layer_mode_log_trace, "HIPSPARSE_LOG_TRACE_PATH");
+            this->bench_file.open(mode & layer_mode_log_bench, "HIPSPARSE_LOG_BENCH_PATH");
+            this->timing_file.open(mode & layer_mode_log_timing, "HIPSPARSE_LOG_TIMING_PATH");
+
+            if(mode & layer_mode_log_timing)
+            {
+                this->timing_file.line("function,host_us,device_us");
+            }
+        }
+
+        // Calls still in flight at exit are not written and events are not destroyed, the
+        // HIP runtime may already be torn down
+        ~layer_log()
+        {
+            this->trace_file.close();
+            this->bench_file.close();
+            this->timing_file.close();
+        }
+
+        void recycle(hipEvent_t start, hipEvent_t stop)
+        {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            this->events.push_back(start);
+            this->events.push_back(stop);
+        }
+
+        // Calls complete in order on their stream, so each stream has a queue of its own
+        // and a call that has not finished yet only holds back the calls behind it on the
+        // same stream
+        void poll()
+        {
+            for(auto it = this->pending.begin(); it != this->pending.end();)
+            {
+                this->poll(it->second, 0);
+                it = it->second.empty() ? this->pending.erase(it) : std::next(it);
+            }
+        }
+
+        // Write the finished calls at the front of the queue, waiting for the first wait
+        // calls to finish
+        void poll(std::deque<timed_call>& queue, size_t wait)
+        {
+            while(!queue.empty())
+            {
+                timed_call& call = queue.front();
+
+                if(wait > 0)
+                {
+                    hipEventSynchronize(call.stop);
+                    --wait;
+                }
+                else if(hipEventQuery(call.stop) != hipSuccess)
+                {
+                    break;
+                }
+
+                float device_ms = 0.0f;
+                if(hipEventElapsedTime(&device_ms, call.start, call.stop) == hipSuccess)
+                {
+                    this->timing_file.print(
+                        "%s,%.3f,%.3f\n", call.name, call.host_us, device_ms * 1e3);
+                }
+                else
+                {
+                    this->timing_file.print("%s,%.3f,\n", call.name, call.host_us);
+                }
+
+                this->events.push_back(call.start);
+                this->events.push_back(call.stop);
+                queue.pop_front();
+            }
+        }
+
+        std::mutex              mutex;
+        layer_file              trace_file;
+        layer_file              bench_file;
+        layer_file              timing_file;
+        std::vector<hipEvent_t> events;
+
+        std::map<std::pair<hipsparseHandle_t, hipStream_t>, std::deque<timed_call>> pending;
+    };
+
+    /* ================================================================================ */
+    /*! \brief  Logs the wrapper it is declared in, from construction to destruction. */
+    class layer_scope
+    {
+    public:
+        template <typename... Ts>
+        layer_scope(int               routine,
+                    const char*       name,
+                    const char*       names,
+                    hipsparseHandle_t handle,
+                    const Ts&... args)
+        {
+            // Only calls made by the application are counted and logged
+            if(depth()++ > 0)
+            {
+                return;
+            }
+
+            this->outermost = true;
+            this->routine   = routine;
+            this->counters  = (handle != nullptr) ? layerCounters(handle) : nullptr;
+
+            if(layerMode() != layer_mode_none)
+            {
+                this->enter(name, names, handle, args...);
+            }
+
+            // Taken after begin(), such that formatting the log lines is not timed
+            this->host_start = std::chrono::steady_clock::now();
+        }
+
+        ~layer_scope()
+        {
+            --depth();
+
+            if(this->outermost)
+            {
+                this->leave();
+            }
+        }
+
+        layer_scope(const layer_scope&) = delete;
+        layer_scope& operator=(const layer_scope&) = delete;
+
+    private:
+        static int& depth()
+        {
+            static thread_local int depth = 0;
+            return depth;
+        }
+
+        // Kept out of line, such that a disabled layer only adds a test to the wrappers
+        template <typename... Ts>
+        __attribute__((noinline)) void
+            enter(const char* name, const char* names, hipsparseHandle_t handle, const Ts&... args)
+        {
+            this->logged = true;
+            this->name   = name;
+            this->handle = handle;
+
+            std::vector<std::pair<std::string, std::string>> values;
+            values.reserve(sizeof...(Ts));
+
+            std::string list(names);
+            size_t      pos = list.find(',');
+
+            int expand[] = {0, (this->append(values, list, pos, args), 0)...};
+            (void)expand;
+            (void)pos;
+
+            this->begin(values);
+        }
+
+        void leave()
+        {
+            uint64_t host_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                   std::chrono::steady_clock::now() - this->host_start)
+                                   .count();
+
+            if(this->counters != nullptr)
+            {
+                this->counters->routine_calls[this->routine].fetch_add(
+                    1, std::memory_order_relaxed);
+                this->counters->routine_time_ns[this->routine].fetch_add(
+                    host_ns, std::memory_order_relaxed);
+            }
+
+            if(this->logged)
+            {
+                this->end(host_ns);
+            }
+        }
+
+        // Pair the next name of the stringified argument list with the argument value.
+        // Wrapped arguments such as hipsparse::layer_spmat(matA) are logged as matA.
+        template <typename T>
+        static void append(std::vector<std::pair<std::string, std::string>>& values,
+                           const std::string&                                 list,
+                           size_t&                                            pos,
+                           const T&                                           arg)
+        {
+            size_t begin = list.find_first_not_of(' ', pos + 1);
+            pos          = list.find(',', begin);
+
+            std::string key = list.substr(begin, pos - begin);
+
+            size_t open = key.rfind('(');
+            if(open != std::string::npos)
+            {
+                key = key.substr(open + 1, key.find(')', open) - open - 1);
+            }
+
+            std::ostringstream os;
+            layerFormat(os, arg);
+            values.emplace_back(key, os.str());
+        }
+
+        static std::string value(const std::vector<std::pair<std::string, std::string>>& values,
+                                 const char*                                             key)
+        {
+            for(const auto& v : values)
+            {
+                if(v.first == key)
+                {
+                    return v.second;
+                }
+            }
+
+            return std::string();
+        }
+
+        void begin(const std::vector<std::pair<std::string, std::string>>& values)
+        {
+            int mode = layerMode();
+
+            if(mode & layer_mode_log_trace)
+            {
+                rocsparse_pointer_mode pointer_mode = rocsparse_pointer_mode_host;
+                rocsparse_get_pointer_mode((rocsparse_handle)this->handle, &pointer_mode);
+
+                std::ostringstream os;
+                os << this->name << ",handle=" << this->handle;
+
+                for(const auto& v : values)
+                {
+                    os << ',' << v.first << '=' << v.second;
+                }
+
+                os << ",pointer_mode="
+                   << (pointer_mode == rocsparse_pointer_mode_host ? "host" : "device");
+
+                layer_log::instance().write(layer_mode_log_trace, os.str());
+            }
+
+            if(mode & layer_mode_log_bench)
+            {
+                layer_log::instance().write(layer_mode_log_bench, this->bench(values));
+            }
+
+            this->timed = false;
+
+            if(mode & layer_mode_log_timing)
+            {
+                this->timed
+                    = rocsparse_get_stream((rocsparse_handle)this->handle, &this->stream)
+                          == rocsparse_status_success
+                      && layer_log::instance().start(this->stream, this->start, this->stop);
+            }
+        }
+
+        __attribute__((noinline)) void end(uint64_t host_ns)
+        {
+            if(layerMode() & layer_mode_log_timing)
+            {
+                layer_log::instance().stop(this->name,
+                                           host_ns * 1e-3,
+                                           this->timed,
+                                           this->handle,
+                                           this->stream,
+                                           this->start,
+                                           this->stop);
+            }
+        }
+
+        // rocsparse-bench command line with the sizes and operations of the call. The
+        // matrix itself is not captured, the bench generates one of the same size.
+        std::string bench(const std::vector<std::pair<std::string, std::string>>& values) const
+        {
+            std::string routine(this->name + 9);
+            std::string precision;
+
+            // Legacy routines carry a precision prefix, generic ones such as SpMV or
+            // Scatter do not
+            bool generic = routine.compare(0, 2, "Sp") == 0 || routine == "Scatter";
+
+            if(!generic && routine.size() > 1
+               && std::string("SDCZX").find(routine[0]) != std::string::npos
+               && islower(routine[1]))
+            {
+                if(routine[0] != 'X')
+                {
+                    precision = std::string(1, tolower(routine[0]));
+                }
+
+                routine = routine.substr(1);
+            }
+
+            for(char& c : routine)
+            {
+                c = tolower(c);
+            }
+
+            std::ostringstream os;
+            os << "rocsparse-bench -f " << routine;
+
+            if(!precision.empty())
+            {
+                os << " -r " << precision;
+            }
+
+            static const std::pair<const char*, const char*> sizes[]
+                = {{"m", "-m"}, {"n", "-n"}, {"k", "-k"}, {"blockDim", "--blockdim"}};
+
+            for(const auto& size : sizes)
+            {
+                std::string v = value(values, size.first);
+                if(!v.empty())
+                {
+                    os << ' ' << size.second << ' ' << v;
+                }
+            }
+
+            static const std::pair<const char*, const char*> trans[]
+                = {{"transA", "--transposeA"}, {"transB", "--transposeB"}};
+
+            for(const auto& op : trans)
+            {
+                std::string v = value(values, op.first);
+                if(!v.empty())
+                {
+                    os << ' ' << op.second << ' ' << "NTC"[atoi(v.c_str()) % 3];
+                }
+            }
+
+            return os.str();
+        }
+
+        bool              outermost = false;
+        bool              logged    = false;
+        int               routine;
+        layer_counters*   counters;
+        const char*       name;
+        hipsparseHandle_t handle;
+        bool              timed;
+        hipStream_t       stream;
+        hipEvent_t        start;
+        hipEvent_t        stop;
+
+        std::chrono::steady_clock::time_point host_start;
+    };
+}
+
+#endif // HIPSPARSE_LAYER_HPP
@@ -104,6 +104,80 @@ module hipsparse
             integer(c_int) :: mode
         end function hipsparseGetPointerMode
 
+!       hipsparseSyncMode_t
+        function hipsparseSetSyncMode(handle, mode) &
+                bind(c, name = 'hipsparseSetSyncMode')
+            use hipsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(HIPSPARSE_STATUS_SUCCESS)) :: hipsparseSetSyncMode
+            type(c_ptr), value :: handle
+            integer(c_int), value :: mode
+        end function hipsparseSetSyncMode
+
+        function hipsparseGetSyncMode(handle, mode) &
+                bind(c, name = 'hipsparseGetSyncMode')
+            use hipsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(HIPSPARSE_STATUS_SUCCESS)) :: hipsparseGetSyncMode
+            type(c_ptr), value :: handle
+            integer(c_int) :: mode
+        end function hipsparseGetSyncMode
+
+!       hipsparseWorkspace
+        function hipsparseReserveWorkspace(handle, sizeInBytes) &
+                bind(c, name = 'hipsparseReserveWorkspace')
+            use hipsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(HIPSPARSE_STATUS_SUCCESS)) :: hipsparseReserveWorkspace
+            type(c_ptr), value :: handle
+            integer(c_size_t), value :: sizeInBytes
+        end function hipsparseReserveWorkspace
+
+        function hipsparseGetWorkspaceSize(handle, sizeInBytes, highWaterMark) &
+                bind(c, name = 'hipsparseGetWorkspaceSize')
+            use hipsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(HIPSPARSE_STATUS_SUCCESS)) :: hipsparseGetWorkspaceSize
+            type(c_ptr), value :: handle
+            integer(c_size_t) :: sizeInBytes
+            integer(c_size_t) :: highWaterMark
+        end function hipsparseGetWorkspaceSize
+
+        function hipsparseReleaseWorkspace(handle) &
+                bind(c, name = 'hipsparseReleaseWorkspace')
+            use hipsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(HIPSPARSE_STATUS_SUCCESS)) :: hipsparseReleaseWorkspace
+            type(c_ptr), value :: handle
+        end function hipsparseReleaseWorkspace
+
+!       hipsparsePerfCounters
+        function hipsparseGetPerfCounters(handle, counters, routines, routineCount) &
+                bind(c, name = 'hipsparseGetPerfCounters')
+            use hipsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(HIPSPARSE_STATUS_SUCCESS)) :: hipsparseGetPerfCounters
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: counters
+            type(c_ptr), value :: routines
+            type(c_ptr), value :: routineCount
+        end function hipsparseGetPerfCounters
+
+        function hipsparseResetPerfCounters(handle) &
+                bind(c, name = 'hipsparseResetPerfCounters')
+            use hipsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(HIPSPARSE_STATUS_SUCCESS)) :: hipsparseResetPerfCounters
+            type(c_ptr), value :: handle
+        end function hipsparseResetPerfCounters
+
 !       hipsparseMatDescr_t
         function hipsparseCreateMatDescr(descr) &
                 bind(c, name = 'hipsparseCreateMatDescr')
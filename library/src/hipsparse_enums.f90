@@ -48,6 +48,12 @@ module hipsparse_enums
         enumerator :: HIPSPARSE_POINTER_MODE_DEVICE = 1
     end enum
 
+!   hipsparseSyncMode_t
+    enum, bind(c)
+        enumerator :: HIPSPARSE_SYNC_MODE_BLOCKING = 0
+        enumerator :: HIPSPARSE_SYNC_MODE_ASYNC = 1
+    end enum
+
 !   hipsparseAction_t
     enum, bind(c)
         enumerator :: HIPSPARSE_ACTION_SYMBOLIC = 0
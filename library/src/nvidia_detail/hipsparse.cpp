@@ -579,6 +579,123 @@ hipsparseStatus_t hipsparseGetPointerMode(hipsparseHandle_t handle, hipsparsePoi
     return hipsparse::hipCUSPARSEStatusToHIPStatus(status);
 }
 
+hipsparseStatus_t hipsparseSetSyncMode(hipsparseHandle_t handle, hipsparseSyncMode_t mode)
+{
+    // cuSPARSE routines keep their blocking semantics
+    if(handle == nullptr)
+    {
+        return HIPSPARSE_STATUS_NOT_INITIALIZED;
+    }
+
+    switch(mode)
+    {
+    case HIPSPARSE_SYNC_MODE_BLOCKING:
+        return HIPSPARSE_STATUS_SUCCESS;
+    case HIPSPARSE_SYNC_MODE_ASYNC:
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    default:
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+}
+
+hipsparseStatus_t hipsparseGetSyncMode(hipsparseHandle_t handle, hipsparseSyncMode_t* mode)
+{
+    if(handle == nullptr)
+    {
+        return HIPSPARSE_STATUS_NOT_INITIALIZED;
+    }
+
+    if(mode == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *mode = HIPSPARSE_SYNC_MODE_BLOCKING;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseReserveWorkspace(hipsparseHandle_t handle, size_t sizeInBytes)
+{
+    // cuSPARSE does not allocate temporary storage in the legacy routines
+    if(handle == nullptr)
+    {
+        return HIPSPARSE_STATUS_NOT_INITIALIZED;
+    }
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t
+    hipsparseGetWorkspaceSize(hipsparseHandle_t handle, size_t* sizeInBytes, size_t* highWaterMark)
+{
+    if(handle == nullptr)
+    {
+        return HIPSPARSE_STATUS_NOT_INITIALIZED;
+    }
+
+    if(sizeInBytes != nullptr)
+    {
+        *sizeInBytes = 0;
+    }
+
+    if(highWaterMark != nullptr)
+    {
+        *highWaterMark = 0;
+    }
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseReleaseWorkspace(hipsparseHandle_t handle)
+{
+    if(handle == nullptr)
+    {
+        return HIPSPARSE_STATUS_NOT_INITIALIZED;
+    }
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseGetPerfCounters(hipsparseHandle_t           handle,
+                                           hipsparsePerfCounters_t*    counters,
+                                           hipsparseRoutineCounters_t* routines,
+                                           int*                        routineCount)
+{
+    // Calls are not counted with the cuSPARSE backend
+    if(handle == nullptr)
+    {
+        return HIPSPARSE_STATUS_NOT_INITIALIZED;
+    }
+
+    if(routines != nullptr && routineCount == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(counters != nullptr)
+    {
+        *counters = {};
+    }
+
+    if(routineCount != nullptr)
+    {
+        *routineCount = 0;
+    }
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseResetPerfCounters(hipsparseHandle_t handle)
+{
+    if(handle == nullptr)
+    {
+        return HIPSPARSE_STATUS_NOT_INITIALIZED;
+    }
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
 hipsparseStatus_t hipsparseCreateMatDescr(hipsparseMatDescr_t* descrA)
 {
     return hipsparse::hipCUSPARSEStatusToHIPStatus(